@@ -26,6 +26,7 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Curve, Standard_Transient)
@@ -183,6 +184,60 @@ void Adaptor3d_Curve::D1(const Standard_Real , gp_Pnt& , gp_Vec& ) const
   throw Standard_NotImplemented("Adaptor3d_Curve::D1");
 }
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D0Batch (const TColStd_Array1OfReal& theU,
+                               TColStd_Array1OfReal& thePoints) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (thePoints.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Adaptor3d_Curve::D0Batch(), inconsistent lengths of arrays");
+  }
+  Standard_Real* aPoints = aNbPoints > 0 ? &thePoints.ChangeFirst() : NULL;
+  gp_Pnt aP;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    D0 (theU (theU.Lower() + i), aP);
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      aPoints[j * aNbPoints + i] = aP.Coord (j + 1);
+    }
+  }
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D1Batch (const TColStd_Array1OfReal& theU,
+                               TColStd_Array1OfReal& thePoints,
+                               TColStd_Array1OfReal& theD1) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (thePoints.Length() != 3 * aNbPoints || theD1.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Adaptor3d_Curve::D1Batch(), inconsistent lengths of arrays");
+  }
+  Standard_Real* aPoints = aNbPoints > 0 ? &thePoints.ChangeFirst() : NULL;
+  Standard_Real* aD1     = aNbPoints > 0 ? &theD1.ChangeFirst() : NULL;
+  gp_Pnt aP;
+  gp_Vec aV;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    D1 (theU (theU.Lower() + i), aP, aV);
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      aPoints[j * aNbPoints + i] = aP.Coord (j + 1);
+      aD1    [j * aNbPoints + i] = aV.Coord (j + 1);
+    }
+  }
+}
+
 
 //=======================================================================
 //function : D2
@@ -98,6 +98,19 @@ public:
   //! is not C1.
   Standard_EXPORT virtual void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const;
   
+  //! Computes the points of the curve at the parameters theU(i) at once.
+  //! The points are stored as the structure of arrays: thePoints contains X coordinates
+  //! of all points, then Y and Z coordinates, and its length is 3 * theU.Length().
+  //! The default implementation calls D0() for each point.
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT virtual void D0Batch (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints) const;
+  
+  //! Computes the points and the first derivatives of the curve at the parameters
+  //! theU(i) at once, the results are stored as in D0Batch().
+  //! The default implementation calls D1() for each point.
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT virtual void D1Batch (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1) const;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
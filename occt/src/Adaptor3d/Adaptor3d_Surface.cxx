@@ -28,6 +28,7 @@
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Surface, Standard_Transient)
@@ -289,6 +290,69 @@ void Adaptor3d_Surface::D1(const Standard_Real , const Standard_Real , gp_Pnt& ,
 }
 
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D0Batch (const TColStd_Array1OfReal& theU,
+                                 const TColStd_Array1OfReal& theV,
+                                 TColStd_Array1OfReal& thePoints) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (theV.Length() != aNbPoints || thePoints.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Adaptor3d_Surface::D0Batch(), inconsistent lengths of arrays");
+  }
+  Standard_Real* aPoints = aNbPoints > 0 ? &thePoints.ChangeFirst() : NULL;
+  gp_Pnt aP;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    D0 (theU (theU.Lower() + i), theV (theV.Lower() + i), aP);
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      aPoints[j * aNbPoints + i] = aP.Coord (j + 1);
+    }
+  }
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D1Batch (const TColStd_Array1OfReal& theU,
+                                 const TColStd_Array1OfReal& theV,
+                                 TColStd_Array1OfReal& thePoints,
+                                 TColStd_Array1OfReal& theD1U,
+                                 TColStd_Array1OfReal& theD1V) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (theV.Length() != aNbPoints
+   || thePoints.Length() != 3 * aNbPoints
+   || theD1U.Length() != 3 * aNbPoints
+   || theD1V.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Adaptor3d_Surface::D1Batch(), inconsistent lengths of arrays");
+  }
+  Standard_Real* aPoints = aNbPoints > 0 ? &thePoints.ChangeFirst() : NULL;
+  Standard_Real* aD1U    = aNbPoints > 0 ? &theD1U.ChangeFirst() : NULL;
+  Standard_Real* aD1V    = aNbPoints > 0 ? &theD1V.ChangeFirst() : NULL;
+  gp_Pnt aP;
+  gp_Vec aDU, aDV;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    D1 (theU (theU.Lower() + i), theV (theV.Lower() + i), aP, aDU, aDV);
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      aPoints[j * aNbPoints + i] = aP.Coord (j + 1);
+      aD1U   [j * aNbPoints + i] = aDU.Coord (j + 1);
+      aD1V   [j * aNbPoints + i] = aDV.Coord (j + 1);
+    }
+  }
+}
+
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -128,6 +128,19 @@ public:
   //! Tip: use GeomLib::NormEstim() to calculate surface normal at specified (U, V) point.
   Standard_EXPORT virtual void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const;
 
+  //! Computes the points of the surface at the parameters (theU(i), theV(i)) at once.
+  //! The points are stored as the structure of arrays: thePoints contains X coordinates
+  //! of all points, then Y and Z coordinates, and its length is 3 * theU.Length().
+  //! The default implementation calls D0() for each point.
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT virtual void D0Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints) const;
+
+  //! Computes the points and the first derivatives of the surface at the parameters
+  //! (theU(i), theV(i)) at once, the results are stored as in D0Batch().
+  //! The default implementation calls D1() for each point.
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT virtual void D1Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1U, TColStd_Array1OfReal& theD1V) const;
+
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //! Raised  if   the   continuity   of the current
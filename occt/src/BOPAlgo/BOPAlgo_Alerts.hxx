@@ -144,4 +144,8 @@ DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertShapeIsNotPeriodic)
 //! Unable to make closed edge on face (to make a seam)
 DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertUnableToMakeClosedEdgeOnFace)
 
+//! The time budget of the self-interference check is exhausted,
+//! not all candidate pairs of sub-shapes have been checked
+DEFINE_SIMPLE_ALERT(BOPAlgo_AlertCheckBudgetExhausted)
+
 #endif // _BOPAlgo_Alerts_HeaderFile
@@ -392,6 +392,9 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetAdaptiveOBB(myAdaptiveOBB);
+  pPF->SetFastPlanar(myFastPlanar);
+  pPF->SetProfile(myProfile);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -556,6 +559,7 @@ void BOPAlgo_BOP::PerformInternal1(const BOPAlgo_PaveFiller& theFiller,
 //=======================================================================
 void BOPAlgo_BOP::BuildRC(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "BOP::BuildRC");
   Message_ProgressScope aPS(theRange, NULL, 1);
 
   TopAbs_ShapeEnum aType;
@@ -801,6 +805,7 @@ void BOPAlgo_BOP::BuildRC(const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_BOP::BuildShape(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "BOP::BuildShape");
   Message_ProgressScope aPS(theRange, NULL, 10.);
 
   if (myDims[0] == 3 && myDims[1] == 3)
@@ -1008,6 +1013,7 @@ void BOPAlgo_BOP::BuildShape(const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_BOP::BuildSolid(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "BOP::BuildSolid");
   Message_ProgressScope aPS(theRange, NULL, 10.);
   // Containers
   TopTools_ListOfShape aLSC;
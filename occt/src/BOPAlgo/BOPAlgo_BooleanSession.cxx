@@ -0,0 +1,319 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BOPAlgo_BooleanSession.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BOPAlgo_BOP.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
+#include <IntTools_Context.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+namespace
+{
+  //! Functor computing the boxes of the shapes in parallel
+  class BOPAlgo_BoxFunctor
+  {
+  public:
+    BOPAlgo_BoxFunctor (const TopTools_IndexedMapOfShape& theShapes,
+                        NCollection_Vector<Bnd_Box>& theBoxes)
+    : myShapes (theShapes), myBoxes (theBoxes) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepBndLib::Add (myShapes (theIndex + 1), myBoxes.ChangeValue (theIndex));
+    }
+
+  private:
+    BOPAlgo_BoxFunctor& operator= (const BOPAlgo_BoxFunctor& );
+
+  private:
+    const TopTools_IndexedMapOfShape& myShapes;
+    NCollection_Vector<Bnd_Box>& myBoxes;
+  };
+}
+
+//=======================================================================
+//function : BOPAlgo_BooleanSession
+//purpose  : 
+//=======================================================================
+BOPAlgo_BooleanSession::BOPAlgo_BooleanSession()
+: BOPAlgo_Options(),
+  myOperation (BOPAlgo_CUT),
+  myFillHistory (Standard_True),
+  myFiller (NULL),
+  myBOP (NULL),
+  myLastFuzzyValue (0.),
+  myLastOperation (BOPAlgo_UNKNOWN),
+  myNbOperations (0)
+{
+}
+
+//=======================================================================
+//function : ~BOPAlgo_BooleanSession
+//purpose  : 
+//=======================================================================
+BOPAlgo_BooleanSession::~BOPAlgo_BooleanSession()
+{
+  releaseOperation();
+}
+
+//=======================================================================
+//function : SetTool
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::SetTool (const TopoDS_Shape& theTool)
+{
+  Clear();
+  myTool = theTool;
+}
+
+//=======================================================================
+//function : SetInteractive
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::SetInteractive (const Standard_Boolean theInteractive)
+{
+  if (!theInteractive)
+    myFaceFaceCache.Nullify();
+  else if (myFaceFaceCache.IsNull())
+    myFaceFaceCache = new BOPAlgo_FaceFaceCache;
+}
+
+//=======================================================================
+//function : Clear
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::Clear()
+{
+  BOPAlgo_Options::Clear();
+  releaseOperation();
+  myToolBoxes.Clear();
+  myObject.Nullify();
+  myObjectBoxes.Clear();
+  myBoxes.Clear();
+  myContext.Nullify();
+  if (!myFaceFaceCache.IsNull())
+    myFaceFaceCache->Clear();
+  myShape.Nullify();
+  myMove = TopLoc_Location();
+  myNbOperations = 0;
+}
+
+//=======================================================================
+//function : isUpToDate
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPAlgo_BooleanSession::isUpToDate (const TopoDS_Shape& theObject,
+                                                     const TopLoc_Location& theMove) const
+{
+  if (myShape.IsNull() || !theObject.IsEqual (myObject) ||
+      myLastOperation != myOperation || myLastFuzzyValue != myFuzzyValue ||
+      (myFillHistory && !myBOP->HasHistory()))
+    return Standard_False;
+
+  // The placement is compared exactly, i.e. it is the same if the tool has not been moved
+  const gp_Trsf aT1 = myMove.Transformation(), aT2 = theMove.Transformation();
+  for (Standard_Integer i = 1; i <= 3; ++i)
+  {
+    for (Standard_Integer j = 1; j <= 4; ++j)
+    {
+      if (aT1.Value (i, j) != aT2.Value (i, j))
+        return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : releaseOperation
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::releaseOperation()
+{
+  // The builder refers to the data structure of the filler, thus it is released first
+  delete myBOP;
+  myBOP = NULL;
+  delete myFiller;
+  myFiller = NULL;
+}
+
+//=======================================================================
+//function : History
+//purpose  : 
+//=======================================================================
+Handle(BRepTools_History) BOPAlgo_BooleanSession::History() const
+{
+  if (!myFillHistory || !myBOP)
+    return Handle(BRepTools_History)();
+  return myBOP->History();
+}
+
+//=======================================================================
+//function : computeBoxes
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::computeBoxes (const TopoDS_Shape& theShape,
+                                           TopTools_DataMapOfShapeBox& theBoxes) const
+{
+  TopTools_IndexedMapOfShape aShapes;
+  TopExp::MapShapes (theShape, TopAbs_EDGE, aShapes);
+  TopExp::MapShapes (theShape, TopAbs_FACE, aShapes);
+  //
+  const Standard_Integer aNbS = aShapes.Extent();
+  if (aNbS == 0)
+  {
+    return;
+  }
+  //
+  NCollection_Vector<Bnd_Box> aBoxes;
+  aBoxes.SetValue (aNbS - 1, Bnd_Box());
+  //
+  BOPAlgo_BoxFunctor aFunctor (aShapes, aBoxes);
+  OSD_Parallel::For (0, aNbS, aFunctor, !myRunParallel);
+  //
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    theBoxes.Bind (aShapes (i + 1), aBoxes (i));
+  }
+}
+
+//=======================================================================
+//function : PerformWithCopy
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::PerformWithCopy (const TopoDS_Shape& theObject,
+                                              const TopoDS_Shape& theToolCopy,
+                                              const Message_ProgressRange& theRange)
+{
+  if (!theToolCopy.IsPartner (myTool))
+  {
+    BOPAlgo_Options::Clear();
+    myShape.Nullify();
+    AddError (new BOPAlgo_AlertUnknownShape (theToolCopy));
+    return;
+  }
+  // theToolCopy = myTool.Moved (aMove)
+  const TopLoc_Location aMove = theToolCopy.Location() * myTool.Location().Inverted();
+  Perform (theObject, aMove, theRange);
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void BOPAlgo_BooleanSession::Perform (const TopoDS_Shape& theObject,
+                                      const TopLoc_Location& theMove,
+                                      const Message_ProgressRange& theRange)
+{
+  if (IsInteractive() && isUpToDate (theObject, theMove))
+  {
+    // Neither the object nor the placement of the tool have changed
+    return;
+  }
+  //
+  BOPAlgo_Options::Clear();
+  releaseOperation();
+  myShape.Nullify();
+  //
+  if (theObject.IsNull() || myTool.IsNull())
+  {
+    AddError (new BOPAlgo_AlertNullInputShapes);
+    return;
+  }
+  //
+  Message_ProgressScope aPS (theRange, "Performing Boolean operation with cached tool", 10);
+  //
+  // Data independent on the placement of the tool
+  if (myToolBoxes.IsEmpty())
+  {
+    computeBoxes (myTool, myToolBoxes);
+  }
+  if (!theObject.IsEqual (myObject))
+  {
+    myObject = theObject;
+    myObjectBoxes.Clear();
+    computeBoxes (myObject, myObjectBoxes);
+  }
+  // The context is not kept between the operations: it would accumulate the
+  // classifiers and projectors of every placement of the tool and of the split shapes
+  myContext = new IntTools_Context;
+  //
+  // Boxes of the arguments of the current operation
+  myBoxes = myObjectBoxes;
+  const Standard_Boolean isMoved = !theMove.IsIdentity();
+  const gp_Trsf aTrsf = theMove.Transformation();
+  for (TopTools_DataMapOfShapeBox::Iterator aItB (myToolBoxes); aItB.More(); aItB.Next())
+  {
+    if (isMoved)
+      myBoxes.Bind (aItB.Key().Moved (theMove), aItB.Value().Transformed (aTrsf));
+    else
+      myBoxes.Bind (aItB.Key(), aItB.Value());
+  }
+  //
+  const TopoDS_Shape aTool = isMoved ? myTool.Moved (theMove) : myTool;
+  //
+  TopTools_ListOfShape anArgs;
+  anArgs.Append (theObject);
+  anArgs.Append (aTool);
+  //
+  myFiller = new BOPAlgo_PaveFiller;
+  myFiller->SetArguments (anArgs);
+  myFiller->SetSharedContext (myContext);
+  myFiller->SetPrecomputedBoxes (&myBoxes);
+  myFiller->SetRunParallel (myRunParallel);
+  myFiller->SetFuzzyValue (myFuzzyValue);
+  myFiller->SetUseOBB (myUseOBB);
+  myFiller->SetAdaptiveOBB (myAdaptiveOBB);
+  myFiller->SetFastPlanar (myFastPlanar);
+  myFiller->SetProfile (myProfile);
+  myFiller->SetNonDestructive (Standard_True);
+  myFiller->SetFaceFaceCache (myFaceFaceCache);
+  myFiller->Perform (aPS.Next (8));
+  myReport->Merge (myFiller->GetReport());
+  if (!myFaceFaceCache.IsNull())
+  {
+    myFaceFaceCache->NextRun();
+  }
+  if (HasErrors())
+  {
+    return;
+  }
+  //
+  myBOP = new BOPAlgo_BOP;
+  myBOP->AddArgument (theObject);
+  myBOP->AddTool (aTool);
+  myBOP->SetOperation (myOperation);
+  myBOP->SetRunParallel (myRunParallel);
+  myBOP->SetProfile (myProfile);
+  myBOP->SetToFillHistory (myFillHistory);
+  myBOP->PerformWithFiller (*myFiller, aPS.Next (2));
+  myReport->Merge (myBOP->GetReport());
+  if (HasErrors())
+  {
+    return;
+  }
+  //
+  myShape = myBOP->Shape();
+  myMove = theMove;
+  myLastFuzzyValue = myFuzzyValue;
+  myLastOperation = myOperation;
+  ++myNbOperations;
+}
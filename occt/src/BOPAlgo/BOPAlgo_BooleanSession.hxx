@@ -0,0 +1,180 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BOPAlgo_BooleanSession_HeaderFile
+#define _BOPAlgo_BooleanSession_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_FaceFaceCache.hxx>
+#include <BOPAlgo_Operation.hxx>
+#include <BOPAlgo_Options.hxx>
+#include <BRepTools_History.hxx>
+#include <Message_ProgressRange.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_DataMapOfShapeBox.hxx>
+
+class BOPAlgo_BOP;
+class BOPAlgo_PaveFiller;
+class IntTools_Context;
+
+//! The class performs series of Boolean operations between the objects
+//! and the copies of the same tool placed differently (e.g. instances of the pattern feature).
+//!
+//! The data which does not depend on the placement of the tool is prepared once and kept
+//! between the operations:
+//! - The bounding boxes of edges and faces of the tool are computed once and transformed
+//!   for each placement instead of being computed by the intersection algorithm;
+//! - The bounding boxes of the object are kept while the same object is used.
+//!
+//! The intersection context (classifiers, projectors etc.) is created for each operation,
+//! as its tools are built for the placed copies of the tool and for the split shapes,
+//! which are not used again by the next operations.
+//!
+//! Only the interferences between the object and the placed tool are computed by each operation.
+//! To keep the cached data valid the operations are always performed in non-destructive mode.
+//!
+//! The interactive mode is intended for dragging the tool, when the operation is
+//! performed for each new placement of the tool. In this mode additionally:
+//! - The results of Face/Face intersections of the recent operations are kept
+//!   and reused for the pairs of faces in the same relative position (see BOPAlgo_FaceFaceCache);
+//! - The operation is not performed again if neither the object nor the placement
+//!   of the tool have changed since the last operation.
+//!
+//! The algorithm returns the following Error alerts:
+//! - *BOPAlgo_AlertNullInputShapes* - in case the object or the tool is null;
+//! - *BOPAlgo_AlertUnknownShape* - in case the given copy of the tool is not a copy of the tool;
+//! - alerts of the intersection and building algorithms.
+class BOPAlgo_BooleanSession : public BOPAlgo_Options
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor
+  Standard_EXPORT BOPAlgo_BooleanSession();
+
+  //! Destructor
+  Standard_EXPORT virtual ~BOPAlgo_BooleanSession();
+
+public: //! @name Setting the operation
+
+  //! Sets the tool of the operations.
+  //! The data cached for the previous tool is released.
+  Standard_EXPORT void SetTool (const TopoDS_Shape& theTool);
+
+  //! Returns the tool of the operations
+  const TopoDS_Shape& Tool() const { return myTool; }
+
+  //! Sets the type of the operations (BOPAlgo_CUT by default)
+  void SetOperation (const BOPAlgo_Operation theOperation) { myOperation = theOperation; }
+
+  //! Returns the type of the operations
+  BOPAlgo_Operation Operation() const { return myOperation; }
+
+  //! Sets the flag defining whether the history of the operations should be filled
+  void SetToFillHistory (const Standard_Boolean theFillHistory) { myFillHistory = theFillHistory; }
+
+  //! Returns the flag defining whether the history of the operations should be filled
+  Standard_Boolean HasHistory() const { return myFillHistory; }
+
+  //! Sets the interactive mode (switched off by default).
+  //! Switching the mode off releases the kept intersection results.
+  Standard_EXPORT void SetInteractive (const Standard_Boolean theInteractive);
+
+  //! Returns TRUE if the interactive mode is switched on
+  Standard_Boolean IsInteractive() const { return !myFaceFaceCache.IsNull(); }
+
+public: //! @name Performing the operations
+
+  //! Performs the operation between the object and the tool moved by theMove.
+  Standard_EXPORT void Perform (const TopoDS_Shape& theObject,
+                                const TopLoc_Location& theMove = TopLoc_Location(),
+                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Performs the operation between the object and the copy of the tool,
+  //! i.e. the shape differing from the tool by location only (see TopoDS_Shape::Moved()).
+  Standard_EXPORT void PerformWithCopy (const TopoDS_Shape& theObject,
+                                        const TopoDS_Shape& theToolCopy,
+                                        const Message_ProgressRange& theRange = Message_ProgressRange());
+
+public: //! @name Obtaining the results
+
+  //! Returns the result of the last operation
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns the history of the last operation (null if the history is not filled)
+  Standard_EXPORT Handle(BRepTools_History) History() const;
+
+  //! Returns the intersection algorithm of the last operation (NULL if nothing has been performed)
+  const BOPAlgo_PaveFiller* PaveFiller() const { return myFiller; }
+
+  //! Returns the intersection context of the last operation
+  const Handle(IntTools_Context)& Context() const { return myContext; }
+
+  //! Returns the number of operations performed since the tool has been set
+  Standard_Integer NbOperations() const { return myNbOperations; }
+
+  //! Returns the number of Face/Face intersections reused in the interactive mode
+  Standard_Integer NbReusedIntersections() const
+  {
+    return myFaceFaceCache.IsNull() ? 0 : myFaceFaceCache->NbHits();
+  }
+
+  //! Clears the results and all the cached data; the tool and the options are kept.
+  Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
+
+protected:
+
+  //! Computes the bounding boxes of edges and faces of the shape.
+  Standard_EXPORT void computeBoxes (const TopoDS_Shape& theShape,
+                                     TopTools_DataMapOfShapeBox& theBoxes) const;
+
+  //! Releases the algorithms of the last operation.
+  Standard_EXPORT void releaseOperation();
+
+  //! Returns TRUE if the result of the last operation is valid for the given arguments.
+  Standard_EXPORT Standard_Boolean isUpToDate (const TopoDS_Shape& theObject,
+                                               const TopLoc_Location& theMove) const;
+
+private:
+
+  BOPAlgo_BooleanSession (const BOPAlgo_BooleanSession& );
+  BOPAlgo_BooleanSession& operator= (const BOPAlgo_BooleanSession& );
+
+protected:
+
+  TopoDS_Shape myTool;
+  BOPAlgo_Operation myOperation;
+  Standard_Boolean myFillHistory;
+  TopTools_DataMapOfShapeBox myToolBoxes;   //!< Boxes of the tool sub-shapes in the initial placement
+  TopoDS_Shape myObject;                    //!< Object of the last operation
+  TopTools_DataMapOfShapeBox myObjectBoxes; //!< Boxes of the object sub-shapes
+  TopTools_DataMapOfShapeBox myBoxes;       //!< Boxes of the arguments of the current operation
+  Handle(IntTools_Context) myContext;
+  BOPAlgo_PaveFiller* myFiller;
+  BOPAlgo_BOP* myBOP;
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache; //!< Face/Face intersections kept in the interactive mode
+  TopoDS_Shape myShape;
+  TopLoc_Location myMove;                   //!< Placement of the tool in the last operation
+  Standard_Real myLastFuzzyValue;           //!< Fuzzy value of the last operation
+  BOPAlgo_Operation myLastOperation;        //!< Type of the last operation
+  Standard_Integer myNbOperations;
+
+};
+
+#endif // _BOPAlgo_BooleanSession_HeaderFile
@@ -199,6 +199,9 @@ void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetAdaptiveOBB(myAdaptiveOBB);
+  pPF->SetFastPlanar(myFastPlanar);
+  pPF->SetProfile(myProfile);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -217,6 +220,8 @@ void BOPAlgo_Builder::PerformWithFiller(const BOPAlgo_PaveFiller& theFiller, con
   myFuzzyValue = theFiller.FuzzyValue();
   myGlue = theFiller.Glue();
   myUseOBB = theFiller.UseOBB();
+  myAdaptiveOBB = theFiller.AdaptiveOBB();
+  myFastPlanar = theFiller.FastPlanar();
   PerformInternal(theFiller, theRange);
 }
 //=======================================================================
@@ -225,6 +230,7 @@ void BOPAlgo_Builder::PerformWithFiller(const BOPAlgo_PaveFiller& theFiller, con
 //=======================================================================
 void BOPAlgo_Builder::PerformInternal(const BOPAlgo_PaveFiller& theFiller, const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::PerformInternal");
   GetReport()->Clear();
   //
   try {
@@ -333,6 +339,7 @@ void BOPAlgo_Builder::PerformInternal1(const BOPAlgo_PaveFiller& theFiller, cons
   myPaveFiller=(BOPAlgo_PaveFiller*)&theFiller;
   myDS=myPaveFiller->PDS();
   myContext=myPaveFiller->Context();
+  myContextPool.SetContext(myContext);
   myFuzzyValue = myPaveFiller->FuzzyValue();
   myNonDestructive = myPaveFiller->NonDestructive();
   //
@@ -452,6 +459,7 @@ void BOPAlgo_Builder::PerformInternal1(const BOPAlgo_PaveFiller& theFiller, cons
 //=======================================================================
 void BOPAlgo_Builder::PostTreat(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::PostTreat");
   Standard_Integer i, aNbS;
   TopAbs_ShapeEnum aType;
   TopTools_IndexedMapOfShape aMA;
@@ -27,6 +27,7 @@
 #include <BOPAlgo_GlueEnum.hxx>
 #include <BOPAlgo_Operation.hxx>
 #include <BOPDS_PDS.hxx>
+#include <BOPTools_Parallel.hxx>
 #include <NCollection_BaseAllocator.hxx>
 #include <Standard_Integer.hxx>
 #include <Standard_Real.hxx>
@@ -525,6 +526,8 @@ protected: //! @name Fields
   BOPAlgo_PPaveFiller myPaveFiller;             //!< Pave Filler - algorithm for sub-shapes intersection
   BOPDS_PDS myDS;                               //!< Data Structure - holder of intersection information
   Handle(IntTools_Context) myContext;           //!< Context - tool for cashing heavy algorithms such as Projectors and Classifiers
+  BOPTools_Parallel::ContextPool<IntTools_Context> myContextPool; //!< Contexts of the threads performing the parallel stages,
+                                                                  //! kept for the whole operation
   Standard_Integer myEntryPoint;                //!< EntryPoint - controls the deletion of the PaveFiller, which could live longer than the Builder
   TopTools_DataMapOfShapeListOfShape myImages;  //!< Images - map of Images of the sub-shapes of arguments
   TopTools_DataMapOfShapeShape myShapesSD;      //!< ShapesSD - map of SD Shapes
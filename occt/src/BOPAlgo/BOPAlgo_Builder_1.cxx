@@ -39,6 +39,7 @@
 //=======================================================================
 void BOPAlgo_Builder::FillImagesVertices(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillImagesVertices");
   Message_ProgressScope aPS(theRange, "Filling splits of vertices", myDS->ShapesSD().Size());
   TColStd_DataMapIteratorOfDataMapOfIntegerInteger aIt(myDS->ShapesSD());
   for (; aIt.More(); aIt.Next(), aPS.Next())
@@ -69,6 +70,7 @@ void BOPAlgo_Builder::FillImagesVertices(const Message_ProgressRange& theRange)
 //=======================================================================
   void BOPAlgo_Builder::FillImagesEdges(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillImagesEdges");
   Standard_Integer i, aNbS = myDS->NbSourceShapes();
   Message_ProgressScope aPS(theRange, "Filling splits of edges", aNbS);
   for (i = 0; i < aNbS; ++i, aPS.Next()) {
@@ -160,6 +162,7 @@ void BOPAlgo_Builder::BuildResult(const TopAbs_ShapeEnum theType)
 //=======================================================================
   void BOPAlgo_Builder::FillImagesContainers(const TopAbs_ShapeEnum theType, const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillImagesContainers");
   Standard_Integer i, aNbS;
   TopTools_MapOfShape aMFP(100, myAllocator);
   //
@@ -183,6 +186,7 @@ void BOPAlgo_Builder::BuildResult(const TopAbs_ShapeEnum theType)
 //=======================================================================
   void BOPAlgo_Builder::FillImagesCompounds(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillImagesCompounds");
   Standard_Integer i, aNbS;
   TopTools_MapOfShape aMFP(100, myAllocator);
   //
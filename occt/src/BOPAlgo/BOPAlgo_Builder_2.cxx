@@ -242,6 +242,7 @@ void BOPAlgo_Builder::FillImagesFaces(const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::BuildSplitFaces");
   Standard_Boolean bHasFaceInfo, bIsClosed, bIsDegenerated, bToReverse;
   Standard_Integer i, j, k, aNbS, aNbPBIn, aNbPBOn, aNbPBSc, aNbAV, nSp;
   TopoDS_Face aFF, aFSD;
@@ -510,7 +511,7 @@ void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
     aBF.SetProgressRange(aPSParallel.Next());
   }
   //===================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVBF);
+  BOPTools_Parallel::Perform (myRunParallel, aVBF, myContextPool);
   //===================================================
   if (UserBreak(aPSOuter))
   {
@@ -572,6 +573,7 @@ static void AddEdgeSet(const TopoDS_Shape& theS,
 //=======================================================================
 void BOPAlgo_Builder::FillSameDomainFaces(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillSameDomainFaces");
   // It is necessary to analyze all Face/Face intersections
   // and find all faces with equal sets of edges
   const BOPDS_VectorOfInterfFF& aFFs = myDS->InterfFF();
@@ -722,7 +724,7 @@ void BOPAlgo_Builder::FillSameDomainFaces(const Message_ProgressRange& theRange)
   }
   //================================================================
   // Perform analysis
-  BOPTools_Parallel::Perform (myRunParallel, aVPSB, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVPSB, myContextPool);
   //================================================================
   if (UserBreak(aPSOuter))
   {
@@ -841,6 +843,7 @@ void BOPAlgo_Builder::FillSameDomainFaces(const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_Builder::FillInternalVertices(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillInternalVertices");
   Message_ProgressScope aPSOuter(theRange, NULL, 1);
 
   // Vector of pairs of Vertex/Face for classification of the vertices
@@ -896,7 +899,7 @@ void BOPAlgo_Builder::FillInternalVertices(const Message_ProgressRange& theRange
   }
   // Perform classification
   //================================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVVFI, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVVFI, myContextPool);
   //================================================================
   if (UserBreak(aPSOuter))
   {
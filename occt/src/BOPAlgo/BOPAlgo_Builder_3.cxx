@@ -57,6 +57,97 @@ static
   void OwnInternalShapes(const TopoDS_Shape& ,
                          TopTools_IndexedMapOfShape& );
 
+static
+  void MakeDraftSolid(const TopoDS_Shape& theSolid,
+                      const TopTools_DataMapOfShapeListOfShape& theImages,
+                      const TopTools_DataMapOfShapeShape& theShapesSD,
+                      const Handle(IntTools_Context)& theContext,
+                      const Handle(Message_Report)& theReport,
+                      TopoDS_Shape& theDraftSolid,
+                      TopTools_ListOfShape& theLIF);
+
+//=======================================================================
+//class : BOPAlgo_DraftSolid
+//purpose  : Auxiliary class for building the draft solids in parallel mode
+//=======================================================================
+class BOPAlgo_DraftSolid : public BOPAlgo_ParallelAlgo
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructor
+  BOPAlgo_DraftSolid()
+  : myIndex(-1),
+    myDS(NULL),
+    myImages(NULL),
+    myShapesSD(NULL),
+    myCheckInverted(Standard_True)
+  {}
+
+  //! Sets the index of the solid in the Data Structure
+  void SetIndex(const Standard_Integer theIndex) { myIndex = theIndex; }
+
+  //! Returns the index of the solid in the Data Structure
+  Standard_Integer Index() const { return myIndex; }
+
+  //! Sets the Data Structure
+  void SetDS(const BOPDS_PDS theDS) { myDS = theDS; }
+
+  //! Sets the images of the faces
+  void SetImages(const TopTools_DataMapOfShapeListOfShape& theImages) { myImages = &theImages; }
+
+  //! Sets the map of same domain faces
+  void SetShapesSD(const TopTools_DataMapOfShapeShape& theShapesSD) { myShapesSD = &theShapesSD; }
+
+  //! Sets the check inverted flag
+  void SetCheckInverted(const Standard_Boolean theCheck) { myCheckInverted = theCheck; }
+
+  //! Sets the context
+  void SetContext(const Handle(IntTools_Context)& theContext) { myContext = theContext; }
+
+  //! Returns the context
+  const Handle(IntTools_Context)& Context() const { return myContext; }
+
+  //! Returns the draft solid
+  const TopoDS_Shape& DraftSolid() const { return myDraftSolid; }
+
+  //! Returns the INTERNAL faces of the solid
+  const TopTools_ListOfShape& InternalFaces() const { return myLIF; }
+
+  //! Builds the bounding box of the solid, if necessary, and the draft solid
+  virtual void Perform()
+  {
+    Message_ProgressScope aPS(myProgressRange, NULL, 1);
+    if (UserBreak(aPS))
+    {
+      return;
+    }
+    //
+    BOPDS_ShapeInfo& aSI = myDS->ChangeShapeInfo(myIndex);
+    Bnd_Box& aBoxS = aSI.ChangeBox();
+    if (aBoxS.IsVoid())
+      myDS->BuildBndBoxSolid(myIndex, aBoxS, myCheckInverted);
+    //
+    TopoDS_Solid aSD;
+    BRep_Builder().MakeSolid(aSD);
+    myDraftSolid = aSD;
+    MakeDraftSolid(aSI.Shape(), *myImages, *myShapesSD, myContext, myReport, myDraftSolid, myLIF);
+  }
+
+private:
+  Standard_Integer myIndex; //!< Index of the solid
+  BOPDS_PDS myDS; //!< Data Structure
+  const TopTools_DataMapOfShapeListOfShape* myImages; //!< Images of the faces
+  const TopTools_DataMapOfShapeShape* myShapesSD; //!< Same domain faces
+  Standard_Boolean myCheckInverted; //!< Check inverted flag
+  Handle(IntTools_Context) myContext; //!< Context
+  TopoDS_Shape myDraftSolid; //!< Draft solid
+  TopTools_ListOfShape myLIF; //!< INTERNAL faces of the solid
+};
+
+// Vector of draft solids
+typedef NCollection_Vector<BOPAlgo_DraftSolid> BOPAlgo_VectorOfDraftSolid;
+
 
 //=======================================================================
 //function : FillImagesSolids
@@ -101,6 +192,7 @@ void BOPAlgo_Builder::FillImagesSolids(const Message_ProgressRange& theRange)
 void BOPAlgo_Builder::FillIn3DParts(TopTools_DataMapOfShapeShape& theDraftSolids,
                                     const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillIn3DParts");
   Message_ProgressScope aPS(theRange, NULL, 2);
 
   Handle(NCollection_BaseAllocator) anAlloc = new NCollection_IncAllocator;
@@ -148,8 +240,6 @@ void BOPAlgo_Builder::FillIn3DParts(TopTools_DataMapOfShapeShape& theDraftSolids
     }
   }
 
-  BRep_Builder aBB;
-
   // Get all solids
   TopTools_ListOfShape aLSolids(anAlloc);
   // Keep INTERNAL faces of the solids
@@ -157,42 +247,56 @@ void BOPAlgo_Builder::FillIn3DParts(TopTools_DataMapOfShapeShape& theDraftSolids
   // Draft solids
   TopTools_IndexedDataMapOfShapeShape aDraftSolid(1, anAlloc);
 
+  // Build the bounding boxes and the draft solids in parallel
+  BOPAlgo_VectorOfDraftSolid aVDS;
   for (i = 0; i < aNbS; ++i)
   {
-    BOPDS_ShapeInfo& aSI = myDS->ChangeShapeInfo(i);
+    const BOPDS_ShapeInfo& aSI = myDS->ShapeInfo(i);
     if (aSI.ShapeType() != TopAbs_SOLID)
     {
       continue;
     }
-    if (UserBreak(aPS))
-    {
-      return;
-    }
-    const TopoDS_Shape& aS = aSI.Shape();
-    const TopoDS_Solid& aSolid = (*(TopoDS_Solid*)(&aS));
-    //
-    // Bounding box for the solid aS
-    Bnd_Box& aBoxS = aSI.ChangeBox();
-    if (aBoxS.IsVoid())
-      myDS->BuildBndBoxSolid(i, aBoxS, myCheckInverted);
+    BOPAlgo_DraftSolid& aDS = aVDS.Appended();
+    aDS.SetIndex(i);
+    aDS.SetDS(myDS);
+    aDS.SetImages(myImages);
+    aDS.SetShapesSD(myShapesSD);
+    aDS.SetCheckInverted(myCheckInverted);
+  }
 
-    // Build Draft Solid
-    TopTools_ListOfShape aLIF;
-    TopoDS_Solid aSD;
-    aBB.MakeSolid(aSD);
-    BuildDraftSolid(aSolid, aSD, aLIF);
+  Standard_Integer aNbDS = aVDS.Length();
+  Message_ProgressScope aPSParallel(aPS.Next(), "Building draft solids", aNbDS);
+  for (i = 0; i < aNbDS; ++i)
+  {
+    aVDS.ChangeValue(i).SetProgressRange(aPSParallel.Next());
+  }
+  //================================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVDS, myContextPool);
+  //================================================================
+  if (UserBreak(aPS))
+  {
+    return;
+  }
+
+  for (i = 0; i < aNbDS; ++i)
+  {
+    const BOPAlgo_DraftSolid& aDS = aVDS(i);
+    myReport->Merge(aDS.GetReport());
+    //
+    const BOPDS_ShapeInfo& aSI = myDS->ShapeInfo(aDS.Index());
+    const TopoDS_Shape& aSD = aDS.DraftSolid();
 
     aLSolids.Append(aSD);
-    aSolidsIF.Bind(aSD, aLIF);
-    aShapeBoxMap.Bind(aSD, aBoxS);
-    aDraftSolid.Add(aS, aSD);
+    aSolidsIF.Bind(aSD, aDS.InternalFaces());
+    aShapeBoxMap.Bind(aSD, aSI.Box());
+    aDraftSolid.Add(aSI.Shape(), aSD);
   }
 
   // Perform classification of the faces
   TopTools_IndexedDataMapOfShapeListOfShape anInParts;
 
   BOPAlgo_Tools::ClassifyFaces(aLFaces, aLSolids, myRunParallel,
-                               myContext, anInParts, aShapeBoxMap,
+                               myContextPool, anInParts, aShapeBoxMap,
                                aSolidsIF, aPS.Next());
 
   // Analyze the results of classification
@@ -247,6 +351,20 @@ void BOPAlgo_Builder::FillIn3DParts(TopTools_DataMapOfShapeShape& theDraftSolids
 void BOPAlgo_Builder::BuildDraftSolid(const TopoDS_Shape& theSolid,
                                       TopoDS_Shape& theDraftSolid,
                                       TopTools_ListOfShape& theLIF)
+{
+  MakeDraftSolid(theSolid, myImages, myShapesSD, myContext, myReport, theDraftSolid, theLIF);
+}
+//=======================================================================
+//function : MakeDraftSolid
+//purpose  : 
+//=======================================================================
+void MakeDraftSolid(const TopoDS_Shape& theSolid,
+                    const TopTools_DataMapOfShapeListOfShape& theImages,
+                    const TopTools_DataMapOfShapeShape& theShapesSD,
+                    const Handle(IntTools_Context)& theContext,
+                    const Handle(Message_Report)& theReport,
+                    TopoDS_Shape& theDraftSolid,
+                    TopTools_ListOfShape& theLIF)
 {
   Standard_Boolean bToReverse;
   Standard_Integer iFlag;
@@ -277,13 +395,13 @@ void BOPAlgo_Builder::BuildDraftSolid(const TopoDS_Shape& theSolid,
       const TopoDS_Shape& aF=aIt2.Value();
       aOrF=aF.Orientation();
       //
-      if (myImages.IsBound(aF)) {
-        const TopTools_ListOfShape& aLSp=myImages.Find(aF);
+      if (theImages.IsBound(aF)) {
+        const TopTools_ListOfShape& aLSp=theImages.Find(aF);
         aItS.Initialize(aLSp);
         for (; aItS.More(); aItS.Next()) {
           aFx=aItS.Value();
           //
-          if (myShapesSD.IsBound(aFx)) {
+          if (theShapesSD.IsBound(aFx)) {
             //
             if (aOrF==TopAbs_INTERNAL) {
               aFx.Orientation(aOrF);
@@ -291,7 +409,7 @@ void BOPAlgo_Builder::BuildDraftSolid(const TopoDS_Shape& theSolid,
             }
             else {
               bToReverse=BOPTools_AlgoTools::IsSplitToReverseWithWarn
-                (aFx, aF, myContext, myReport);
+                (aFx, aF, theContext, theReport);
               if (bToReverse) {
                 aFx.Reverse();
               }
@@ -299,7 +417,7 @@ void BOPAlgo_Builder::BuildDraftSolid(const TopoDS_Shape& theSolid,
               iFlag=1;
               aBB.Add(aShD, aFx);
             }
-          }//if (myShapesSD.IsBound(aFx)) {
+          }//if (theShapesSD.IsBound(aFx)) {
           else {
             aFx.Orientation(aOrF);
             if (aOrF==TopAbs_INTERNAL) {
@@ -311,7 +429,7 @@ void BOPAlgo_Builder::BuildDraftSolid(const TopoDS_Shape& theSolid,
             }
           }
         }
-      } // if (myImages.IsBound(aF)) { 
+      } // if (theImages.IsBound(aF)) { 
       //
       else {
         if (aOrF==TopAbs_INTERNAL) {
@@ -382,6 +500,7 @@ typedef NCollection_Vector<BOPAlgo_SplitSolid> BOPAlgo_VectorOfBuilderSolid;
 void BOPAlgo_Builder::BuildSplitSolids(TopTools_DataMapOfShapeShape& theDraftSolids,
                                        const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::BuildSplitSolids");
   Standard_Boolean bFlagSD;
   Standard_Integer i, aNbS;
   TopExp_Explorer aExp;
@@ -485,7 +604,7 @@ void BOPAlgo_Builder::BuildSplitSolids(TopTools_DataMapOfShapeShape& theDraftSol
   }
   //
   //===================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVBS);
+  BOPTools_Parallel::Perform (myRunParallel, aVBS, myContextPool);
   //===================================================
   if (UserBreak(aPSOuter))
   {
@@ -569,6 +688,7 @@ void BOPAlgo_Builder::BuildSplitSolids(TopTools_DataMapOfShapeShape& theDraftSol
 //=======================================================================
 void BOPAlgo_Builder::FillInternalShapes(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::FillInternalShapes");
   Standard_Integer i, j,  aNbS, aNbSI, aNbSx;
   TopAbs_ShapeEnum aType;
   TopAbs_State aState; 
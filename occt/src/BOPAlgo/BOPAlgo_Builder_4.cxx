@@ -147,6 +147,7 @@ const TopTools_ListOfShape* BOPAlgo_Builder::LocModified(const TopoDS_Shape& the
 //=======================================================================
 void BOPAlgo_Builder::PrepareHistory(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "Builder::PrepareHistory");
   if (!HasHistory())
     return;
 
@@ -19,8 +19,11 @@
 #include <BOPAlgo_BuilderSolid.hxx>
 #include <BOPDS_DS.hxx>
 #include <BOPTools_AlgoTools.hxx>
+#include <BOPTools_Parallel.hxx>
 #include <BRep_Builder.hxx>
+#include <IntTools_Context.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
+#include <TColStd_DataMapOfIntegerInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -37,6 +40,102 @@ static
 static void CollectMaterialBoundaries(const TopTools_ListOfShape& theLS,
                                       TopTools_MapOfShape& theMapKeepBnd);
 
+//=======================================================================
+//class : BOPAlgo_UnifySolids
+//purpose  : Auxiliary class for building the unified solid of the
+//           connexity block of solids of the same material in parallel mode
+//=======================================================================
+class BOPAlgo_UnifySolids : public BOPAlgo_BuilderSolid
+{
+public:
+  //! Constructor
+  BOPAlgo_UnifySolids()
+  : myGroup(0),
+    myToUnify(Standard_False)
+  {}
+
+  //! Sets the index of the group of solids
+  void SetGroup(const Standard_Integer theGroup) { myGroup = theGroup; }
+
+  //! Returns the index of the group of solids
+  Standard_Integer Group() const { return myGroup; }
+
+  //! Sets the connexity block of solids
+  void SetBlock(const TopoDS_Shape& theBlock) { myBlock = theBlock; }
+
+  //! Returns the connexity block of solids
+  const TopoDS_Shape& Block() const { return myBlock; }
+
+  //! Returns the internal parts of the solids of the block
+  const TopTools_ListOfShape& Internals() const { return myInternals; }
+
+  //! Returns TRUE if the block contains the faces to remove,
+  //! i.e. the unified solid has been built
+  Standard_Boolean ToUnify() const { return myToUnify; }
+
+  //! Builds the unified solid from the faces attached to only one solid of the block
+  void Perform()
+  {
+    // Map faces and solids to find boundary faces that can be removed
+    TopTools_IndexedDataMapOfShapeListOfShape aDMFS;
+    //
+    TopoDS_Iterator aItS(myBlock);
+    for (; aItS.More(); aItS.Next()) {
+      const TopoDS_Shape& aSol = aItS.Value();
+      //
+      TopoDS_Iterator aItIS(aSol);
+      for (; aItIS.More(); aItIS.Next()) {
+        const TopoDS_Shape& aSI = aItIS.Value();
+        if (aSI.Orientation() == TopAbs_INTERNAL) {
+          myInternals.Append(aSI);
+        }
+        else {
+          TopoDS_Iterator aItF(aSI);
+          for (; aItF.More(); aItF.Next()) {
+            const TopoDS_Shape& aF = aItF.Value();
+            TopTools_ListOfShape *pLSols = aDMFS.ChangeSeek(aF);
+            if (!pLSols) {
+              pLSols = &aDMFS(aDMFS.Add(aF, TopTools_ListOfShape()));
+            }
+            pLSols->Append(aSol);
+          }
+        }
+      }
+    }
+    //
+    // to build unified solid, select only faces attached to only one solid
+    TopTools_ListOfShape aLFUnique;
+    Standard_Integer i, aNb = aDMFS.Extent();
+    for (i = 1; i <= aNb; ++i) {
+      if (aDMFS(i).Extent() == 1) {
+        aLFUnique.Append(aDMFS.FindKey(i));
+      }
+    }
+    //
+    if (aNb == aLFUnique.Extent()) {
+      // no faces to remove
+      return;
+    }
+    //
+    myToUnify = Standard_True;
+    SetShapes(aLFUnique);
+    BOPAlgo_BuilderSolid::Perform(Message_ProgressRange());
+  }
+
+private:
+  //! Disable the range enabled method
+  virtual void Perform(const Message_ProgressRange& /*theRange*/) {}
+
+private:
+  Standard_Integer myGroup;          //!< Index of the group of solids
+  TopoDS_Shape myBlock;              //!< Connexity block of solids
+  TopTools_ListOfShape myInternals;  //!< Internal parts of the solids
+  Standard_Boolean myToUnify;        //!< Flag of presence of the faces to remove
+};
+
+// Vector of solids unifiers
+typedef NCollection_Vector<BOPAlgo_UnifySolids> BOPAlgo_VectorOfUnifySolids;
+
 //=======================================================================
 //function : empty constructor
 //purpose  : 
@@ -459,9 +558,37 @@ void BOPAlgo_CellsBuilder::RemoveInternalBoundaries()
   // try to remove the internal boundaries between the
   // shapes of the same material
   TopTools_DataMapIteratorOfDataMapOfIntegerListOfShape aItM(myMaterials);
+  //
+  // remove internal faces between the solids of the same material
+  // for all materials at once, to unify the solids of all materials in parallel
+  NCollection_Vector<TopTools_ListOfShape> aLLSolids, aLLSolidsNew;
+  NCollection_Vector<Standard_Boolean> aSolidsRemoved;
+  TColStd_DataMapOfIntegerInteger aMaterialGroup;
+  for (; aItM.More(); aItM.Next()) {
+    const TopTools_ListOfShape& aLS = aItM.Value();
+    if (aLS.Extent() < 2) {
+      continue;
+    }
+    //
+    TopTools_ListIteratorOfListOfShape aItLS(aLS);
+    for (; aItLS.More(); aItLS.Next()) {
+      if (aItLS.Value().ShapeType() != TopAbs_SOLID) {
+        break;
+      }
+    }
+    if (!aItLS.More()) {
+      aMaterialGroup.Bind(aItM.Key(), aLLSolids.Length());
+      aLLSolids.Append(aLS);
+    }
+  }
+  //
+  if (!aLLSolids.IsEmpty()) {
+    RemoveInternalsOfSolids(aLLSolids, aLLSolidsNew, aSolidsRemoved);
+  }
+  //
   TopTools_ListOfShape aLSUnify[2];
   TopTools_MapOfShape aKeepMap[2];
-  for (; aItM.More(); aItM.Next()) {
+  for (aItM.Initialize(myMaterials); aItM.More(); aItM.Next()) {
     Standard_Integer iMaterial = aItM.Key();
     TopTools_ListOfShape& aLS = aItM.ChangeValue();
     //
@@ -513,12 +640,13 @@ void BOPAlgo_CellsBuilder::RemoveInternalBoundaries()
       else
       {
         // aType is Solid;
-        // remove internal faces between solids of the same material just now
-        TopTools_ListOfShape aLSNew;
-        if (RemoveInternals(aLS, aLSNew))
+        // the internal faces between solids of the same material have been removed above
+        const Standard_Integer* pGroup = aMaterialGroup.Seek(iMaterial);
+        if (pGroup && aSolidsRemoved(*pGroup))
         {
           bChanged = Standard_True;
           // update materials maps
+          const TopTools_ListOfShape& aLSNew = aLLSolidsNew(*pGroup);
           for (aItLS.Initialize(aLSNew); aItLS.More(); aItLS.Next()) {
             const TopoDS_Shape& aS = aItLS.Value();
             myShapeMaterial.Bind(aS, iMaterial);
@@ -830,11 +958,38 @@ Standard_Boolean BOPAlgo_CellsBuilder::RemoveInternals(const TopTools_ListOfShap
     }
   }
   else if (aType == TopAbs_SOLID) {
-    BRep_Builder aBB;
+    NCollection_Vector<TopTools_ListOfShape> aLLS, aLLSNew;
+    NCollection_Vector<Standard_Boolean> aRemoved;
+    aLLS.Append(theLS);
+    RemoveInternalsOfSolids(aLLS, aLLSNew, aRemoved);
+    //
+    theLSNew.Append(aLLSNew.ChangeFirst());
+    bRemoved = aRemoved.First();
+  }
+  return bRemoved;
+}
+
+//=======================================================================
+//function : RemoveInternalsOfSolids
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CellsBuilder::RemoveInternalsOfSolids
+  (const NCollection_Vector<TopTools_ListOfShape>& theLLS,
+   NCollection_Vector<TopTools_ListOfShape>& theLLSNew,
+   NCollection_Vector<Standard_Boolean>& theRemoved)
+{
+  BRep_Builder aBB;
+  BOPAlgo_VectorOfUnifySolids aVUS;
+  //
+  Standard_Integer iG, aNbG = theLLS.Length();
+  for (iG = 0; iG < aNbG; ++iG) {
+    theLLSNew.Appended();
+    theRemoved.Append(Standard_False);
+    //
     TopoDS_Compound aSolids;
     aBB.MakeCompound(aSolids);
     //
-    TopTools_ListIteratorOfListOfShape aItLS(theLS);
+    TopTools_ListIteratorOfListOfShape aItLS(theLLS(iG));
     for (; aItLS.More(); aItLS.Next()) {
       const TopoDS_Shape& aSol = aItLS.Value();
       aBB.Add(aSolids, aSol);
@@ -845,105 +1000,72 @@ Standard_Boolean BOPAlgo_CellsBuilder::RemoveInternals(const TopTools_ListOfShap
     TopTools_ListOfShape aLCB;
     BOPTools_AlgoTools::MakeConnexityBlocks(aSolids, TopAbs_FACE, TopAbs_SOLID, aLCB);
     //
-    // for each block remove internal faces
     TopTools_ListIteratorOfListOfShape aItLCB(aLCB);
     for (; aItLCB.More(); aItLCB.Next()) {
-      const TopoDS_Shape& aCB = aItLCB.Value();
-      //
-      // Map faces and solids to find boundary faces that can be removed
-      TopTools_IndexedDataMapOfShapeListOfShape aDMFS;
-      // internal entities
-      TopTools_ListOfShape aLSInt;
-      //
-      TopoDS_Iterator aItS(aCB);
+      BOPAlgo_UnifySolids& aUS = aVUS.Appended();
+      aUS.SetGroup(iG);
+      aUS.SetBlock(aItLCB.Value());
+    }
+  }
+  //
+  // for each block remove internal faces
+  //================================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVUS, myContextPool);
+  //================================================================
+  //
+  Standard_Integer k, aNbUS = aVUS.Length();
+  for (k = 0; k < aNbUS; ++k) {
+    BOPAlgo_UnifySolids& aUS = aVUS(k);
+    const TopoDS_Shape& aCB = aUS.Block();
+    TopTools_ListOfShape& aLSNew = theLLSNew(aUS.Group());
+    //
+    TopoDS_Iterator aItS(aCB);
+    if (!aUS.ToUnify()) {
+      // no faces to remove
       for (; aItS.More(); aItS.Next()) {
-        const TopoDS_Shape& aSol = aItS.Value();
-        //
-        TopoDS_Iterator aItIS(aSol);
-        for (; aItIS.More(); aItIS.Next()) {
-          const TopoDS_Shape& aSI = aItIS.Value();
-          if (aSI.Orientation() == TopAbs_INTERNAL) {
-            aLSInt.Append(aSI);
-          }
-          else {
-            TopoDS_Iterator aItF(aSI);
-            for (; aItF.More(); aItF.Next()) {
-              const TopoDS_Shape& aF = aItF.Value();
-              TopTools_ListOfShape *pLSols = aDMFS.ChangeSeek(aF);
-              if (!pLSols) {
-                pLSols = &aDMFS(aDMFS.Add(aF, TopTools_ListOfShape()));
-              }
-              pLSols->Append(aSol);
-            }
-          }
-        }
+        aLSNew.Append(aItS.Value());
       }
-      //
-      // to build unified solid, select only faces attached to only one solid
-      TopTools_ListOfShape aLFUnique;
-      Standard_Integer i, aNb = aDMFS.Extent();
-      for (i = 1; i <= aNb; ++i) {
-        if (aDMFS(i).Extent() == 1) {
-          aLFUnique.Append(aDMFS.FindKey(i));
-        }
-      }
-      //
-      if (aNb == aLFUnique.Extent()) {
-        // no faces to remove
-        aItS.Initialize(aCB);
-        for (; aItS.More(); aItS.Next()) {
-          theLSNew.Append(aItS.Value());
-        }
-        continue;
-      }
-      //
-      // build new solid
-      BOPAlgo_BuilderSolid aBS;
-      aBS.SetShapes(aLFUnique);
-      aBS.Perform();
-      //
-      if (aBS.HasErrors() || aBS.Areas().Extent() != 1) {
-        // add the warning
-        {
-          TopoDS_Compound aUniqeFaces;
-          aBB.MakeCompound(aUniqeFaces);
-          TopTools_ListIteratorOfListOfShape aItLFUniqe(aLFUnique);
-          for (; aItLFUniqe.More(); aItLFUniqe.Next()) {
-            aBB.Add(aUniqeFaces, aItLFUniqe.Value());
-          }
-          //
-          AddWarning (new BOPAlgo_AlertRemovalOfIBForSolidsFailed (aUniqeFaces));
+      continue;
+    }
+    //
+    if (aUS.HasErrors() || aUS.Areas().Extent() != 1) {
+      // add the warning
+      {
+        TopoDS_Compound aUniqeFaces;
+        aBB.MakeCompound(aUniqeFaces);
+        TopTools_ListIteratorOfListOfShape aItLFUniqe(aUS.Shapes());
+        for (; aItLFUniqe.More(); aItLFUniqe.Next()) {
+          aBB.Add(aUniqeFaces, aItLFUniqe.Value());
         }
         //
-        aItS.Initialize(aCB);
-        for (; aItS.More(); aItS.Next()) {
-          theLSNew.Append(aItS.Value());
-        }
-        continue;
+        AddWarning (new BOPAlgo_AlertRemovalOfIBForSolidsFailed (aUniqeFaces));
       }
       //
-      myReport->Merge(aBS.GetReport());
-      //
-      TopoDS_Solid& aSNew = *(TopoDS_Solid*)&aBS.Areas().First();
-      //
-      // put all internal parts into new solid
-      aSNew.Free(Standard_True);
-      TopTools_ListIteratorOfListOfShape aItLSI(aLSInt);
-      for (; aItLSI.More(); aItLSI.Next()) {
-        aBB.Add(aSNew, aItLSI.Value());
+      for (; aItS.More(); aItS.Next()) {
+        aLSNew.Append(aItS.Value());
       }
-      aSNew.Free(Standard_False);
-      //
-      theLSNew.Append(aSNew);
-      bRemoved = Standard_True;
-
-      // Save information about the fuse of the solids into a history map
-      aItS.Initialize(aCB);
-      for (; aItS.More(); aItS.Next())
-        myMapModified.Bind(aItS.Value(), aSNew);
+      continue;
     }
+    //
+    myReport->Merge(aUS.GetReport());
+    //
+    TopoDS_Solid& aSNew = *(TopoDS_Solid*)&aUS.Areas().First();
+    //
+    // put all internal parts into new solid
+    aSNew.Free(Standard_True);
+    TopTools_ListIteratorOfListOfShape aItLSI(aUS.Internals());
+    for (; aItLSI.More(); aItLSI.Next()) {
+      aBB.Add(aSNew, aItLSI.Value());
+    }
+    aSNew.Free(Standard_False);
+    //
+    aLSNew.Append(aSNew);
+    theRemoved(aUS.Group()) = Standard_True;
+
+    // Save information about the fuse of the solids into a history map
+    for (; aItS.More(); aItS.Next())
+      myMapModified.Bind(aItS.Value(), aSNew);
   }
-  return bRemoved;
 }
 
 //=======================================================================
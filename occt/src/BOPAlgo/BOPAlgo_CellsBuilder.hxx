@@ -27,6 +27,7 @@
 #include <TopTools_DataMapOfIntegerListOfShape.hxx>
 #include <TopTools_DataMapOfShapeInteger.hxx>
 #include <TopTools_DataMapOfShapeShape.hxx>
+#include <NCollection_Vector.hxx>
 
 //! The algorithm is based on the General Fuse algorithm (GFA).
 //! The result of GFA is all split parts of the Arguments.
@@ -254,6 +255,15 @@ class BOPAlgo_CellsBuilder : public BOPAlgo_Builder
                                                    TopTools_ListOfShape& theLSNew,
                                                    const TopTools_MapOfShape& theMapKeepBnd = TopTools_MapOfShape());
 
+  //! Removes internal faces between the solids of the same material
+  //! for several groups of solids (one group per material) at once.
+  //! The unified solids for the connexity blocks of all groups are built in parallel.<br>
+  //! <theLLSNew> receives the new solids of each group, <theRemoved> - the flags
+  //! of the groups in which any internal faces have been removed.
+  Standard_EXPORT void RemoveInternalsOfSolids(const NCollection_Vector<TopTools_ListOfShape>& theLLS,
+                                               NCollection_Vector<TopTools_ListOfShape>& theLLSNew,
+                                               NCollection_Vector<Standard_Boolean>& theRemoved);
+
   // fields
   TopoDS_Shape myAllParts;                           //!< All split parts of the arguments
   TopTools_IndexedDataMapOfShapeListOfShape myIndex; //!< Connection map from all splits parts to the argument shapes from which they were created
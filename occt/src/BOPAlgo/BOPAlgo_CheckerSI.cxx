@@ -25,6 +25,7 @@
 #include <BOPDS_MapOfPair.hxx>
 #include <BOPDS_Pair.hxx>
 #include <BOPDS_PIteratorSI.hxx>
+#include <BOPDS_Tools.hxx>
 #include <BOPDS_VectorOfInterfEF.hxx>
 #include <BOPDS_VectorOfInterfFF.hxx>
 #include <BOPDS_VectorOfInterfVE.hxx>
@@ -104,6 +105,32 @@ class BOPAlgo_FaceSelfIntersect :
 
 typedef NCollection_Vector<BOPAlgo_FaceSelfIntersect> BOPAlgo_VectorOfFaceSelfIntersect;
 
+//! Number of portions of Face/Face pairs checked in the early exit or budgeted mode
+static const Standard_Integer THE_NB_PORTIONS = 16;
+//! Minimal number of Face/Face pairs in the portion
+static const Standard_Integer THE_MIN_PORTION_SIZE = 32;
+
+//=======================================================================
+//function : HasInterfOfSourceShapes
+//purpose  : Returns true if the interferences starting from the given
+//           index contain the interference of the source shapes
+//=======================================================================
+template <class InterfVector>
+static Standard_Boolean HasInterfOfSourceShapes (const InterfVector& theInterfs,
+                                                 const BOPDS_DS& theDS,
+                                                 Standard_Integer& theNbScanned)
+{
+  Standard_Boolean bFound = Standard_False;
+  const Standard_Integer aNb = theInterfs.Length();
+  for (; !bFound && theNbScanned < aNb; ++theNbScanned)
+  {
+    Standard_Integer n1, n2;
+    theInterfs (theNbScanned).Indices (n1, n2);
+    bFound = !theDS.IsNewShape (n1) && !theDS.IsNewShape (n2);
+  }
+  return bFound;
+}
+
 //=======================================================================
 //function : 
 //purpose  : 
@@ -115,6 +142,18 @@ BOPAlgo_CheckerSI::BOPAlgo_CheckerSI()
   myLevelOfCheck=BOPDS_DS::NbInterfTypes()-1;
   myNonDestructive=Standard_True;
   SetAvoidBuildPCurve(Standard_True);
+  //
+  myStopOnFirst = Standard_False;
+  myTimeBudget = 0.;
+  myIsFound = Standard_False;
+  myIsBudgetExhausted = Standard_False;
+  myIsComplete = Standard_True;
+  myNbCandidates.Resize (0, BOPDS_DS::NbInterfTypes() - 1, Standard_False);
+  myNbCandidates.Init (0);
+  myNbChecked.Resize (0, BOPDS_DS::NbInterfTypes() - 1, Standard_False);
+  myNbChecked.Init (0);
+  myNbScanned.Resize (0, BOPDS_DS::NbInterfTypes() - 1, Standard_False);
+  myNbScanned.Init (0);
 }
 //=======================================================================
 //function : ~
@@ -159,6 +198,37 @@ void BOPAlgo_CheckerSI::Init(const Message_ProgressRange& /*theRange*/)
   theIterSI->UpdateByLevelOfCheck(myLevelOfCheck);
   //
   myIterator=theIterSI;
+  //
+  // 4. coverage of the check
+  for (Standard_Integer i = myNbCandidates.Lower(); i <= myNbCandidates.Upper(); ++i) {
+    myNbCandidates(i) = theIterSI->NbPairs(i);
+  }
+  myNbChecked.Init(0);
+  myNbScanned.Init(0);
+}
+//=======================================================================
+//function : NbCandidates
+//purpose  : 
+//=======================================================================
+Standard_Integer BOPAlgo_CheckerSI::NbCandidates() const
+{
+  Standard_Integer aNb = 0;
+  for (Standard_Integer i = myNbCandidates.Lower(); i <= myNbCandidates.Upper(); ++i) {
+    aNb += myNbCandidates(i);
+  }
+  return aNb;
+}
+//=======================================================================
+//function : NbChecked
+//purpose  : 
+//=======================================================================
+Standard_Integer BOPAlgo_CheckerSI::NbChecked() const
+{
+  Standard_Integer aNb = 0;
+  for (Standard_Integer i = myNbChecked.Lower(); i <= myNbChecked.Upper(); ++i) {
+    aNb += myNbChecked(i);
+  }
+  return aNb;
 }
 //=======================================================================
 //function : Perform
@@ -174,6 +244,12 @@ void BOPAlgo_CheckerSI::Perform(const Message_ProgressRange& theRange)
       return;
     }
     //
+    myIsFound = Standard_False;
+    myIsBudgetExhausted = Standard_False;
+    myIsComplete = Standard_True;
+    myTimer.Reset();
+    myTimer.Start();
+    //
     Message_ProgressScope aPS(theRange, "Checking shape on self-intersection", 10);
     // Perform intersection of sub shapes
     BOPAlgo_PaveFiller::Perform(aPS.Next(8));
@@ -182,27 +258,53 @@ void BOPAlgo_CheckerSI::Perform(const Message_ProgressRange& theRange)
       return;
     }
     //
-    CheckFaceSelfIntersection(aPS.Next());
+    // the self-intersection of faces is checked along with Face/Face pairs
+    if (!ToStop(5)) {
+      CheckFaceSelfIntersection(aPS.Next());
+      if (myStopOnFirst && !myDS->Interferences().IsEmpty()) {
+        myIsFound = Standard_True;
+      }
+    }
+    else if (myLevelOfCheck >= 5) {
+      // clear the interferences collected during intersection
+      // of sub-shapes as CheckFaceSelfIntersection() does,
+      // the confirmed ones are added in PostTreat()
+      ((BOPDS_MapOfPair*)&myDS->Interferences())->Clear();
+    }
     
     Message_ProgressScope aPSZZ(aPS.Next(), NULL, 4);
     // Perform intersection with solids
-    if (!HasErrors())
+    if (!HasErrors() && !ToStop(6)) {
       PerformVZ(aPSZZ.Next());
+      SetChecked(6);
+    }
     //
-    if (!HasErrors())
+    if (!HasErrors() && !ToStop(7)) {
       PerformEZ(aPSZZ.Next());
+      SetChecked(7);
+    }
     //
-    if (!HasErrors())
+    if (!HasErrors() && !ToStop(8)) {
       PerformFZ(aPSZZ.Next());
+      SetChecked(8);
+    }
     //
-    if (!HasErrors())
+    if (!HasErrors() && !ToStop(9)) {
       PerformZZ(aPSZZ.Next());
+      SetChecked(9);
+    }
+    //
+    myTimer.Stop();
     //
     if (HasErrors())
       return;
 
     // Treat the intersection results
     PostTreat();
+    //
+    if (myIsBudgetExhausted && !myIsComplete) {
+      AddWarning (new BOPAlgo_AlertCheckBudgetExhausted);
+    }
   }
   //
   catch (Standard_Failure const&) {
@@ -210,6 +312,175 @@ void BOPAlgo_CheckerSI::Perform(const Message_ProgressRange& theRange)
   }
 }
 //=======================================================================
+//function : PerformVV
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformVV(const Message_ProgressRange& theRange)
+{
+  if (ToStop(0))
+    return;
+  BOPAlgo_PaveFiller::PerformVV(theRange);
+  SetChecked(0);
+}
+//=======================================================================
+//function : PerformVE
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformVE(const Message_ProgressRange& theRange)
+{
+  if (ToStop(1))
+    return;
+  BOPAlgo_PaveFiller::PerformVE(theRange);
+  SetChecked(1);
+}
+//=======================================================================
+//function : PerformEE
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformEE(const Message_ProgressRange& theRange)
+{
+  if (ToStop(2))
+    return;
+  BOPAlgo_PaveFiller::PerformEE(theRange);
+  SetChecked(2);
+}
+//=======================================================================
+//function : PerformVF
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformVF(const Message_ProgressRange& theRange)
+{
+  if (ToStop(3))
+    return;
+  BOPAlgo_PaveFiller::PerformVF(theRange);
+  SetChecked(3);
+}
+//=======================================================================
+//function : PerformEF
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformEF(const Message_ProgressRange& theRange)
+{
+  if (ToStop(4))
+    return;
+  BOPAlgo_PaveFiller::PerformEF(theRange);
+  SetChecked(4);
+}
+//=======================================================================
+//function : PerformFF
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformFF(const Message_ProgressRange& theRange)
+{
+  if (ToStop(5))
+    return;
+  //
+  if (!myStopOnFirst && myTimeBudget <= 0.) {
+    BOPAlgo_PaveFiller::PerformFF(theRange);
+    SetChecked(5);
+    return;
+  }
+  //
+  // Intersect the faces by portions, starting from the pairs
+  // most likely to interfere, to be able to stop in between
+  BOPDS_PIteratorSI anIterSI = (BOPDS_PIteratorSI)myIterator;
+  const Standard_Integer aNbFF = anIterSI->OrderByLikelihood(TopAbs_FACE, TopAbs_FACE);
+  const Standard_Integer aSize = Max(THE_MIN_PORTION_SIZE,
+                                     (aNbFF + THE_NB_PORTIONS - 1) / THE_NB_PORTIONS);
+  // at least one portion is processed to update the faces information
+  const Standard_Integer aNbPortions = Max(1, (aNbFF + aSize - 1) / aSize);
+  //
+  Message_ProgressScope aPS(theRange, NULL, aNbPortions);
+  for (Standard_Integer i = 0; i < aNbPortions; ++i) {
+    if (i > 0 && ToStop(5)) {
+      break;
+    }
+    //
+    const Standard_Integer aFirst = i * aSize;
+    anIterSI->SelectPortion(TopAbs_FACE, TopAbs_FACE, aFirst, aSize);
+    BOPAlgo_PaveFiller::PerformFF(aPS.Next());
+    if (HasErrors()) {
+      return;
+    }
+    //
+    myNbChecked(5) += Min(aSize, aNbFF - aFirst);
+    UpdateStopConditions();
+  }
+}
+//=======================================================================
+//function : ToStop
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPAlgo_CheckerSI::ToStop(const Standard_Integer theInterfType)
+{
+  if (!(myStopOnFirst && myIsFound) && !myIsBudgetExhausted) {
+    return Standard_False;
+  }
+  //
+  // the faces are checked on self-intersection along with the Face/Face pairs
+  if (myNbChecked(theInterfType) < myNbCandidates(theInterfType) ||
+      (theInterfType == 5 && myLevelOfCheck >= 5)) {
+    myIsComplete = Standard_False;
+  }
+  return Standard_True;
+}
+//=======================================================================
+//function : SetChecked
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::SetChecked(const Standard_Integer theInterfType)
+{
+  myNbChecked(theInterfType) = myNbCandidates(theInterfType);
+  UpdateStopConditions();
+}
+//=======================================================================
+//function : UpdateStopConditions
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::UpdateStopConditions()
+{
+  if (myTimeBudget > 0. && myTimer.ElapsedTime() > myTimeBudget) {
+    myIsBudgetExhausted = Standard_True;
+  }
+  //
+  if (!myStopOnFirst || myIsFound) {
+    return;
+  }
+  //
+  // Only the interferences of the source shapes not requiring
+  // any post treatment are considered as confirmed (see PostTreat())
+  const BOPDS_DS& aDS = *myDS;
+  myIsFound =
+    HasInterfOfSourceShapes(myDS->InterfVV(), aDS, myNbScanned(0)) ||
+    HasInterfOfSourceShapes(myDS->InterfVE(), aDS, myNbScanned(1)) ||
+    HasInterfOfSourceShapes(myDS->InterfEE(), aDS, myNbScanned(2)) ||
+    HasInterfOfSourceShapes(myDS->InterfVF(), aDS, myNbScanned(3)) ||
+    HasInterfOfSourceShapes(myDS->InterfVZ(), aDS, myNbScanned(6)) ||
+    HasInterfOfSourceShapes(myDS->InterfEZ(), aDS, myNbScanned(7)) ||
+    HasInterfOfSourceShapes(myDS->InterfFZ(), aDS, myNbScanned(8)) ||
+    HasInterfOfSourceShapes(myDS->InterfZZ(), aDS, myNbScanned(9));
+  //
+  Standard_Integer n1, n2;
+  BOPDS_VectorOfInterfEF& aEFs = myDS->InterfEF();
+  for (; !myIsFound && myNbScanned(4) < aEFs.Length(); ++myNbScanned(4)) {
+    const BOPDS_InterfEF& aEF = aEFs(myNbScanned(4));
+    aEF.Indices(n1, n2);
+    myIsFound = aEF.CommonPart().Type() != TopAbs_SHAPE &&
+                !myDS->IsNewShape(n1) && !myDS->IsNewShape(n2);
+  }
+  //
+  // The intersection of the adjacent faces may be the common edge, thus
+  // only the faces without common vertices are confirmed to interfere
+  BOPDS_PIteratorSI anIterSI = (BOPDS_PIteratorSI)myIterator;
+  BOPDS_VectorOfInterfFF& aFFs = myDS->InterfFF();
+  for (; !myIsFound && myNbScanned(5) < aFFs.Length(); ++myNbScanned(5)) {
+    const BOPDS_InterfFF& aFF = aFFs(myNbScanned(5));
+    aFF.Indices(n1, n2);
+    myIsFound = (aFF.Curves().Length() || aFF.Points().Length()) &&
+                !anIterSI->HasCommonVertex(n1, n2);
+  }
+}
+//=======================================================================
 //function : PostTreat
 //purpose  : 
 //=======================================================================
@@ -23,6 +23,8 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_PaveFiller.hxx>
+#include <OSD_Timer.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 
 
 //! Checks the shape on self-interference.
@@ -33,6 +35,19 @@
 //! In case the error has occurred during intersection of sub-shapes, i.e.
 //! in BOPAlgo_PaveFiller::PerformInternal() method, the errors from this method
 //! directly will be returned.
+//!
+//! The algorithm can set the following warnings:
+//! - *BOPAlgo_AlertCheckBudgetExhausted* - The time budget of the check has been
+//!   exhausted and not all candidate pairs of sub-shapes have been checked.
+//!
+//! By default all pairs of sub-shapes with interfering bounding boxes are checked.
+//! The check may be used as a cheap validity gate by requesting to stop it at the
+//! first confirmed interference (see SetStopOnFirst()) and/or by limiting the time
+//! spent on the check (see SetTimeBudget()). In this mode the Face/Face pairs, the
+//! most costly ones, are checked by portions starting from the pairs most likely
+//! to interfere (see BOPDS_IteratorSI::OrderByLikelihood()) and the stop conditions
+//! are verified after each portion and after each type of interferences.
+//! The coverage of the check is reported by NbCandidates(), NbChecked() and IsComplete().
 
 class BOPAlgo_CheckerSI  : public BOPAlgo_PaveFiller
 {
@@ -60,6 +75,33 @@ public:
   //! 9 - V/V, V/E, E/E, V/F, E/F, F/F, V/S, E/S, F/S and S/S - all interferences (Default value)
   Standard_EXPORT void SetLevelOfCheck (const Standard_Integer theLevel);
 
+public: //! @name Early exit and time budget
+
+  //! Sets the flag to stop the check at the first confirmed interference.
+  //! Disabled by default.
+  void SetStopOnFirst (const Standard_Boolean theFlag) { myStopOnFirst = theFlag; }
+
+  //! Returns the flag to stop the check at the first confirmed interference.
+  Standard_Boolean StopOnFirst() const { return myStopOnFirst; }
+
+  //! Sets the time budget of the check, in seconds of wall clock time.
+  //! Zero or negative value means no limit (default).
+  void SetTimeBudget (const Standard_Real theTime) { myTimeBudget = theTime; }
+
+  //! Returns the time budget of the check.
+  Standard_Real TimeBudget() const { return myTimeBudget; }
+
+  //! Returns the number of pairs of sub-shapes with interfering bounding boxes
+  //! selected for the check by the last call to Perform().
+  Standard_EXPORT Standard_Integer NbCandidates() const;
+
+  //! Returns the number of the candidate pairs checked by the last call to Perform().
+  Standard_EXPORT Standard_Integer NbChecked() const;
+
+  //! Returns TRUE if the last check has not been stopped before checking all the
+  //! candidates, either at the first confirmed interference or by the time budget.
+  Standard_Boolean IsComplete() const { return myIsComplete; }
+
 protected:
 
   Standard_EXPORT virtual void Init(const Message_ProgressRange& theRange) Standard_OVERRIDE;
@@ -86,7 +128,44 @@ protected:
   //! Used for intersection of edges and faces with solids
   Standard_EXPORT virtual void PerformSZ(const TopAbs_ShapeEnum aTS, const Message_ProgressRange& theRange);
 
+protected: //! @name Intersection of sub-shapes with verification of the stop conditions
+
+  Standard_EXPORT virtual void PerformVV(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  Standard_EXPORT virtual void PerformVE(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  Standard_EXPORT virtual void PerformEE(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  Standard_EXPORT virtual void PerformVF(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  Standard_EXPORT virtual void PerformEF(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  //! Performs Face/Face intersection; in the early exit or budgeted mode
+  //! the pairs are intersected by portions, most probable interferences first.
+  Standard_EXPORT virtual void PerformFF(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  //! Returns TRUE if the stop conditions have been met before checking the
+  //! interferences of the given type (see BOPDS_Tools::TypeToInteger()).
+  //! In this case the check is marked as incomplete if there are unchecked pairs of this type.
+  Standard_EXPORT Standard_Boolean ToStop (const Standard_Integer theInterfType);
+
+  //! Marks the pairs of the given type as checked and updates the stop conditions.
+  Standard_EXPORT void SetChecked (const Standard_Integer theInterfType);
+
+  //! Looks for the confirmed interferences among the ones computed since the
+  //! previous call and verifies the time budget.
+  Standard_EXPORT void UpdateStopConditions();
+
   Standard_Integer myLevelOfCheck;
+  Standard_Boolean myStopOnFirst;            //!< Stop at the first confirmed interference
+  Standard_Real myTimeBudget;                //!< Time budget of the check
+  OSD_Timer myTimer;                         //!< Timer of the check
+  Standard_Boolean myIsFound;                //!< A confirmed interference has been found
+  Standard_Boolean myIsBudgetExhausted;      //!< The time budget is exhausted
+  Standard_Boolean myIsComplete;             //!< All candidates have been checked
+  TColStd_Array1OfInteger myNbCandidates;    //!< Number of candidate pairs per interference type
+  TColStd_Array1OfInteger myNbChecked;       //!< Number of checked pairs per interference type
+  TColStd_Array1OfInteger myNbScanned;       //!< Number of interferences scanned for the confirmed ones
 
 private:
 
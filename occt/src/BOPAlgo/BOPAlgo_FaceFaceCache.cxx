@@ -0,0 +1,216 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BOPAlgo_FaceFaceCache.hxx>
+
+#include <Geom_Curve.hxx>
+#include <Geom2d_Curve.hxx>
+#include <IntTools_Curve.hxx>
+#include <IntTools_PntOn2Faces.hxx>
+#include <IntTools_PntOnFace.hxx>
+#include <Precision.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+namespace
+{
+  //! Returns the transformation of the location of the face
+  static gp_Trsf faceTrsf (const TopoDS_Face& theFace)
+  {
+    return theFace.Location().Transformation();
+  }
+
+  //! Compares the transformations with the tolerance
+  //! sufficient to take into account rounding errors only
+  static Standard_Boolean isSameTrsf (const gp_Trsf& theT1,
+                                      const gp_Trsf& theT2)
+  {
+    if ((theT1.TranslationPart() - theT2.TranslationPart()).SquareModulus() >
+        Precision::SquareConfusion() * 1.e-4)
+      return Standard_False;
+    if (Abs (theT1.ScaleFactor() - theT2.ScaleFactor()) > Precision::Angular())
+      return Standard_False;
+
+    const gp_Mat aM1 = theT1.HVectorialPart(), aM2 = theT2.HVectorialPart();
+    for (Standard_Integer i = 1; i <= 3; ++i)
+    {
+      for (Standard_Integer j = 1; j <= 3; ++j)
+      {
+        if (Abs (aM1 (i, j) - aM2 (i, j)) > Precision::Angular())
+          return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+}
+
+//=======================================================================
+//function : BOPAlgo_FaceFaceCache
+//purpose  : 
+//=======================================================================
+BOPAlgo_FaceFaceCache::BOPAlgo_FaceFaceCache (const Standard_Integer theMaxAge)
+: myMaxAge (Max (theMaxAge, 1)),
+  myRun (0),
+  myNbEntries (0),
+  myNbHits (0)
+{
+}
+
+//=======================================================================
+//function : Find
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPAlgo_FaceFaceCache::Find (const TopoDS_Face& theFace1,
+                                              const TopoDS_Face& theFace2,
+                                              const Parameters& theParams,
+                                              Standard_Boolean& theTangentFaces,
+                                              IntTools_SequenceOfCurves& theCurves,
+                                              IntTools_SequenceOfPntOn2Faces& thePoints)
+{
+  ListOfEntry* pEntries = myEntries.ChangeSeek (theFace1.Located (TopLoc_Location()));
+  if (!pEntries)
+    return Standard_False;
+
+  const gp_Trsf aT1 = faceTrsf (theFace1);
+  const gp_Trsf aRelTrsf = aT1.Inverted() * faceTrsf (theFace2);
+  const TopoDS_Shape aF2 = theFace2.Located (TopLoc_Location());
+
+  for (ListOfEntry::Iterator aIt (*pEntries); aIt.More(); aIt.Next())
+  {
+    Entry& anEntry = aIt.ChangeValue();
+    if (!anEntry.Face2.IsEqual (aF2) ||
+        anEntry.Orientation1 != theFace1.Orientation() ||
+        !anEntry.Params.IsEqual (theParams) ||
+        !isSameTrsf (anEntry.RelativeTrsf, aRelTrsf))
+      continue;
+
+    theTangentFaces = anEntry.TangentFaces;
+    transformResults (anEntry.Curves, anEntry.Points, aT1, theCurves, thePoints);
+    anEntry.LastRun = myRun;
+    ++myNbHits;
+    return Standard_True;
+  }
+  return Standard_False;
+}
+
+//=======================================================================
+//function : Add
+//purpose  : 
+//=======================================================================
+void BOPAlgo_FaceFaceCache::Add (const TopoDS_Face& theFace1,
+                                 const TopoDS_Face& theFace2,
+                                 const Parameters& theParams,
+                                 const Standard_Boolean theTangentFaces,
+                                 const IntTools_SequenceOfCurves& theCurves,
+                                 const IntTools_SequenceOfPntOn2Faces& thePoints)
+{
+  const TopoDS_Shape aF1 = theFace1.Located (TopLoc_Location());
+  ListOfEntry* pEntries = myEntries.ChangeSeek (aF1);
+  if (!pEntries)
+    pEntries = myEntries.Bound (aF1, ListOfEntry());
+
+  const gp_Trsf aT1 = faceTrsf (theFace1);
+
+  Entry& anEntry = pEntries->Append (Entry());
+  anEntry.Face2 = TopoDS::Face (theFace2.Located (TopLoc_Location()));
+  anEntry.Orientation1 = theFace1.Orientation();
+  anEntry.RelativeTrsf = aT1.Inverted() * faceTrsf (theFace2);
+  anEntry.Params = theParams;
+  anEntry.TangentFaces = theTangentFaces;
+  transformResults (theCurves, thePoints, aT1.Inverted(), anEntry.Curves, anEntry.Points);
+  anEntry.LastRun = myRun;
+  ++myNbEntries;
+}
+
+//=======================================================================
+//function : NextRun
+//purpose  : 
+//=======================================================================
+void BOPAlgo_FaceFaceCache::NextRun()
+{
+  ++myRun;
+  const Standard_Integer anOldest = myRun - myMaxAge;
+
+  TopTools_ListOfShape anEmpty;
+  for (DataMapOfFaceEntries::Iterator aItM (myEntries); aItM.More(); aItM.Next())
+  {
+    ListOfEntry& aEntries = aItM.ChangeValue();
+    for (ListOfEntry::Iterator aIt (aEntries); aIt.More();)
+    {
+      if (aIt.Value().LastRun < anOldest)
+      {
+        aEntries.Remove (aIt);
+        --myNbEntries;
+      }
+      else
+        aIt.Next();
+    }
+    if (aEntries.IsEmpty())
+      anEmpty.Append (aItM.Key());
+  }
+
+  for (TopTools_ListOfShape::Iterator aIt (anEmpty); aIt.More(); aIt.Next())
+    myEntries.UnBind (aIt.Value());
+}
+
+//=======================================================================
+//function : Clear
+//purpose  : 
+//=======================================================================
+void BOPAlgo_FaceFaceCache::Clear()
+{
+  myEntries.Clear();
+  myNbEntries = 0;
+  myNbHits = 0;
+}
+
+//=======================================================================
+//function : transformResults
+//purpose  : 
+//=======================================================================
+void BOPAlgo_FaceFaceCache::transformResults (const IntTools_SequenceOfCurves& theCurves,
+                                              const IntTools_SequenceOfPntOn2Faces& thePoints,
+                                              const gp_Trsf& theTrsf,
+                                              IntTools_SequenceOfCurves& theTCurves,
+                                              IntTools_SequenceOfPntOn2Faces& theTPoints)
+{
+  // The curves are modified by the intersection algorithm,
+  // so the copies are made even for identity transformation
+  theTCurves.Clear();
+  for (IntTools_SequenceOfCurves::Iterator aIt (theCurves); aIt.More(); aIt.Next())
+  {
+    IntTools_Curve aIC = aIt.Value();
+    if (!aIC.Curve().IsNull())
+      aIC.SetCurve (Handle(Geom_Curve)::DownCast (aIC.Curve()->Transformed (theTrsf)));
+    if (!aIC.FirstCurve2d().IsNull())
+      aIC.SetFirstCurve2d (Handle(Geom2d_Curve)::DownCast (aIC.FirstCurve2d()->Copy()));
+    if (!aIC.SecondCurve2d().IsNull())
+      aIC.SetSecondCurve2d (Handle(Geom2d_Curve)::DownCast (aIC.SecondCurve2d()->Copy()));
+    theTCurves.Append (aIC);
+  }
+
+  theTPoints.Clear();
+  for (IntTools_SequenceOfPntOn2Faces::Iterator aIt (thePoints); aIt.More(); aIt.Next())
+  {
+    IntTools_PntOn2Faces aP2F = aIt.Value();
+    IntTools_PntOnFace aPOnF1 = aP2F.P1(), aPOnF2 = aP2F.P2();
+    aPOnF1.SetPnt (aPOnF1.Pnt().Transformed (theTrsf));
+    aPOnF2.SetPnt (aPOnF2.Pnt().Transformed (theTrsf));
+    aP2F.SetP1 (aPOnF1);
+    aP2F.SetP2 (aPOnF2);
+    theTPoints.Append (aP2F);
+  }
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BOPAlgo_FaceFaceCache_HeaderFile
+#define _BOPAlgo_FaceFaceCache_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_Handle.hxx>
+#include <Standard_Transient.hxx>
+
+#include <gp_Trsf.hxx>
+#include <IntTools_SequenceOfCurves.hxx>
+#include <IntTools_SequenceOfPntOn2Faces.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+class BOPAlgo_FaceFaceCache;
+DEFINE_STANDARD_HANDLE(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+//! Cache of the results of Face/Face intersections, shared by the consecutive runs
+//! of the intersection algorithm (see BOPAlgo_PaveFiller::SetFaceFaceCache()).
+//!
+//! The results are stored in the coordinate system of the first face, thus
+//! they are reused for the same pair of faces (the same TShapes and orientations)
+//! in the same relative position, independently on the absolute position of the pair.
+//! E.g. when the tool is moved back to one of its previous placements, or the object
+//! and the tool are moved together, the faces are not intersected again.
+//!
+//! The results of intersection depend also on the parameters of intersection
+//! (see BOPAlgo_FaceFaceCache::Parameters), which are the parts of the key. The starting points of intersection (obtained from
+//! the Edge/Face interferences of the same faces) are defined by the relative position
+//! of the faces as well.
+//!
+//! The entries not used during the last MaxAge() runs are removed by NextRun().
+class BOPAlgo_FaceFaceCache : public Standard_Transient
+{
+public:
+
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+  //! Parameters of intersection the results are valid for
+  struct Parameters
+  {
+    Standard_Real TolFF;              //!< Intersection tolerance
+    Standard_Real FuzzyValue;         //!< Fuzzy value
+    Standard_Real ApproxTol;          //!< Approximation tolerance
+    Standard_Boolean Approximation;   //!< Approximation of the curves
+    Standard_Boolean PCurveOnS1;      //!< Computation of 2D curves on the first face
+    Standard_Boolean PCurveOnS2;      //!< Computation of 2D curves on the second face
+    Standard_Boolean FastPlanar;      //!< Fast intersection of planar faces
+
+    Parameters()
+    : TolFF (0.), FuzzyValue (0.), ApproxTol (0.),
+      Approximation (Standard_False), PCurveOnS1 (Standard_False),
+      PCurveOnS2 (Standard_False), FastPlanar (Standard_False)
+    {}
+
+    //! Returns TRUE if the parameters are exactly the same
+    Standard_Boolean IsEqual (const Parameters& theOther) const
+    {
+      return TolFF == theOther.TolFF
+          && FuzzyValue == theOther.FuzzyValue
+          && ApproxTol == theOther.ApproxTol
+          && Approximation == theOther.Approximation
+          && PCurveOnS1 == theOther.PCurveOnS1
+          && PCurveOnS2 == theOther.PCurveOnS2
+          && FastPlanar == theOther.FastPlanar;
+    }
+  };
+
+  //! Creates the empty cache keeping the entries for theMaxAge runs.
+  Standard_EXPORT BOPAlgo_FaceFaceCache (const Standard_Integer theMaxAge = 4);
+
+  //! Looks for the results of intersection of the faces in the same relative position.
+  //! The found curves and points are transformed to the current position of the faces.
+  //! @return TRUE if the results are found
+  Standard_EXPORT Standard_Boolean Find (const TopoDS_Face& theFace1,
+                                         const TopoDS_Face& theFace2,
+                                         const Parameters& theParams,
+                                         Standard_Boolean& theTangentFaces,
+                                         IntTools_SequenceOfCurves& theCurves,
+                                         IntTools_SequenceOfPntOn2Faces& thePoints);
+
+  //! Stores the results of intersection of the faces.
+  Standard_EXPORT void Add (const TopoDS_Face& theFace1,
+                            const TopoDS_Face& theFace2,
+                            const Parameters& theParams,
+                            const Standard_Boolean theTangentFaces,
+                            const IntTools_SequenceOfCurves& theCurves,
+                            const IntTools_SequenceOfPntOn2Faces& thePoints);
+
+  //! Starts the next run: removes the entries which have not been used
+  //! during the last MaxAge() runs.
+  Standard_EXPORT void NextRun();
+
+  //! Removes all entries.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of stored intersections.
+  Standard_Integer Extent() const { return myNbEntries; }
+
+  //! Returns the number of intersections reused from the cache.
+  Standard_Integer NbHits() const { return myNbHits; }
+
+  //! Returns the number of runs the unused entries are kept for.
+  Standard_Integer MaxAge() const { return myMaxAge; }
+
+protected:
+
+  //! Stored results of intersection of two faces
+  struct Entry
+  {
+    TopoDS_Face Face2;                       //!< Second face (without location)
+    TopAbs_Orientation Orientation1;         //!< Orientation of the first face
+    gp_Trsf RelativeTrsf;                    //!< Position of the second face relatively the first one
+    Parameters Params;                       //!< Parameters of intersection
+    Standard_Boolean TangentFaces;           //!< Tangency flag
+    IntTools_SequenceOfCurves Curves;        //!< Curves in the coordinate system of the first face
+    IntTools_SequenceOfPntOn2Faces Points;   //!< Points in the coordinate system of the first face
+    Standard_Integer LastRun;                //!< Index of the run the entry has been used last time
+  };
+
+  typedef NCollection_List<Entry> ListOfEntry;
+  typedef NCollection_DataMap<TopoDS_Shape, ListOfEntry, TopTools_ShapeMapHasher> DataMapOfFaceEntries;
+
+  //! Copies the curves and points applying the transformation.
+  Standard_EXPORT static void transformResults (const IntTools_SequenceOfCurves& theCurves,
+                                                const IntTools_SequenceOfPntOn2Faces& thePoints,
+                                                const gp_Trsf& theTrsf,
+                                                IntTools_SequenceOfCurves& theTCurves,
+                                                IntTools_SequenceOfPntOn2Faces& theTPoints);
+
+protected:
+
+  DataMapOfFaceEntries myEntries; //!< Entries by the first face (without location)
+  Standard_Integer myMaxAge;
+  Standard_Integer myRun;
+  Standard_Integer myNbEntries;
+  Standard_Integer myNbHits;
+
+};
+
+#endif // _BOPAlgo_FaceFaceCache_HeaderFile
@@ -93,6 +93,9 @@ void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetAdaptiveOBB(myAdaptiveOBB);
+  pPF->SetFastPlanar(myFastPlanar);
+  pPF->SetProfile(myProfile);
   pPF->Perform(aPS.Next(anInterPart));
   //
   myEntryPoint = 1;
@@ -52,7 +52,9 @@ BOPAlgo_Options::BOPAlgo_Options()
   myReport(new Message_Report),
   myRunParallel(myGlobalRunParallel),
   myFuzzyValue(Precision::Confusion()),
-  myUseOBB(Standard_False)
+  myUseOBB(Standard_False),
+  myAdaptiveOBB(Standard_True),
+  myFastPlanar(Standard_True)
 {
   BOPAlgo_LoadMessages();
 }
@@ -68,7 +70,9 @@ BOPAlgo_Options::BOPAlgo_Options
   myReport(new Message_Report),
   myRunParallel(myGlobalRunParallel),
   myFuzzyValue(Precision::Confusion()),
-  myUseOBB(Standard_False)
+  myUseOBB(Standard_False),
+  myAdaptiveOBB(Standard_True),
+  myFastPlanar(Standard_True)
 {
   BOPAlgo_LoadMessages();
 }
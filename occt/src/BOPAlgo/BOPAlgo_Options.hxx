@@ -15,6 +15,7 @@
 #ifndef _BOPAlgo_Options_HeaderFile
 #define _BOPAlgo_Options_HeaderFile
 
+#include <BOPAlgo_Profile.hxx>
 #include <Message_Report.hxx>
 #include <Standard_OStream.hxx>
 
@@ -31,7 +32,12 @@ class Message_ProgressScope;
 //! - *Fuzzy tolerance* - additional tolerance for the operation to detect
 //!                       touching or coinciding cases;
 //! - *Using the Oriented Bounding Boxes* - Allows using the Oriented Bounding Boxes of the shapes
-//!                          for filtering the intersections.
+//!                          for filtering the intersections. By default the OBBs are used adaptively,
+//!                          i.e. only when the axis-aligned boxes give many false candidates.
+//! - *Fast path for planar faces* - allows intersecting the Plane/Plane and Plane/Cylinder
+//!                                 pairs of faces in closed form (see IntTools_FaceFace::SetFastPlanar);
+//! - *Profiling* - allows collecting the timings of the stages of the operation
+//!                 and the counters of the intersections (see BOPAlgo_Profile).
 //!
 class BOPAlgo_Options
 {
@@ -165,6 +171,51 @@ public:
     return myUseOBB;
   }
 
+  //! Enables/Disables the adaptive usage of OBB when the usage of OBB is not
+  //! enabled explicitly: the OBBs filter the intersections only if the rate of false
+  //! candidates given by the axis-aligned boxes is high (see BOPDS_Iterator).
+  //! Enabled by default.
+  void SetAdaptiveOBB(const Standard_Boolean theAdaptiveOBB)
+  {
+    myAdaptiveOBB = theAdaptiveOBB;
+  }
+
+  //! Returns the flag defining adaptive usage of OBB
+  Standard_Boolean AdaptiveOBB() const
+  {
+    return myAdaptiveOBB;
+  }
+
+  //! Enables/Disables the closed form intersection of the Plane/Plane and
+  //! Plane/Cylinder pairs of faces bounded by lines and circles, bypassing
+  //! the general surface/surface intersection. Enabled by default.
+  void SetFastPlanar(const Standard_Boolean theFastPlanar)
+  {
+    myFastPlanar = theFastPlanar;
+  }
+
+  //! Returns the flag defining usage of the fast path for planar faces
+  Standard_Boolean FastPlanar() const
+  {
+    return myFastPlanar;
+  }
+
+public:
+  //!@name Profiling
+
+  //! Sets the profile collecting the timings and counters of the operation.
+  //! Null handle (default) disables profiling.
+  void SetProfile(const Handle(BOPAlgo_Profile)& theProfile)
+  {
+    myProfile = theProfile;
+  }
+
+  //! Returns the profile of the operation
+  const Handle(BOPAlgo_Profile)& Profile() const
+  {
+    return myProfile;
+  }
+
 protected:
 
   //! Adds error to the report if the break signal was caught. Returns true in this case, false otherwise.
@@ -177,6 +228,9 @@ protected:
   Standard_Boolean myRunParallel;
   Standard_Real myFuzzyValue;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myAdaptiveOBB;
+  Standard_Boolean myFastPlanar;
+  Handle(BOPAlgo_Profile) myProfile;
 
 };
 
@@ -66,6 +66,7 @@ BOPAlgo_PaveFiller::BOPAlgo_PaveFiller()
   myIsPrimary = Standard_True;
   myAvoidBuildPCurve = Standard_False;
   myGlue = BOPAlgo_GlueOff;
+  myPrecomputedBoxes = NULL;
 }
 //=======================================================================
 //function : 
@@ -86,6 +87,7 @@ BOPAlgo_PaveFiller::BOPAlgo_PaveFiller
   myIsPrimary = Standard_True;
   myAvoidBuildPCurve = Standard_False;
   myGlue = BOPAlgo_GlueOff;
+  myPrecomputedBoxes = NULL;
 }
 //=======================================================================
 //function : ~
@@ -199,6 +201,7 @@ void BOPAlgo_PaveFiller::SetSectionAttribute
 //=======================================================================
 void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope (myProfile, "PaveFiller::Init");
   if (!myArguments.Extent()) {
     AddError (new BOPAlgo_AlertTooFewArguments);
     return;
@@ -219,16 +222,33 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   // 1.myDS 
   myDS = new BOPDS_DS (myAllocator);
   myDS->SetArguments (myArguments);
+  myDS->SetPrecomputedBoxes (myPrecomputedBoxes);
   myDS->Init (myFuzzyValue);
   //
   // 2 myContext
-  myContext = new IntTools_Context;
+  myContext = mySharedContext;
+  if (myContext.IsNull()) {
+    myContext = new IntTools_Context;
+  }
+  // the contexts of the threads are kept while the main context is shared
+  myContextPool.SetContext (myContext);
   //
   // 3.myIterator 
   myIterator = new BOPDS_Iterator (myAllocator);
   myIterator->SetRunParallel (myRunParallel);
   myIterator->SetDS (myDS);
+  myIterator->SetAdaptiveOBB (myAdaptiveOBB);
   myIterator->Prepare (myContext, myUseOBB, myFuzzyValue);
+  if (!myProfile.IsNull()) {
+    // Statistics of the filtering of the candidates by oriented boxes
+    const BOPDS_Iterator::FilterStatistics& aStat = myIterator->Statistics();
+    myProfile->AddCounter ("AABB candidates", aStat.NbCandidates);
+    myProfile->AddCounter ("OBB sampled", aStat.NbSampled);
+    myProfile->AddCounter ("OBB tested", aStat.NbTested);
+    myProfile->AddCounter ("OBB rejected", aStat.NbRejectedOBB);
+    myProfile->AddCounter ("Hull rejected", aStat.NbRejectedHull);
+    myProfile->AddCounter ("OBB filtered runs", aStat.IsActive ? 1 : 0);
+  }
   //
   // 4 NonDestructive flag
   SetNonDestructive();
@@ -240,6 +260,7 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_PaveFiller::Perform (const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope (myProfile, "PaveFiller::Perform");
   try {
     OCC_CATCH_SIGNALS
       //
@@ -249,6 +270,17 @@ void BOPAlgo_PaveFiller::Perform (const Message_ProgressRange& theRange)
   catch (Standard_Failure const&) {
     AddError (new BOPAlgo_AlertIntersectionFailed);
   }
+  //
+  if (!myProfile.IsNull() && myDS) {
+    // Number of the real interferences to compare with the number of candidates;
+    // as all counters, they are accumulated over the runs sharing the profile
+    myProfile->AddCounter ("VV interferences", myDS->InterfVV().Length());
+    myProfile->AddCounter ("VE interferences", myDS->InterfVE().Length());
+    myProfile->AddCounter ("EE interferences", myDS->InterfEE().Length());
+    myProfile->AddCounter ("VF interferences", myDS->InterfVF().Length());
+    myProfile->AddCounter ("EF interferences", myDS->InterfEF().Length());
+    myProfile->AddCounter ("FF interferences", myDS->InterfFF().Length());
+  }
 }
 
 //=======================================================================
@@ -370,6 +402,7 @@ void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_PaveFiller::RepeatIntersection (const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope (myProfile, "PaveFiller::RepeatIntersection");
   // Find all vertices with increased tolerance
   TColStd_MapOfInteger anExtraInterfMap;
   const Standard_Integer aNbS = myDS->NbSourceShapes();
@@ -23,6 +23,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_Algo.hxx>
+#include <BOPAlgo_FaceFaceCache.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
 #include <BOPAlgo_SectionAttribute.hxx>
 #include <BOPDS_DataMapOfPaveBlockListOfPaveBlock.hxx>
@@ -36,6 +37,7 @@
 #include <BOPDS_PIterator.hxx>
 #include <BOPDS_VectorOfCurve.hxx>
 #include <BOPTools_BoxTree.hxx>
+#include <BOPTools_Parallel.hxx>
 #include <IntSurf_ListOfPntOn2S.hxx>
 #include <IntTools_ShrunkRange.hxx>
 #include <NCollection_BaseAllocator.hxx>
@@ -47,6 +49,7 @@
 #include <TColStd_ListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_DataMapOfShapeBox.hxx>
 #include <TopTools_DataMapOfShapeInteger.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
@@ -141,6 +144,30 @@ public:
   }
   
   Standard_EXPORT const Handle(IntTools_Context)& Context();
+
+  //! Sets the context to be used by the algorithm instead of creating a new one on each run.
+  //! The context caches the tools (classifiers, projectors etc.) built for the shapes,
+  //! thus sharing it between the runs involving the same shapes avoids building them again.
+  void SetSharedContext (const Handle(IntTools_Context)& theContext)
+  {
+    mySharedContext = theContext;
+  }
+
+  //! Sets the bounding boxes of edges and faces of the arguments computed in advance
+  //! (see BOPDS_DS::SetPrecomputedBoxes()).
+  //! The map is not copied and should be kept alive until the algorithm is performed.
+  void SetPrecomputedBoxes (const TopTools_DataMapOfShapeBox* theBoxes)
+  {
+    myPrecomputedBoxes = theBoxes;
+  }
+
+  //! Sets the cache of Face/Face intersection results shared with other runs
+  //! (see BOPAlgo_FaceFaceCache). The cached results are valid for the same
+  //! section attributes only.
+  void SetFaceFaceCache (const Handle(BOPAlgo_FaceFaceCache)& theCache)
+  {
+    myFaceFaceCache = theCache;
+  }
   
   Standard_EXPORT void SetSectionAttribute (const BOPAlgo_SectionAttribute& theSecAttr);
   
@@ -644,6 +671,11 @@ protected: //! Fields
   BOPDS_PDS myDS;
   BOPDS_PIterator myIterator;
   Handle(IntTools_Context) myContext;
+  Handle(IntTools_Context) mySharedContext; //!< Context shared with other runs
+  BOPTools_Parallel::ContextPool<IntTools_Context> myContextPool; //!< Contexts of the threads performing the parallel stages,
+                                                                  //! kept for the whole operation
+  const TopTools_DataMapOfShapeBox* myPrecomputedBoxes; //!< Boxes of the argument sub-shapes computed in advance
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache; //!< Results of Face/Face intersections shared with other runs
   BOPAlgo_SectionAttribute mySectionAttribute;
   Standard_Boolean myNonDestructive;
   Standard_Boolean myIsPrimary;
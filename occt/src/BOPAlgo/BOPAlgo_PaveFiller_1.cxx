@@ -44,11 +44,15 @@
 //=======================================================================
 void BOPAlgo_PaveFiller::PerformVV(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::PerformVV");
   Standard_Integer n1, n2, iFlag, aSize;
   Handle(NCollection_BaseAllocator) aAllocator;
   //
   myIterator->Initialize(TopAbs_VERTEX, TopAbs_VERTEX);
   aSize=myIterator->ExpectedLength();
+  if (!myProfile.IsNull()) {
+    myProfile->AddCounter("VV candidates", aSize);
+  }
   Message_ProgressScope aPS(theRange, NULL, 2.);
   if (!aSize) {
     return; 
@@ -147,12 +147,16 @@ typedef NCollection_Vector<BOPAlgo_VertexEdge> BOPAlgo_VectorOfVertexEdge;
 //=======================================================================
 void BOPAlgo_PaveFiller::PerformVE(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::PerformVE");
   FillShrunkData(TopAbs_VERTEX, TopAbs_EDGE);
   //
   myIterator->Initialize(TopAbs_VERTEX, TopAbs_EDGE);
   Message_ProgressScope aPS(theRange, NULL, 1);
 
   Standard_Integer iSize = myIterator->ExpectedLength();
+  if (!myProfile.IsNull()) {
+    myProfile->AddCounter("VE candidates", iSize);
+  }
   if (!iSize) {
     return; 
   }
@@ -292,7 +296,7 @@ void BOPAlgo_PaveFiller::IntersectVE
   }
   // Perform intersection
   //=============================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVVE, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVVE, myContextPool);
   //=============================================================
   if (UserBreak(aPSOuter))
   {
@@ -156,10 +156,14 @@ typedef NCollection_Vector<BOPAlgo_EdgeEdge> BOPAlgo_VectorOfEdgeEdge;
 //=======================================================================
 void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::PerformEE");
   FillShrunkData(TopAbs_EDGE, TopAbs_EDGE);
   //
   myIterator->Initialize(TopAbs_EDGE, TopAbs_EDGE);
   Standard_Integer iSize = myIterator->ExpectedLength();
+  if (!myProfile.IsNull()) {
+    myProfile->AddCounter("EE candidates", iSize);
+  }
   Message_ProgressScope aPSOuter(theRange, NULL, 10);
   if (!iSize) {
     return; 
@@ -938,6 +942,7 @@ void BOPAlgo_PaveFiller::UpdateVerticesOfCB()
 //=======================================================================
 void BOPAlgo_PaveFiller::ForceInterfEE(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::ForceInterfEE");
   // Now that we have vertices increased and unified, try to find additional
   // common blocks among the pairs of edges.
   // Since all real intersections should have already happened, here we
@@ -137,8 +137,12 @@ typedef NCollection_Vector<BOPAlgo_VertexFace> BOPAlgo_VectorOfVertexFace;
 //=======================================================================
 void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::PerformVF");
   myIterator->Initialize(TopAbs_VERTEX, TopAbs_FACE);
   Standard_Integer iSize = myIterator->ExpectedLength();
+  if (!myProfile.IsNull()) {
+    myProfile->AddCounter("VF candidates", iSize);
+  }
   //
   Standard_Integer nV, nF;
   //
@@ -229,7 +233,7 @@ void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
     aVertexFace.SetProgressRange(aPS.Next());
   }
   //================================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVVF, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVVF, myContextPool);
   //================================================================
   if (UserBreak(aPSOuter))
   {
@@ -170,11 +170,15 @@ typedef NCollection_Vector<BOPAlgo_EdgeFace> BOPAlgo_VectorOfEdgeFace;
 //=======================================================================
 void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::PerformEF");
   FillShrunkData(TopAbs_EDGE, TopAbs_FACE);
   //
   myIterator->Initialize(TopAbs_EDGE, TopAbs_FACE);
   Message_ProgressScope aPSOuter(theRange, NULL, 10);
   Standard_Integer iSize = myIterator->ExpectedLength();
+  if (!myProfile.IsNull()) {
+    myProfile->AddCounter("EF candidates", iSize);
+  }
   if (!iSize) {
     return; 
   }
@@ -305,7 +309,7 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
     aEdgeFace.SetProgressRange(aPS.Next());
   }
   //=================================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVEdgeFace, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVEdgeFace, myContextPool);
   //=================================================================
   if (UserBreak(aPSOuter))
   {
@@ -764,6 +768,7 @@ void BOPAlgo_PaveFiller::ReduceIntersectionRange(const Standard_Integer theV1,
 //=======================================================================
 void BOPAlgo_PaveFiller::ForceInterfEF(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::ForceInterfEF");
   Message_ProgressScope aPS(theRange, NULL, 1);
   if (!myIsPrimary)
     return;
@@ -1082,7 +1087,7 @@ void BOPAlgo_PaveFiller::ForceInterfEF(const BOPDS_IndexedMapOfPaveBlock& theMPB
     aEdgeFace.SetProgressRange(aPS.Next());
   }
   // Perform intersection of the found pairs
-  BOPTools_Parallel::Perform (myRunParallel, aVEdgeFace, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVEdgeFace, myContextPool);
   if (UserBreak(aPSOuter))
   {
     return;
@@ -94,7 +94,9 @@ class BOPAlgo_FaceFace :
   BOPAlgo_FaceFace() : 
     IntTools_FaceFace(),  
     BOPAlgo_ParallelAlgo(),
-    myIF1(-1), myIF2(-1), myTolFF(1.e-7) {
+    myIF1(-1), myIF2(-1), myTolFF(1.e-7),
+    myIsCached(Standard_False), myToCache(Standard_False),
+    myToMeasure(Standard_False), myTime(0.) {
   }
   //
   virtual ~BOPAlgo_FaceFace() {
@@ -144,11 +146,38 @@ class BOPAlgo_FaceFace :
     IntTools_FaceFace::SetFuzzyValue(theFuzz);
   }
   //
+  void SetFastPlanar(const Standard_Boolean theFastPlanar) {
+    IntTools_FaceFace::SetFastPlanar(theFastPlanar);
+  }
+  //
   const gp_Trsf& Trsf() const { return myTrsf; }
   //
+  //! Sets the results of intersection taken from the cache
+  void SetCachedResults(const Standard_Boolean theTangentFaces,
+                        const IntTools_SequenceOfCurves& theCurves,
+                        const IntTools_SequenceOfPntOn2Faces& thePoints) {
+    myIsDone = Standard_True;
+    myTangentFaces = theTangentFaces;
+    mySeqOfCurve = theCurves;
+    myPnts = thePoints;
+    myIsCached = Standard_True;
+  }
+  //
+  Standard_Boolean IsCached() const { return myIsCached; }
+  //
+  void SetToCache(const Standard_Boolean theToCache) { myToCache = theToCache; }
+  //
+  Standard_Boolean ToCache() const { return myToCache; }
+  //
+  //! Sets the flag to measure the time of intersection
+  void SetToMeasure(const Standard_Boolean theToMeasure) { myToMeasure = theToMeasure; }
+  //
+  //! Returns the wall clock time of intersection (if measured)
+  Standard_Real Time() const { return myTime; }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
-    if (UserBreak(aPS))
+    if (myIsCached || UserBreak(aPS))
     {
       return;
     }
@@ -178,7 +207,12 @@ class BOPAlgo_FaceFace :
         myTrsf = aTrsf.Inverted();
       }
 
+      const Standard_Real aTStart = myToMeasure ? OSD_Timer::GetWallClockTime() : 0.;
       IntTools_FaceFace::Perform (aF1, aF2, myRunParallel);
+      if (myToMeasure)
+      {
+        myTime = OSD_Timer::GetWallClockTime() - aTStart;
+      }
     }
     catch (Standard_Failure const&)
     {
@@ -219,6 +253,10 @@ class BOPAlgo_FaceFace :
   Bnd_Box myBox1;
   Bnd_Box myBox2;
   gp_Trsf myTrsf;
+  Standard_Boolean myIsCached;
+  Standard_Boolean myToCache;
+  Standard_Boolean myToMeasure;
+  Standard_Real myTime;
 };
 //
 //=======================================================================
@@ -231,11 +269,15 @@ typedef NCollection_Vector<BOPAlgo_FaceFace> BOPAlgo_VectorOfFaceFace;
 //=======================================================================
 void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::PerformFF");
   // Update face info for all Face/Face intersection pairs
   // and also for the rest of the faces with FaceInfo already initialized,
   // i.e. anyhow touched faces.
   myIterator->Initialize(TopAbs_FACE, TopAbs_FACE);
   Standard_Integer iSize = myIterator->ExpectedLength();
+  if (!myProfile.IsNull()) {
+    myProfile->AddCounter("FF candidates", iSize);
+  }
 
   // Collect faces from intersection pairs
   TColStd_MapOfInteger aMIFence;
@@ -275,6 +317,14 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
                    bCompC2D1 = mySectionAttribute.PCurveOnS1(),
                    bCompC2D2 = mySectionAttribute.PCurveOnS2();
   Standard_Real    anApproxTol = 1.e-7;
+  // The same options define the validity of the cached intersection results
+  BOPAlgo_FaceFaceCache::Parameters aCacheParams;
+  aCacheParams.FuzzyValue = myFuzzyValue;
+  aCacheParams.ApproxTol = anApproxTol;
+  aCacheParams.Approximation = bApprox;
+  aCacheParams.PCurveOnS1 = bCompC2D1;
+  aCacheParams.PCurveOnS2 = bCompC2D2;
+  aCacheParams.FastPlanar = myFastPlanar;
   // Post-processing options
   Standard_Boolean bSplitCurve = Standard_False;
   //
@@ -427,6 +477,23 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      aFaceFace.SetFastPlanar(myFastPlanar);
+      aFaceFace.SetToMeasure(!myProfile.IsNull());
+      //
+      // Take the results from the cache if the faces in the same relative position
+      // have already been intersected (the intersections of shifted faces are not cached)
+      if (!myFaceFaceCache.IsNull() && aShiftValue == 0.) {
+        Standard_Boolean bTangentFaces = Standard_False;
+        IntTools_SequenceOfCurves aCvs;
+        IntTools_SequenceOfPntOn2Faces aPnts;
+        aCacheParams.TolFF = aTolFF;
+        if (myFaceFaceCache->Find(aF1, aF2, aCacheParams, bTangentFaces, aCvs, aPnts)) {
+          aFaceFace.SetCachedResults(bTangentFaces, aCvs, aPnts);
+        }
+        else {
+          aFaceFace.SetToCache(Standard_True);
+        }
+      }
     }
     else {
       // for the Glue mode just add all interferences of that type
@@ -446,7 +513,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
   }
   //======================================================
   // Perform intersection
-  BOPTools_Parallel::Perform (myRunParallel, aVFaceFace);
+  BOPTools_Parallel::Perform (myRunParallel, aVFaceFace, myContextPool);
   if (UserBreak(aPSOuter))
   {
     return;
@@ -473,9 +540,17 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Boolean bTangentFaces = aFaceFace.TangentFaces();
     Standard_Real aTolFF = aFaceFace.TolFF();
     //
-    aFaceFace.PrepareLines3D(bSplitCurve);
-    //
-    aFaceFace.ApplyTrsf();
+    if (!aFaceFace.IsCached()) {
+      aFaceFace.PrepareLines3D(bSplitCurve);
+      //
+      aFaceFace.ApplyTrsf();
+      //
+      if (aFaceFace.ToCache()) {
+        aCacheParams.TolFF = aTolFF;
+        myFaceFaceCache->Add(aFaceFace.Face1(), aFaceFace.Face2(), aCacheParams,
+                             bTangentFaces, aFaceFace.Lines(), aFaceFace.Points());
+      }
+    }
     //
     const IntTools_SequenceOfCurves& aCvsX = aFaceFace.Lines();
     const IntTools_SequenceOfPntOn2Faces& aPntsX = aFaceFace.Points();
@@ -483,6 +558,16 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Integer aNbCurves = aCvsX.Length();
     Standard_Integer aNbPoints = aPntsX.Length();
     //
+    if (!myProfile.IsNull() && !aFaceFace.IsCached()) {
+      BOPAlgo_Profile::FaceFace aRecord;
+      aRecord.Face1 = aFaceFace.Face1();
+      aRecord.Face2 = aFaceFace.Face2();
+      aRecord.Time = aFaceFace.Time();
+      aRecord.NbCurves = aNbCurves;
+      aRecord.NbPoints = aNbPoints;
+      myProfile->AddFaceFace(aRecord);
+    }
+    //
     if (aNbCurves || aNbPoints) {
       myDS->AddInterf(nF1, nF2);
     }
@@ -562,6 +647,7 @@ static void UpdateSavedTolerance(const BOPDS_PDS& theDS,
 //=======================================================================
 void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::MakeBlocks");
   Message_ProgressScope aPSOuter(theRange, NULL, 4);
   if (myGlue != BOPAlgo_GlueOff) {
     return;
@@ -391,6 +391,7 @@ typedef NCollection_Vector<BOPAlgo_BPC> BOPAlgo_VectorOfBPC;
 //=======================================================================
 void BOPAlgo_PaveFiller::MakeSplitEdges(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::MakeSplitEdges");
   BOPDS_VectorOfListOfPaveBlock& aPBP=myDS->ChangePaveBlocksPool();
   Standard_Integer aNbPBP = aPBP.Length();
   Message_ProgressScope aPSOuter(theRange, NULL, 1);
@@ -516,7 +517,7 @@ void BOPAlgo_PaveFiller::MakeSplitEdges(const Message_ProgressRange& theRange)
     aBSE.SetProgressRange(aPS.Next());
   }
   //======================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVBSE, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVBSE, myContextPool);
   //======================================================
   if (HasErrors())
   {
@@ -599,6 +600,7 @@ Standard_Integer BOPAlgo_PaveFiller::SplitEdge(const Standard_Integer nE,
 //=======================================================================
 void BOPAlgo_PaveFiller::MakePCurves(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::MakePCurves");
   Message_ProgressScope aPSOuter(theRange, NULL, 1);
   if (myAvoidBuildPCurve ||
       (!mySectionAttribute.PCurveOnS1() && !mySectionAttribute.PCurveOnS2()))
@@ -762,7 +764,7 @@ void BOPAlgo_PaveFiller::MakePCurves(const Message_ProgressRange& theRange)
     aMPC.SetProgressRange(aPS.Next());
   }
   //======================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVMPC, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVMPC, myContextPool);
   //======================================================
   if (HasErrors())
   {
@@ -845,6 +847,7 @@ void UpdateVertices(const TopoDS_Edge& aE,
 //=======================================================================
 void BOPAlgo_PaveFiller::Prepare(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::Prepare");
   if (myNonDestructive) {
     // do not allow storing pcurves in original edges if non-destructive mode is on
     return;
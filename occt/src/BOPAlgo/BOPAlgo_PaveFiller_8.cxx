@@ -56,6 +56,7 @@ static
 //=======================================================================
 void BOPAlgo_PaveFiller::ProcessDE(const Message_ProgressRange& theRange)
 {
+  BOPAlgo_Profile::Scope aProfileScope(myProfile, "PaveFiller::ProcessDE");
   Message_ProgressScope aPSOuter(theRange, NULL, 1);
 
   Standard_Integer nF, aNb, nE, nV, nVSD, aNbPB;
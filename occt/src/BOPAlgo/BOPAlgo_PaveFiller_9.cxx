@@ -124,7 +124,7 @@ void BOPAlgo_PaveFiller::FillShrunkData(const TopAbs_ShapeEnum aType1,
   //
   aNbVSD=aVSD.Length();
   //=============================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVSD, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVSD, myContextPool);
   //=============================================================
   //
   for (k=0; k < aNbVSD; ++k) {
@@ -0,0 +1,164 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_Profile.hxx>
+
+#include <BRep_Tool.hxx>
+#include <Geom_Surface.hxx>
+
+#include <algorithm>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_Profile, Standard_Transient)
+
+namespace
+{
+  //! Returns the name of the type of the face surface.
+  static Standard_CString SurfaceTypeName (const TopoDS_Face& theFace)
+  {
+    if (theFace.IsNull())
+    {
+      return "";
+    }
+    const Handle(Geom_Surface)& aS = BRep_Tool::Surface (theFace);
+    return aS.IsNull() ? "" : aS->DynamicType()->Name();
+  }
+
+  //! Orders the face/face records by decreasing time.
+  struct SlowerFirst
+  {
+    SlowerFirst (const NCollection_Vector<BOPAlgo_Profile::FaceFace>& theRecords)
+    : myRecords (theRecords) {}
+
+    bool operator() (const Standard_Integer theI1, const Standard_Integer theI2) const
+    {
+      return myRecords (theI1).Time > myRecords (theI2).Time;
+    }
+
+    const NCollection_Vector<BOPAlgo_Profile::FaceFace>& myRecords;
+  };
+}
+
+//=======================================================================
+//function : AddStage
+//purpose  : 
+//=======================================================================
+void BOPAlgo_Profile::AddStage (const TCollection_AsciiString& theStage,
+                                const Standard_Real theTime)
+{
+  Stage* pStage = myStages.ChangeSeek (theStage);
+  if (!pStage)
+  {
+    pStage = &myStages.ChangeFromIndex (myStages.Add (theStage, Stage()));
+  }
+  pStage->Time += theTime;
+  ++pStage->NbRuns;
+}
+
+//=======================================================================
+//function : SetCounter
+//purpose  : 
+//=======================================================================
+void BOPAlgo_Profile::SetCounter (const TCollection_AsciiString& theCounter,
+                                  const Standard_Integer theValue)
+{
+  Standard_Integer* pValue = myCounters.ChangeSeek (theCounter);
+  if (pValue)
+  {
+    *pValue = theValue;
+  }
+  else
+  {
+    myCounters.Add (theCounter, theValue);
+  }
+}
+
+//=======================================================================
+//function : AddCounter
+//purpose  : 
+//=======================================================================
+void BOPAlgo_Profile::AddCounter (const TCollection_AsciiString& theCounter,
+                                  const Standard_Integer theValue)
+{
+  Standard_Integer* pValue = myCounters.ChangeSeek (theCounter);
+  if (pValue)
+  {
+    *pValue += theValue;
+  }
+  else
+  {
+    myCounters.Add (theCounter, theValue);
+  }
+}
+
+//=======================================================================
+//function : Clear
+//purpose  : 
+//=======================================================================
+void BOPAlgo_Profile::Clear()
+{
+  myStages.Clear();
+  myCounters.Clear();
+  myFaceFaces.Clear();
+}
+
+//=======================================================================
+//function : Dump
+//purpose  : 
+//=======================================================================
+void BOPAlgo_Profile::Dump (Standard_OStream& theStream,
+                            const Standard_Integer theNbSlowest) const
+{
+  theStream << "{\"stages\":[";
+  for (Standard_Integer i = 1; i <= myStages.Extent(); ++i)
+  {
+    const Stage& aStage = myStages (i);
+    theStream << (i > 1 ? "," : "")
+              << "{\"name\":\"" << myStages.FindKey (i)
+              << "\",\"time\":" << aStage.Time
+              << ",\"runs\":" << aStage.NbRuns << "}";
+  }
+  //
+  theStream << "],\"counters\":{";
+  for (Standard_Integer i = 1; i <= myCounters.Extent(); ++i)
+  {
+    theStream << (i > 1 ? "," : "")
+              << "\"" << myCounters.FindKey (i) << "\":" << myCounters (i);
+  }
+  //
+  // Total time of face/face intersections and the slowest pairs
+  Standard_Real aTotal = 0.;
+  std::vector<Standard_Integer> anOrder (myFaceFaces.Length());
+  for (Standard_Integer i = 0; i < myFaceFaces.Length(); ++i)
+  {
+    aTotal += myFaceFaces (i).Time;
+    anOrder[i] = i;
+  }
+  const Standard_Integer aNbSlowest = std::min (std::max (theNbSlowest, 0), myFaceFaces.Length());
+  std::partial_sort (anOrder.begin(), anOrder.begin() + aNbSlowest, anOrder.end(),
+                     SlowerFirst (myFaceFaces));
+  //
+  theStream << "},\"faceFace\":{\"pairs\":" << myFaceFaces.Length()
+            << ",\"time\":" << aTotal << ",\"slowest\":[";
+  for (Standard_Integer i = 0; i < aNbSlowest; ++i)
+  {
+    const FaceFace& aFF = myFaceFaces (anOrder[i]);
+    theStream << (i > 0 ? "," : "")
+              << "{\"time\":" << aFF.Time
+              << ",\"curves\":" << aFF.NbCurves
+              << ",\"points\":" << aFF.NbPoints
+              << ",\"type1\":\"" << SurfaceTypeName (aFF.Face1)
+              << "\",\"type2\":\"" << SurfaceTypeName (aFF.Face2) << "\"}";
+  }
+  theStream << "]}}";
+}
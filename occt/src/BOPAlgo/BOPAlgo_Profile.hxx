@@ -0,0 +1,158 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_Profile_HeaderFile
+#define _BOPAlgo_Profile_HeaderFile
+
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Timer.hxx>
+#include <Standard_OStream.hxx>
+#include <Standard_Transient.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopoDS_Face.hxx>
+
+class BOPAlgo_Profile;
+DEFINE_STANDARD_HANDLE(BOPAlgo_Profile, Standard_Transient)
+
+//! Collects the profiling data of the Boolean operation:
+//! - wall clock time spent by each stage of the Intersection and Building parts;
+//! - counters of the candidate pairs given by the iterator versus the real interferences;
+//! - time of the intersection of each pair of faces.
+//!
+//! Stages may be nested, e.g. the time of "PaveFiller::Perform" includes the times of its steps.
+//!
+//! The profile is attached to the algorithm by BOPAlgo_Options::SetProfile().
+//! When no profile is attached, the stage scopes do not even query the clock.
+//! The same profile may be shared by several algorithms (e.g. Pave Filler and Builder)
+//! to accumulate the data of the whole operation. The data is not cleared automatically:
+//! the stage times and the counters filled by the algorithms are summed over all runs.
+//!
+//! The stages and face/face records are added from the thread performing the operation only,
+//! thus the class is not protected against concurrent access.
+class BOPAlgo_Profile : public Standard_Transient
+{
+public:
+
+  //! Time spent by the stage.
+  struct Stage
+  {
+    Stage() : Time (0.), NbRuns (0) {}
+    Standard_Real    Time;   //!< accumulated wall clock time, in seconds
+    Standard_Integer NbRuns; //!< number of times the stage has been performed
+  };
+
+  //! Time spent on the intersection of the pair of faces.
+  struct FaceFace
+  {
+    FaceFace() : Time (0.), NbCurves (0), NbPoints (0) {}
+    TopoDS_Face      Face1;
+    TopoDS_Face      Face2;
+    Standard_Real    Time;     //!< wall clock time of IntTools_FaceFace::Perform(), in seconds
+    Standard_Integer NbCurves; //!< number of intersection curves
+    Standard_Integer NbPoints; //!< number of intersection points
+  };
+
+  //! Measures the time of the stage from construction to destruction.
+  //! Does nothing if the profile is null.
+  class Scope
+  {
+  public:
+    Scope (const Handle(BOPAlgo_Profile)& theProfile, const Standard_CString theStage)
+    : myProfile (theProfile.get()),
+      myStage (theStage),
+      myStart (myProfile ? OSD_Timer::GetWallClockTime() : 0.)
+    {}
+
+    ~Scope()
+    {
+      if (myProfile)
+      {
+        myProfile->AddStage (myStage, OSD_Timer::GetWallClockTime() - myStart);
+      }
+    }
+
+  private:
+    Scope (const Scope&);
+    Scope& operator= (const Scope&);
+
+  private:
+    BOPAlgo_Profile* myProfile;
+    Standard_CString myStage;
+    Standard_Real    myStart;
+  };
+
+public:
+
+  //! Empty constructor
+  BOPAlgo_Profile() {}
+
+  //! Adds the time to the stage with the given name.
+  Standard_EXPORT void AddStage (const TCollection_AsciiString& theStage,
+                                 const Standard_Real theTime);
+
+  //! Sets the value of the counter with the given name.
+  Standard_EXPORT void SetCounter (const TCollection_AsciiString& theCounter,
+                                   const Standard_Integer theValue);
+
+  //! Adds the value to the counter with the given name.
+  Standard_EXPORT void AddCounter (const TCollection_AsciiString& theCounter,
+                                   const Standard_Integer theValue);
+
+  //! Adds the record of the face/face intersection.
+  void AddFaceFace (const FaceFace& theRecord)
+  {
+    myFaceFaces.Append (theRecord);
+  }
+
+  //! Returns the stages in the order of their first run.
+  const NCollection_IndexedDataMap<TCollection_AsciiString, Stage>& Stages() const
+  {
+    return myStages;
+  }
+
+  //! Returns the counters.
+  const NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Integer>& Counters() const
+  {
+    return myCounters;
+  }
+
+  //! Returns the records of the face/face intersections.
+  const NCollection_Vector<FaceFace>& FaceFaces() const
+  {
+    return myFaceFaces;
+  }
+
+  //! Clears the collected data.
+  Standard_EXPORT void Clear();
+
+  //! Writes the profile into the stream as JSON object:
+  //! {"stages":[{"name":..,"time":..,"runs":..},..],
+  //!  "counters":{"name":value,..},
+  //!  "faceFace":{"pairs":..,"time":..,"slowest":[{"time":..,"curves":..,"points":..,
+  //!                                              "type1":..,"type2":..},..]}}
+  //! @param theNbSlowest [in] number of the slowest face/face pairs to report
+  Standard_EXPORT void Dump (Standard_OStream& theStream,
+                             const Standard_Integer theNbSlowest = 10) const;
+
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_Profile, Standard_Transient)
+
+private:
+
+  NCollection_IndexedDataMap<TCollection_AsciiString, Stage> myStages;
+  NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Integer> myCounters;
+  NCollection_Vector<FaceFace> myFaceFaces;
+
+};
+
+#endif // _BOPAlgo_Profile_HeaderFile
@@ -94,6 +94,9 @@ void BOPAlgo_Splitter::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetAdaptiveOBB(myAdaptiveOBB);
+  pPF->SetFastPlanar(myFastPlanar);
+  pPF->SetProfile(myProfile);
   //
   Message_ProgressScope aPS(theRange, "Performing Split operation", 10);
   pPF->Perform(aPS.Next(9));
@@ -41,11 +41,13 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <IntTools_Context.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_Vector.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <TColStd_IndexedMapOfInteger.hxx>
+#include <TColStd_MapOfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -1095,6 +1097,95 @@ void BOPAlgo_Tools::IntersectVertices(const TopTools_IndexedDataMapOfShapeReal&
   }
 }
 
+//=======================================================================
+//function : GroupDisjointShapes
+//purpose  : Distributes the shapes into groups of mutually disjoint shapes
+//=======================================================================
+Standard_Integer BOPAlgo_Tools::GroupDisjointShapes(const TopTools_ListOfShape& theShapes,
+                                                    const Standard_Real theFuzzyValue,
+                                                    TopTools_ListOfListOfShape& theGroups)
+{
+  const Standard_Integer aNbS = theShapes.Extent();
+  if (!aNbS)
+    return 0;
+
+  // Additional tolerance for intersection
+  const Standard_Real aTolAdd = theFuzzyValue / 2.;
+
+  NCollection_Vector<TopoDS_Shape> aVS;
+  BOPTools_BoxTree aBBTree;
+  aBBTree.SetSize (aNbS);
+  //
+  TopTools_ListIteratorOfListOfShape aItLS (theShapes);
+  for (Standard_Integer i = 0; aItLS.More(); aItLS.Next(), ++i)
+  {
+    const TopoDS_Shape& aS = aItLS.Value();
+    aVS.Append (aS);
+    //
+    Bnd_Box aBox;
+    BRepBndLib::Add (aS, aBox);
+    if (aBox.IsVoid())
+      // Shape without geometry does not interfere with anything
+      continue;
+    aBox.SetGap (aBox.GetGap() + aTolAdd);
+    aBBTree.Add (i, Bnd_Tools::Bnd2BVH (aBox));
+  }
+  aBBTree.Build();
+
+  // Select pairs of shapes with interfering bounding boxes
+  BOPTools_BoxPairSelector aPairSelector;
+  aPairSelector.SetBVHSets (&aBBTree, &aBBTree);
+  aPairSelector.SetSame (Standard_True);
+  aPairSelector.Select();
+
+  const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aPairSelector.Pairs();
+  if (aPairs.empty())
+  {
+    // All shapes are mutually disjoint
+    theGroups.Append (theShapes);
+    return 1;
+  }
+
+  NCollection_Array1<TColStd_ListOfInteger> aVNeighbors (0, aNbS - 1);
+  for (size_t iPair = 0; iPair < aPairs.size(); ++iPair)
+  {
+    const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
+    aVNeighbors.ChangeValue (aPair.ID1).Append (aPair.ID2);
+    aVNeighbors.ChangeValue (aPair.ID2).Append (aPair.ID1);
+  }
+
+  // Put each shape into the first group not containing its neighbors
+  NCollection_Array1<Standard_Integer> aVGroupOf (0, aNbS - 1);
+  aVGroupOf.Init (-1);
+  NCollection_Vector<TopTools_ListOfShape> aVGroups;
+  TColStd_MapOfInteger aMUsed;
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    aMUsed.Clear();
+    TColStd_ListIteratorOfListOfInteger aItLN (aVNeighbors (i));
+    for (; aItLN.More(); aItLN.Next())
+    {
+      const Standard_Integer iGN = aVGroupOf (aItLN.Value());
+      if (iGN >= 0)
+        aMUsed.Add (iGN);
+    }
+    //
+    Standard_Integer iG = 0;
+    while (aMUsed.Contains (iG))
+      ++iG;
+    //
+    if (iG == aVGroups.Length())
+      aVGroups.Appended();
+    aVGroups.ChangeValue (iG).Append (aVS (i));
+    aVGroupOf.ChangeValue (i) = iG;
+  }
+
+  for (Standard_Integer iG = 0; iG < aVGroups.Length(); ++iG)
+    theGroups.Append (aVGroups (iG));
+
+  return aVGroups.Length();
+}
+
 //=======================================================================
 // Classification of the faces relatively solids
 //=======================================================================
@@ -1500,6 +1591,25 @@ void BOPAlgo_Tools::ClassifyFaces(const TopTools_ListOfShape& theFaces,
                                   const TopTools_DataMapOfShapeBox& theShapeBoxMap,
                                   const TopTools_DataMapOfShapeListOfShape& theSolidsIF,
                                   const Message_ProgressRange& theRange)
+{
+  BOPTools_Parallel::ContextPool<IntTools_Context> aContextPool;
+  aContextPool.SetContext(theContext);
+  ClassifyFaces(theFaces, theSolids, theRunParallel, aContextPool,
+                theInParts, theShapeBoxMap, theSolidsIF, theRange);
+}
+
+//=======================================================================
+//function : ClassifyFaces
+//purpose  :
+//=======================================================================
+void BOPAlgo_Tools::ClassifyFaces(const TopTools_ListOfShape& theFaces,
+                                  const TopTools_ListOfShape& theSolids,
+                                  const Standard_Boolean theRunParallel,
+                                  BOPTools_Parallel::ContextPool<IntTools_Context>& theContextPool,
+                                  TopTools_IndexedDataMapOfShapeListOfShape& theInParts,
+                                  const TopTools_DataMapOfShapeBox& theShapeBoxMap,
+                                  const TopTools_DataMapOfShapeListOfShape& theSolidsIF,
+                                  const Message_ProgressRange& theRange)
 {
   Handle(NCollection_BaseAllocator) anAlloc = new NCollection_IncAllocator;
 
@@ -1594,7 +1704,7 @@ void BOPAlgo_Tools::ClassifyFaces(const TopTools_ListOfShape& theFaces,
   }
   // Perform classification
   //================================================================
-  BOPTools_Parallel::Perform (theRunParallel, aVFIP, theContext);
+  BOPTools_Parallel::Perform (theRunParallel, aVFIP, theContextPool);
   //================================================================
   // Analyze the results and fill the resulting map
   for (Standard_Integer i = 0; i < aNbS; ++i)
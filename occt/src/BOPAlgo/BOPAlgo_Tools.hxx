@@ -21,6 +21,7 @@
 #include <BOPDS_IndexedDataMapOfPaveBlockListOfInteger.hxx>
 #include <BOPDS_IndexedDataMapOfPaveBlockListOfPaveBlock.hxx>
 #include <BOPDS_PDS.hxx>
+#include <BOPTools_Parallel.hxx>
 #include <NCollection_BaseAllocator.hxx>
 #include <TopTools_DataMapOfShapeBox.hxx>
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
@@ -165,6 +166,17 @@ public:
                                                 const Standard_Real theFuzzyValue,
                                                 TopTools_ListOfListOfShape& theChains);
 
+  //! Distributes the shapes into the groups of shapes with mutually disjoint
+  //! bounding boxes (increased by the fuzzy value), so that each group may be used
+  //! as a single argument of the Boolean operation and its shapes will not be
+  //! intersected with each other.
+  //! The pairs of shapes with interfering boxes are selected using the BVH tree
+  //! (the same way as in BOPDS_Iterator), the shapes are grouped greedily in the given order.
+  //! Returns the number of groups, i.e. 1 in case all shapes are mutually disjoint.
+  Standard_EXPORT static Standard_Integer GroupDisjointShapes(const TopTools_ListOfShape& theShapes,
+                                                              const Standard_Real theFuzzyValue,
+                                                              TopTools_ListOfListOfShape& theGroups);
+
   //! Classifies the faces <theFaces> relatively solids <theSolids>.
   //! The IN faces for solids are stored into output data map <theInParts>.
   //!
@@ -187,6 +199,19 @@ public:
                                             const TopTools_DataMapOfShapeListOfShape& theSolidsIF = TopTools_DataMapOfShapeListOfShape(),
                                             const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Classifies the faces <theFaces> relatively solids <theSolids> the same way
+  //! as the method above, taking the contexts of the threads performing the
+  //! classification from the pool <theContextPool>. The pool keeps the contexts,
+  //! and thus the classifiers of the solids, for the subsequent runs.
+  Standard_EXPORT static void ClassifyFaces(const TopTools_ListOfShape& theFaces,
+                                            const TopTools_ListOfShape& theSolids,
+                                            const Standard_Boolean theRunParallel,
+                                            BOPTools_Parallel::ContextPool<IntTools_Context>& theContextPool,
+                                            TopTools_IndexedDataMapOfShapeListOfShape& theInParts,
+                                            const TopTools_DataMapOfShapeBox& theShapeBoxMap = TopTools_DataMapOfShapeBox(),
+                                            const TopTools_DataMapOfShapeListOfShape& theSolidsIF = TopTools_DataMapOfShapeListOfShape(),
+                                            const Message_ProgressRange& theRange = Message_ProgressRange());
+
   //! Classifies the given parts relatively the given solids and
   //! fills the solids with the parts classified as INTERNAL.
   //!
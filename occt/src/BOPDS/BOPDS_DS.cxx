@@ -82,7 +82,8 @@ BOPDS_DS::BOPDS_DS()
   myInterfEZ(0, myAllocator),
   myInterfFZ(0, myAllocator),
   myInterfZZ(0, myAllocator),
-  myInterfered(100, myAllocator)
+  myInterfered(100, myAllocator),
+  myPrecomputedBoxes(NULL)
 {
   myNbShapes=0;
   myNbSourceShapes=0;
@@ -114,7 +115,8 @@ BOPDS_DS::BOPDS_DS(const Handle(NCollection_BaseAllocator)& theAllocator)
   myInterfEZ(0, myAllocator),
   myInterfFZ(0, myAllocator),
   myInterfZZ(0, myAllocator),
-  myInterfered(100, myAllocator)
+  myInterfered(100, myAllocator),
+  myPrecomputedBoxes(NULL)
 {
   myNbShapes=0;
   myNbSourceShapes=0;
@@ -457,7 +459,13 @@ void BOPDS_DS::Init(const Standard_Real theFuzz)
       }
       //
       Bnd_Box& aBox=aSI.ChangeBox();
-      BRepBndLib::Add(aE, aBox);
+      const Bnd_Box* pBox = myPrecomputedBoxes ? myPrecomputedBoxes->Seek(aE) : NULL;
+      if (pBox) {
+        aBox = *pBox;
+      }
+      else {
+        BRepBndLib::Add(aE, aBox);
+      }
       //
       const TColStd_ListOfInteger& aLV=aSI.SubShapes(); 
       aIt1.Initialize(aLV);
@@ -484,7 +492,13 @@ void BOPDS_DS::Init(const Standard_Real theFuzz)
       const TopoDS_Shape& aS=aSI.Shape();
       //
       Bnd_Box& aBox=aSI.ChangeBox();
-      BRepBndLib::Add(aS, aBox);
+      const Bnd_Box* pBox = myPrecomputedBoxes ? myPrecomputedBoxes->Seek(aS) : NULL;
+      if (pBox) {
+        aBox = *pBox;
+      }
+      else {
+        BRepBndLib::Add(aS, aBox);
+      }
       //
       TColStd_ListOfInteger& aLW=aSI.ChangeSubShapes(); 
       aIt1.Initialize(aLW);
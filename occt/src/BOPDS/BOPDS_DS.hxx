@@ -45,6 +45,7 @@
 #include <TColStd_DataMapOfIntegerListOfInteger.hxx>
 #include <TColStd_ListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
+#include <TopTools_DataMapOfShapeBox.hxx>
 #include <TopTools_DataMapOfShapeInteger.hxx>
 #include <TopTools_ListOfShape.hxx>
 
@@ -114,6 +115,16 @@ public:
   //! Initializes the data structure for
   //! the arguments
   Standard_EXPORT void Init(const Standard_Real theFuzz = Precision::Confusion());
+
+  //! Modifier
+  //! Sets the bounding boxes of edges and faces of the arguments computed in advance
+  //! (by BRepBndLib::Add() or transformed from such boxes) to be used by Init()
+  //! instead of computing them again.
+  //! The map is not copied and should be kept alive until Init() is performed.
+  void SetPrecomputedBoxes (const TopTools_DataMapOfShapeBox* theBoxes)
+  {
+    myPrecomputedBoxes = theBoxes;
+  }
   
 
   //! Selector
@@ -516,6 +527,7 @@ protected:
   BOPDS_VectorOfInterfFZ myInterfFZ;
   BOPDS_VectorOfInterfZZ myInterfZZ;
   TColStd_MapOfInteger myInterfered;
+  const TopTools_DataMapOfShapeBox* myPrecomputedBoxes;
 
 
 private:
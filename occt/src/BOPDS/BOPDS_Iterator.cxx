@@ -26,8 +26,15 @@
 #include <BOPDS_Tools.hxx>
 #include <BOPTools_BoxTree.hxx>
 #include <BOPTools_Parallel.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
 #include <IntTools_Context.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_Vector.hxx>
+#include <TColgp_HArray2OfPnt.hxx>
+#include <TopoDS.hxx>
 #include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////
@@ -69,6 +76,199 @@ class BOPDS_TSR : public BOPTools_BoxTreeSelector
 typedef NCollection_Vector<BOPDS_TSR> BOPDS_VectorOfTSR;
 /////////////////////////////////////////////////////////////////////////
 
+//! Minimal number of the costly pairs for which the adaptive filter is considered
+static const Standard_Integer THE_MIN_NB_TO_SAMPLE = 16;
+//! Number of the costly pairs tested to estimate the rate of false candidates
+static const Standard_Integer THE_SAMPLE_SIZE = 64;
+
+//=======================================================================
+//function : IsCostlyPair
+//purpose  : Returns true if the geometrical intersection of the shapes
+//           of the pair is costly, i.e. the pair is Edge/Edge, Edge/Face
+//           or Face/Face.
+//=======================================================================
+static Standard_Boolean IsCostlyPair (const BOPDS_DS& theDS,
+                                      const BOPDS_Pair& thePair)
+{
+  Standard_Integer n1, n2;
+  thePair.Indices (n1, n2);
+  const TopAbs_ShapeEnum aT1 = theDS.ShapeInfo (n1).ShapeType();
+  const TopAbs_ShapeEnum aT2 = theDS.ShapeInfo (n2).ShapeType();
+  return (aT1 == TopAbs_EDGE || aT1 == TopAbs_FACE) &&
+         (aT2 == TopAbs_EDGE || aT2 == TopAbs_FACE);
+}
+
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPDS_HullChecker
+//purpose  : Checks the hull of the control net of the B-spline and
+//           Bezier faces against the oriented box. The surface lies
+//           inside the convex hull of its poles, so the face is out of
+//           the box if its poles are separated from the box by some
+//           axis. The axes tested are the axes of the box and their
+//           cross products with the boundary directions of the net.
+//=======================================================================
+class BOPDS_HullChecker
+{
+ public:
+  BOPDS_HullChecker (const BOPDS_DS& theDS,
+                     const Standard_Boolean theToCheck)
+  : myDS (theDS),
+    myToCheck (theToCheck)
+  {}
+  //
+  //! Returns true if the face with the given index is out of the box
+  Standard_Boolean IsOut (const Standard_Integer theIndex,
+                          const Bnd_OBB& theOBB,
+                          const Standard_Real theFuzzyValue)
+  {
+    if (!myToCheck || theOBB.IsVoid())
+      return Standard_False;
+    //
+    const BOPDS_ShapeInfo& aSI = myDS.ShapeInfo (theIndex);
+    if (aSI.ShapeType() != TopAbs_FACE)
+      return Standard_False;
+    //
+    const Handle(TColgp_HArray2OfPnt)& aPoles = Poles (theIndex);
+    if (aPoles.IsNull())
+      return Standard_False;
+    //
+    const Standard_Real aTol = BRep_Tool::Tolerance (TopoDS::Face (aSI.Shape())) + theFuzzyValue;
+    const gp_XYZ aBoxAxes[3] = { theOBB.XDirection(), theOBB.YDirection(), theOBB.ZDirection() };
+    //
+    // Boundary directions of the control net
+    const TColgp_Array2OfPnt& aNet = aPoles->Array2();
+    const Standard_Integer iU1 = aNet.LowerRow(), iU2 = aNet.UpperRow();
+    const Standard_Integer iV1 = aNet.LowerCol(), iV2 = aNet.UpperCol();
+    const gp_XYZ aNetDirs[4] = { aNet (iU2, iV1).XYZ() - aNet (iU1, iV1).XYZ(),
+                                 aNet (iU2, iV2).XYZ() - aNet (iU2, iV1).XYZ(),
+                                 aNet (iU1, iV2).XYZ() - aNet (iU2, iV2).XYZ(),
+                                 aNet (iU1, iV1).XYZ() - aNet (iU1, iV2).XYZ() };
+    //
+    for (Standard_Integer k = 0; k < 3; ++k)
+    {
+      if (IsSeparated (aNet, theOBB, aBoxAxes[k], aTol))
+        return Standard_True;
+    }
+    for (Standard_Integer i = 0; i < 4; ++i)
+    {
+      for (Standard_Integer k = 0; k < 3; ++k)
+      {
+        const gp_XYZ anAxis = aNetDirs[i].Crossed (aBoxAxes[k]);
+        const Standard_Real aMod = anAxis.Modulus();
+        if (aMod > gp::Resolution() && IsSeparated (aNet, theOBB, anAxis / aMod, aTol))
+          return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+  //
+ protected:
+  //! Returns true if the projections of the poles and of the box
+  //! on the given unit axis do not overlap
+  static Standard_Boolean IsSeparated (const TColgp_Array2OfPnt& theNet,
+                                       const Bnd_OBB& theOBB,
+                                       const gp_XYZ& theAxis,
+                                       const Standard_Real theTol)
+  {
+    const Standard_Real aC = theOBB.Center().Dot (theAxis);
+    const Standard_Real aR = theOBB.XHSize() * Abs (theOBB.XDirection().Dot (theAxis)) +
+                             theOBB.YHSize() * Abs (theOBB.YDirection().Dot (theAxis)) +
+                             theOBB.ZHSize() * Abs (theOBB.ZDirection().Dot (theAxis)) + theTol;
+    Standard_Real aMin = RealLast(), aMax = RealFirst();
+    for (Standard_Integer i = theNet.LowerRow(); i <= theNet.UpperRow(); ++i)
+    {
+      for (Standard_Integer j = theNet.LowerCol(); j <= theNet.UpperCol(); ++j)
+      {
+        const Standard_Real aD = theNet (i, j).XYZ().Dot (theAxis);
+        aMin = Min (aMin, aD);
+        aMax = Max (aMax, aD);
+      }
+      if (aMin <= aC + aR && aMax >= aC - aR)
+        return Standard_False;
+    }
+    return Standard_True;
+  }
+  //
+  //! Returns the poles of the surface of the face (null for other surfaces)
+  const Handle(TColgp_HArray2OfPnt)& Poles (const Standard_Integer theIndex)
+  {
+    Handle(TColgp_HArray2OfPnt)* pPoles = myPoles.ChangeSeek (theIndex);
+    if (pPoles)
+      return *pPoles;
+    //
+    Handle(TColgp_HArray2OfPnt) aPoles;
+    TopLoc_Location aLoc;
+    Handle(Geom_Surface) aS =
+      BRep_Tool::Surface (TopoDS::Face (myDS.ShapeInfo (theIndex).Shape()), aLoc);
+    while (!aS.IsNull() && aS->IsKind (STANDARD_TYPE (Geom_RectangularTrimmedSurface)))
+      aS = Handle(Geom_RectangularTrimmedSurface)::DownCast (aS)->BasisSurface();
+    //
+    Handle(Geom_BSplineSurface) aBS = Handle(Geom_BSplineSurface)::DownCast (aS);
+    Handle(Geom_BezierSurface) aBz = Handle(Geom_BezierSurface)::DownCast (aS);
+    if (!aBS.IsNull() || !aBz.IsNull())
+    {
+      const Standard_Integer aNbU = !aBS.IsNull() ? aBS->NbUPoles() : aBz->NbUPoles();
+      const Standard_Integer aNbV = !aBS.IsNull() ? aBS->NbVPoles() : aBz->NbVPoles();
+      const gp_Trsf& aTrsf = aLoc.Transformation();
+      aPoles = new TColgp_HArray2OfPnt (1, aNbU, 1, aNbV);
+      for (Standard_Integer i = 1; i <= aNbU; ++i)
+      {
+        for (Standard_Integer j = 1; j <= aNbV; ++j)
+        {
+          gp_Pnt aP = !aBS.IsNull() ? aBS->Pole (i, j) : aBz->Pole (i, j);
+          if (!aLoc.IsIdentity())
+            aP.Transform (aTrsf);
+          aPoles->SetValue (i, j, aP);
+        }
+      }
+    }
+    return *myPoles.Bound (theIndex, aPoles);
+  }
+  //
+ protected:
+  const BOPDS_DS& myDS;
+  Standard_Boolean myToCheck;
+  NCollection_DataMap<Standard_Integer, Handle(TColgp_HArray2OfPnt)> myPoles;
+};
+
+//=======================================================================
+//function : IsOut
+//purpose  : Checks the pair of shapes by their oriented boxes and, for
+//           the B-spline and Bezier faces, by the hulls of their poles
+//=======================================================================
+static Standard_Boolean IsOut (const BOPDS_DS& theDS,
+                               const BOPDS_Pair& thePair,
+                               const Handle(IntTools_Context)& theCtx,
+                               const Standard_Real theFuzzyValue,
+                               BOPDS_HullChecker& theHullChecker,
+                               BOPDS_Iterator::FilterStatistics& theStatistics)
+{
+  Standard_Integer n1, n2;
+  thePair.Indices (n1, n2);
+  ++theStatistics.NbTested;
+  //
+  const Bnd_OBB& anOBB1 = theCtx->OBB (theDS.ShapeInfo (n1).Shape(), theFuzzyValue);
+  const Bnd_OBB& anOBB2 = theCtx->OBB (theDS.ShapeInfo (n2).Shape(), theFuzzyValue);
+  if (anOBB1.IsVoid() || anOBB2.IsVoid())
+    // no reliable box
+    return Standard_False;
+  //
+  if (anOBB1.IsOut (anOBB2))
+  {
+    ++theStatistics.NbRejectedOBB;
+    return Standard_True;
+  }
+  //
+  if (theHullChecker.IsOut (n1, anOBB2, theFuzzyValue) ||
+      theHullChecker.IsOut (n2, anOBB1, theFuzzyValue))
+  {
+    ++theStatistics.NbRejectedHull;
+    return Standard_True;
+  }
+  return Standard_False;
+}
+
 //=======================================================================
 //function : 
 //purpose  : 
@@ -77,7 +277,10 @@ BOPDS_Iterator::BOPDS_Iterator()
 :
   myAllocator(NCollection_BaseAllocator::CommonBaseAllocator()),
   myRunParallel(Standard_False),
-  myUseExt(Standard_False)
+  myUseExt(Standard_False),
+  myAdaptiveOBB(Standard_True),
+  myOBBThreshold(0.2),
+  myCheckHull(Standard_True)
 {
   Standard_Integer i, aNb;
   //
@@ -107,7 +310,10 @@ BOPDS_Iterator::BOPDS_Iterator
   myLists(0, theAllocator),
   myRunParallel(Standard_False),
   myExtLists(0, theAllocator),
-  myUseExt(Standard_False)
+  myUseExt(Standard_False),
+  myAdaptiveOBB(Standard_True),
+  myOBBThreshold(0.2),
+  myCheckHull(Standard_True)
 {
   Standard_Integer i, aNb;
   //
@@ -281,6 +487,7 @@ void BOPDS_Iterator::Intersect(const Handle(IntTools_Context)& theCtx,
                                const Standard_Boolean theCheckOBB,
                                const Standard_Real theFuzzyValue)
 {
+  myStatistics = FilterStatistics();
   const Standard_Integer aNb = myDS->NbSourceShapes();
 
   // Prepare BVH
@@ -311,6 +518,9 @@ void BOPDS_Iterator::Intersect(const Handle(IntTools_Context)& theCtx,
 
   Standard_Integer iPair = 0;
 
+  // Pairs with interfering boxes of the shapes from different arguments
+  NCollection_Vector<BOPDS_Pair> aCandidates (256, myAllocator);
+
   const Standard_Integer aNbR = myDS->NbRanges();
   for (Standard_Integer iR = 0; iR < aNbR; ++iR)
   {
@@ -341,21 +551,75 @@ void BOPDS_Iterator::Intersect(const Handle(IntTools_Context)& theCtx,
           ((iType1 > iType2) && aSI2.HasSubShape (aPair.ID1)))
         continue;
 
-      if (theCheckOBB)
-      {
-        // Check intersection of Oriented bounding boxes of the shapes
-        const Bnd_OBB& anOBB1 = theCtx->OBB (aSI1.Shape(), theFuzzyValue);
-        const Bnd_OBB& anOBB2 = theCtx->OBB (aSI2.Shape(), theFuzzyValue);
+      aCandidates.Append (BOPDS_Pair (Min (aPair.ID1, aPair.ID2),
+                                      Max (aPair.ID1, aPair.ID2)));
+    }
+  }
+
+  myStatistics.NbCandidates = aCandidates.Length();
+
+  // Filter the candidates by the oriented bounding boxes
+  std::vector<Standard_Boolean> aRejected (aCandidates.Length(), Standard_False);
+  std::vector<Standard_Boolean> aTested (aCandidates.Length(), Standard_False);
+
+  if (theCheckOBB || (myAdaptiveOBB && !theCtx.IsNull()))
+  {
+    BOPDS_HullChecker aHullChecker (*myDS, myCheckHull);
 
-        if (anOBB1.IsOut (anOBB2))
-          continue;
+    // Indices of the pairs to filter
+    NCollection_Vector<Standard_Integer> aToFilter (256, myAllocator);
+    for (Standard_Integer i = 0; i < aCandidates.Length(); ++i)
+    {
+      if (theCheckOBB || IsCostlyPair (*myDS, aCandidates (i)))
+        aToFilter.Append (i);
+    }
+
+    Standard_Boolean isActive = theCheckOBB;
+    if (!isActive && aToFilter.Length() >= THE_MIN_NB_TO_SAMPLE)
+    {
+      // Estimate the rate of false candidates on the evenly distributed sample
+      const Standard_Integer aNbSample = Min (aToFilter.Length(), THE_SAMPLE_SIZE);
+      Standard_Integer aNbRejected = 0;
+      for (Standard_Integer k = 0; k < aNbSample; ++k)
+      {
+        const Standard_Integer i = aToFilter ((Standard_Integer)
+          ((Standard_Real)k * aToFilter.Length() / aNbSample));
+        aTested[i] = Standard_True;
+        if (IsOut (*myDS, aCandidates (i), theCtx, theFuzzyValue, aHullChecker, myStatistics))
+        {
+          aRejected[i] = Standard_True;
+          ++aNbRejected;
+        }
       }
+      myStatistics.NbSampled = aNbSample;
+      isActive = (aNbRejected >= myOBBThreshold * aNbSample);
+    }
 
-      Standard_Integer iX = BOPDS_Tools::TypeToInteger (aType1, aType2);
-      myLists(iX).Append (BOPDS_Pair (Min (aPair.ID1, aPair.ID2),
-                                      Max (aPair.ID1, aPair.ID2)));
+    if (isActive)
+    {
+      myStatistics.IsActive = Standard_True;
+      for (Standard_Integer k = 0; k < aToFilter.Length(); ++k)
+      {
+        const Standard_Integer i = aToFilter (k);
+        if (!aTested[i])
+          aRejected[i] = IsOut (*myDS, aCandidates (i), theCtx, theFuzzyValue, aHullChecker, myStatistics);
+      }
     }
   }
+
+  // Save the pairs
+  for (Standard_Integer i = 0; i < aCandidates.Length(); ++i)
+  {
+    if (aRejected[i])
+      continue;
+
+    const BOPDS_Pair& aPair = aCandidates (i);
+    Standard_Integer n1, n2;
+    aPair.Indices (n1, n2);
+    const Standard_Integer iX = BOPDS_Tools::TypeToInteger (myDS->ShapeInfo (n1).ShapeType(),
+                                                            myDS->ShapeInfo (n2).ShapeType());
+    myLists(iX).Append (aPair);
+  }
 }
 
 //=======================================================================
@@ -37,6 +37,15 @@ class IntTools_Context;
 //! in terms of theirs bounding boxes
 //! 2.provides interface to iterate the pairs of
 //! intersected sub-shapes of given type
+//!
+//! The pairs of sub-shapes with interfering axis-aligned boxes may be
+//! filtered additionally by their oriented bounding boxes (OBB).
+//! The filter is either requested explicitly (see Prepare()) or
+//! turned on adaptively: the OBBs are tested on the sample of the costly
+//! (Edge/Edge, Edge/Face and Face/Face) pairs and if the rate of the false
+//! candidates in the sample exceeds the threshold all costly pairs are filtered.
+//! When the OBB filter is active, the control polygon hull of the B-spline and
+//! Bezier faces is tested against the OBB of the other shape of the pair.
 class BOPDS_Iterator 
 {
 public:
@@ -101,6 +110,47 @@ public:
   //! Returns the flag of parallel processing
   Standard_EXPORT Standard_Boolean RunParallel() const;
 
+public: //! @name Adaptive filtering of the candidates
+
+  //! Statistics of the filtering of the candidate pairs
+  struct FilterStatistics
+  {
+    FilterStatistics()
+    : NbCandidates (0), NbSampled (0), NbTested (0),
+      NbRejectedOBB (0), NbRejectedHull (0), IsActive (Standard_False) {}
+
+    Standard_Integer NbCandidates;   //!< Number of pairs with interfering axis-aligned boxes
+    Standard_Integer NbSampled;      //!< Number of pairs tested to estimate the rate of false candidates
+    Standard_Integer NbTested;       //!< Number of pairs tested by OBB (including sampled ones)
+    Standard_Integer NbRejectedOBB;  //!< Number of pairs rejected by OBB
+    Standard_Integer NbRejectedHull; //!< Number of pairs rejected by the control polygon hull
+    Standard_Boolean IsActive;       //!< Whether the OBB filter has been applied to all costly pairs
+  };
+
+  //! Enables/Disables the adaptive OBB filter used when the OBB check
+  //! is not requested explicitly. Enabled by default.
+  void SetAdaptiveOBB (const Standard_Boolean theFlag) { myAdaptiveOBB = theFlag; }
+
+  //! Returns the flag of the adaptive OBB filter
+  Standard_Boolean AdaptiveOBB() const { return myAdaptiveOBB; }
+
+  //! Sets the rate of false candidates in the sample starting from which
+  //! the adaptive OBB filter is turned on (0.2 by default).
+  void SetOBBThreshold (const Standard_Real theRate) { myOBBThreshold = theRate; }
+
+  //! Returns the threshold of the adaptive OBB filter
+  Standard_Real OBBThreshold() const { return myOBBThreshold; }
+
+  //! Enables/Disables the check of the control polygon hull of the B-spline and
+  //! Bezier faces performed when the OBB filter is active. Enabled by default.
+  void SetCheckHull (const Standard_Boolean theFlag) { myCheckHull = theFlag; }
+
+  //! Returns the flag of the control polygon hull check
+  Standard_Boolean CheckHull() const { return myCheckHull; }
+
+  //! Returns the statistics of the filtering performed by the last call to Prepare()
+  const FilterStatistics& Statistics() const { return myStatistics; }
+
 
 public: //! @name Number of extra interfering types
 
@@ -128,6 +178,10 @@ protected: //! @name Fields
   BOPDS_VectorOfVectorOfPair myExtLists;         //!< Extra pairs of sub-shapes found after
                                                  //! intersection of increased sub-shapes
   Standard_Boolean myUseExt;                     //!< Information flag for using the extra lists
+  Standard_Boolean myAdaptiveOBB;                //!< Flag for the adaptive OBB filter
+  Standard_Real myOBBThreshold;                  //!< Rate of false candidates turning the filter on
+  Standard_Boolean myCheckHull;                  //!< Flag for the control polygon hull check
+  FilterStatistics myStatistics;                 //!< Statistics of the filtering
 
 };
 
@@ -22,8 +22,61 @@
 #include <BOPTools_BoxTree.hxx>
 #include <BRep_Tool.hxx>
 #include <IntTools_Context.hxx>
+#include <TColStd_MapOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 
+#include <algorithm>
+#include <vector>
+
+//=======================================================================
+//class    : BOPDS_RankedPair
+//purpose  : Pair of sub-shapes with the estimation of the likelihood
+//           of its interference
+//=======================================================================
+struct BOPDS_RankedPair
+{
+  BOPDS_Pair       Pair;
+  Standard_Boolean IsAdjacent; //!< the shapes have common vertices
+  Standard_Real    Overlap;    //!< relative overlap of the bounding boxes
+
+  //! The most probable interferences go first
+  bool operator< (const BOPDS_RankedPair& theOther) const
+  {
+    if (IsAdjacent != theOther.IsAdjacent)
+      return !IsAdjacent;
+    return Overlap > theOther.Overlap;
+  }
+};
+
+//=======================================================================
+//function : RelativeOverlap
+//purpose  : Returns the volume of the overlap of the boxes relatively
+//           to the volume of the smaller box
+//=======================================================================
+static Standard_Real RelativeOverlap (const Bnd_Box& theBox1,
+                                      const Bnd_Box& theBox2)
+{
+  if (theBox1.IsVoid() || theBox2.IsVoid())
+    return 0.;
+  //
+  Standard_Real aMin1[3], aMax1[3], aMin2[3], aMax2[3];
+  theBox1.Get (aMin1[0], aMin1[1], aMin1[2], aMax1[0], aMax1[1], aMax1[2]);
+  theBox2.Get (aMin2[0], aMin2[1], aMin2[2], aMax2[0], aMax2[1], aMax2[2]);
+  //
+  Standard_Real aVO = 1., aV1 = 1., aV2 = 1.;
+  for (Standard_Integer i = 0; i < 3; ++i)
+  {
+    const Standard_Real aD = Min (aMax1[i], aMax2[i]) - Max (aMin1[i], aMin2[i]);
+    if (aD <= 0.)
+      return 0.;
+    aVO *= aD;
+    aV1 *= aMax1[i] - aMin1[i];
+    aV2 *= aMax2[i] - aMin2[i];
+  }
+  const Standard_Real aVMin = Min (aV1, aV2);
+  return aVMin > 0. ? aVO / aVMin : 0.;
+}
+
 //
 //=======================================================================
 //function : 
@@ -133,3 +186,97 @@ void BOPDS_IteratorSI::Intersect (const Handle(IntTools_Context)& theCtx,
                                     Max (aPair.ID1, aPair.ID2)));
   }
 }
+//=======================================================================
+// function: HasCommonVertex
+// purpose: 
+//=======================================================================
+Standard_Boolean BOPDS_IteratorSI::HasCommonVertex (const Standard_Integer theI1,
+                                                    const Standard_Integer theI2) const
+{
+  const BOPDS_ShapeInfo& aSI1 = myDS->ShapeInfo (theI1);
+  const BOPDS_ShapeInfo& aSI2 = myDS->ShapeInfo (theI2);
+  //
+  TColStd_MapOfInteger aMV1;
+  if (aSI1.ShapeType() == TopAbs_VERTEX)
+    aMV1.Add (theI1);
+  else
+  {
+    for (TColStd_ListOfInteger::Iterator aIt (aSI1.SubShapes()); aIt.More(); aIt.Next())
+    {
+      if (myDS->ShapeInfo (aIt.Value()).ShapeType() == TopAbs_VERTEX)
+        aMV1.Add (aIt.Value());
+    }
+  }
+  //
+  if (aSI2.ShapeType() == TopAbs_VERTEX)
+    return aMV1.Contains (theI2);
+  //
+  for (TColStd_ListOfInteger::Iterator aIt (aSI2.SubShapes()); aIt.More(); aIt.Next())
+  {
+    if (aMV1.Contains (aIt.Value()))
+      return Standard_True;
+  }
+  return Standard_False;
+}
+//=======================================================================
+// function: OrderByLikelihood
+// purpose: 
+//=======================================================================
+Standard_Integer BOPDS_IteratorSI::OrderByLikelihood (const TopAbs_ShapeEnum theType1,
+                                                      const TopAbs_ShapeEnum theType2)
+{
+  const Standard_Integer iX = BOPDS_Tools::TypeToInteger (theType1, theType2);
+  if (iX < 0)
+    return 0;
+  //
+  while (myOrderedLists.Length() < myLists.Length())
+    myOrderedLists.Appended();
+  //
+  BOPDS_VectorOfPair& aPairs = myLists (iX);
+  // keep the order of the pairs with equal ranks constant
+  std::stable_sort (aPairs.begin(), aPairs.end());
+  //
+  std::vector<BOPDS_RankedPair> aRanked;
+  aRanked.reserve (aPairs.Length());
+  for (BOPDS_VectorOfPair::Iterator aIt (aPairs); aIt.More(); aIt.Next())
+  {
+    Standard_Integer n1, n2;
+    aIt.Value().Indices (n1, n2);
+    //
+    BOPDS_RankedPair aRP;
+    aRP.Pair = aIt.Value();
+    aRP.IsAdjacent = HasCommonVertex (n1, n2);
+    aRP.Overlap = RelativeOverlap (myDS->ShapeInfo (n1).Box(), myDS->ShapeInfo (n2).Box());
+    aRanked.push_back (aRP);
+  }
+  std::stable_sort (aRanked.begin(), aRanked.end());
+  //
+  BOPDS_VectorOfPair& anOrdered = myOrderedLists (iX);
+  anOrdered.Clear();
+  for (size_t i = 0; i < aRanked.size(); ++i)
+    anOrdered.Append (aRanked[i].Pair);
+  //
+  aPairs.Clear();
+  return anOrdered.Length();
+}
+//=======================================================================
+// function: SelectPortion
+// purpose: 
+//=======================================================================
+void BOPDS_IteratorSI::SelectPortion (const TopAbs_ShapeEnum theType1,
+                                      const TopAbs_ShapeEnum theType2,
+                                      const Standard_Integer theFirst,
+                                      const Standard_Integer theNb)
+{
+  const Standard_Integer iX = BOPDS_Tools::TypeToInteger (theType1, theType2);
+  if (iX < 0 || iX >= myOrderedLists.Length())
+    return;
+  //
+  BOPDS_VectorOfPair& aPairs = myLists (iX);
+  aPairs.Clear();
+  //
+  const BOPDS_VectorOfPair& anOrdered = myOrderedLists (iX);
+  const Standard_Integer aLast = Min (theFirst + theNb, anOrdered.Length());
+  for (Standard_Integer i = Max (theFirst, 0); i < aLast; ++i)
+    aPairs.Append (anOrdered (i));
+}
@@ -62,6 +62,37 @@ public:
   //! other - all interferences.
   Standard_EXPORT void UpdateByLevelOfCheck (const Standard_Integer theLevel);
 
+  //! Returns the number of pairs of the given interference type
+  //! (see BOPDS_Tools::TypeToInteger()) to be checked.
+  Standard_Integer NbPairs (const Standard_Integer theInterfType) const
+  {
+    return myLists (theInterfType).Length();
+  }
+
+public: //! @name Check of the pairs by portions
+
+  //! Orders the pairs of sub-shapes of the given types by the likelihood of
+  //! their interference and puts them aside for the iteration by portions
+  //! (see SelectPortion()).
+  //! The pairs of sub-shapes without common vertices go first, as the
+  //! overlapping of their boxes is not explained by the adjacency of the shapes.
+  //! Within each group the pairs are ordered by decreasing volume of the overlap
+  //! of the bounding boxes relatively to the volume of the smaller box.
+  //! Returns the number of the ordered pairs.
+  Standard_EXPORT Standard_Integer OrderByLikelihood (const TopAbs_ShapeEnum theType1,
+                                                      const TopAbs_ShapeEnum theType2);
+
+  //! Makes the ordered pairs of the given types with indices in the range
+  //! [theFirst, theFirst + theNb) available for the iteration.
+  Standard_EXPORT void SelectPortion (const TopAbs_ShapeEnum theType1,
+                                      const TopAbs_ShapeEnum theType2,
+                                      const Standard_Integer theFirst,
+                                      const Standard_Integer theNb);
+
+  //! Returns TRUE if the shapes with the given indices have common vertices.
+  Standard_EXPORT Standard_Boolean HasCommonVertex (const Standard_Integer theI1,
+                                                    const Standard_Integer theI2) const;
+
 
 
 
@@ -72,7 +103,7 @@ protected:
                                          const Standard_Boolean theCheckOBB = Standard_False,
                                          const Standard_Real theFuzzyValue = Precision::Confusion()) Standard_OVERRIDE;
 
-
+  BOPDS_VectorOfVectorOfPair myOrderedLists; //!< Pairs ordered by the likelihood of interference
 
 
 private:
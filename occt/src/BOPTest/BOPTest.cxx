@@ -58,6 +58,8 @@ void  BOPTest::AllCommands(Draw_Interpretor& theCommands)
   BOPTest::RemoveFeaturesCommands(theCommands);
   BOPTest::PeriodicityCommands(theCommands);
   BOPTest::MkConnectedCommands(theCommands);
+  BOPTest::SessionCommands   (theCommands);
+  BOPTest::MeshCommands      (theCommands);
 }
 //=======================================================================
 //function : Factory
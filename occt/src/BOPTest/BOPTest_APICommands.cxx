@@ -14,6 +14,7 @@
 
 
 #include <BOPAlgo_PaveFiller.hxx>
+#include <BOPAlgo_Tools.hxx>
 #include <BOPTest.hxx>
 #include <BOPTest_Objects.hxx>
 #include <BRepAlgoAPI_Common.hxx>
@@ -21,18 +22,22 @@
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepAlgoAPI_Splitter.hxx>
+#include <BRep_Builder.hxx>
 #include <BRepTest_Objects.hxx>
 #include <DBRep.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopTools_ListOfShape.hxx>
 
 #include <Draw_ProgressIndicator.hxx>
 
+#include <sstream>
 #include <stdio.h>
 
 static Standard_Integer bapibuild(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapibop  (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapisplit(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bmbop    (Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : APICommands
@@ -68,6 +73,19 @@ void BOPTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tObjects for the operation are added using commands baddobjects and baddtools.\n"
                   "\t\tUsage: bapisplit result",
                   __FILE__, bapisplit, g);
+
+  theCommands.Add("bmcut", "Cuts the object by all tools at once using top level API.\n"
+                  "\t\tUsage: bmcut result object tool1 [tool2 ...] [-nogroup]\n"
+                  "\t\tEach argument may be a list of shape names.\n"
+                  "\t\tThe tools with mutually disjoint bounding boxes are joined into one argument\n"
+                  "\t\tof the operation to avoid their intersection with each other;\n"
+                  "\t\t-nogroup - disables such grouping (each tool is a separate argument).",
+                  __FILE__, bmbop, g);
+
+  theCommands.Add("bmfuse", "Fuses the object with all tools at once using top level API.\n"
+                  "\t\tUsage: bmfuse result object tool1 [tool2 ...] [-nogroup]\n"
+                  "\t\tThe arguments are the same as for bmcut command.",
+                  __FILE__, bmbop, g);
 }
 //=======================================================================
 //function : bapibop
@@ -144,6 +162,10 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  pBuilder->SetFastPlanar(BOPTest_Objects::FastPlanar());
+  pBuilder->SetProfile(BOPTest_Objects::Profile());
+  pBuilder->SetCache(BOPTest_Objects::BooleanCache());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -212,6 +234,9 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aBuilder.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aBuilder.SetProfile(BOPTest_Objects::Profile());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -272,6 +297,9 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aSplitter.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aSplitter.SetProfile(BOPTest_Objects::Profile());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
@@ -310,3 +338,130 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   DBRep::Set(a[1], aR);
   return 0;
 }
+
+//=======================================================================
+//function : bmbop
+//purpose  : 
+//=======================================================================
+Standard_Integer bmbop(Draw_Interpretor& di,
+                       Standard_Integer n,
+                       const char** a)
+{
+  if (n < 4) {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  //
+  const BOPAlgo_Operation anOp = !strcmp(a[0], "bmcut") ? BOPAlgo_CUT : BOPAlgo_FUSE;
+  //
+  Standard_Boolean bGroup = Standard_True;
+  TopoDS_Shape anObject;
+  TopTools_ListOfShape aLT;
+  for (Standard_Integer i = 2; i < n; ++i) {
+    if (!strcmp(a[i], "-nogroup")) {
+      bGroup = Standard_False;
+      continue;
+    }
+    // The argument may be a list of names
+    std::istringstream aNames(a[i]);
+    std::string aName;
+    while (aNames >> aName) {
+      Standard_CString aShapeName = aName.c_str();
+      TopoDS_Shape aS = DBRep::Get(aShapeName);
+      if (aS.IsNull()) {
+        di << "Error: " << aShapeName << " is a null shape\n";
+        return 1;
+      }
+      if (anObject.IsNull()) {
+        anObject = aS;
+      }
+      else {
+        aLT.Append(aS);
+      }
+    }
+  }
+  //
+  if (aLT.IsEmpty()) {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  //
+  const Standard_Real aFuzzyValue = BOPTest_Objects::FuzzyValue();
+  //
+  TopTools_ListOfShape aLTools;
+  if (bGroup && aLT.Extent() > 1) {
+    // Join the tools which do not interfere with each other
+    TopTools_ListOfListOfShape aLGroups;
+    BOPAlgo_Tools::GroupDisjointShapes(aLT, aFuzzyValue, aLGroups);
+    //
+    BRep_Builder aBB;
+    TopTools_ListOfListOfShape::Iterator aItLG(aLGroups);
+    for (; aItLG.More(); aItLG.Next()) {
+      const TopTools_ListOfShape& aLG = aItLG.Value();
+      if (aLG.Extent() == 1) {
+        aLTools.Append(aLG.First());
+        continue;
+      }
+      TopoDS_Compound aCG;
+      aBB.MakeCompound(aCG);
+      TopTools_ListOfShape::Iterator aItLS(aLG);
+      for (; aItLS.More(); aItLS.Next()) {
+        aBB.Add(aCG, aItLS.Value());
+      }
+      aLTools.Append(aCG);
+    }
+  }
+  else {
+    aLTools = aLT;
+  }
+  //
+  TopTools_ListOfShape aLS;
+  aLS.Append(anObject);
+  //
+  BRepAlgoAPI_BooleanOperation aBuilder;
+  aBuilder.SetOperation(anOp);
+  aBuilder.SetArguments(aLS);
+  aBuilder.SetTools(aLTools);
+  aBuilder.SetRunParallel(BOPTest_Objects::RunParallel());
+  aBuilder.SetFuzzyValue(aFuzzyValue);
+  aBuilder.SetNonDestructive(BOPTest_Objects::NonDestructive());
+  aBuilder.SetGlue(BOPTest_Objects::Glue());
+  aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
+  aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aBuilder.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aBuilder.SetProfile(BOPTest_Objects::Profile());
+  aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
+  //
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+  aBuilder.Build(aProgress->Start());
+  aBuilder.SimplifyResult(BOPTest_Objects::UnifyEdges(),
+                          BOPTest_Objects::UnifyFaces(),
+                          BOPTest_Objects::Angular());
+
+  // Store the history of operation into the session
+  if (BRepTest_Objects::IsHistoryNeeded())
+    BRepTest_Objects::SetHistory(aBuilder.History());
+
+  if (aBuilder.HasWarnings()) {
+    Standard_SStream aSStream;
+    aBuilder.DumpWarnings(aSStream);
+    di << aSStream;
+  }
+  //
+  if (aBuilder.HasErrors()) {
+    Standard_SStream aSStream;
+    aBuilder.DumpErrors(aSStream);
+    di << aSStream;
+    return 0;
+  }
+  //
+  const TopoDS_Shape& aR = aBuilder.Shape();
+  if (aR.IsNull()) {
+    di << "Result is a null shape\n";
+    return 0;
+  }
+  //
+  DBRep::Set(a[1], aR);
+  return 0;
+}
@@ -22,6 +22,7 @@
 #include <BOPDS_DS.hxx>
 #include <BOPTest.hxx>
 #include <BOPTest_Objects.hxx>
+#include <BRepAlgoAPI_BooleanOperation.hxx>
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepTest_Objects.hxx>
 #include <DBRep.hxx>
@@ -57,6 +58,13 @@ static
                        const char** a,
                        const BOPAlgo_Operation aOp);
 //
+static
+  Standard_Integer bsmtcached (Draw_Interpretor& di,
+                               const char* theName,
+                               const TopoDS_Shape& theS1,
+                               const TopoDS_Shape& theS2,
+                               const BOPAlgo_Operation theOp);
+//
 static Standard_Integer bop       (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bopsection(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer boptuc    (Draw_Interpretor&, Standard_Integer, const char**);
@@ -159,6 +167,9 @@ Standard_Integer bop(Draw_Interpretor& di,
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  pPF->SetFastPlanar(BOPTest_Objects::FastPlanar());
+  pPF->SetProfile(BOPTest_Objects::Profile());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
@@ -444,6 +455,9 @@ Standard_Integer  bsection(Draw_Interpretor& di,
   aSec.SetNonDestructive(bNonDestructive);
   aSec.SetGlue(aGlue);
   aSec.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSec.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aSec.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aSec.SetProfile(BOPTest_Objects::Profile());
   //
   aSec.Build(aProgress->Start());  
   // Store the history of Section operation into the session
@@ -496,6 +510,11 @@ Standard_Integer bsmt (Draw_Interpretor& di,
     di << " null shapes are not allowed \n";
     return 0;
   }
+  // The results are reused from the session cache by the API algorithm
+  if (!BOPTest_Objects::BooleanCache().IsNull()) {
+    return bsmtcached(di, a[1], aS1, aS2, aOp);
+  }
+  //
   aLC.Append(aS1);
   aLC.Append(aS2);
   //
@@ -512,6 +531,9 @@ Standard_Integer bsmt (Draw_Interpretor& di,
   aBOP.SetNonDestructive(BOPTest_Objects::NonDestructive());
   aBOP.SetRunParallel(BOPTest_Objects::RunParallel());
   aBOP.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBOP.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aBOP.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aBOP.SetProfile(BOPTest_Objects::Profile());
   aBOP.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBOP.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
@@ -536,6 +558,59 @@ Standard_Integer bsmt (Draw_Interpretor& di,
   return 0;
 }
 //=======================================================================
+//function : bsmtcached
+//purpose  : performs the operation by BRepAlgoAPI_BooleanOperation
+//           taking the result from the session cache if available
+//=======================================================================
+Standard_Integer bsmtcached (Draw_Interpretor& di,
+                             const char* theName,
+                             const TopoDS_Shape& theS1,
+                             const TopoDS_Shape& theS2,
+                             const BOPAlgo_Operation theOp)
+{
+  TopTools_ListOfShape aLA, aLT;
+  // CUT21 is performed as CUT of the swapped arguments, as bapibop does
+  aLA.Append(theOp != BOPAlgo_CUT21 ? theS1 : theS2);
+  aLT.Append(theOp != BOPAlgo_CUT21 ? theS2 : theS1);
+  //
+  BRepAlgoAPI_BooleanOperation aBuilder;
+  aBuilder.SetArguments(aLA);
+  aBuilder.SetTools(aLT);
+  aBuilder.SetOperation(theOp != BOPAlgo_CUT21 ? theOp : BOPAlgo_CUT);
+  // set options
+  aBuilder.SetGlue(BOPTest_Objects::Glue());
+  aBuilder.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  aBuilder.SetNonDestructive(BOPTest_Objects::NonDestructive());
+  aBuilder.SetRunParallel(BOPTest_Objects::RunParallel());
+  aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aBuilder.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aBuilder.SetProfile(BOPTest_Objects::Profile());
+  aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
+  aBuilder.SetCache(BOPTest_Objects::BooleanCache());
+  aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
+  //
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+  aBuilder.Build(aProgress->Start());
+  BOPTest::ReportAlerts(aBuilder.GetReport());
+
+  // Store the history of Boolean operation into the session
+  if (BRepTest_Objects::IsHistoryNeeded())
+    BRepTest_Objects::SetHistory(aBuilder.History());
+
+  if (aBuilder.HasErrors()) {
+    return 0;
+  }
+  const TopoDS_Shape& aR=aBuilder.Shape();
+  if (aR.IsNull()) {
+    di << " null shape\n";
+    return 0;
+  }
+  //
+  DBRep::Set(theName, aR);
+  return 0;
+}
+//=======================================================================
 //function : bopcurves
 //purpose  : 
 //=======================================================================
@@ -829,6 +904,9 @@ Standard_Integer mkvolume(Draw_Interpretor& di, Standard_Integer n, const char**
   aMV.SetAvoidInternalShapes(bAvoidInternal);
   aMV.SetGlue(aGlue);
   aMV.SetUseOBB(BOPTest_Objects::UseOBB());
+  aMV.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aMV.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aMV.SetProfile(BOPTest_Objects::Profile());
   aMV.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
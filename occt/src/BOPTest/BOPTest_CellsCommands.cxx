@@ -116,6 +116,9 @@ Standard_Integer bcbuild(Draw_Interpretor& di,
   aCBuilder.SetGlue(aGlue);
   aCBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aCBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aCBuilder.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aCBuilder.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aCBuilder.SetProfile(BOPTest_Objects::Profile());
   aCBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
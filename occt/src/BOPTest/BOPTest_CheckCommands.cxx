@@ -71,7 +71,7 @@ void  BOPTest::CheckCommands(Draw_Interpretor& theCommands)
   const char* g = "BOPTest commands";
   //
   theCommands.Add("bopcheck",  
-                  "use bopcheck Shape [level of check: 0 - 9] [-t]",
+                  "use bopcheck Shape [level of check: 0 - 9] [-t] [-first] [-budget time]",
                   __FILE__, bopcheck, g);
   theCommands.Add("bopargcheck" , 
                   "use bopargcheck without parameters to get ",  
@@ -157,7 +157,7 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
                            const char** a )
 {
   if (n<2) {
-    di << " use bopcheck Shape [level of check: 0 - 9] [-t]\n";
+    di << " use bopcheck Shape [level of check: 0 - 9] [-t] [-first] [-budget time]\n";
     di << " The level of check defines "; 
     di << " which interferences will be checked:\n";
     di << " 0 - V/V only\n"; 
@@ -171,6 +171,9 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     di << " 8 - V/V, V/E, E/E, V/F, E/F, F/F, E/Z, F/Z\n";
     di << " 9 - V/V, V/E, E/E, V/F, E/F, F/F, E/Z, F/Z, Z/Z\n";
     di << " Default level is 9\n";
+    di << " -t           - prints the time of the check\n";
+    di << " -first       - stops the check at the first confirmed interference\n";
+    di << " -budget time - stops the check after the given time (in seconds)\n";
     return 1;
   }
   //
@@ -180,9 +183,9 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     return 1;
   }
   //
-  Standard_Boolean bRunParallel, bShowTime;
+  Standard_Boolean bRunParallel, bShowTime, bStopOnFirst;
   Standard_Integer i, aLevel, aNbInterfTypes;
-  Standard_Real aTol;
+  Standard_Real aTol, aTimeBudget;
   //
   aNbInterfTypes=BOPDS_DS::NbInterfTypes();
   //
@@ -200,6 +203,8 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
   }
   //
   bShowTime=Standard_False;
+  bStopOnFirst=Standard_False;
+  aTimeBudget=0.;
   aTol=BOPTest_Objects::FuzzyValue();
   bRunParallel=BOPTest_Objects::RunParallel(); 
   //
@@ -207,7 +212,17 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     if (!strcmp(a[i], "-t")) {
       bShowTime=Standard_True;
     }
+    else if (!strcmp(a[i], "-first")) {
+      bStopOnFirst=Standard_True;
+    }
+    else if (!strcmp(a[i], "-budget")) {
+      if (i+1 >= n) {
+        di << "Error: time budget is not given\n";
+        return 1;
       }
+      aTimeBudget=Draw::Atof(a[++i]);
+    }
+  }
   //
   //aLevel = (n==3) ? Draw::Atoi(a[2]) : aNbInterfTypes-1;
   //-------------------------------------------------------------------
@@ -240,6 +255,8 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
   aChecker.SetLevelOfCheck(aLevel);
   aChecker.SetRunParallel(bRunParallel);
   aChecker.SetFuzzyValue(aTol);
+  aChecker.SetStopOnFirst(bStopOnFirst);
+  aChecker.SetTimeBudget(aTimeBudget);
   //
   OSD_Timer aTimer;
   aTimer.Start();
@@ -318,7 +335,12 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     di << "so the list may be incomplete.\n";
   }
   //
-  if (!iCnt) {
+  if (!aChecker.IsComplete()) {
+    di << "The check has been stopped, " << aChecker.NbChecked() << " of "
+       << aChecker.NbCandidates() << " pairs of sub-shapes have been checked.\n";
+  }
+  //
+  if (!iCnt && aChecker.IsComplete()) {
     di << " This shape seems to be OK.\n";
   }
   if (bShowTime)
@@ -240,6 +240,7 @@ Standard_Integer bopiterator (Draw_Interpretor& di,
 
   BOPDS_DS& aDS = *pDS;
   aIt.SetDS(&aDS);
+  aIt.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
   aIt.Prepare(aCtx, BOPTest_Objects::UseOBB(), BOPTest_Objects::FuzzyValue());
   //
   if (n == 1) {
@@ -15,10 +15,13 @@
 
 
 #include <BOPTest.hxx>
+#include <BOPTest_Objects.hxx>
 #include <BOPTools_AlgoTools2D.hxx>
 #include <BRep_GCurve.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_BulkClassifier.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepClass_FaceClassifier.hxx>
 #include <DBRep.hxx>
@@ -27,7 +30,11 @@
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <math_BullardGenerator.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Timer.hxx>
 #include <TopAbs_State.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -48,6 +55,7 @@ static
                                       Standard_Real& Last);
 
 static  Standard_Integer bclassify   (Draw_Interpretor& , Standard_Integer , const char** );
+static  Standard_Integer bclassifypoints (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassify (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassifx (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , const char** );
@@ -65,6 +73,11 @@ static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , con
   const char* g = "BOPTest commands";
   theCommands.Add("bclassify"    , "use bclassify Solid Point [Tolerance=1.e-7]",
                   __FILE__, bclassify   , g);
+  theCommands.Add("bclassifypoints", "use bclassifypoints Shape NbPoints [-tol Tolerance=1.e-7] [-compare]\n"
+    "Classifies <NbPoints> random points of the bounding box of the first solid of the shape\n"
+    "by the bulk classifier on the triangulation of the solid.\n"
+    "-compare: compares the states with the ones of the exact classifier.",
+                  __FILE__, bclassifypoints, g);
   theCommands.Add("b2dclassify"  , "use b2dclassify Face Point2d [Tol] [UseBox] [GapCheckTol]\n" 
     "Classify  the Point  Point2d  with  Tolerance <Tol> on the face described by <Face>.\n" 
     "<UseBox> == 1/0 (default <UseBox> = 0): switch on/off the use Bnd_Box in the classification.\n"
@@ -173,10 +186,13 @@ Standard_Integer bclassify (Draw_Interpretor& theDI,
     theDI << " Null Shape is not allowed\n";
     return 1;
   }
-  else if (aS.ShapeType() != TopAbs_SOLID)  {
-    theDI << " Shape type must be SOLID\n";
+  // the result of Boolean operation is a compound, take its solid
+  TopExp_Explorer anExp (aS, TopAbs_SOLID);
+  if (!anExp.More())  {
+    theDI << " Shape must contain a SOLID\n";
     return 1;
   }
+  aS = anExp.Current();
 
   gp_Pnt aP (8., 9., 10.);
   DrawTrSurf::GetPoint (theArgVec[2], aP);
@@ -190,6 +206,121 @@ Standard_Integer bclassify (Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : bclassifypoints
+//purpose  : 
+//=======================================================================
+Standard_Integer bclassifypoints (Draw_Interpretor& theDI,
+                                  Standard_Integer  theArgNb,
+                                  const char**      theArgVec)
+{
+  if (theArgNb < 3)  {
+    theDI.PrintHelp (theArgVec[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get (theArgVec[1]);
+  if (aS.IsNull())  {
+    theDI << " Null Shape is not allowed\n";
+    return 1;
+  }
+  // the result of Boolean operation is a compound, take its solid
+  TopExp_Explorer anExp (aS, TopAbs_SOLID);
+  if (!anExp.More())  {
+    theDI << " Shape must contain a SOLID\n";
+    return 1;
+  }
+  aS = anExp.Current();
+
+  const Standard_Integer aNbPoints = Draw::Atoi (theArgVec[2]);
+  if (aNbPoints <= 0)  {
+    theDI << " Number of points must be positive\n";
+    return 1;
+  }
+
+  Standard_Real aTol = 1.e-7;
+  Standard_Boolean toCompare = Standard_False;
+  for (Standard_Integer i = 3; i < theArgNb; ++i)
+  {
+    if (!strcmp (theArgVec[i], "-tol") && i + 1 < theArgNb) {
+      aTol = Draw::Atof (theArgVec[++i]);
+    }
+    else if (!strcmp (theArgVec[i], "-compare")) {
+      toCompare = Standard_True;
+    }
+    else {
+      theDI << " Unknown option " << theArgVec[i] << "\n";
+      return 1;
+    }
+  }
+
+  // the points are taken in the slightly enlarged box
+  // to have the points outside of the solid in all directions
+  Bnd_Box aBox;
+  BRepBndLib::Add (aS, aBox);
+  aBox.Enlarge (0.1 * sqrt (aBox.SquareExtent()));
+  Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+  aBox.Get (aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+
+  math_BullardGenerator aRandom;
+  NCollection_Array1<Standard_Real> aCoords (0, 3 * aNbPoints - 1);
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    aCoords (3 * i)     = aRandom.NextReal() * (aXMax - aXMin) + aXMin;
+    aCoords (3 * i + 1) = aRandom.NextReal() * (aYMax - aYMin) + aYMin;
+    aCoords (3 * i + 2) = aRandom.NextReal() * (aZMax - aZMin) + aZMin;
+  }
+  NCollection_Array1<Standard_Byte> aStates (0, aNbPoints - 1);
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+  BRepClass3d_BulkClassifier aBulk (aS, aTol);
+  aBulk.SetRunParallel (BOPTest_Objects::RunParallel());
+  aBulk.Perform (&aCoords.First(), aNbPoints, &aStates.ChangeFirst());
+  aTimer.Stop();
+
+  Standard_Integer aNbIn = 0, aNbOut = 0, aNbOn = 0;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    switch (aStates (i))
+    {
+      case TopAbs_IN:  ++aNbIn;  break;
+      case TopAbs_OUT: ++aNbOut; break;
+      case TopAbs_ON:  ++aNbOn;  break;
+      default: break;
+    }
+  }
+
+  char buf[256];
+  Sprintf (buf, "IN: %d OUT: %d ON: %d, exact: %d, time %.4f s\n",
+           aNbIn, aNbOut, aNbOn, aBulk.NbExact(), aTimer.ElapsedTime());
+  theDI << buf;
+  if (!aBulk.HasMesh()) {
+    theDI << "Warning: the solid is not meshed, all points are classified exactly\n";
+  }
+
+  if (!toCompare) {
+    return 0;
+  }
+
+  aTimer.Reset();
+  aTimer.Start();
+  BRepClass3d_SolidClassifier aSC (aS);
+  Standard_Integer aNbDiff = 0;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    aSC.Perform (gp_Pnt (aCoords (3 * i), aCoords (3 * i + 1), aCoords (3 * i + 2)), aTol);
+    if (aSC.State() != (TopAbs_State )aStates (i)) {
+      ++aNbDiff;
+    }
+  }
+  aTimer.Stop();
+
+  Sprintf (buf, "Exact: time %.4f s, mismatches: %d\n", aTimer.ElapsedTime(), aNbDiff);
+  theDI << buf;
+  return 0;
+}
+
 //=======================================================================
 //function : bhaspc
 //purpose  : 
@@ -0,0 +1,209 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BOPTest.hxx>
+
+#include <BOPTest_Objects.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_BooleanOperation.hxx>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+
+#include <DBRep.hxx>
+#include <Draw.hxx>
+
+#include <GProp_GProps.hxx>
+
+#include <MeshCSG_Boolean.hxx>
+
+#include <OSD_Timer.hxx>
+
+#include <TopoDS_Face.hxx>
+
+static Standard_Integer bmeshop (Draw_Interpretor&, Standard_Integer, const char**);
+
+//=======================================================================
+//function : MeshCommands
+//purpose  : 
+//=======================================================================
+void BOPTest::MeshCommands(Draw_Interpretor& theCommands)
+{
+  static Standard_Boolean done = Standard_False;
+  if (done) return;
+  done = Standard_True;
+  // Chapter's name
+  const char* group = "BOPTest commands";
+  // Commands
+  theCommands.Add("bmeshop", "bmeshop result object tool operation [-d deflection] [-compare]\n"
+                  "\t\tPerforms the approximate Boolean operation on the triangulations of the shapes\n"
+                  "\t\t(preview of the result of the exact operation).\n"
+                  "\t\tThe result is the face holding the resulting triangulation.\n"
+                  "\t\toperation - type of the operation (common, fuse, cut);\n"
+                  "\t\t-d        - meshes the shapes with the given deflection first,\n"
+                  "\t\t            otherwise the shapes should be already meshed (see incmesh);\n"
+                  "\t\t-compare  - performs also the exact Boolean operation and prints\n"
+                  "\t\t            the times of both operations and the deviation of the volume\n"
+                  "\t\t            of the preview from the volume of the exact result (in percents).\n"
+                  "\t\tThe option of parallel processing (brunparallel) is used.",
+                  __FILE__, bmeshop, group);
+}
+
+//=======================================================================
+//function : bmeshop
+//purpose  : 
+//=======================================================================
+Standard_Integer bmeshop(Draw_Interpretor& theDI,
+                         Standard_Integer theArgc,
+                         const char** theArgv)
+{
+  if (theArgc < 5)
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+  //
+  TopoDS_Shape aShapes[2];
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    aShapes[i] = DBRep::Get(theArgv[i + 2]);
+    if (aShapes[i].IsNull())
+    {
+      theDI << "Error: " << theArgv[i + 2] << " is a null shape\n";
+      return 1;
+    }
+  }
+  //
+  MeshCSG_Operation anOp;
+  BOPAlgo_Operation anExactOp;
+  TCollection_AsciiString anOpName(theArgv[4]);
+  anOpName.LowerCase();
+  if (anOpName == "common") {
+    anOp = MeshCSG_Common;
+    anExactOp = BOPAlgo_COMMON;
+  }
+  else if (anOpName == "fuse") {
+    anOp = MeshCSG_Fuse;
+    anExactOp = BOPAlgo_FUSE;
+  }
+  else if (anOpName == "cut") {
+    anOp = MeshCSG_Cut;
+    anExactOp = BOPAlgo_CUT;
+  }
+  else {
+    theDI << "Error: unknown operation " << theArgv[4] << "\n";
+    return 1;
+  }
+  //
+  Standard_Real aDeflection = -1.;
+  Standard_Boolean toCompare = Standard_False;
+  for (Standard_Integer i = 5; i < theArgc; ++i)
+  {
+    if (!strcmp(theArgv[i], "-d") && i + 1 < theArgc) {
+      aDeflection = Draw::Atof(theArgv[++i]);
+    }
+    else if (!strcmp(theArgv[i], "-compare")) {
+      toCompare = Standard_True;
+    }
+    else {
+      theDI << "Error: unknown option " << theArgv[i] << "\n";
+      return 1;
+    }
+  }
+  //
+  const Standard_Boolean bRunParallel = BOPTest_Objects::RunParallel();
+  Handle(Poly_Triangulation) aMeshes[2];
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    if (aDeflection > 0.) {
+      BRepMesh_IncrementalMesh(aShapes[i], aDeflection, Standard_False, 0.5, bRunParallel);
+    }
+    aMeshes[i] = MeshCSG_Boolean::Triangulation(aShapes[i]);
+    if (aMeshes[i].IsNull())
+    {
+      theDI << "Error: " << theArgv[i + 2] << " is not meshed\n";
+      return 1;
+    }
+  }
+  //
+  MeshCSG_Boolean aBop;
+  aBop.SetObject(aMeshes[0]);
+  aBop.SetTool(aMeshes[1]);
+  aBop.SetOperation(anOp);
+  aBop.SetRunParallel(bRunParallel);
+  //
+  OSD_Timer aTimer;
+  aTimer.Start();
+  aBop.Perform();
+  aTimer.Stop();
+  if (!aBop.IsDone())
+  {
+    theDI << "Error: the operation has failed\n";
+    return 0;
+  }
+  const Standard_Real aMeshTime = aTimer.ElapsedTime();
+  //
+  TopoDS_Face aResult;
+  BRep_Builder().MakeFace(aResult, aBop.Result());
+  DBRep::Set(theArgv[1], aResult);
+  //
+  char buf[256];
+  Sprintf(buf, "Preview: %d triangles, %d intersections, time %.4f s\n",
+          aBop.Result()->NbTriangles(), aBop.NbIntersections(), aMeshTime);
+  theDI << buf;
+  //
+  if (!toCompare) {
+    return 0;
+  }
+  //
+  TopTools_ListOfShape anArgs, aTools;
+  anArgs.Append(aShapes[0]);
+  aTools.Append(aShapes[1]);
+  //
+  BRepAlgoAPI_BooleanOperation anExact;
+  anExact.SetOperation(anExactOp);
+  anExact.SetArguments(anArgs);
+  anExact.SetTools(aTools);
+  anExact.SetRunParallel(bRunParallel);
+  anExact.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  anExact.SetUseOBB(BOPTest_Objects::UseOBB());
+  anExact.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  anExact.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  anExact.SetToFillHistory(Standard_False);
+  //
+  aTimer.Reset();
+  aTimer.Start();
+  anExact.Build();
+  aTimer.Stop();
+  BOPTest::ReportAlerts(anExact.GetReport());
+  if (anExact.HasErrors()) {
+    return 0;
+  }
+  const Standard_Real anExactTime = aTimer.ElapsedTime();
+  //
+  GProp_GProps aProps;
+  BRepGProp::VolumeProperties(anExact.Shape(), aProps);
+  const Standard_Real anExactVolume = aProps.Mass();
+  const Standard_Real aMeshVolume = MeshCSG_Boolean::Volume(aBop.Result());
+  const Standard_Real aDeviation = anExactVolume > 0.
+    ? 100. * Abs(aMeshVolume - anExactVolume) / anExactVolume
+    : Abs(aMeshVolume);
+  //
+  Sprintf(buf, "Exact: time %.4f s\n", anExactTime);
+  theDI << buf;
+  Sprintf(buf, "Volume: preview %.6g, exact %.6g, deviation %.4f %%\n",
+          aMeshVolume, anExactVolume, aDeviation);
+  theDI << buf;
+  return 0;
+}
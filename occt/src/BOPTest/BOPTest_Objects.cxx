@@ -108,9 +108,13 @@ class BOPTest_Session {
     myDrawWarnShapes = Standard_False;
     myCheckInverted = Standard_True;
     myUseOBB = Standard_False;
+    myAdaptiveOBB = Standard_True;
+    myFastPlanar = Standard_True;
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
+    myProfile.Nullify();
+    myBooleanCache.Nullify();
   }
   //
   void SetRunParallel(const Standard_Boolean bFlag) {
@@ -168,6 +172,22 @@ class BOPTest_Session {
   Standard_Boolean UseOBB() const {
     return myUseOBB;
   };
+  //
+  void SetAdaptiveOBB(const Standard_Boolean bAdaptive) {
+    myAdaptiveOBB = bAdaptive;
+  };
+  //
+  Standard_Boolean AdaptiveOBB() const {
+    return myAdaptiveOBB;
+  };
+  //
+  void SetFastPlanar(const Standard_Boolean bFastPlanar) {
+    myFastPlanar = bFastPlanar;
+  };
+  //
+  Standard_Boolean FastPlanar() const {
+    return myFastPlanar;
+  };
 
   // Controls the Unification of Edges after BOP
   void SetUnifyEdges(const Standard_Boolean bUE) { myUnifyEdges = bUE; }
@@ -184,6 +204,16 @@ class BOPTest_Session {
   // Returns angular tolerance
   Standard_Real Angular() const { return myAngTol; }
 
+  // Sets the profile of the operations (null handle disables profiling)
+  void SetProfile(const Handle(BOPAlgo_Profile)& theProfile) { myProfile = theProfile; }
+  // Returns the profile of the operations
+  const Handle(BOPAlgo_Profile)& Profile() const { return myProfile; }
+
+  // Sets the cache of results of Boolean operations (null handle disables caching)
+  void SetBooleanCache(const Handle(BRepAlgoAPI_BooleanCache)& theCache) { myBooleanCache = theCache; }
+  // Returns the cache of results of Boolean operations
+  const Handle(BRepAlgoAPI_BooleanCache)& BooleanCache() const { return myBooleanCache; }
+
 protected:
   //
   BOPTest_Session(const BOPTest_Session&);
@@ -204,9 +234,13 @@ protected:
   Standard_Boolean myDrawWarnShapes;
   Standard_Boolean myCheckInverted;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myAdaptiveOBB;
+  Standard_Boolean myFastPlanar;
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
+  Handle(BOPAlgo_Profile) myProfile;
+  Handle(BRepAlgoAPI_BooleanCache) myBooleanCache;
 };
 //
 //=======================================================================
@@ -457,6 +491,38 @@ Standard_Boolean BOPTest_Objects::UseOBB()
   return GetSession().UseOBB();
 }
 //=======================================================================
+//function : SetAdaptiveOBB
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetAdaptiveOBB(const Standard_Boolean bAdaptive)
+{
+  GetSession().SetAdaptiveOBB(bAdaptive);
+}
+//=======================================================================
+//function : AdaptiveOBB
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPTest_Objects::AdaptiveOBB()
+{
+  return GetSession().AdaptiveOBB();
+}
+//=======================================================================
+//function : SetFastPlanar
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetFastPlanar(const Standard_Boolean bFastPlanar)
+{
+  GetSession().SetFastPlanar(bFastPlanar);
+}
+//=======================================================================
+//function : FastPlanar
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPTest_Objects::FastPlanar()
+{
+  return GetSession().FastPlanar();
+}
+//=======================================================================
 //function : SetUnifyEdges
 //purpose  : 
 //=======================================================================
@@ -505,6 +571,38 @@ Standard_Real BOPTest_Objects::Angular()
   return GetSession().Angular();
 }
 //=======================================================================
+//function : SetProfile
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetProfile(const Handle(BOPAlgo_Profile)& theProfile)
+{
+  GetSession().SetProfile(theProfile);
+}
+//=======================================================================
+//function : Profile
+//purpose  : 
+//=======================================================================
+const Handle(BOPAlgo_Profile)& BOPTest_Objects::Profile()
+{
+  return GetSession().Profile();
+}
+//=======================================================================
+//function : SetBooleanCache
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetBooleanCache(const Handle(BRepAlgoAPI_BooleanCache)& theCache)
+{
+  GetSession().SetBooleanCache(theCache);
+}
+//=======================================================================
+//function : BooleanCache
+//purpose  : 
+//=======================================================================
+const Handle(BRepAlgoAPI_BooleanCache)& BOPTest_Objects::BooleanCache()
+{
+  return GetSession().BooleanCache();
+}
+//=======================================================================
 //function : Allocator1
 //purpose  : 
 //=======================================================================
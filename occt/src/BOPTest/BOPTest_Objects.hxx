@@ -23,6 +23,8 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BOPAlgo_CellsBuilder.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_Profile.hxx>
+#include <BRepAlgoAPI_BooleanCache.hxx>
 //
 class BOPAlgo_PaveFiller;
 class BOPAlgo_Builder;
@@ -94,6 +96,14 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  Standard_EXPORT static void SetAdaptiveOBB(const Standard_Boolean bAdaptive);
+
+  Standard_EXPORT static Standard_Boolean AdaptiveOBB();
+
+  Standard_EXPORT static void SetFastPlanar(const Standard_Boolean bFastPlanar);
+
+  Standard_EXPORT static Standard_Boolean FastPlanar();
+
   Standard_EXPORT static void SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
@@ -103,6 +113,16 @@ public:
   Standard_EXPORT static void SetAngular(const Standard_Real bAngTol);
   Standard_EXPORT static Standard_Real Angular();
 
+  //! Sets the profile collecting timings and counters of the operations (null disables profiling)
+  Standard_EXPORT static void SetProfile(const Handle(BOPAlgo_Profile)& theProfile);
+  //! Returns the profile of the operations
+  Standard_EXPORT static const Handle(BOPAlgo_Profile)& Profile();
+
+  //! Sets the cache of results of Boolean operations (null disables caching)
+  Standard_EXPORT static void SetBooleanCache(const Handle(BRepAlgoAPI_BooleanCache)& theCache);
+  //! Returns the cache of results of Boolean operations
+  Standard_EXPORT static const Handle(BRepAlgoAPI_BooleanCache)& BooleanCache();
+
 protected:
 
 private:
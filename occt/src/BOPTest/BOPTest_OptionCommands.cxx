@@ -18,6 +18,7 @@
 #include <DBRep.hxx>
 #include <Draw.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <Standard_SStream.hxx>
 
 #include <string.h>
 static Standard_Integer boptions (Draw_Interpretor&, Standard_Integer, const char**); 
@@ -28,7 +29,10 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bfastplanar(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bopprofile(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bopcache(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : OptionCommands
@@ -72,15 +76,39 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                   __FILE__, bcheckinverted, g);
 
   theCommands.Add("buseobb", "Enables/disables the usage of OBB in BOP algorithms\n"
-                             "\t\tUsage: buseobb 0 (off) / 1 (on)",
+                             "\t\tUsage: buseobb 0 (off) / 1 (on) / 2 (adaptive, default)\n"
+                             "\t\tIn adaptive mode OBBs are used only if the axis-aligned boxes\n"
+                             "\t\tgive many false candidates for intersection",
                   __FILE__, buseobb, g);
 
+  theCommands.Add("bfastplanar", "Enables/disables the closed form intersection of planar and cylindrical faces\n"
+                                 "\t\tbounded by lines and circles in BOP algorithms\n"
+                                 "\t\tUsage: bfastplanar 0 (off) / 1 (on, default)",
+                  __FILE__, bfastplanar, g);
+
   theCommands.Add("bsimplify", "Enables/Disables the result simplification after BOP\n"
                                "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
                                "\t\t-e 0/1 - enables/disables edges unification\n"
                                "\t\t-f 0/1 - enables/disables faces unification\n"
                                "\t\t-a tol - changes default angular tolerance of unification algo (accepts value in degrees).",
                   __FILE__, bsimplify, g);
+
+  theCommands.Add("bopprofile", "Enables/Disables profiling of BOP algorithms and dumps the collected profile.\n"
+                                "\t\tUsage: bopprofile [0/1] [-clear] [-n nb]\n"
+                                "\t\t0/1    - disables/enables profiling (enabling starts the new profile)\n"
+                                "\t\t-clear - clears the collected data\n"
+                                "\t\t-n nb  - number of the slowest Face/Face intersections to dump (10 by default)\n"
+                                "\t\tW/o 0/1 and -clear dumps the profile of the operations performed\n"
+                                "\t\tsince profiling is enabled as JSON object",
+                  __FILE__, bopprofile, g);
+
+  theCommands.Add("bopcache", "Enables/Disables caching of the results of Boolean operations in bapibop command.\n"
+                              "\t\tUsage: bopcache [0/1] [-size nb] [-clear]\n"
+                              "\t\t0/1      - disables/enables caching (enabling starts the new cache)\n"
+                              "\t\t-size nb - maximal number of cached results (64 by default)\n"
+                              "\t\t-clear   - removes all cached results\n"
+                              "\t\tW/o arguments dumps the statistics of the cache",
+                  __FILE__, bopcache, g);
 }
 //=======================================================================
 //function : boptions
@@ -131,9 +159,13 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Check for invert solids: %s \t(%s)\n", BOPTest_Objects::CheckInverted() ? "Yes" : "No",
                "use \"bcheckinverted\" command to change");
   di << buf;
-  Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" : "No",
+  Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" :
+               (BOPTest_Objects::AdaptiveOBB() ? "Adaptive" : "No"),
                "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf, " Fast planar: %s \t\t(%s)\n", BOPTest_Objects::FastPlanar() ? "Yes" : "No",
+               "use \"bfastplanar\" command to change");
+  di << buf;
   Sprintf(buf, " Unify Edges: %s \t\t(%s)\n", BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
                "use \"bsimplify -e\" command to change");
   di << buf;
@@ -143,6 +175,12 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Angular: %g \t\t(%s)\n", BOPTest_Objects::Angular(),
                "use \"bsimplify -a\" command to change");
   di << buf;
+  Sprintf(buf, " Profiling: %s \t\t(%s)\n", !BOPTest_Objects::Profile().IsNull() ? "Yes" : "No",
+               "use \"bopprofile\" command to change");
+  di << buf;
+  Sprintf(buf, " Cache of results: %s \t(%s)\n", !BOPTest_Objects::BooleanCache().IsNull() ? "Yes" : "No",
+               "use \"bopcache\" command to change");
+  di << buf;
   //
   return 0;
 }
@@ -281,7 +319,27 @@ Standard_Integer buseobb(Draw_Interpretor& di,
   }
 
   Standard_Integer iUse = Draw::Atoi(a[1]);
-  BOPTest_Objects::SetUseOBB(iUse != 0);
+  BOPTest_Objects::SetUseOBB(iUse == 1);
+  BOPTest_Objects::SetAdaptiveOBB(iUse == 2);
+  return 0;
+}
+
+//=======================================================================
+//function : bfastplanar
+//purpose  : 
+//=======================================================================
+Standard_Integer bfastplanar(Draw_Interpretor& di,
+                             Standard_Integer n,
+                             const char** a)
+{
+  if (n != 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  Standard_Integer iUse = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetFastPlanar(iUse != 0);
   return 0;
 }
 
@@ -325,3 +383,109 @@ Standard_Integer bsimplify(Draw_Interpretor& di,
   }
   return 0;
 }
+
+//=======================================================================
+//function : bopprofile
+//purpose  : 
+//=======================================================================
+Standard_Integer bopprofile(Draw_Interpretor& di,
+                            Standard_Integer n,
+                            const char** a)
+{
+  Standard_Boolean bDump = Standard_True;
+  Standard_Integer aNbSlowest = 10;
+  for (Standard_Integer i = 1; i < n; ++i)
+  {
+    if (!strcmp(a[i], "0") || !strcmp(a[i], "1"))
+    {
+      BOPTest_Objects::SetProfile(!strcmp(a[i], "1") ? new BOPAlgo_Profile() : NULL);
+      bDump = Standard_False;
+    }
+    else if (!strcmp(a[i], "-clear"))
+    {
+      if (!BOPTest_Objects::Profile().IsNull())
+        BOPTest_Objects::Profile()->Clear();
+      bDump = Standard_False;
+    }
+    else if (!strcmp(a[i], "-n") && i + 1 < n)
+    {
+      aNbSlowest = Draw::Atoi(a[++i]);
+    }
+    else
+    {
+      di << "Wrong key option.\n";
+      di.PrintHelp(a[0]);
+      return 1;
+    }
+  }
+  //
+  if (!bDump)
+    return 0;
+  //
+  const Handle(BOPAlgo_Profile)& aProfile = BOPTest_Objects::Profile();
+  if (aProfile.IsNull())
+  {
+    di << "Profiling is disabled, use \"bopprofile 1\" to enable it\n";
+    return 0;
+  }
+  //
+  Standard_SStream aSStream;
+  aProfile->Dump(aSStream, aNbSlowest);
+  di << aSStream.str().c_str() << "\n";
+  return 0;
+}
+
+//=======================================================================
+//function : bopcache
+//purpose  : 
+//=======================================================================
+Standard_Integer bopcache(Draw_Interpretor& di,
+                          Standard_Integer n,
+                          const char** a)
+{
+  Standard_Boolean bDump = (n == 1);
+  for (Standard_Integer i = 1; i < n; ++i)
+  {
+    if (!strcmp(a[i], "0") || !strcmp(a[i], "1"))
+    {
+      BOPTest_Objects::SetBooleanCache(!strcmp(a[i], "1") ? new BRepAlgoAPI_BooleanCache() : NULL);
+    }
+    else if (!strcmp(a[i], "-size") && i + 1 < n)
+    {
+      Standard_Integer aSize = Draw::Atoi(a[++i]);
+      if (aSize < 1)
+      {
+        di << "The size of the cache should be positive.\n";
+        return 1;
+      }
+      if (!BOPTest_Objects::BooleanCache().IsNull())
+        BOPTest_Objects::BooleanCache()->SetMaxSize(aSize);
+    }
+    else if (!strcmp(a[i], "-clear"))
+    {
+      if (!BOPTest_Objects::BooleanCache().IsNull())
+        BOPTest_Objects::BooleanCache()->Clear();
+    }
+    else
+    {
+      di << "Wrong key option.\n";
+      di.PrintHelp(a[0]);
+      return 1;
+    }
+  }
+  //
+  if (!bDump)
+    return 0;
+  //
+  const Handle(BRepAlgoAPI_BooleanCache)& aCache = BOPTest_Objects::BooleanCache();
+  if (aCache.IsNull())
+  {
+    di << "Caching is disabled, use \"bopcache 1\" to enable it\n";
+    return 0;
+  }
+  //
+  di << "Cached results: " << aCache->Extent() << " of " << aCache->MaxSize() << "\n";
+  di << "Hits: " << aCache->NbHits() << " (by content: " << aCache->NbContentHits() << ")\n";
+  di << "Misses: " << aCache->NbMisses() << "\n";
+  return 0;
+}
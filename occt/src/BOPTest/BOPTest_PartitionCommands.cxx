@@ -166,6 +166,9 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aPF.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aPF.SetProfile(BOPTest_Objects::Profile());
   //
   OSD_Timer aTimer;
   aTimer.Start();
@@ -246,6 +249,7 @@ Standard_Integer bbuild(Draw_Interpretor& di,
   }
   aBuilder.SetRunParallel(bRunParallel);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
+  aBuilder.SetProfile(BOPTest_Objects::Profile());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -364,6 +368,7 @@ Standard_Integer bbop(Draw_Interpretor& di,
   //
   pBuilder->SetRunParallel(bRunParallel);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
+  pBuilder->SetProfile(BOPTest_Objects::Profile());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -439,6 +444,7 @@ Standard_Integer bsplit(Draw_Interpretor& di,
   pSplitter->SetNonDestructive(BOPTest_Objects::NonDestructive());
   pSplitter->SetFuzzyValue(BOPTest_Objects::FuzzyValue());
   pSplitter->SetCheckInverted(BOPTest_Objects::CheckInverted());
+  pSplitter->SetProfile(BOPTest_Objects::Profile());
   pSplitter->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // measure the time of the operation
@@ -0,0 +1,203 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BOPTest.hxx>
+
+#include <BOPAlgo_BooleanSession.hxx>
+
+#include <BOPTest_Objects.hxx>
+
+#include <BRepTest_Objects.hxx>
+
+#include <DBRep.hxx>
+#include <Draw.hxx>
+#include <Draw_ProgressIndicator.hxx>
+
+static Standard_Integer bsession    (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bsessionrun (Draw_Interpretor&, Standard_Integer, const char**);
+
+namespace
+{
+  static BOPAlgo_BooleanSession& getBooleanSession()
+  {
+    static BOPAlgo_BooleanSession TheBooleanSession;
+    return TheBooleanSession;
+  }
+}
+
+//=======================================================================
+//function : SessionCommands
+//purpose  : 
+//=======================================================================
+void BOPTest::SessionCommands(Draw_Interpretor& theCommands)
+{
+  static Standard_Boolean done = Standard_False;
+  if (done) return;
+  done = Standard_True;
+  // Chapter's name
+  const char* group = "BOPTest commands";
+  // Commands
+  theCommands.Add("bsession", "bsession [tool [operation] [-interactive]] [-clear]\n"
+                  "\t\tStarts the session of Boolean operations with the same tool\n"
+                  "\t\tand its copies placed differently.\n"
+                  "\t\ttool         - the tool of the operations;\n"
+                  "\t\toperation    - type of the operations (common, fuse, cut, tuc), cut by default;\n"
+                  "\t\t-interactive - keeps the intersection results of the recent operations\n"
+                  "\t\t               for reuse when the tool is dragged;\n"
+                  "\t\t-clear       - releases the data cached by the session.\n"
+                  "\t\tWithout arguments prints the number of operations performed in the session\n"
+                  "\t\tand the number of reused Face/Face intersections.",
+                  __FILE__, bsession, group);
+
+  theCommands.Add("bsessionrun", "bsessionrun result object [toolcopy]\n"
+                  "\t\tPerforms the Boolean operation of the session between the object\n"
+                  "\t\tand the copy of the tool (the tool itself if not given).\n"
+                  "\t\tThe copy should differ from the tool by location only (see copy, ttranslate, trotate).\n"
+                  "\t\tThe options of Boolean operations (bfuzzyvalue, brunparallel, buseobb) are used.",
+                  __FILE__, bsessionrun, group);
+}
+
+//=======================================================================
+//function : bsession
+//purpose  : 
+//=======================================================================
+Standard_Integer bsession(Draw_Interpretor& theDI,
+                          Standard_Integer theArgc,
+                          const char** theArgv)
+{
+  BOPAlgo_BooleanSession& aSession = getBooleanSession();
+  if (theArgc == 1)
+  {
+    theDI << "Number of operations: " << aSession.NbOperations() << "\n";
+    theDI << "Reused intersections: " << aSession.NbReusedIntersections() << "\n";
+    return 0;
+  }
+
+  if (theArgc == 2 && !strcmp(theArgv[1], "-clear"))
+  {
+    aSession.Clear();
+    return 0;
+  }
+
+  TopoDS_Shape aTool;
+  BOPAlgo_Operation anOp = BOPAlgo_CUT;
+  Standard_Boolean isInteractive = Standard_False;
+  for (Standard_Integer i = 1; i < theArgc; ++i)
+  {
+    if (!strcmp(theArgv[i], "-interactive"))
+    {
+      isInteractive = Standard_True;
+    }
+    else if (aTool.IsNull())
+    {
+      aTool = DBRep::Get(theArgv[i]);
+      if (aTool.IsNull())
+      {
+        theDI << "Error: " << theArgv[i] << " is a null shape\n";
+        return 1;
+      }
+    }
+    else
+    {
+      anOp = BOPTest::GetOperationType(theArgv[i]);
+      if (anOp == BOPAlgo_UNKNOWN || anOp == BOPAlgo_SECTION)
+      {
+        theDI << "Error: invalid operation type " << theArgv[i] << "\n";
+        return 1;
+      }
+    }
+  }
+
+  if (aTool.IsNull())
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+
+  aSession.SetTool(aTool);
+  aSession.SetOperation(anOp);
+  aSession.SetInteractive(isInteractive);
+  return 0;
+}
+
+//=======================================================================
+//function : bsessionrun
+//purpose  : 
+//=======================================================================
+Standard_Integer bsessionrun(Draw_Interpretor& theDI,
+                             Standard_Integer theArgc,
+                             const char** theArgv)
+{
+  if (theArgc < 3 || theArgc > 4)
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+
+  BOPAlgo_BooleanSession& aSession = getBooleanSession();
+  if (aSession.Tool().IsNull())
+  {
+    theDI << "Error: the session has not been started, use bsession command\n";
+    return 1;
+  }
+
+  TopoDS_Shape anObject = DBRep::Get(theArgv[2]);
+  if (anObject.IsNull())
+  {
+    theDI << "Error: " << theArgv[2] << " is a null shape\n";
+    return 1;
+  }
+
+  TopoDS_Shape aToolCopy = aSession.Tool();
+  if (theArgc == 4)
+  {
+    aToolCopy = DBRep::Get(theArgv[3]);
+    if (aToolCopy.IsNull())
+    {
+      theDI << "Error: " << theArgv[3] << " is a null shape\n";
+      return 1;
+    }
+  }
+
+  aSession.SetRunParallel(BOPTest_Objects::RunParallel());
+  aSession.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  aSession.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSession.SetAdaptiveOBB(BOPTest_Objects::AdaptiveOBB());
+  aSession.SetFastPlanar(BOPTest_Objects::FastPlanar());
+  aSession.SetProfile(BOPTest_Objects::Profile());
+  aSession.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  aSession.PerformWithCopy(anObject, aToolCopy, aProgress->Start());
+
+  // Print Error/Warning messages
+  BOPTest::ReportAlerts(aSession.GetReport());
+
+  // Store the history of Boolean operation into the session
+  if (BRepTest_Objects::IsHistoryNeeded())
+    BRepTest_Objects::SetHistory(aSession.History());
+
+  if (aSession.HasErrors())
+    return 0;
+
+  const TopoDS_Shape& aResult = aSession.Shape();
+  if (aResult.IsNull())
+  {
+    theDI << " null shape\n";
+    return 0;
+  }
+
+  DBRep::Set(theArgv[1], aResult);
+  return 0;
+}
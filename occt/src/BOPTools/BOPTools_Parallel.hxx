@@ -18,12 +18,136 @@
 #include <OSD_Parallel.hxx>
 #include <OSD_ThreadPool.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard_Mutex.hxx>
 #include <OSD_Thread.hxx>
 
 //! Implementation of Functors/Starters
 class BOPTools_Parallel
 {
+  //! Auxiliary thread ID  hasher.
+  struct Hasher
+  {
+    //! Computes a hash code for the given thread identifier, in the range [1, theUpperBound]
+    //! @param theThreadId the thread identifier which hash code is to be computed
+    //! @param theUpperBound the upper bound of the range a computing hash code must be within
+    //! @return a computed hash code, in the range [1, theUpperBound]
+    static Standard_Integer HashCode (const Standard_ThreadId theThreadId, const Standard_Integer theUpperBound)
+    {
+      return ::HashCode (theThreadId, theUpperBound);
+    }
+
+    static Standard_Boolean IsEqual(const Standard_ThreadId theKey1,
+                                    const Standard_ThreadId theKey2)
+    {
+      return theKey1 == theKey2;
+    }
+  };
+
+public:
+
+  //! Pool of algorithm contexts of the threads executing the parallel loops.
+  //! The pool keeps the contexts between the loops, so that the tools cached by the contexts
+  //! (projectors, classifiers etc.) are built once per thread for the whole algorithm
+  //! rather than for each loop.
+  template<class TypeContext>
+  class ContextPool
+  {
+  public:
+
+    //! Constructor
+    ContextPool() {}
+
+    //! Sets the context of the calling thread.
+    //! The contexts of the other threads are released if the context is changed.
+    void SetContext (const opencascade::handle<TypeContext>& theContext)
+    {
+      if (myContext != theContext)
+      {
+        Clear();
+        myContext = theContext;
+      }
+    }
+
+    //! Returns the context of the calling thread.
+    const opencascade::handle<TypeContext>& Context() const
+    {
+      return myContext;
+    }
+
+    //! Releases all contexts.
+    void Clear()
+    {
+      myContext.Nullify();
+      myIndexedContexts.Clear();
+      myContextMap.Clear();
+    }
+
+  public: //! @name Access to the contexts from the functors
+
+    //! Prepares the slots for the contexts of the threads of the pool launcher with indices [0, theNbThreads).
+    //! Should be called from the calling thread before the loop.
+    void Reserve (const Standard_Integer theNbThreads)
+    {
+      while (myIndexedContexts.Length() < theNbThreads)
+      {
+        myIndexedContexts.Appended();
+      }
+    }
+
+    //! Returns the context of the thread with the given index of the pool launcher
+    //! (see Reserve()), the context is created on first access.
+    const opencascade::handle<TypeContext>& IndexedContext (const Standard_Integer theThreadIndex)
+    {
+      opencascade::handle<TypeContext>& aContext = myIndexedContexts.ChangeValue (theThreadIndex);
+      if (aContext.IsNull())
+      {
+        aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+      }
+      return aContext;
+    }
+
+    //! Returns the context of the current thread identified by its ID,
+    //! the context is created on first access.
+    const opencascade::handle<TypeContext>& ThreadContext()
+    {
+      const Standard_ThreadId aThreadID = OSD_Thread::Current();
+      {
+        Standard_Mutex::Sentry aLocker (myMutex);
+        const opencascade::handle<TypeContext>* aContextPtr = myContextMap.Seek (aThreadID);
+        if (aContextPtr && !aContextPtr->IsNull())
+        {
+          return *aContextPtr;
+        }
+      }
+
+      // Create new context
+      opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+
+      Standard_Mutex::Sentry aLocker (myMutex);
+      return *myContextMap.Bound (aThreadID, aContext);
+    }
+
+    //! Binds the context of the calling thread to its ID.
+    void BindThreadContext()
+    {
+      Standard_Mutex::Sentry aLocker (myMutex);
+      myContextMap.Bind (OSD_Thread::Current(), myContext);
+    }
+
+  private:
+    ContextPool (const ContextPool&);
+    ContextPool& operator= (const ContextPool&);
+
+  private:
+    opencascade::handle<TypeContext> myContext;
+    NCollection_Vector<opencascade::handle<TypeContext> > myIndexedContexts;
+    NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>, Hasher> myContextMap;
+    Standard_Mutex myMutex;
+  };
+
+private:
+
   template<class TypeSolverVector>
   class Functor
   {
@@ -46,64 +170,24 @@ class BOPTools_Parallel
     TypeSolverVector& mySolvers;
   };
 
-  //! Functor storing map of thread id -> algorithm context
+  //! Functor taking the algorithm contexts from the pool by thread id
   template<class TypeSolverVector, class TypeContext>
   class ContextFunctor
   {
-    //! Auxiliary thread ID  hasher.
-    struct Hasher
-    {
-      //! Computes a hash code for the given thread identifier, in the range [1, theUpperBound]
-      //! @param theThreadId the thread identifier which hash code is to be computed
-      //! @param theUpperBound the upper bound of the range a computing hash code must be within
-      //! @return a computed hash code, in the range [1, theUpperBound]
-      static Standard_Integer HashCode (const Standard_ThreadId theThreadId, const Standard_Integer theUpperBound)
-      {
-        return ::HashCode (theThreadId, theUpperBound);
-      }
-
-      static Standard_Boolean IsEqual(const Standard_ThreadId theKey1,
-                                      const Standard_ThreadId theKey2)
-      {
-        return theKey1 == theKey2;
-      }
-    };
-
   public:
 
     //! Constructor
-    explicit ContextFunctor (TypeSolverVector& theVector) : mySolverVector(theVector) {}
-
-    //! Binds main thread context
-    void SetContext (const opencascade::handle<TypeContext>& theContext)
-    {
-      myContextMap.Bind (OSD_Thread::Current(), theContext);
-    }
-
-    //! Returns current thread context
-    const opencascade::handle<TypeContext>& GetThreadContext() const
+    ContextFunctor (TypeSolverVector& theVector, ContextPool<TypeContext>& thePool)
+    : mySolverVector(theVector),
+      myPool (thePool)
     {
-      const Standard_ThreadId aThreadID = OSD_Thread::Current();
-      if (const opencascade::handle<TypeContext>* aContextPtr = myContextMap.Seek (aThreadID))
-      {
-        if (!aContextPtr->IsNull())
-        {
-          return *aContextPtr;
-        }
-      }
-
-      // Create new context
-      opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
-
-      Standard_Mutex::Sentry aLocker (myMutex);
-      myContextMap.Bind (aThreadID, aContext);
-      return myContextMap (aThreadID);
+      myPool.BindThreadContext();
     }
 
     //! Defines functor interface
     void operator()( const Standard_Integer theIndex ) const
     {
-      const opencascade::handle<TypeContext>& aContext = GetThreadContext();
+      const opencascade::handle<TypeContext>& aContext = myPool.ThreadContext();
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
 
       aSolver.SetContext(aContext);
@@ -116,36 +200,33 @@ class BOPTools_Parallel
 
   private:
     TypeSolverVector& mySolverVector;
-    mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>, Hasher> myContextMap;
-    mutable Standard_Mutex myMutex;
+    ContextPool<TypeContext>& myPool;
   };
 
-  //! Functor storing array of algorithm contexts per thread in pool
+  //! Functor taking the algorithm contexts from the pool by thread index in the pool launcher
   template<class TypeSolverVector, class TypeContext>
   class ContextFunctor2
   {
   public:
 
     //! Constructor
-    explicit ContextFunctor2 (TypeSolverVector& theVector, const OSD_ThreadPool::Launcher& thePoolLauncher)
+    ContextFunctor2 (TypeSolverVector& theVector,
+                     const OSD_ThreadPool::Launcher& thePoolLauncher,
+                     ContextPool<TypeContext>& thePool)
     : mySolverVector(theVector),
-      myContextArray (thePoolLauncher.LowerThreadIndex(), thePoolLauncher.UpperThreadIndex()) {}
-
-    //! Binds main thread context
-    void SetContext (const opencascade::handle<TypeContext>& theContext)
+      myPool (thePool),
+      myMainThreadIndex (thePoolLauncher.UpperThreadIndex()) // reserved for a main thread
     {
-      myContextArray.ChangeLast() = theContext; // OSD_ThreadPool::Launcher::UpperThreadIndex() is reserved for a main thread
+      myPool.Reserve (myMainThreadIndex + 1);
     }
 
     //! Defines functor interface with serialized thread index.
     void operator() (int theThreadIndex,
                      int theIndex) const
     {
-      opencascade::handle<TypeContext>& aContext = myContextArray.ChangeValue (theThreadIndex);
-      if (aContext.IsNull())
-      {
-        aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
-      }
+      const opencascade::handle<TypeContext>& aContext = theThreadIndex == myMainThreadIndex && !myPool.Context().IsNull()
+                                                       ? myPool.Context()
+                                                       : myPool.IndexedContext (theThreadIndex);
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
       aSolver.SetContext (aContext);
       aSolver.Perform();
@@ -157,7 +238,8 @@ class BOPTools_Parallel
 
   private:
     TypeSolverVector& mySolverVector;
-    mutable NCollection_Array1< opencascade::handle<TypeContext> > myContextArray;
+    ContextPool<TypeContext>& myPool;
+    int myMainThreadIndex;
   };
 
 public:
@@ -176,19 +258,28 @@ public:
   static void Perform (Standard_Boolean  theIsRunParallel,
                        TypeSolverVector& theSolverVector,
                        opencascade::handle<TypeContext>& theContext)
+  {
+    ContextPool<TypeContext> aPool;
+    aPool.SetContext (theContext);
+    Perform (theIsRunParallel, theSolverVector, aPool);
+  }
+
+  //! Context dependent version taking the contexts of the threads from the pool
+  template<class TypeSolverVector, class TypeContext>
+  static void Perform (Standard_Boolean  theIsRunParallel,
+                       TypeSolverVector& theSolverVector,
+                       ContextPool<TypeContext>& thePool)
   {
     if (OSD_Parallel::ToUseOcctThreads())
     {
       const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
       OSD_ThreadPool::Launcher aPoolLauncher (*aThreadPool, theIsRunParallel ? theSolverVector.Length() : 0);
-      ContextFunctor2<TypeSolverVector, TypeContext> aFunctor (theSolverVector, aPoolLauncher);
-      aFunctor.SetContext (theContext);
+      ContextFunctor2<TypeSolverVector, TypeContext> aFunctor (theSolverVector, aPoolLauncher, thePool);
       aPoolLauncher.Perform (0, theSolverVector.Length(), aFunctor);
     }
     else
     {
-      ContextFunctor<TypeSolverVector, TypeContext> aFunctor (theSolverVector);
-      aFunctor.SetContext (theContext);
+      ContextFunctor<TypeSolverVector, TypeContext> aFunctor (theSolverVector, thePool);
       OSD_Parallel::For (0, theSolverVector.Length(), aFunctor, !theIsRunParallel);
     }
   }
@@ -254,6 +254,72 @@ void  BRepAdaptor_Surface::D1(const Standard_Real U,
   D1V.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : transformBatch
+//purpose  : transforms the points or the vectors stored as the structure of arrays
+//=======================================================================
+
+static void transformBatch (const gp_Trsf& theTrsf,
+                            const Standard_Boolean isVector,
+                            TColStd_Array1OfReal& theCoords)
+{
+  if (theTrsf.Form() == gp_Identity)
+  {
+    return;
+  }
+  const Standard_Integer aNbPoints = theCoords.Length() / 3;
+  const Standard_Integer aLower = theCoords.Lower();
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    gp_XYZ aXYZ (theCoords (aLower + i),
+                 theCoords (aLower + aNbPoints + i),
+                 theCoords (aLower + 2 * aNbPoints + i));
+    if (isVector)
+    {
+      gp_Vec aVec (aXYZ);
+      aVec.Transform (theTrsf);
+      aXYZ = aVec.XYZ();
+    }
+    else
+    {
+      theTrsf.Transforms (aXYZ);
+    }
+    theCoords (aLower + i)                 = aXYZ.X();
+    theCoords (aLower + aNbPoints + i)     = aXYZ.Y();
+    theCoords (aLower + 2 * aNbPoints + i) = aXYZ.Z();
+  }
+}
+
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D0Batch (const TColStd_Array1OfReal& theU,
+                                   const TColStd_Array1OfReal& theV,
+                                   TColStd_Array1OfReal& thePoints) const
+{
+  mySurf.D0Batch (theU, theV, thePoints);
+  transformBatch (myTrsf, Standard_False, thePoints);
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D1Batch (const TColStd_Array1OfReal& theU,
+                                   const TColStd_Array1OfReal& theV,
+                                   TColStd_Array1OfReal& thePoints,
+                                   TColStd_Array1OfReal& theD1U,
+                                   TColStd_Array1OfReal& theD1V) const
+{
+  mySurf.D1Batch (theU, theV, thePoints, theD1U, theD1V);
+  transformBatch (myTrsf, Standard_False, thePoints);
+  transformBatch (myTrsf, Standard_True,  theD1U);
+  transformBatch (myTrsf, Standard_True,  theD1V);
+}
+
 
 //=======================================================================
 //function : D2
@@ -153,6 +153,14 @@ public:
   //! Tip: use GeomLib::NormEstim() to calculate surface normal at specified (U, V) point.
   Standard_EXPORT void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const Standard_OVERRIDE;
 
+  //! Computes the points of the surface at the parameters (theU(i), theV(i)) at once
+  //! (see Adaptor3d_Surface::D0Batch()).
+  Standard_EXPORT void D0Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the surface at the parameters
+  //! (theU(i), theV(i)) at once (see Adaptor3d_Surface::D1Batch()).
+  Standard_EXPORT void D1Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1U, TColStd_Array1OfReal& theD1V) const Standard_OVERRIDE;
+
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //! Raised  if   the   continuity   of the current
@@ -52,6 +52,13 @@ public:
   using BOPAlgo_Options::ClearWarnings;
   using BOPAlgo_Options::GetReport;
   using BOPAlgo_Options::SetUseOBB;
+  using BOPAlgo_Options::UseOBB;
+  using BOPAlgo_Options::SetAdaptiveOBB;
+  using BOPAlgo_Options::AdaptiveOBB;
+  using BOPAlgo_Options::SetFastPlanar;
+  using BOPAlgo_Options::FastPlanar;
+  using BOPAlgo_Options::SetProfile;
+  using BOPAlgo_Options::Profile;
 
 protected:
 
@@ -0,0 +1,367 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepAlgoAPI_BooleanCache.hxx>
+
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_BooleanOperation.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <sstream>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepAlgoAPI_BooleanCache, Standard_Transient)
+
+//=======================================================================
+//function : isEqualLists
+//purpose  : Returns TRUE if the lists contain the same shapes (TShapes,
+//           locations and orientations) in the same order
+//=======================================================================
+static Standard_Boolean isEqualLists (const TopTools_ListOfShape& theList1,
+                                      const TopTools_ListOfShape& theList2)
+{
+  if (theList1.Extent() != theList2.Extent())
+    return Standard_False;
+  TopTools_ListIteratorOfListOfShape aIt1 (theList1), aIt2 (theList2);
+  for (; aIt1.More(); aIt1.Next(), aIt2.Next())
+  {
+    if (!aIt1.Value().IsEqual (aIt2.Value()))
+      return Standard_False;
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : mapShapes
+//purpose  : Maps all sub-shapes of the shapes of the list
+//=======================================================================
+static void mapShapes (const TopTools_ListOfShape& theList,
+                       TopTools_IndexedMapOfShape& theMap)
+{
+  for (TopTools_ListIteratorOfListOfShape aIt (theList); aIt.More(); aIt.Next())
+    TopExp::MapShapes (aIt.Value(), theMap);
+}
+
+//=======================================================================
+//function : BRepAlgoAPI_BooleanCache
+//purpose  :
+//=======================================================================
+BRepAlgoAPI_BooleanCache::BRepAlgoAPI_BooleanCache (const Standard_Integer theMaxSize)
+: myMaxSize (Max (theMaxSize, 1)),
+  myNbHits (0),
+  myNbContentHits (0),
+  myNbMisses (0)
+{
+  myLastMiss.Hash = 0;
+}
+
+//=======================================================================
+//function : SetMaxSize
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_BooleanCache::SetMaxSize (const Standard_Integer theMaxSize)
+{
+  myMaxSize = Max (theMaxSize, 1);
+  while (myEntries.Extent() > myMaxSize)
+    myEntries.RemoveFirst();
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_BooleanCache::Clear()
+{
+  myEntries.Clear();
+  myLastMiss.Arguments.Clear();
+  myLastMiss.Tools.Clear();
+  myLastMiss.Hash = 0;
+  myNbHits = 0;
+  myNbContentHits = 0;
+  myNbMisses = 0;
+}
+
+//=======================================================================
+//function : HashOperands
+//purpose  :
+//=======================================================================
+uint64_t BRepAlgoAPI_BooleanCache::HashOperands (const TopTools_ListOfShape& theArguments,
+                                                 const TopTools_ListOfShape& theTools)
+{
+  // Write all operands as a single compound to take into account
+  // the sub-shapes shared between the operands
+  BRep_Builder aBB;
+  TopoDS_Compound aComp;
+  aBB.MakeCompound (aComp);
+  for (TopTools_ListIteratorOfListOfShape aIt (theArguments); aIt.More(); aIt.Next())
+    aBB.Add (aComp, aIt.Value());
+  for (TopTools_ListIteratorOfListOfShape aIt (theTools); aIt.More(); aIt.Next())
+    aBB.Add (aComp, aIt.Value());
+
+  std::ostringstream aStream;
+  BinTools::Write (aComp, aStream, Standard_False, Standard_False, BinTools_FormatVersion_CURRENT);
+  const std::string aData = aStream.str();
+
+  // FNV-1a
+  uint64_t aHash = 14695981039346656037ULL;
+  for (std::string::const_iterator aIt = aData.begin(); aIt != aData.end(); ++aIt)
+  {
+    aHash ^= uint64_t (Standard_Byte (*aIt));
+    aHash *= 1099511628211ULL;
+  }
+  // Mix in the number of arguments to distinguish the split of the same shapes
+  // into arguments and tools
+  aHash ^= uint64_t (theArguments.Extent());
+  aHash *= 1099511628211ULL;
+  return aHash != 0 ? aHash : 1;
+}
+
+//=======================================================================
+//function : makeKey
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_BooleanCache::makeKey (const BRepAlgoAPI_BooleanOperation& theBOP,
+                                        Key& theKey)
+{
+  theKey.Arguments = theBOP.Arguments();
+  theKey.Tools = theBOP.Tools();
+  theKey.Operation = theBOP.Operation();
+  theKey.FuzzyValue = theBOP.FuzzyValue();
+  theKey.Glue = theBOP.Glue();
+  theKey.NonDestructive = theBOP.NonDestructive();
+  theKey.CheckInverted = theBOP.CheckInverted();
+  theKey.FillHistory = theBOP.HasHistory();
+  theKey.UseOBB = theBOP.UseOBB();
+  theKey.AdaptiveOBB = theBOP.AdaptiveOBB();
+  theKey.FastPlanar = theBOP.FastPlanar();
+  theKey.Hash = 0;
+}
+
+//=======================================================================
+//function : isSameOptions
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepAlgoAPI_BooleanCache::isSameOptions (const Key& theKey1,
+                                                          const Key& theKey2)
+{
+  return theKey1.Operation == theKey2.Operation
+      && theKey1.FuzzyValue == theKey2.FuzzyValue
+      && theKey1.Glue == theKey2.Glue
+      && theKey1.NonDestructive == theKey2.NonDestructive
+      && theKey1.CheckInverted == theKey2.CheckInverted
+      && theKey1.FillHistory == theKey2.FillHistory
+      && theKey1.UseOBB == theKey2.UseOBB
+      && theKey1.AdaptiveOBB == theKey2.AdaptiveOBB
+      && theKey1.FastPlanar == theKey2.FastPlanar;
+}
+
+//=======================================================================
+//function : isSameOperands
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepAlgoAPI_BooleanCache::isSameOperands (const Key& theKey1,
+                                                           const Key& theKey2)
+{
+  return isEqualLists (theKey1.Arguments, theKey2.Arguments)
+      && isEqualLists (theKey1.Tools, theKey2.Tools);
+}
+
+//=======================================================================
+//function : touch
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_BooleanCache::touch (ListOfEntry::Iterator& theIt)
+{
+  if (&theIt.Value() == &myEntries.Last())
+    return;
+  const Entry anEntry = theIt.Value();
+  myEntries.Remove (theIt);
+  myEntries.Append (anEntry);
+}
+
+//=======================================================================
+//function : remapHistory
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepAlgoAPI_BooleanCache::remapHistory (const Entry& theEntry,
+                                                         const Key& theKey,
+                                                         Handle(BRepTools_History)& theHistory)
+{
+  // Pair the sub-shapes of the old and new operands.
+  // The operands have the same content, thus they are explored in the same order.
+  TopTools_IndexedMapOfShape aMOld, aMNew;
+  mapShapes (theEntry.OpKey.Arguments, aMOld);
+  mapShapes (theEntry.OpKey.Tools, aMOld);
+  mapShapes (theKey.Arguments, aMNew);
+  mapShapes (theKey.Tools, aMNew);
+
+  const Standard_Integer aNbS = aMOld.Extent();
+  if (aNbS != aMNew.Extent())
+    return Standard_False;
+  for (Standard_Integer i = 1; i <= aNbS; ++i)
+  {
+    if (aMOld (i).ShapeType() != aMNew (i).ShapeType())
+      return Standard_False;
+  }
+
+  theHistory.Nullify();
+  if (theEntry.History.IsNull())
+    return Standard_True;
+
+  // The result is not rebuilt, as the Boolean operation stores the data related
+  // to the result in the sub-shapes of the operands (e.g. parameters of the vertices
+  // on the split edges). Instead, the sub-shapes of the old operands kept in the result
+  // are considered as modified from the corresponding sub-shapes of the new operands.
+  TopTools_IndexedMapOfShape aMResult;
+  TopExp::MapShapes (theEntry.Result, aMResult);
+
+  theHistory = new BRepTools_History;
+  for (Standard_Integer i = 1; i <= aNbS; ++i)
+  {
+    const TopoDS_Shape& aSOld = aMOld (i);
+    if (!BRepTools_History::IsSupportedType (aSOld))
+      continue;
+
+    const TopoDS_Shape& aSNew = aMNew (i);
+    if (theEntry.History->IsRemoved (aSOld))
+      theHistory->Remove (aSNew);
+
+    TopTools_ListIteratorOfListOfShape aIt (theEntry.History->Modified (aSOld));
+    for (; aIt.More(); aIt.Next())
+      theHistory->AddModified (aSNew, aIt.Value());
+
+    aIt.Initialize (theEntry.History->Generated (aSOld));
+    for (; aIt.More(); aIt.Next())
+      theHistory->AddGenerated (aSNew, aIt.Value());
+
+    if (!aSOld.IsSame (aSNew) && aMResult.Contains (aSOld))
+      theHistory->AddModified (aSNew, aMResult.FindKey (aMResult.FindIndex (aSOld)));
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepAlgoAPI_BooleanCache::Find (const BRepAlgoAPI_BooleanOperation& theBOP,
+                                                 TopoDS_Shape& theResult,
+                                                 Handle(BRepTools_History)& theHistory)
+{
+  Key aKey;
+  makeKey (theBOP, aKey);
+
+  // Look for the same operands first, it does not require hashing
+  ListOfEntry::Iterator aIt (myEntries);
+  for (; aIt.More(); aIt.Next())
+  {
+    const Entry& anEntry = aIt.Value();
+    if (isSameOptions (anEntry.OpKey, aKey) && isSameOperands (anEntry.OpKey, aKey))
+      break;
+  }
+
+  if (aIt.More())
+  {
+    touch (aIt);
+    const Entry& anEntry = myEntries.Last();
+    theResult = anEntry.Result;
+    theHistory.Nullify();
+    if (!anEntry.History.IsNull())
+    {
+      theHistory = new BRepTools_History;
+      theHistory->Merge (anEntry.History);
+    }
+    ++myNbHits;
+    return Standard_True;
+  }
+
+  // Look for the operands with the same content
+  aKey.Hash = HashOperands (aKey.Arguments, aKey.Tools);
+  for (aIt.Initialize (myEntries); aIt.More(); aIt.Next())
+  {
+    const Entry& anEntry = aIt.Value();
+    if (anEntry.OpKey.Hash != aKey.Hash || !isSameOptions (anEntry.OpKey, aKey))
+      continue;
+
+    Handle(BRepTools_History) aHistory;
+    if (!remapHistory (anEntry, aKey, aHistory))
+      continue;
+
+    // Keep the history for the new operands, as the old ones are not likely to be used again
+    touch (aIt);
+    Entry& aLast = myEntries.Last();
+    aLast.OpKey = aKey;
+    aLast.History = aHistory;
+    theResult = aLast.Result;
+
+    theHistory.Nullify();
+    if (!aHistory.IsNull())
+    {
+      theHistory = new BRepTools_History;
+      theHistory->Merge (aHistory);
+    }
+    ++myNbHits;
+    ++myNbContentHits;
+    return Standard_True;
+  }
+
+  myLastMiss = aKey;
+  ++myNbMisses;
+  return Standard_False;
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_BooleanCache::Add (const BRepAlgoAPI_BooleanOperation& theBOP,
+                                    const TopoDS_Shape& theResult,
+                                    const Handle(BRepTools_History)& theHistory)
+{
+  Entry anEntry;
+  makeKey (theBOP, anEntry.OpKey);
+  // Use the hash of the operands before the operation if available
+  if (myLastMiss.Hash != 0 &&
+      isSameOptions (myLastMiss, anEntry.OpKey) &&
+      isSameOperands (myLastMiss, anEntry.OpKey))
+    anEntry.OpKey.Hash = myLastMiss.Hash;
+  else
+    anEntry.OpKey.Hash = HashOperands (anEntry.OpKey.Arguments, anEntry.OpKey.Tools);
+
+  myLastMiss.Arguments.Clear();
+  myLastMiss.Tools.Clear();
+  myLastMiss.Hash = 0;
+
+  // Remove the entry of the same operation
+  for (ListOfEntry::Iterator aIt (myEntries); aIt.More();)
+  {
+    const Key& aKey = aIt.Value().OpKey;
+    if (aKey.Hash == anEntry.OpKey.Hash && isSameOptions (aKey, anEntry.OpKey))
+      myEntries.Remove (aIt);
+    else
+      aIt.Next();
+  }
+
+  anEntry.Result = theResult;
+  if (!theHistory.IsNull())
+  {
+    anEntry.History = new BRepTools_History;
+    anEntry.History->Merge (theHistory);
+  }
+  myEntries.Append (anEntry);
+
+  while (myEntries.Extent() > myMaxSize)
+    myEntries.RemoveFirst();
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepAlgoAPI_BooleanCache_HeaderFile
+#define _BRepAlgoAPI_BooleanCache_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_Handle.hxx>
+#include <Standard_Transient.hxx>
+
+#include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_Operation.hxx>
+#include <BRepTools_History.hxx>
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+#include <stdint.h>
+
+class BRepAlgoAPI_BooleanOperation;
+
+class BRepAlgoAPI_BooleanCache;
+DEFINE_STANDARD_HANDLE(BRepAlgoAPI_BooleanCache, Standard_Transient)
+
+//! Cache of the results of Boolean operations, shared by the consecutive runs
+//! of the operations (see BRepAlgoAPI_BooleanOperation::SetCache()).
+//!
+//! The result is reused when the operation is performed on the same operands
+//! with the same type and options (fuzzy value, gluing, safe processing mode,
+//! check for inverted solids, filling of the history, usage of oriented and
+//! adaptive oriented bounding boxes and fast intersection of planar faces).
+//! The operands are matched:
+//! - by identity, i.e. the arguments and tools are the same shapes
+//!   (the same TShapes, locations and orientations) as in the cached operation;
+//! - by content, i.e. the arguments and tools, rebuilt from scratch, have the same
+//!   geometry, tolerances, locations and topology as in the cached operation.
+//!   The content is compared by the hash of the shapes in binary format (without triangulations).
+//!   In this case the cached result is returned as is, and the history of the operation
+//!   is rebuilt for the new operands, so that it is possible to track the new operands
+//!   to the result. The sub-shapes of the old operands kept in the result unchanged
+//!   are considered as modified from the corresponding sub-shapes of the new operands.
+//!
+//! The number of stored results is bounded by MaxSize(), the least recently used
+//! result is removed when the limit is exceeded.
+//!
+//! Note that the cached result shares sub-shapes with the operands and the callers,
+//! thus the operations modifying shapes in place (e.g. Boolean operations in
+//! the destructive mode increasing the tolerances of arguments) affect the stored results.
+class BRepAlgoAPI_BooleanCache : public Standard_Transient
+{
+public:
+
+  DEFINE_STANDARD_RTTIEXT(BRepAlgoAPI_BooleanCache, Standard_Transient)
+
+  //! Creates the empty cache keeping at most theMaxSize results.
+  Standard_EXPORT BRepAlgoAPI_BooleanCache (const Standard_Integer theMaxSize = 64);
+
+  //! Looks for the result of the operation with the same operands and options.
+  //! The operation is not modified, the operands are not hashed if they are
+  //! found by identity.
+  //! @param theBOP [in] operation to look for
+  //! @param theResult [out] the result of the operation
+  //! @param theHistory [out] the history of the operation (the copy which can be modified
+  //!                         by the caller), null if the history is not filled by the operation
+  //! @return TRUE if the result is found
+  Standard_EXPORT Standard_Boolean Find (const BRepAlgoAPI_BooleanOperation& theBOP,
+                                         TopoDS_Shape& theResult,
+                                         Handle(BRepTools_History)& theHistory);
+
+  //! Stores the result of the operation.
+  //! The content hash of the operands computed by the last unsuccessful call to Find()
+  //! for the same operands is used, thus the modifications of the operands
+  //! made by the operation itself are not taken into account.
+  //! @param theBOP [in] performed operation
+  //! @param theResult [in] the result of the operation
+  //! @param theHistory [in] the history of the operation (copied by the cache)
+  Standard_EXPORT void Add (const BRepAlgoAPI_BooleanOperation& theBOP,
+                            const TopoDS_Shape& theResult,
+                            const Handle(BRepTools_History)& theHistory);
+
+  //! Sets the maximal number of stored results, removing the least recently used ones.
+  Standard_EXPORT void SetMaxSize (const Standard_Integer theMaxSize);
+
+  //! Returns the maximal number of stored results.
+  Standard_Integer MaxSize() const { return myMaxSize; }
+
+  //! Removes all stored results and resets the counters.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of stored results.
+  Standard_Integer Extent() const { return myEntries.Extent(); }
+
+  //! Returns the number of results reused from the cache.
+  Standard_Integer NbHits() const { return myNbHits; }
+
+  //! Returns the number of results reused by the content of the operands
+  //! (included into NbHits()).
+  Standard_Integer NbContentHits() const { return myNbContentHits; }
+
+  //! Returns the number of operations not found in the cache.
+  Standard_Integer NbMisses() const { return myNbMisses; }
+
+  //! Computes the content hash of the operands, i.e. FNV-1a hash of the compound
+  //! of the arguments and tools written in binary format without triangulations.
+  Standard_EXPORT static uint64_t HashOperands (const TopTools_ListOfShape& theArguments,
+                                                const TopTools_ListOfShape& theTools);
+
+protected:
+
+  //! Key of the operation
+  struct Key
+  {
+    TopTools_ListOfShape Arguments;   //!< Arguments of the operation
+    TopTools_ListOfShape Tools;       //!< Tools of the operation
+    BOPAlgo_Operation Operation;      //!< Type of the operation
+    Standard_Real FuzzyValue;         //!< Fuzzy value
+    BOPAlgo_GlueEnum Glue;            //!< Gluing option
+    Standard_Boolean NonDestructive;  //!< Safe processing mode
+    Standard_Boolean CheckInverted;   //!< Check for inverted solids
+    Standard_Boolean FillHistory;     //!< Filling of the history
+    Standard_Boolean UseOBB;          //!< Usage of oriented bounding boxes
+    Standard_Boolean AdaptiveOBB;     //!< Adaptive filtering by oriented bounding boxes
+    Standard_Boolean FastPlanar;      //!< Fast intersection of planar faces
+    uint64_t Hash;                    //!< Content hash of the operands (zero if not computed)
+  };
+
+  //! Stored result of the operation
+  struct Entry
+  {
+    Key OpKey;                           //!< Key of the operation
+    TopoDS_Shape Result;                 //!< Result of the operation
+    Handle(BRepTools_History) History;   //!< History of the operation
+  };
+
+  typedef NCollection_List<Entry> ListOfEntry;
+
+  //! Fills the key of the operation (without hash).
+  Standard_EXPORT static void makeKey (const BRepAlgoAPI_BooleanOperation& theBOP,
+                                       Key& theKey);
+
+  //! Returns TRUE if the operations have the same type and options.
+  Standard_EXPORT static Standard_Boolean isSameOptions (const Key& theKey1,
+                                                         const Key& theKey2);
+
+  //! Returns TRUE if the operations have the identical operands.
+  Standard_EXPORT static Standard_Boolean isSameOperands (const Key& theKey1,
+                                                          const Key& theKey2);
+
+  //! Rebuilds the history of the stored operation for the operands of the key.
+  //! @return FALSE if the operands have different topology
+  Standard_EXPORT static Standard_Boolean remapHistory (const Entry& theEntry,
+                                                        const Key& theKey,
+                                                        Handle(BRepTools_History)& theHistory);
+
+  //! Moves the entry to the end of the list, marking it as the most recently used.
+  Standard_EXPORT void touch (ListOfEntry::Iterator& theIt);
+
+protected:
+
+  ListOfEntry myEntries;      //!< Entries from the least to the most recently used
+  Key myLastMiss;             //!< Key of the last operation not found in the cache
+  Standard_Integer myMaxSize;
+  Standard_Integer myNbHits;
+  Standard_Integer myNbContentHits;
+  Standard_Integer myNbMisses;
+
+};
+
+#endif // _BRepAlgoAPI_BooleanCache_HeaderFile
@@ -187,6 +187,16 @@ void BRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& theRange)
       return;
   }
 
+  // Take the result from the cache if the same operation has already been performed.
+  // The operations with precomputed intersection are not cached.
+  const Standard_Boolean isCached = !myCache.IsNull() && myIsIntersectionNeeded &&
+                                    myOperation != BOPAlgo_SECTION;
+  if (isCached && myCache->Find(*this, myShape, myHistory))
+  {
+    Done();
+    return;
+  }
+
   Message_ProgressScope aPS(theRange, aPSName, myIsIntersectionNeeded ? 100 : 30);
   // If necessary perform intersection of the argument shapes
   if (myIsIntersectionNeeded)
@@ -230,6 +240,11 @@ void BRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& theRange)
     return;
   }
 
+  if (isCached)
+  {
+    myCache->Add(*this, myShape, myHistory);
+  }
+
   if (aDumpOper.IsDump()) {
     Standard_Boolean isDumpRes = myShape.IsNull() ||
                                  !BRepAlgoAPI_Check(myShape).IsValid();
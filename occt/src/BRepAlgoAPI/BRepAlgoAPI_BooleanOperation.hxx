@@ -22,6 +22,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_Operation.hxx>
+#include <BRepAlgoAPI_BooleanCache.hxx>
 #include <BRepAlgoAPI_BuilderAlgo.hxx>
 class BOPAlgo_PaveFiller;
 class TopoDS_Shape;
@@ -48,6 +49,10 @@ class TopoDS_Shape;
 //! Additionally to the errors of the base class the algorithm returns
 //! the following Errors:<br>
 //! - *BOPAlgo_AlertBOPNotSet* - in case the type of Boolean Operation is not set.<br>
+//!
+//! The results of the operations *FUSE*, *COMMON* and *CUT* can be reused by the
+//! consecutive operations on the same operands with the help of the cache of results
+//! (see *SetCache()* and *BRepAlgoAPI_BooleanCache*).
 class BRepAlgoAPI_BooleanOperation  : public BRepAlgoAPI_BuilderAlgo
 {
 public:
@@ -107,6 +112,26 @@ public: //! @name Setting/Getting the type of Boolean operation
   }
 
 
+public: //! @name Caching the results
+
+  //! Sets the cache of results of Boolean operations (null handle disables caching).
+  //! If the result of the operation with the same operands and options is found in the cache,
+  //! the operation is not performed, the result and history are taken from the cache.
+  //! In this case the intersection and building tools are not available, thus
+  //! the section edges are not returned by the SectionEdges() method.
+  //! The SECTION operation is not cached.
+  void SetCache(const Handle(BRepAlgoAPI_BooleanCache)& theCache)
+  {
+    myCache = theCache;
+  }
+
+  //! Returns the cache of results of Boolean operations
+  const Handle(BRepAlgoAPI_BooleanCache)& Cache() const
+  {
+    return myCache;
+  }
+
+
 public: //! @name Performing the operation
 
   //! Performs the Boolean operation.
@@ -134,6 +159,7 @@ protected: //! @name Fields
 
   TopTools_ListOfShape myTools;  //!< Tool arguments of operation
   BOPAlgo_Operation myOperation; //!< Type of Boolean Operation
+  Handle(BRepAlgoAPI_BooleanCache) myCache; //!< Cache of results of Boolean operations
 
 };
 
@@ -130,6 +130,9 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape& theArg
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetAdaptiveOBB(myAdaptiveOBB);
+  myDSFiller->SetFastPlanar(myFastPlanar);
+  myDSFiller->SetProfile(myProfile);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -147,6 +150,7 @@ void BRepAlgoAPI_BuilderAlgo::BuildResult(const Message_ProgressRange& theRange)
   myBuilder->SetRunParallel(myRunParallel);
 
   myBuilder->SetCheckInverted(myCheckInverted);
+  myBuilder->SetProfile(myProfile);
   myBuilder->SetToFillHistory(myFillHistory);
   // Perform building of the result with pre-calculated intersections
   myBuilder->PerformWithFiller(*myDSFiller, theRange);
@@ -0,0 +1,414 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepClass3d_BulkClassifier.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+namespace
+{
+  typedef BRepClass3d_BulkClassifier::BVHSet BVHSet;
+
+  //! Number of points in the batch processed by one thread at once.
+  static const Standard_Integer THE_BATCH_SIZE = 1024;
+
+  //! Directions of the rays used for classification of the points,
+  //! chosen with the irrational ratios of the coordinates to avoid passing
+  //! through the edges of the regular (e.g. axis aligned) triangulations.
+  static const gp_XYZ THE_RAY_DIRS[3] =
+  {
+    gp_XYZ ( 1.0,        1.41421356,  1.73205081).Normalized(),
+    gp_XYZ (-2.23606798, 1.0,        -2.64575131).Normalized(),
+    gp_XYZ ( 3.14159265, -2.71828183, -1.0).Normalized()
+  };
+
+  //=======================================================================
+  //function : triangle
+  //purpose  : Returns the nodes of the triangle of the set
+  //=======================================================================
+  static void triangle (const BVHSet& theSet,
+                        const Standard_Integer theIndex,
+                        BVH_Vec3d theNodes[3])
+  {
+    const BVH_Vec4i& anElem = theSet.Elements[theIndex];
+    theNodes[0] = theSet.Vertices[anElem.x()];
+    theNodes[1] = theSet.Vertices[anElem.y()];
+    theNodes[2] = theSet.Vertices[anElem.z()];
+  }
+
+  //=======================================================================
+  //class    : BRepClass3d_RayCounter
+  //purpose  : Counts the intersections of the ray with the triangles
+  //=======================================================================
+  class BRepClass3d_RayCounter : public BVH_Traverse<Standard_Real, 3, BVHSet>
+  {
+  public:
+
+    BRepClass3d_RayCounter (const BVHSet& theSet, const gp_XYZ& theOrigin, const gp_XYZ& theDir)
+    : mySet (theSet),
+      myOrigin (theOrigin.X(), theOrigin.Y(), theOrigin.Z()),
+      myDir (theDir.X(), theDir.Y(), theDir.Z()),
+      myNbHits (0)
+    {}
+
+    //! Slab test of the box.
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin, const BVH_Vec3d& theMax,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      Standard_Real aTimeEnter = 0.0, aTimeLeave = 0.0;
+      return !BVH_Tools<Standard_Real, 3>::RayBoxIntersection (myOrigin, myDir, theMin, theMax,
+                                                               aTimeEnter, aTimeLeave);
+    }
+
+    //! Counts the triangle if it is hit in front of the origin.
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      BVH_Vec3d aNodes[3];
+      triangle (mySet, theIndex, aNodes);
+      Standard_Real aTime = 0.0;
+      if (!BVH_Tools<Standard_Real, 3>::RayTriangleIntersection (myOrigin, myDir,
+                                                                 aNodes[0], aNodes[1], aNodes[2], aTime)
+       || aTime <= 0.0)
+      {
+        return Standard_False;
+      }
+      ++myNbHits;
+      return Standard_True;
+    }
+
+    Standard_Integer NbHits() const { return myNbHits; }
+
+  private:
+
+    const BVHSet&    mySet;
+    BVH_Vec3d        myOrigin;
+    BVH_Vec3d        myDir;
+    Standard_Integer myNbHits;
+  };
+
+  //=======================================================================
+  //class    : BRepClass3d_BandSelector
+  //purpose  : Checks if the point is closer to the triangles than the band
+  //=======================================================================
+  class BRepClass3d_BandSelector : public BVH_Traverse<Standard_Real, 3, BVHSet>
+  {
+  public:
+
+    BRepClass3d_BandSelector (const BVHSet& theSet, const BVH_Vec3d& thePnt, const Standard_Real theBand)
+    : mySet (theSet), myPnt (thePnt), mySqBand (theBand * theBand), myIsNear (Standard_False)
+    {}
+
+    //! Rejects the boxes farther than the band.
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin, const BVH_Vec3d& theMax,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      return BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myPnt, theMin, theMax) > mySqBand;
+    }
+
+    //! Checks the distance to the triangle.
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      BVH_Vec3d aNodes[3];
+      triangle (mySet, theIndex, aNodes);
+      myIsNear = BVH_Tools<Standard_Real, 3>::PointTriangleSquareDistance
+        (myPnt, aNodes[0], aNodes[1], aNodes[2]) <= mySqBand;
+      return myIsNear;
+    }
+
+    //! Stops at the first triangle within the band.
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsNear; }
+
+    Standard_Boolean IsNear() const { return myIsNear; }
+
+  private:
+
+    const BVHSet&    mySet;
+    BVH_Vec3d        myPnt;
+    Standard_Real    mySqBand;
+    Standard_Boolean myIsNear;
+  };
+
+  //=======================================================================
+  //class    : BRepClass3d_BulkFunctor
+  //purpose  : Classifies the batches of points
+  //=======================================================================
+  class BRepClass3d_BulkFunctor
+  {
+  public:
+
+    BRepClass3d_BulkFunctor (const BRepClass3d_BulkClassifier& theAlgo,
+                             const TopoDS_Shape& theSolid,
+                             const Standard_Real* theCoords,
+                             const Standard_Integer theNbPoints,
+                             Standard_Byte* theStates,
+                             NCollection_Array1<BRepClass3d_SolidClassifier*>& theClassifiers,
+                             NCollection_Array1<Standard_Integer>& theNbExact)
+    : myAlgo (theAlgo), mySolid (theSolid), myCoords (theCoords), myNbPoints (theNbPoints),
+      myStates (theStates), myClassifiers (theClassifiers), myNbExact (theNbExact)
+    {}
+
+    void operator() (int theThreadIndex, int theBatchIndex) const
+    {
+      const Standard_Integer aFirst = theBatchIndex * THE_BATCH_SIZE;
+      const Standard_Integer aLast = Min (aFirst + THE_BATCH_SIZE, myNbPoints);
+      Standard_Integer aNbExact = 0;
+      for (Standard_Integer i = aFirst; i < aLast; ++i)
+      {
+        const gp_Pnt aP (myCoords[3 * i], myCoords[3 * i + 1], myCoords[3 * i + 2]);
+        TopAbs_State aState = TopAbs_UNKNOWN;
+        if (!myAlgo.ClassifyOnMesh (aP, aState))
+        {
+          // the exact classifiers are loaded on demand, as the most of points
+          // are usually classified on the mesh
+          BRepClass3d_SolidClassifier*& aClassifier = myClassifiers.ChangeValue (theThreadIndex);
+          if (aClassifier == NULL)
+          {
+            aClassifier = new BRepClass3d_SolidClassifier (mySolid);
+          }
+          aClassifier->Perform (aP, myAlgo.Tolerance());
+          aState = aClassifier->State();
+          ++aNbExact;
+        }
+        myStates[i] = (Standard_Byte )aState;
+      }
+      myNbExact.ChangeValue (theBatchIndex) = aNbExact;
+    }
+
+  private:
+
+    BRepClass3d_BulkFunctor (const BRepClass3d_BulkFunctor&);
+    BRepClass3d_BulkFunctor& operator= (const BRepClass3d_BulkFunctor&);
+
+  private:
+
+    const BRepClass3d_BulkClassifier&                 myAlgo;
+    const TopoDS_Shape&                               mySolid;
+    const Standard_Real*                              myCoords;
+    Standard_Integer                                  myNbPoints;
+    Standard_Byte*                                    myStates;
+    NCollection_Array1<BRepClass3d_SolidClassifier*>& myClassifiers;
+    NCollection_Array1<Standard_Integer>&             myNbExact;
+  };
+}
+
+//=======================================================================
+//function : BRepClass3d_BulkClassifier
+//purpose  : 
+//=======================================================================
+BRepClass3d_BulkClassifier::BRepClass3d_BulkClassifier()
+: myTol (0.0),
+  myBand (0.0),
+  myHasMesh (Standard_False),
+  myIsInfinite (Standard_False),
+  myRunParallel (Standard_False),
+  myNbExact (0)
+{
+}
+
+//=======================================================================
+//function : BRepClass3d_BulkClassifier
+//purpose  : 
+//=======================================================================
+BRepClass3d_BulkClassifier::BRepClass3d_BulkClassifier (const TopoDS_Shape& theSolid,
+                                                        const Standard_Real theTol)
+: myTol (0.0),
+  myBand (0.0),
+  myHasMesh (Standard_False),
+  myIsInfinite (Standard_False),
+  myRunParallel (Standard_False),
+  myNbExact (0)
+{
+  Load (theSolid, theTol);
+}
+
+//=======================================================================
+//function : Load
+//purpose  : 
+//=======================================================================
+void BRepClass3d_BulkClassifier::Load (const TopoDS_Shape& theSolid,
+                                       const Standard_Real theTol)
+{
+  mySolid = theSolid;
+  myTol = theTol;
+  myNbExact = 0;
+  myClassifier.Load (theSolid);
+  // the parity of the intersections gives the state relatively
+  // the finite volume, thus it is inverted for the infinite solids
+  myClassifier.PerformInfinitePoint (theTol);
+  myIsInfinite = (myClassifier.State() == TopAbs_IN);
+  buildMesh();
+}
+
+//=======================================================================
+//function : buildMesh
+//purpose  : 
+//=======================================================================
+void BRepClass3d_BulkClassifier::buildMesh()
+{
+  mySet.Nullify();
+  myTree.Nullify();
+  myBox.Clear();
+  myBand = 0.0;
+  myHasMesh = Standard_False;
+
+  Standard_Real aMaxDeflection = 0.0, aMaxTol = 0.0;
+  Handle(BVHSet) aSet = new BVHSet (new BVH_LinearBuilder<Standard_Real, 3>());
+  for (TopExp_Explorer anExp (mySolid, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTriangulation.IsNull() || aTriangulation->NbTriangles() == 0)
+    {
+      return;
+    }
+    aMaxDeflection = Max (aMaxDeflection, aTriangulation->Deflection());
+    aMaxTol = Max (aMaxTol, BRep_Tool::Tolerance (aFace));
+
+    // the orientation of the triangles is not used by the parity check
+    const gp_Trsf& aTrsf = aLoc.Transformation();
+    const Standard_Integer aShift = (Standard_Integer )aSet->Vertices.size() - 1;
+    for (Standard_Integer i = 1; i <= aTriangulation->NbNodes(); ++i)
+    {
+      gp_Pnt aP = aTriangulation->Node (i);
+      aP.Transform (aTrsf);
+      aSet->Vertices.push_back (BVH_Vec3d (aP.X(), aP.Y(), aP.Z()));
+    }
+    for (Standard_Integer i = 1; i <= aTriangulation->NbTriangles(); ++i)
+    {
+      Standard_Integer n1, n2, n3;
+      aTriangulation->Triangle (i).Get (n1, n2, n3);
+      aSet->Elements.push_back (BVH_Vec4i (n1 + aShift, n2 + aShift, n3 + aShift,
+                                           (Standard_Integer )aSet->Elements.size()));
+    }
+  }
+  if (aSet->Elements.empty())
+  {
+    return;
+  }
+
+  // build the tree at once to share it between threads
+  aSet->MarkDirty();
+  mySet = aSet;
+  myTree = aSet->BVH();
+  myBox = aSet->Box();
+  myBand = aMaxDeflection + aMaxTol + myTol;
+  myHasMesh = Standard_True;
+}
+
+//=======================================================================
+//function : ClassifyOnMesh
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepClass3d_BulkClassifier::ClassifyOnMesh (const gp_Pnt& thePnt,
+                                                             TopAbs_State& theState) const
+{
+  if (!myHasMesh)
+  {
+    return Standard_False;
+  }
+
+  const BVH_Vec3d aP (thePnt.X(), thePnt.Y(), thePnt.Z());
+  const TopAbs_State anOut = myIsInfinite ? TopAbs_IN : TopAbs_OUT;
+  const TopAbs_State anIn = myIsInfinite ? TopAbs_OUT : TopAbs_IN;
+  if (BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (aP, myBox.CornerMin(), myBox.CornerMax())
+      > myBand * myBand)
+  {
+    theState = anOut;
+    return Standard_True;
+  }
+
+  BRepClass3d_BandSelector aSelector (*mySet, aP, myBand);
+  aSelector.Select (myTree);
+  if (aSelector.IsNear())
+  {
+    return Standard_False;
+  }
+
+  Standard_Integer aNbIn = 0, aNbOut = 0;
+  for (Standard_Integer i = 0; i < 3 && aNbIn < 2 && aNbOut < 2; ++i)
+  {
+    BRepClass3d_RayCounter aCounter (*mySet, thePnt.XYZ(), THE_RAY_DIRS[i]);
+    aCounter.Select (myTree);
+    ++((aCounter.NbHits() % 2) ? aNbIn : aNbOut);
+  }
+  theState = aNbIn >= 2 ? anIn : anOut;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+TopAbs_State BRepClass3d_BulkClassifier::Perform (const gp_Pnt& thePnt)
+{
+  TopAbs_State aState = TopAbs_UNKNOWN;
+  myNbExact = 0;
+  if (!ClassifyOnMesh (thePnt, aState))
+  {
+    myClassifier.Perform (thePnt, myTol);
+    aState = myClassifier.State();
+    myNbExact = 1;
+  }
+  return aState;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void BRepClass3d_BulkClassifier::Perform (const Standard_Real* theCoords,
+                                          const Standard_Integer theNbPoints,
+                                          Standard_Byte* theStates)
+{
+  myNbExact = 0;
+  if (theNbPoints <= 0)
+  {
+    return;
+  }
+
+  const Standard_Integer aNbBatches = (theNbPoints + THE_BATCH_SIZE - 1) / THE_BATCH_SIZE;
+  OSD_ThreadPool::Launcher aLauncher (*OSD_ThreadPool::DefaultPool(), myRunParallel ? aNbBatches : 0);
+
+  // the exact classifier of the algorithm is used by the calling thread
+  NCollection_Array1<BRepClass3d_SolidClassifier*> aClassifiers (0, aLauncher.UpperThreadIndex());
+  aClassifiers.Init (NULL);
+  aClassifiers.ChangeLast() = &myClassifier;
+  NCollection_Array1<Standard_Integer> aNbExact (0, aNbBatches - 1);
+  aNbExact.Init (0);
+
+  BRepClass3d_BulkFunctor aFunctor (*this, mySolid, theCoords, theNbPoints,
+                                    theStates, aClassifiers, aNbExact);
+  aLauncher.Perform (0, aNbBatches, aFunctor);
+
+  for (Standard_Integer i = aClassifiers.Lower(); i < aClassifiers.Upper(); ++i)
+  {
+    delete aClassifiers (i);
+  }
+  for (Standard_Integer i = 0; i < aNbBatches; ++i)
+  {
+    myNbExact += aNbExact (i);
+  }
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BRepClass3d_BulkClassifier_HeaderFile
+#define _BRepClass3d_BulkClassifier_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BVH_Triangulation.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+
+class gp_Pnt;
+
+//! Classifies large sets of points relatively the solid.
+//!
+//! The points are classified on the triangulation of the solid,
+//! kept in the BVH tree built once on loading of the solid.
+//! The state of the point is defined by the parity of the numbers of
+//! intersections of the rays cast from the point with the triangles
+//! (the majority of three rays in different directions is taken).
+//!
+//! The triangulation differs from the surfaces of the solid within its deflection,
+//! thus the points closer to the triangulation than the band
+//! (the deflection of the triangulation plus the tolerances of the faces
+//! and the tolerance of classification) are classified exactly
+//! by BRepClass3d_SolidClassifier, as well as all points if some face
+//! of the solid has no triangulation (see HasMesh()).
+//!
+//! The batches of points are classified in parallel if the parallel mode is on,
+//! using the separate exact classifier for each thread.
+//! The solid should be closed for the correct results.
+class BRepClass3d_BulkClassifier
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  typedef BVH_Triangulation<Standard_Real, 3> BVHSet;
+  typedef BVH_Tree<Standard_Real, 3>          BVHTree;
+
+  //! Empty constructor.
+  Standard_EXPORT BRepClass3d_BulkClassifier();
+
+  //! Constructor loading the solid.
+  Standard_EXPORT BRepClass3d_BulkClassifier (const TopoDS_Shape& theSolid,
+                                              const Standard_Real theTol);
+
+  //! Loads the solid and builds the BVH tree on the triangulations of its faces.
+  //! @param theSolid [in] the solid to classify the points on
+  //! @param theTol [in] the tolerance of classification
+  Standard_EXPORT void Load (const TopoDS_Shape& theSolid,
+                             const Standard_Real theTol);
+
+  //! Sets the flag of parallel processing of the batches of points.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
+  //! Returns TRUE if all faces of the solid are triangulated
+  //! and the points far from the surfaces are classified on the triangulation.
+  Standard_Boolean HasMesh() const { return myHasMesh; }
+
+  //! Returns the distance to the triangulation within which the points are classified exactly.
+  Standard_Real Band() const { return myBand; }
+
+  //! Returns the tolerance of classification.
+  Standard_Real Tolerance() const { return myTol; }
+
+  //! Classifies the point.
+  Standard_EXPORT TopAbs_State Perform (const gp_Pnt& thePnt);
+
+  //! Classifies the batch of points.
+  //! @param theCoords [in] the coordinates of the points (X1, Y1, Z1, X2, Y2, Z2 ...)
+  //! @param theNbPoints [in] the number of points
+  //! @param theStates [out] the states of the points (TopAbs_State values)
+  Standard_EXPORT void Perform (const Standard_Real* theCoords,
+                                const Standard_Integer theNbPoints,
+                                Standard_Byte* theStates);
+
+  //! Classifies the point on the triangulation only.
+  //! @return FALSE if the point is within the band and should be classified exactly
+  Standard_EXPORT Standard_Boolean ClassifyOnMesh (const gp_Pnt& thePnt,
+                                                   TopAbs_State& theState) const;
+
+  //! Returns the number of points classified exactly by the last call to Perform().
+  Standard_Integer NbExact() const { return myNbExact; }
+
+private:
+
+  //! Prepares the triangulation of the solid.
+  void buildMesh();
+
+private:
+
+  TopoDS_Shape                mySolid;
+  Standard_Real               myTol;
+  Standard_Real               myBand;
+  Handle(BVHSet)              mySet;
+  Handle(BVHTree)             myTree;
+  BVH_Box<Standard_Real, 3>   myBox;
+  BRepClass3d_SolidClassifier myClassifier;
+  Standard_Boolean            myHasMesh;
+  Standard_Boolean            myIsInfinite;
+  Standard_Boolean            myRunParallel;
+  Standard_Integer            myNbExact;
+
+};
+
+#endif // _BRepClass3d_BulkClassifier_HeaderFile
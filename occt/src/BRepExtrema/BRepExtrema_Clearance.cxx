@@ -0,0 +1,1106 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepExtrema_Clearance.hxx>
+
+#include <Bnd_Box.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_BulkClassifier.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepExtrema_ShapeProximity.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_Distance.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <TColStd_PackedMapOfInteger.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  typedef BVH_Tools<Standard_Real, 3> BVH_Tools3d;
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BRepExtrema_ShapeBoxSet;
+  typedef std::pair<Standard_Integer, Standard_Integer> BRepExtrema_IndexPair;
+
+  //! Function computing the distance between the shapes (see BRepExtrema_Clearance::distance()).
+  typedef Standard_Integer (*BRepExtrema_DistanceFunction) (const BRepExtrema_Clearance::ShapeData&,
+                                                            const BRepExtrema_Clearance::ShapeData&,
+                                                            const Standard_Real,
+                                                            BRepExtrema_Clearance::Result&);
+
+  //=======================================================================
+  //function : isFarShapes
+  //purpose  : Checks if the bounding boxes of the shapes (extended by the
+  //           deflections of the triangulations) are farther than the distance
+  //=======================================================================
+  static Standard_Boolean isFarShapes (const BRepExtrema_Clearance::ShapeData& theShape1,
+                                       const BRepExtrema_Clearance::ShapeData& theShape2,
+                                       const Standard_Real theDistance)
+  {
+    if (!theShape1.Box.IsValid() || !theShape2.Box.IsValid())
+    {
+      return Standard_False;
+    }
+    const Standard_Real aLimit = theDistance + theShape1.Deflection + theShape2.Deflection;
+    return BVH_Tools3d::BoxBoxSquareDistance (theShape1.Box, theShape2.Box) > aLimit * aLimit;
+  }
+
+  //=======================================================================
+  //class    : BRepExtrema_ShapePairSelector
+  //purpose  : Selects the pairs of shapes with the close bounding boxes
+  //           from the BVH tree of the boxes enlarged by the half of distance
+  //=======================================================================
+  class BRepExtrema_ShapePairSelector : public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_ShapeBoxSet>
+  {
+  public:
+
+    BRepExtrema_ShapePairSelector (const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& theShapes,
+                                   const Standard_Real theDistance,
+                                   std::vector<BRepExtrema_IndexPair>& thePairs)
+    : myShapes (theShapes), myDistance (theDistance), myPairs (thePairs)
+    {}
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin1, const BVH_Vec3d& theMax1,
+                                         const BVH_Vec3d& theMin2, const BVH_Vec3d& theMax2,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      return BVH_Tools3d::BoxBoxSquareDistance (theMin1, theMax1, theMin2, theMax2) > 0.0;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      // the tree is traversed with itself, each pair is taken once
+      const Standard_Integer aShape1 = myBVHSet1->Element (theIndex1);
+      const Standard_Integer aShape2 = myBVHSet2->Element (theIndex2);
+      if (aShape1 >= aShape2 || isFarShapes (myShapes (aShape1), myShapes (aShape2), myDistance))
+      {
+        return Standard_False;
+      }
+      myPairs.push_back (BRepExtrema_IndexPair (aShape1, aShape2));
+      return Standard_True;
+    }
+
+  private:
+
+    const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& myShapes;
+    Standard_Real myDistance;
+    std::vector<BRepExtrema_IndexPair>& myPairs;
+  };
+
+  //=======================================================================
+  //function : findCandidatePairs
+  //purpose  : Broad phase: selects the pairs of shapes (zero-based indices)
+  //           with the bounding boxes closer than the distance
+  //=======================================================================
+  static void findCandidatePairs (const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& theShapes,
+                                  const Standard_Real theDistance,
+                                  std::vector<BRepExtrema_IndexPair>& thePairs)
+  {
+    Handle(BRepExtrema_ShapeBoxSet) aBoxSet = new BRepExtrema_ShapeBoxSet();
+    aBoxSet->SetSize (theShapes.Length());
+    for (Standard_Integer i = 0; i < theShapes.Length(); ++i)
+    {
+      const BRepExtrema_Clearance::ShapeData& aShape = theShapes (i);
+      if (!aShape.Box.IsValid())
+      {
+        // the shape without geometry
+        continue;
+      }
+      const Standard_Real anOffset = 0.5 * theDistance + aShape.Deflection;
+      const BVH_Vec3d anOffsetVec (anOffset, anOffset, anOffset);
+      aBoxSet->Add (i, BVH_Box<Standard_Real, 3> (aShape.Box.CornerMin() - anOffsetVec,
+                                                  aShape.Box.CornerMax() + anOffsetVec));
+    }
+    aBoxSet->Build();
+
+    BRepExtrema_ShapePairSelector aSelector (theShapes, theDistance, thePairs);
+    aSelector.SetBVHSets (aBoxSet.get(), aBoxSet.get());
+    aSelector.Select();
+    std::sort (thePairs.begin(), thePairs.end());
+  }
+
+  //=======================================================================
+  //function : segmentSegmentSqDistance
+  //purpose  : Square distance between two segments
+  //=======================================================================
+  static Standard_Real segmentSegmentSqDistance (const BVH_Vec3d& theP1, const BVH_Vec3d& theQ1,
+                                                 const BVH_Vec3d& theP2, const BVH_Vec3d& theQ2)
+  {
+    const BVH_Vec3d aD1 = theQ1 - theP1;
+    const BVH_Vec3d aD2 = theQ2 - theP2;
+    const BVH_Vec3d aR = theP1 - theP2;
+    const Standard_Real anA = aD1.Dot (aD1);
+    const Standard_Real anE = aD2.Dot (aD2);
+    const Standard_Real anF = aD2.Dot (aR);
+    Standard_Real aS = 0.0, aT = 0.0;
+    if (anA <= RealSmall() && anE <= RealSmall())
+    {
+      return aR.Dot (aR);
+    }
+    if (anA <= RealSmall())
+    {
+      aT = Max (0.0, Min (1.0, anF / anE));
+    }
+    else
+    {
+      const Standard_Real aC = aD1.Dot (aR);
+      if (anE <= RealSmall())
+      {
+        aS = Max (0.0, Min (1.0, -aC / anA));
+      }
+      else
+      {
+        const Standard_Real aB = aD1.Dot (aD2);
+        const Standard_Real aDenom = anA * anE - aB * aB;
+        aS = aDenom > RealSmall() ? Max (0.0, Min (1.0, (aB * anF - aC * anE) / aDenom)) : 0.0;
+        aT = (aB * aS + anF) / anE;
+        if (aT < 0.0)
+        {
+          aT = 0.0;
+          aS = Max (0.0, Min (1.0, -aC / anA));
+        }
+        else if (aT > 1.0)
+        {
+          aT = 1.0;
+          aS = Max (0.0, Min (1.0, (aB - aC) / anA));
+        }
+      }
+    }
+    const BVH_Vec3d aDiff = (theP1 + aD1 * aS) - (theP2 + aD2 * aT);
+    return aDiff.Dot (aDiff);
+  }
+
+  //=======================================================================
+  //function : isSegmentCrossTriangle
+  //purpose  : Checks if the segment crosses the triangle
+  //=======================================================================
+  static Standard_Boolean isSegmentCrossTriangle (const BVH_Vec3d& theP, const BVH_Vec3d& theQ,
+                                                  const BVH_Vec3d theTri[3])
+  {
+    const BVH_Vec3d aDir = theQ - theP;
+    const BVH_Vec3d anE1 = theTri[1] - theTri[0];
+    const BVH_Vec3d anE2 = theTri[2] - theTri[0];
+    const BVH_Vec3d aPV = BVH_Vec3d::Cross (aDir, anE2);
+    const Standard_Real aDet = anE1.Dot (aPV);
+    if (Abs (aDet) < RealSmall())
+    {
+      return Standard_False;
+    }
+    const Standard_Real anInvDet = 1.0 / aDet;
+    const BVH_Vec3d aTV = theP - theTri[0];
+    const Standard_Real anU = aTV.Dot (aPV) * anInvDet;
+    if (anU < 0.0 || anU > 1.0)
+    {
+      return Standard_False;
+    }
+    const BVH_Vec3d aQV = BVH_Vec3d::Cross (aTV, anE1);
+    const Standard_Real aV = aDir.Dot (aQV) * anInvDet;
+    if (aV < 0.0 || anU + aV > 1.0)
+    {
+      return Standard_False;
+    }
+    const Standard_Real aT = anE2.Dot (aQV) * anInvDet;
+    return aT >= 0.0 && aT <= 1.0;
+  }
+
+  //=======================================================================
+  //function : triangleTriangleSqDistance
+  //purpose  : Square distance between two triangles: zero for the crossing
+  //           triangles, otherwise the minimum of the distances between
+  //           the nodes and the triangles and between the sides
+  //=======================================================================
+  static Standard_Real triangleTriangleSqDistance (const BVH_Vec3d theTri1[3],
+                                                   const BVH_Vec3d theTri2[3])
+  {
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (isSegmentCrossTriangle (theTri1[i], theTri1[(i + 1) % 3], theTri2)
+       || isSegmentCrossTriangle (theTri2[i], theTri2[(i + 1) % 3], theTri1))
+      {
+        return 0.0;
+      }
+    }
+    Standard_Real aDist = RealLast();
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      aDist = Min (aDist, BVH_Tools3d::PointTriangleSquareDistance (theTri1[i], theTri2[0], theTri2[1], theTri2[2]));
+      aDist = Min (aDist, BVH_Tools3d::PointTriangleSquareDistance (theTri2[i], theTri1[0], theTri1[1], theTri1[2]));
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        aDist = Min (aDist, segmentSegmentSqDistance (theTri1[i], theTri1[(i + 1) % 3],
+                                                      theTri2[j], theTri2[(j + 1) % 3]));
+      }
+    }
+    return aDist;
+  }
+
+  //=======================================================================
+  //function : isOnBothSides
+  //purpose  : Checks if the triangle has the nodes on both sides of the
+  //           plane of the other triangle farther than the tolerance
+  //=======================================================================
+  static Standard_Boolean isOnBothSides (const BVH_Vec3d thePlaneTri[3],
+                                         const BVH_Vec3d theTri[3],
+                                         const Standard_Real theTolerance)
+  {
+    BVH_Vec3d aNorm = BVH_Vec3d::Cross (thePlaneTri[1] - thePlaneTri[0], thePlaneTri[2] - thePlaneTri[0]);
+    const Standard_Real aNormLen = aNorm.Modulus();
+    if (aNormLen < RealSmall())
+    {
+      return Standard_False;
+    }
+    aNorm /= aNormLen;
+
+    Standard_Real aMin = RealLast(), aMax = -RealLast();
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      const Standard_Real aDist = (theTri[i] - thePlaneTri[0]).Dot (aNorm);
+      aMin = Min (aMin, aDist);
+      aMax = Max (aMax, aDist);
+    }
+    return aMin < -theTolerance && aMax > theTolerance;
+  }
+
+  //=======================================================================
+  //function : isTrianglesCrossing
+  //purpose  : Checks if the triangles cross each other transversally
+  //           (the contacts within the tolerance are not considered)
+  //=======================================================================
+  static Standard_Boolean isTrianglesCrossing (const BVH_Vec3d theTri1[3],
+                                               const BVH_Vec3d theTri2[3],
+                                               const Standard_Real theTolerance)
+  {
+    if (!isOnBothSides (theTri1, theTri2, theTolerance)
+     || !isOnBothSides (theTri2, theTri1, theTolerance))
+    {
+      return Standard_False;
+    }
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (isSegmentCrossTriangle (theTri1[i], theTri1[(i + 1) % 3], theTri2)
+       || isSegmentCrossTriangle (theTri2[i], theTri2[(i + 1) % 3], theTri1))
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //! Pair of faces with the lower bound of the distance between them.
+  struct BRepExtrema_FacePair
+  {
+    Standard_Real    LowerBound;
+    Standard_Integer Face1;
+    Standard_Integer Face2;
+
+    bool operator< (const BRepExtrema_FacePair& theOther) const
+    {
+      return LowerBound < theOther.LowerBound;
+    }
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_FaceBounds
+  //purpose  : Computes the distances between the triangulations of the
+  //           pairs of faces, skipping the triangles farther than the
+  //           best upper bound of the distance between the shapes
+  //=======================================================================
+  class BRepExtrema_FaceBounds : public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_TriangleSet>
+  {
+  public:
+
+    BRepExtrema_FaceBounds (const BRepExtrema_TriangleSet& theSet1,
+                            const BRepExtrema_TriangleSet& theSet2,
+                            const Standard_Integer theNbFaces2,
+                            const Standard_Real theDeflection,
+                            const Standard_Real theMaxDistance)
+    : mySet1 (theSet1), mySet2 (theSet2), myNbFaces2 (theNbFaces2),
+      myDeflection (theDeflection), myMaxDistance (theMaxDistance), myUpperBound (RealLast())
+    {}
+
+    //! Returns the distance beyond which the triangles can not improve the result.
+    Standard_Real Threshold() const
+    {
+      return Min (myMaxDistance, myUpperBound) + myDeflection;
+    }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin1, const BVH_Vec3d& theMax1,
+                                         const BVH_Vec3d& theMin2, const BVH_Vec3d& theMax2,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools3d::BoxBoxSquareDistance (theMin1, theMax1, theMin2, theMax2);
+      return RejectMetric (theMetric);
+    }
+
+    virtual Standard_Boolean RejectMetric (const Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      const Standard_Real aThreshold = Threshold();
+      return theMetric > aThreshold * aThreshold;
+    }
+
+    virtual Standard_Boolean IsMetricBetter (const Standard_Real& theLeft,
+                                             const Standard_Real& theRight) const Standard_OVERRIDE
+    {
+      return theLeft < theRight;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      BVH_Vec3d aTri1[3], aTri2[3];
+      mySet1.GetVertices (theIndex1, aTri1[0], aTri1[1], aTri1[2]);
+      mySet2.GetVertices (theIndex2, aTri2[0], aTri2[1], aTri2[2]);
+      const Standard_Real aDist = Sqrt (triangleTriangleSqDistance (aTri1, aTri2));
+      if (aDist > Threshold())
+      {
+        return Standard_False;
+      }
+      // 64-bit key as the product of the numbers of faces may exceed the integer range
+      const uint64_t aKey = (uint64_t )mySet1.GetFaceID (theIndex1) * (uint64_t )myNbFaces2
+                          + (uint64_t )mySet2.GetFaceID (theIndex2);
+      Standard_Real* aFaceDist = myFaceDistances.ChangeSeek (aKey);
+      if (aFaceDist == NULL)
+      {
+        myFaceDistances.Bind (aKey, aDist);
+      }
+      else if (aDist < *aFaceDist)
+      {
+        *aFaceDist = aDist;
+      }
+      myUpperBound = Min (myUpperBound, aDist + myDeflection);
+      return Standard_True;
+    }
+
+    //! Returns the pairs of faces which may contain the closest points
+    //! ordered by the lower bounds of the distances.
+    void FacePairs (std::vector<BRepExtrema_FacePair>& thePairs) const
+    {
+      const Standard_Real aLimit = Min (myMaxDistance, myUpperBound);
+      for (NCollection_DataMap<uint64_t, Standard_Real>::Iterator anIt (myFaceDistances); anIt.More(); anIt.Next())
+      {
+        const Standard_Real aLowerBound = anIt.Value() - myDeflection;
+        if (aLowerBound <= aLimit)
+        {
+          BRepExtrema_FacePair aPair;
+          aPair.LowerBound = aLowerBound;
+          aPair.Face1 = (Standard_Integer )(anIt.Key() / (uint64_t )myNbFaces2);
+          aPair.Face2 = (Standard_Integer )(anIt.Key() % (uint64_t )myNbFaces2);
+          thePairs.push_back (aPair);
+        }
+      }
+      std::sort (thePairs.begin(), thePairs.end());
+    }
+
+  private:
+
+    const BRepExtrema_TriangleSet& mySet1;
+    const BRepExtrema_TriangleSet& mySet2;
+    Standard_Integer myNbFaces2;
+    Standard_Real    myDeflection;
+    Standard_Real    myMaxDistance;
+    Standard_Real    myUpperBound;
+    NCollection_DataMap<uint64_t, Standard_Real> myFaceDistances;
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_ClearanceFunctor
+  //purpose  : Computes the distances for the pairs of shapes in parallel
+  //=======================================================================
+  class BRepExtrema_ClearanceFunctor
+  {
+  public:
+
+    BRepExtrema_ClearanceFunctor (const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& theShapes,
+                                  std::vector<BRepExtrema_Clearance::Result>& thePairs,
+                                  std::vector<Standard_Integer>& theNbExact,
+                                  const Standard_Real theMaxDistance,
+                                  BRepExtrema_DistanceFunction theFunction)
+    : myShapes (theShapes), myPairs (thePairs), myNbExact (theNbExact),
+      myMaxDistance (theMaxDistance), myFunction (theFunction)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepExtrema_Clearance::Result& aPair = myPairs[theIndex];
+      myNbExact[theIndex] = myFunction (myShapes (aPair.Shape1 - 1), myShapes (aPair.Shape2 - 1),
+                                        myMaxDistance, aPair);
+    }
+
+  private:
+
+    const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& myShapes;
+    std::vector<BRepExtrema_Clearance::Result>& myPairs;
+    std::vector<Standard_Integer>& myNbExact;
+    Standard_Real myMaxDistance;
+    BRepExtrema_DistanceFunction myFunction;
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_CrossingSelector
+  //purpose  : Searches for the crossing triangles of the given faces
+  //=======================================================================
+  class BRepExtrema_CrossingSelector : public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_TriangleSet>
+  {
+  public:
+
+    BRepExtrema_CrossingSelector (const TColStd_PackedMapOfInteger& theFaces1,
+                                  const TColStd_PackedMapOfInteger& theFaces2,
+                                  const Standard_Real theTolerance)
+    : myFaces1 (theFaces1), myFaces2 (theFaces2), myTolerance (theTolerance), myIsCrossing (Standard_False)
+    {}
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin1, const BVH_Vec3d& theMax1,
+                                         const BVH_Vec3d& theMin2, const BVH_Vec3d& theMax2,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      return BVH_Tools3d::BoxBoxSquareDistance (theMin1, theMax1, theMin2, theMax2) > 0.0;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      if (!myFaces1.Contains (myBVHSet1->GetFaceID (theIndex1))
+       || !myFaces2.Contains (myBVHSet2->GetFaceID (theIndex2)))
+      {
+        return Standard_False;
+      }
+      BVH_Vec3d aTri1[3], aTri2[3];
+      myBVHSet1->GetVertices (theIndex1, aTri1[0], aTri1[1], aTri1[2]);
+      myBVHSet2->GetVertices (theIndex2, aTri2[0], aTri2[1], aTri2[2]);
+      myIsCrossing = isTrianglesCrossing (aTri1, aTri2, myTolerance);
+      return myIsCrossing;
+    }
+
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsCrossing; }
+
+    Standard_Boolean IsCrossing() const { return myIsCrossing; }
+
+  private:
+
+    const TColStd_PackedMapOfInteger& myFaces1;
+    const TColStd_PackedMapOfInteger& myFaces2;
+    Standard_Real    myTolerance;
+    Standard_Boolean myIsCrossing;
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_PointDistance
+  //purpose  : Computes the square distance from the point to the triangles
+  //=======================================================================
+  class BRepExtrema_PointDistance : public BVH_Distance<Standard_Real, 3, BVH_Vec3d, BRepExtrema_TriangleSet>
+  {
+  public:
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin, const BVH_Vec3d& theMax,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools3d::PointBoxSquareDistance (myObject, theMin, theMax);
+      return RejectMetric (theMetric);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      BVH_Vec3d aNodes[3];
+      myBVHSet->GetVertices (theIndex, aNodes[0], aNodes[1], aNodes[2]);
+      const Standard_Real aDist = BVH_Tools3d::PointTriangleSquareDistance (myObject, aNodes[0], aNodes[1], aNodes[2]);
+      if (aDist < myDistance)
+      {
+        myDistance = aDist;
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+  };
+
+  //=======================================================================
+  //function : penetrationDepth
+  //purpose  : Estimates the depth of penetration of the shape into the solid
+  //           by the nodes (and centers) of the triangles of the given faces
+  //           lying inside the solid farther than the band of the classifier.
+  //           If theToStopOutside is TRUE, the check stops (returning zero)
+  //           at the first point outside the solid (used for the shapes
+  //           without contact, which are either inside or outside).
+  //=======================================================================
+  static Standard_Real penetrationDepth (const BRepExtrema_Clearance::ShapeData& theShape,
+                                         const TColStd_PackedMapOfInteger* theFaces,
+                                         const BRepClass3d_BulkClassifier& theSolid,
+                                         const BRepExtrema_Clearance::ShapeData& theSolidData,
+                                         const Standard_Boolean theToStopOutside)
+  {
+    const BRepExtrema_TriangleSet& aSet = *theShape.Triangles;
+    const BVH_Array3d& aNodes = aSet.GetVertices();
+    TColStd_PackedMapOfInteger aVisited;
+    NCollection_Array1<Standard_Integer> aVtx (0, 2);
+    Standard_Real aDepth = 0.0;
+    for (Standard_Integer aTrgIdx = 0; aTrgIdx < aSet.Size(); ++aTrgIdx)
+    {
+      if (theFaces != NULL && !theFaces->Contains (aSet.GetFaceID (aTrgIdx)))
+      {
+        continue;
+      }
+
+      aSet.GetVtxIndices (aTrgIdx, aVtx);
+      BVH_Vec3d aPnts[4];
+      Standard_Integer aNbPnts = 0;
+      for (Standard_Integer k = 0; k < 3; ++k)
+      {
+        if (aVisited.Add (aVtx (k)))
+        {
+          aPnts[aNbPnts++] = aNodes[aVtx (k)];
+        }
+      }
+      aPnts[aNbPnts++] = (aNodes[aVtx (0)] + aNodes[aVtx (1)] + aNodes[aVtx (2)]) / 3.0;
+
+      for (Standard_Integer k = 0; k < aNbPnts; ++k)
+      {
+        TopAbs_State aState = TopAbs_UNKNOWN;
+        if (!theSolid.ClassifyOnMesh (gp_Pnt (aPnts[k].x(), aPnts[k].y(), aPnts[k].z()), aState))
+        {
+          // the point is close to the boundary of the solid
+          continue;
+        }
+        if (aState == TopAbs_IN)
+        {
+          BRepExtrema_PointDistance aDistance;
+          aDistance.SetObject (aPnts[k]);
+          aDistance.SetBVHSet (theSolidData.Triangles.get());
+          aDepth = Max (aDepth, Sqrt (aDistance.ComputeDistance()));
+        }
+        else if (theToStopOutside)
+        {
+          return 0.0;
+        }
+      }
+    }
+    return aDepth;
+  }
+
+  //! State of the pair of shapes in the interference query.
+  struct BRepExtrema_InterferenceState
+  {
+    BRepExtrema_Clearance::Interference Interference;
+    TColStd_PackedMapOfInteger Faces1;       //!< Overlapped faces of the first shape
+    TColStd_PackedMapOfInteger Faces2;       //!< Overlapped faces of the second shape
+    Standard_Integer           Inner;        //!< The shape (1 or 2) which may be inside the other one without contact
+    Standard_Boolean           IsFound;      //!< The shapes interfere
+    Standard_Boolean           ToCheckDepth; //!< The penetration should be checked
+    Standard_Integer           NbExact;      //!< Number of pairs of faces refined exactly
+
+    BRepExtrema_InterferenceState()
+    : Inner (0), IsFound (Standard_False), ToCheckDepth (Standard_False), NbExact (0) {}
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_ContactFunctor
+  //purpose  : Searches for the overlapped faces of the pairs of shapes and
+  //           computes the distances between them in parallel
+  //=======================================================================
+  class BRepExtrema_ContactFunctor
+  {
+  public:
+
+    BRepExtrema_ContactFunctor (const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& theShapes,
+                                const NCollection_Array1<Standard_Boolean>& theHasSolid,
+                                std::vector<BRepExtrema_InterferenceState>& theStates,
+                                const Standard_Real theTolerance,
+                                BRepExtrema_DistanceFunction theFunction)
+    : myShapes (theShapes), myHasSolid (theHasSolid), myStates (theStates),
+      myTolerance (theTolerance), myFunction (theFunction)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepExtrema_InterferenceState& aState = myStates[theIndex];
+      BRepExtrema_Clearance::Interference& anInterf = aState.Interference;
+      const BRepExtrema_Clearance::ShapeData& aShape1 = myShapes (anInterf.Shape1 - 1);
+      const BRepExtrema_Clearance::ShapeData& aShape2 = myShapes (anInterf.Shape2 - 1);
+      const Standard_Boolean isMeshed = !aShape1.Triangles.IsNull() && !aShape2.Triangles.IsNull();
+
+      if (isMeshed)
+      {
+        // mid phase: the triangles are compared within the deflections
+        BRepExtrema_ShapeProximity aProximity (myTolerance + aShape1.Deflection + aShape2.Deflection);
+        aProximity.LoadShape1 (aShape1.Faces, aShape1.Triangles);
+        aProximity.LoadShape2 (aShape2.Faces, aShape2.Triangles);
+        aProximity.Perform();
+        if (aProximity.IsDone())
+        {
+          for (BRepExtrema_MapOfIntegerPackedMapOfInteger::Iterator anIt (aProximity.OverlapSubShapes1()); anIt.More(); anIt.Next())
+          {
+            aState.Faces1.Add (anIt.Key());
+          }
+          for (BRepExtrema_MapOfIntegerPackedMapOfInteger::Iterator anIt (aProximity.OverlapSubShapes2()); anIt.More(); anIt.Next())
+          {
+            aState.Faces2.Add (anIt.Key());
+          }
+        }
+
+        if (aState.Faces1.IsEmpty())
+        {
+          checkContainment (aState);
+          return;
+        }
+      }
+
+      BRepExtrema_Clearance::Result aResult;
+      aState.NbExact = myFunction (aShape1, aShape2, myTolerance, aResult);
+      if (aResult.Distance > myTolerance)
+      {
+        if (isMeshed)
+        {
+          checkContainment (aState);
+        }
+        return;
+      }
+
+      aState.IsFound = Standard_True;
+      if (aResult.Distance > Precision::Confusion())
+      {
+        anInterf.Type = BRepExtrema_Clearance::Near;
+        anInterf.Distance = aResult.Distance;
+        return;
+      }
+
+      anInterf.Type = BRepExtrema_Clearance::Touch;
+      aState.ToCheckDepth = isMeshed;
+    }
+
+  private:
+
+    //! Marks the shapes without contact for the check of containment,
+    //! if the bounding box of one shape is inside the box of the other solid.
+    void checkContainment (BRepExtrema_InterferenceState& theState) const
+    {
+      const Standard_Integer anIndex1 = theState.Interference.Shape1 - 1;
+      const Standard_Integer anIndex2 = theState.Interference.Shape2 - 1;
+      const BVH_Box<Standard_Real, 3>& aBox1 = myShapes (anIndex1).Box;
+      const BVH_Box<Standard_Real, 3>& aBox2 = myShapes (anIndex2).Box;
+      if (myHasSolid (anIndex2) && !aBox2.IsOut (aBox1.CornerMin()) && !aBox2.IsOut (aBox1.CornerMax()))
+      {
+        theState.Inner = 1;
+      }
+      else if (myHasSolid (anIndex1) && !aBox1.IsOut (aBox2.CornerMin()) && !aBox1.IsOut (aBox2.CornerMax()))
+      {
+        theState.Inner = 2;
+      }
+      theState.ToCheckDepth = theState.Inner != 0;
+    }
+
+    const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& myShapes;
+    const NCollection_Array1<Standard_Boolean>& myHasSolid;
+    std::vector<BRepExtrema_InterferenceState>& myStates;
+    Standard_Real myTolerance;
+    BRepExtrema_DistanceFunction myFunction;
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_ClassifierFunctor
+  //purpose  : Prepares the classifiers of the solids in parallel
+  //=======================================================================
+  class BRepExtrema_ClassifierFunctor
+  {
+  public:
+
+    BRepExtrema_ClassifierFunctor (const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& theShapes,
+                                   const std::vector<Standard_Integer>& theSolids,
+                                   NCollection_Array1<BRepClass3d_BulkClassifier*>& theClassifiers)
+    : myShapes (theShapes), mySolids (theSolids), myClassifiers (theClassifiers)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer aShape = mySolids[theIndex];
+      myClassifiers (aShape) = new BRepClass3d_BulkClassifier (myShapes (aShape).Shape, Precision::Confusion());
+    }
+
+  private:
+
+    const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& myShapes;
+    const std::vector<Standard_Integer>& mySolids;
+    NCollection_Array1<BRepClass3d_BulkClassifier*>& myClassifiers;
+  };
+
+  //=======================================================================
+  //class    : BRepExtrema_DepthFunctor
+  //purpose  : Estimates the depths of penetration of the pairs in parallel
+  //=======================================================================
+  class BRepExtrema_DepthFunctor
+  {
+  public:
+
+    BRepExtrema_DepthFunctor (const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& theShapes,
+                              const NCollection_Array1<BRepClass3d_BulkClassifier*>& theClassifiers,
+                              const std::vector<Standard_Integer>& thePairs,
+                              std::vector<BRepExtrema_InterferenceState>& theStates)
+    : myShapes (theShapes), myClassifiers (theClassifiers), myPairs (thePairs), myStates (theStates)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepExtrema_InterferenceState& aState = myStates[myPairs[theIndex]];
+      BRepExtrema_Clearance::Interference& anInterf = aState.Interference;
+      const BRepExtrema_Clearance::ShapeData& aShape1 = myShapes (anInterf.Shape1 - 1);
+      const BRepExtrema_Clearance::ShapeData& aShape2 = myShapes (anInterf.Shape2 - 1);
+      const BRepClass3d_BulkClassifier* aSolid1 = myClassifiers (anInterf.Shape1 - 1);
+      const BRepClass3d_BulkClassifier* aSolid2 = myClassifiers (anInterf.Shape2 - 1);
+
+      Standard_Real aDepth = 0.0;
+      Standard_Boolean isCrossing = Standard_False;
+      if (aState.Inner == 1)
+      {
+        aDepth = penetrationDepth (aShape1, NULL, *aSolid2, aShape2, Standard_True);
+      }
+      else if (aState.Inner == 2)
+      {
+        aDepth = penetrationDepth (aShape2, NULL, *aSolid1, aShape1, Standard_True);
+      }
+      else
+      {
+        if (aSolid2 != NULL)
+        {
+          aDepth = penetrationDepth (aShape1, &aState.Faces1, *aSolid2, aShape2, Standard_False);
+        }
+        if (aSolid1 != NULL)
+        {
+          aDepth = Max (aDepth, penetrationDepth (aShape2, &aState.Faces2, *aSolid1, aShape1, Standard_False));
+        }
+        if (aDepth == 0.0)
+        {
+          // the shapes may penetrate each other between the nodes of the triangulations
+          BRepExtrema_CrossingSelector aSelector (aState.Faces1, aState.Faces2,
+                                                  aShape1.Deflection + aShape2.Deflection + Precision::Confusion());
+          aSelector.SetBVHSets (aShape1.Triangles.get(), aShape2.Triangles.get());
+          aSelector.Select();
+          isCrossing = aSelector.IsCrossing();
+        }
+      }
+
+      if (aDepth > 0.0 || isCrossing)
+      {
+        aState.IsFound = Standard_True;
+        anInterf.Type = BRepExtrema_Clearance::Overlap;
+        anInterf.Distance = 0.0;
+        anInterf.Depth = aDepth;
+      }
+    }
+
+  private:
+
+    const NCollection_Vector<BRepExtrema_Clearance::ShapeData>& myShapes;
+    const NCollection_Array1<BRepClass3d_BulkClassifier*>& myClassifiers;
+    const std::vector<Standard_Integer>& myPairs;
+    std::vector<BRepExtrema_InterferenceState>& myStates;
+  };
+}
+
+//=======================================================================
+//function : BRepExtrema_Clearance
+//purpose  : 
+//=======================================================================
+BRepExtrema_Clearance::BRepExtrema_Clearance()
+: myRunParallel (Standard_False),
+  myNbCheckedPairs (0),
+  myNbExactPairs (0)
+{
+}
+
+//=======================================================================
+//function : AddShape
+//purpose  : 
+//=======================================================================
+Standard_Integer BRepExtrema_Clearance::AddShape (const TopoDS_Shape& theShape)
+{
+  ShapeData& aData = myShapes.Appended();
+  aData.Shape = theShape;
+  aData.Deflection = 0.0;
+
+  Standard_Boolean isMeshed = Standard_True;
+  for (TopExp_Explorer anExp (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (TopoDS::Face (anExp.Current()), aLoc);
+    if (aTriangulation.IsNull() || aTriangulation->NbTriangles() == 0)
+    {
+      isMeshed = Standard_False;
+      break;
+    }
+    aData.Deflection = Max (aData.Deflection, aTriangulation->Deflection());
+    aData.Faces.Append (anExp.Current());
+  }
+
+  if (isMeshed && !aData.Faces.IsEmpty())
+  {
+    aData.Triangles = new BRepExtrema_TriangleSet (aData.Faces);
+    aData.Box = aData.Triangles->Box();
+  }
+  else
+  {
+    // the shapes without (complete) triangulation are processed exactly
+    aData.Faces.Clear();
+    aData.Deflection = 0.0;
+    Bnd_Box aBox;
+    BRepBndLib::Add (theShape, aBox);
+    if (!aBox.IsVoid())
+    {
+      Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+      aBox.Get (aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+      aData.Box = BVH_Box<Standard_Real, 3> (BVH_Vec3d (aXMin, aYMin, aZMin),
+                                             BVH_Vec3d (aXMax, aYMax, aZMax));
+    }
+  }
+  return myShapes.Length();
+}
+
+//=======================================================================
+//function : Clear
+//purpose  : 
+//=======================================================================
+void BRepExtrema_Clearance::Clear()
+{
+  myShapes.Clear();
+  myResults.Clear();
+  myInterferences.Clear();
+  myNbCheckedPairs = 0;
+  myNbExactPairs = 0;
+}
+
+//=======================================================================
+//function : exactDistance
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepExtrema_Clearance::exactDistance (const TopoDS_Shape& theShape1,
+                                                       const TopoDS_Shape& theShape2,
+                                                       Result& theResult)
+{
+  BRepExtrema_DistShapeShape aDist (theShape1, theShape2);
+  if (!aDist.IsDone() || aDist.NbSolution() == 0)
+  {
+    return Standard_False;
+  }
+  theResult.Distance = aDist.Value();
+  theResult.Point1 = aDist.PointOnShape1 (1);
+  theResult.Point2 = aDist.PointOnShape2 (1);
+  return Standard_True;
+}
+
+//=======================================================================
+//function : distance
+//purpose  : 
+//=======================================================================
+Standard_Integer BRepExtrema_Clearance::distance (const ShapeData& theShape1,
+                                                  const ShapeData& theShape2,
+                                                  const Standard_Real theMaxDistance,
+                                                  Result& theResult)
+{
+  theResult.Distance = RealLast();
+  if (isFarShapes (theShape1, theShape2, theMaxDistance))
+  {
+    return 0;
+  }
+
+  if (theShape1.Triangles.IsNull() || theShape2.Triangles.IsNull())
+  {
+    exactDistance (theShape1.Shape, theShape2.Shape, theResult);
+    return 1;
+  }
+
+  BRepExtrema_FaceBounds aBounds (*theShape1.Triangles, *theShape2.Triangles, theShape2.Faces.Length(),
+                                  theShape1.Deflection + theShape2.Deflection, theMaxDistance);
+  aBounds.Select (theShape1.Triangles->BVH(), theShape2.Triangles->BVH());
+
+  std::vector<BRepExtrema_FacePair> aPairs;
+  aBounds.FacePairs (aPairs);
+
+  // the pairs are ordered by the lower bounds, the rest of pairs can not be
+  // closer than the exact distance found
+  Standard_Integer aNbExact = 0;
+  for (size_t i = 0; i < aPairs.size(); ++i)
+  {
+    if (aPairs[i].LowerBound > Min (theResult.Distance, theMaxDistance))
+    {
+      break;
+    }
+    Result aResult;
+    ++aNbExact;
+    if (exactDistance (theShape1.Faces (aPairs[i].Face1), theShape2.Faces (aPairs[i].Face2), aResult)
+     && aResult.Distance < theResult.Distance)
+    {
+      theResult.Distance = aResult.Distance;
+      theResult.Point1 = aResult.Point1;
+      theResult.Point2 = aResult.Point2;
+    }
+  }
+  return aNbExact;
+}
+
+//=======================================================================
+//function : Distance
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepExtrema_Clearance::Distance (const Standard_Integer theShape1,
+                                                  const Standard_Integer theShape2,
+                                                  Result& theResult)
+{
+  theResult.Shape1 = theShape1;
+  theResult.Shape2 = theShape2;
+  myNbCheckedPairs = 1;
+  myNbExactPairs = distance (myShapes (theShape1 - 1), myShapes (theShape2 - 1), RealLast(), theResult);
+  return theResult.Distance < RealLast();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void BRepExtrema_Clearance::Perform (const Standard_Real theDistance)
+{
+  myResults.Clear();
+  myNbCheckedPairs = 0;
+  myNbExactPairs = 0;
+
+  // broad phase: the pairs of shapes with close bounding boxes
+  std::vector<BRepExtrema_IndexPair> aCandidates;
+  findCandidatePairs (myShapes, theDistance, aCandidates);
+
+  std::vector<Result> aPairs (aCandidates.size());
+  for (size_t i = 0; i < aCandidates.size(); ++i)
+  {
+    aPairs[i].Shape1 = aCandidates[i].first + 1;
+    aPairs[i].Shape2 = aCandidates[i].second + 1;
+  }
+  myNbCheckedPairs = (Standard_Integer )aPairs.size();
+  if (aPairs.empty())
+  {
+    return;
+  }
+
+  std::vector<Standard_Integer> aNbExact (aPairs.size(), 0);
+  BRepExtrema_ClearanceFunctor aFunctor (myShapes, aPairs, aNbExact, theDistance, &distance);
+  OSD_Parallel::For (0, (Standard_Integer )aPairs.size(), aFunctor, !myRunParallel);
+
+  for (size_t i = 0; i < aPairs.size(); ++i)
+  {
+    myNbExactPairs += aNbExact[i];
+    if (aPairs[i].Distance <= theDistance)
+    {
+      myResults.Append (aPairs[i]);
+    }
+  }
+}
+
+//=======================================================================
+//function : PerformInterference
+//purpose  : 
+//=======================================================================
+void BRepExtrema_Clearance::PerformInterference (const Standard_Real theTolerance)
+{
+  myInterferences.Clear();
+  myNbCheckedPairs = 0;
+  myNbExactPairs = 0;
+
+  // broad phase: the pairs of shapes with close bounding boxes
+  std::vector<BRepExtrema_IndexPair> aCandidates;
+  findCandidatePairs (myShapes, theTolerance, aCandidates);
+  myNbCheckedPairs = (Standard_Integer )aCandidates.size();
+  if (aCandidates.empty())
+  {
+    return;
+  }
+
+  NCollection_Array1<Standard_Boolean> aHasSolid (0, myShapes.Length() - 1);
+  for (Standard_Integer i = 0; i < myShapes.Length(); ++i)
+  {
+    aHasSolid (i) = TopExp_Explorer (myShapes (i).Shape, TopAbs_SOLID).More();
+  }
+
+  // mid and narrow phases: the overlapped faces and the distances
+  std::vector<BRepExtrema_InterferenceState> aStates (aCandidates.size());
+  for (size_t i = 0; i < aCandidates.size(); ++i)
+  {
+    aStates[i].Interference.Shape1 = aCandidates[i].first + 1;
+    aStates[i].Interference.Shape2 = aCandidates[i].second + 1;
+  }
+  BRepExtrema_ContactFunctor aContactFunctor (myShapes, aHasSolid, aStates, theTolerance, &distance);
+  OSD_Parallel::For (0, (Standard_Integer )aStates.size(), aContactFunctor, !myRunParallel);
+
+  // classifiers of the solids in contact (or possibly containing other shapes)
+  NCollection_Array1<BRepClass3d_BulkClassifier*> aClassifiers (0, myShapes.Length() - 1);
+  aClassifiers.Init (NULL);
+  NCollection_Array1<Standard_Boolean> aToClassify (0, myShapes.Length() - 1);
+  aToClassify.Init (Standard_False);
+  std::vector<Standard_Integer> aDepthPairs;
+  for (size_t i = 0; i < aStates.size(); ++i)
+  {
+    const BRepExtrema_InterferenceState& aState = aStates[i];
+    if (!aState.ToCheckDepth)
+    {
+      continue;
+    }
+    aDepthPairs.push_back ((Standard_Integer )i);
+    const Standard_Integer aShape1 = aState.Interference.Shape1 - 1;
+    const Standard_Integer aShape2 = aState.Interference.Shape2 - 1;
+    if (aState.Inner != 1 && aHasSolid (aShape1))
+    {
+      aToClassify (aShape1) = Standard_True;
+    }
+    if (aState.Inner != 2 && aHasSolid (aShape2))
+    {
+      aToClassify (aShape2) = Standard_True;
+    }
+  }
+
+  std::vector<Standard_Integer> aSolids;
+  for (Standard_Integer i = 0; i < myShapes.Length(); ++i)
+  {
+    if (aToClassify (i))
+    {
+      aSolids.push_back (i);
+    }
+  }
+  if (!aSolids.empty())
+  {
+    BRepExtrema_ClassifierFunctor aClassifierFunctor (myShapes, aSolids, aClassifiers);
+    OSD_Parallel::For (0, (Standard_Integer )aSolids.size(), aClassifierFunctor, !myRunParallel);
+
+    // depths of penetration
+    BRepExtrema_DepthFunctor aDepthFunctor (myShapes, aClassifiers, aDepthPairs, aStates);
+    OSD_Parallel::For (0, (Standard_Integer )aDepthPairs.size(), aDepthFunctor, !myRunParallel);
+
+    for (Standard_Integer i = aClassifiers.Lower(); i <= aClassifiers.Upper(); ++i)
+    {
+      delete aClassifiers (i);
+    }
+  }
+
+  for (size_t i = 0; i < aStates.size(); ++i)
+  {
+    myNbExactPairs += aStates[i].NbExact;
+    if (aStates[i].IsFound)
+    {
+      myInterferences.Append (aStates[i].Interference);
+    }
+  }
+}
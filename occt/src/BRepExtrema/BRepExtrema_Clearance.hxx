@@ -0,0 +1,177 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BRepExtrema_Clearance_HeaderFile
+#define _BRepExtrema_Clearance_HeaderFile
+
+#include <BRepExtrema_TriangleSet.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! @brief Computes the minimal distances (clearances) between the shapes.
+//!
+//! The shapes are added once, their triangulations (which should be built in advance)
+//! are kept in the BVH trees reused by all queries. For each pair of shapes:
+//! - the pairs of shapes with the bounding boxes farther than the requested distance are skipped;
+//! - the distances between the triangles of the faces give the lower and upper bounds
+//!   of the distances between the faces (within the deflections of the triangulations),
+//!   the triangles farther than the current best upper bound are not visited;
+//! - only the pairs of faces with the lower bound not exceeding the best upper bound
+//!   (and the requested distance) are refined exactly by BRepExtrema_DistShapeShape,
+//!   in order of the lower bounds.
+//!
+//! The shapes with not triangulated faces are processed by BRepExtrema_DistShapeShape at once.
+//!
+//! The interference query builds the sparse matrix of the pairs of shapes which overlap,
+//! touch or are located closer than the given tolerance:
+//! - the candidate pairs are selected by the BVH tree of the bounding boxes of the shapes;
+//! - the overlapped faces are searched by BRepExtrema_ShapeProximity on the triangle sets
+//!   of the shapes, built once and shared by all pairs;
+//! - the pairs with overlapped faces are checked by the exact distance;
+//! - the shapes in contact are considered overlapping if the nodes of the triangles
+//!   of the overlapped faces (or the centers of the triangles) lie inside the other solid,
+//!   or if the triangles cross each other farther than the deflections; the shapes
+//!   without contact are checked for containment in the other solid.
+//!   The shapes without triangulations are reported as touching in case of contact.
+//!
+//! The pairs of shapes are processed in parallel if the parallel mode is on.
+class BRepExtrema_Clearance
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Distance between two shapes.
+  struct Result
+  {
+    Standard_Integer Shape1;   //!< Index of the first shape
+    Standard_Integer Shape2;   //!< Index of the second shape
+    Standard_Real    Distance; //!< Minimal distance between the shapes
+    gp_Pnt           Point1;   //!< Point on the first shape
+    gp_Pnt           Point2;   //!< Point on the second shape
+
+    Result() : Shape1 (0), Shape2 (0), Distance (RealLast()) {}
+  };
+
+  //! Kind of interference of two shapes.
+  enum InterferenceType
+  {
+    Near,    //!< the shapes are located closer than the tolerance
+    Touch,   //!< the boundaries of the shapes are in contact
+    Overlap  //!< the shapes penetrate each other
+  };
+
+  //! Interference of two shapes.
+  struct Interference
+  {
+    Standard_Integer Shape1;   //!< Index of the first shape
+    Standard_Integer Shape2;   //!< Index of the second shape
+    InterferenceType Type;     //!< Kind of interference
+    Standard_Real    Distance; //!< Minimal distance between the shapes (zero for touching and overlapping shapes)
+    Standard_Real    Depth;    //!< Lower estimate of the depth of penetration, i.e. the maximal distance from the nodes
+                               //!  of one shape inside the other solid to its boundary (zero if there are no such nodes)
+
+    Interference() : Shape1 (0), Shape2 (0), Type (Near), Distance (0.0), Depth (0.0) {}
+  };
+
+public:
+
+  //! Creates empty tool.
+  Standard_EXPORT BRepExtrema_Clearance();
+
+  //! Adds the shape.
+  //! @return index of the shape (starting from 1)
+  Standard_EXPORT Standard_Integer AddShape (const TopoDS_Shape& theShape);
+
+  //! Returns the number of shapes.
+  Standard_Integer NbShapes() const { return myShapes.Length(); }
+
+  //! Returns the shape by its index.
+  const TopoDS_Shape& Shape (const Standard_Integer theIndex) const { return myShapes (theIndex - 1).Shape; }
+
+  //! Removes all shapes.
+  Standard_EXPORT void Clear();
+
+  //! Sets the flag of parallel processing of the pairs of shapes.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
+  //! Computes the minimal distance between two shapes.
+  //! @return FALSE if the distance cannot be computed
+  Standard_EXPORT Standard_Boolean Distance (const Standard_Integer theShape1,
+                                             const Standard_Integer theShape2,
+                                             Result& theResult);
+
+  //! Finds all pairs of shapes located closer than the given distance.
+  //! The pairs are ordered by the indices of the shapes.
+  Standard_EXPORT void Perform (const Standard_Real theDistance);
+
+  //! Returns the pairs found by the last call to Perform().
+  const NCollection_Vector<Result>& Results() const { return myResults; }
+
+  //! Finds all pairs of shapes which overlap, touch or are located closer than the tolerance.
+  //! The pairs are ordered by the indices of the shapes.
+  Standard_EXPORT void PerformInterference (const Standard_Real theTolerance);
+
+  //! Returns the pairs found by the last call to PerformInterference().
+  const NCollection_Vector<Interference>& Interferences() const { return myInterferences; }
+
+  //! Returns the number of pairs of shapes checked by the last query
+  //! (not rejected by the bounding boxes).
+  Standard_Integer NbCheckedPairs() const { return myNbCheckedPairs; }
+
+  //! Returns the number of pairs of faces refined exactly by the last query.
+  Standard_Integer NbExactPairs() const { return myNbExactPairs; }
+
+public:
+
+  //! Cached data of the shape.
+  struct ShapeData
+  {
+    TopoDS_Shape                    Shape;      //!< The shape
+    BRepExtrema_ShapeList           Faces;      //!< Faces of the shape
+    Handle(BRepExtrema_TriangleSet) Triangles;  //!< Triangles of the faces (null if not meshed)
+    Standard_Real                   Deflection; //!< Maximal deflection of the triangulations
+    BVH_Box<Standard_Real, 3>       Box;        //!< Bounding box of the shape
+  };
+
+protected:
+
+  //! Computes the distance between the shapes if it does not exceed the given one.
+  //! @return the number of pairs of faces refined exactly
+  Standard_EXPORT static Standard_Integer distance (const ShapeData& theShape1,
+                                                    const ShapeData& theShape2,
+                                                    const Standard_Real theMaxDistance,
+                                                    Result& theResult);
+
+  //! Computes the distance between the shapes exactly.
+  Standard_EXPORT static Standard_Boolean exactDistance (const TopoDS_Shape& theShape1,
+                                                         const TopoDS_Shape& theShape2,
+                                                         Result& theResult);
+
+protected:
+
+  NCollection_Vector<ShapeData>    myShapes;
+  NCollection_Vector<Result>       myResults;
+  NCollection_Vector<Interference> myInterferences;
+  Standard_Boolean                 myRunParallel;
+  Standard_Integer                 myNbCheckedPairs;
+  Standard_Integer                 myNbExactPairs;
+
+};
+
+#endif // _BRepExtrema_Clearance_HeaderFile
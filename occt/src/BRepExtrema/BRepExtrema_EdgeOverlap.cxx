@@ -0,0 +1,524 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepExtrema_EdgeOverlap.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <Extrema_ExtPC.hxx>
+#include <Extrema_LocateExtPC.hxx>
+#include <GCPnts_AbscissaPoint.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  typedef BVH_Tools<Standard_Real, 3> BVH_Tools3d;
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BRepExtrema_EdgeBoxSet;
+  typedef std::pair<Standard_Integer, Standard_Integer> BRepExtrema_IndexPair;
+
+  //! Angular deflection of the polylines of the edges.
+  static const Standard_Real THE_ANGULAR_DEFLECTION = 0.5;
+
+  //! Relative deflection of the polylines of the edges used by default.
+  static const Standard_Real THE_RELATIVE_DEFLECTION = 0.001;
+
+  //! States of the pair of edges checked for overlapping.
+  enum BRepExtrema_OverlapState
+  {
+    BRepExtrema_OverlapState_Rejected, //!< rejected by the polyline
+    BRepExtrema_OverlapState_Apart,    //!< not overlapping by the exact check
+    BRepExtrema_OverlapState_Overlap   //!< overlapping
+  };
+
+  //=======================================================================
+  //function : pairTolerance
+  //purpose  : Returns the tolerance of overlapping of the edge of the
+  //           first set with the edges of the second set
+  //=======================================================================
+  static Standard_Real pairTolerance (const BRepExtrema_EdgeOverlap::EdgeData& theEdge1,
+                                      const Standard_Real theTolerance)
+  {
+    return theTolerance < 0.0 ? theEdge1.Tolerance : theTolerance;
+  }
+
+  //=======================================================================
+  //function : fillEdgeData
+  //purpose  : Computes the length, sample points and polyline of the edge
+  //=======================================================================
+  static void fillEdgeData (const TopoDS_Edge& theEdge,
+                            const Standard_Real theDeflection,
+                            BRepExtrema_EdgeOverlap::EdgeData& theData)
+  {
+    theData.Edge = theEdge;
+    theData.HasCurve = Standard_False;
+    theData.First = theData.Last = 0.0;
+    theData.Length = 0.0;
+    theData.Tolerance = BRep_Tool::Tolerance (theEdge);
+    theData.Deflection = 0.0;
+    if (BRep_Tool::Degenerated (theEdge) || !BRep_Tool::IsGeometric (theEdge))
+    {
+      return;
+    }
+
+    BRepAdaptor_Curve aCurve (theEdge);
+    theData.First = aCurve.FirstParameter();
+    theData.Last = aCurve.LastParameter();
+    theData.Length = GCPnts_AbscissaPoint::Length (aCurve);
+    theData.Deflection = theDeflection > 0.0
+                       ? theDeflection
+                       : Max (THE_RELATIVE_DEFLECTION * theData.Length, Precision::Confusion());
+
+    // the points placed evenly by the length, including the ends
+    const Standard_Integer aNbSteps = BRepExtrema_EdgeOverlap::NbSamples - 1;
+    theData.Samples[0] = aCurve.Value (theData.First);
+    theData.Samples[aNbSteps] = aCurve.Value (theData.Last);
+    for (Standard_Integer i = 1; i < aNbSteps; ++i)
+    {
+      const Standard_Real aRatio = (Standard_Real )i / aNbSteps;
+      GCPnts_AbscissaPoint anAbscissa (Precision::Confusion(), aCurve, aRatio * theData.Length, theData.First);
+      const Standard_Real aParam = anAbscissa.IsDone()
+                                 ? anAbscissa.Parameter()
+                                 : theData.First + aRatio * (theData.Last - theData.First);
+      theData.Samples[i] = aCurve.Value (aParam);
+    }
+
+    GCPnts_TangentialDeflection aPolyline (aCurve, theData.First, theData.Last,
+                                           THE_ANGULAR_DEFLECTION, theData.Deflection);
+    for (Standard_Integer i = 1; i <= aPolyline.NbPoints(); ++i)
+    {
+      const gp_Pnt& aNode = aPolyline.Value (i);
+      theData.Nodes.Append (aNode);
+      theData.Parameters.Append (aPolyline.Parameter (i));
+      theData.Box.Add (BVH_Vec3d (aNode.X(), aNode.Y(), aNode.Z()));
+    }
+    theData.HasCurve = theData.Nodes.Length() >= 2;
+  }
+
+  //=======================================================================
+  //function : polylineSqDistance
+  //purpose  : Returns the square distance from the point to the polyline
+  //           of the edge and the parameter of the closest point on the
+  //           edge interpolated by the closest segment
+  //=======================================================================
+  static Standard_Real polylineSqDistance (const gp_Pnt& thePoint,
+                                           const BRepExtrema_EdgeOverlap::EdgeData& theEdge,
+                                           Standard_Real& theParam)
+  {
+    Standard_Real aMinDist = RealLast();
+    theParam = theEdge.First;
+    for (Standard_Integer i = 1; i < theEdge.Nodes.Length(); ++i)
+    {
+      const gp_XYZ& aStart = theEdge.Nodes (i - 1).XYZ();
+      const gp_XYZ aDir = theEdge.Nodes (i).XYZ() - aStart;
+      const gp_XYZ aVec = thePoint.XYZ() - aStart;
+      const Standard_Real aSqLen = aDir.SquareModulus();
+      const Standard_Real aRatio = aSqLen > RealSmall() ? Max (0.0, Min (1.0, aVec.Dot (aDir) / aSqLen)) : 0.0;
+      const Standard_Real aDist = (aVec - aDir * aRatio).SquareModulus();
+      if (aDist < aMinDist)
+      {
+        aMinDist = aDist;
+        theParam = theEdge.Parameters (i - 1) + aRatio * (theEdge.Parameters (i) - theEdge.Parameters (i - 1));
+      }
+    }
+    return aMinDist;
+  }
+
+  //=======================================================================
+  //function : projectPoint
+  //purpose  : Projects the point on the edge starting from the parameter
+  //           given by the polyline (the global search is performed only
+  //           if the local one does not give the distance within tolerance),
+  //           returns TRUE if the distance is less than the tolerance
+  //=======================================================================
+  static Standard_Boolean projectPoint (const gp_Pnt& thePoint,
+                                        const BRepExtrema_EdgeOverlap::EdgeData& theEdge,
+                                        const BRepAdaptor_Curve& theCurve,
+                                        Extrema_LocateExtPC& theLocator,
+                                        const Standard_Real theStartParam,
+                                        const Standard_Real theTolerance,
+                                        Standard_Real& theParam,
+                                        Standard_Real& theDistance)
+  {
+    // the ends of the edge
+    theParam = theEdge.First;
+    theDistance = thePoint.Distance (theEdge.Nodes.First());
+    const Standard_Real aLastDist = thePoint.Distance (theEdge.Nodes.Last());
+    if (aLastDist < theDistance)
+    {
+      theParam = theEdge.Last;
+      theDistance = aLastDist;
+    }
+
+    // any point of the edge gives the upper bound of the distance,
+    // thus the local extremum is accepted even if it is not minimal
+    theLocator.Perform (thePoint, theStartParam);
+    if (theLocator.IsDone())
+    {
+      const Standard_Real aDist = Sqrt (theLocator.SquareDistance());
+      if (aDist < theDistance)
+      {
+        theParam = theLocator.Point().Parameter();
+        theDistance = aDist;
+      }
+    }
+    if (theDistance < theTolerance)
+    {
+      return Standard_True;
+    }
+
+    Extrema_ExtPC anExtrema (thePoint, theCurve, theEdge.First, theEdge.Last);
+    if (anExtrema.IsDone())
+    {
+      for (Standard_Integer i = 1; i <= anExtrema.NbExt(); ++i)
+      {
+        const Standard_Real aDist = Sqrt (anExtrema.SquareDistance (i));
+        if (aDist < theDistance)
+        {
+          theParam = anExtrema.Point (i).Parameter();
+          theDistance = aDist;
+        }
+      }
+    }
+    return theDistance < theTolerance;
+  }
+
+  //=======================================================================
+  //class    : BRepExtrema_EdgePairSelector
+  //purpose  : Selects the pairs of edges of two sets with the close
+  //           bounding boxes from the BVH trees of the boxes enlarged by
+  //           the tolerances and the deflections of the polylines
+  //=======================================================================
+  class BRepExtrema_EdgePairSelector : public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_EdgeBoxSet>
+  {
+  public:
+
+    BRepExtrema_EdgePairSelector (std::vector<BRepExtrema_IndexPair>& thePairs)
+    : myPairs (thePairs)
+    {}
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin1, const BVH_Vec3d& theMax1,
+                                         const BVH_Vec3d& theMin2, const BVH_Vec3d& theMax2,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      return BVH_Tools3d::BoxBoxSquareDistance (theMin1, theMax1, theMin2, theMax2) > 0.0;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      if (BVH_Tools3d::BoxBoxSquareDistance (myBVHSet1->Box (theIndex1), myBVHSet2->Box (theIndex2)) > 0.0)
+      {
+        return Standard_False;
+      }
+      myPairs.push_back (BRepExtrema_IndexPair (myBVHSet1->Element (theIndex1),
+                                                myBVHSet2->Element (theIndex2)));
+      return Standard_True;
+    }
+
+  private:
+
+    std::vector<BRepExtrema_IndexPair>& myPairs;
+  };
+
+  //=======================================================================
+  //function : makeBoxSet
+  //purpose  : Builds the BVH tree of the boxes of the edges enlarged by
+  //           the deflections of the polylines (and the tolerances of
+  //           overlapping for the first set)
+  //=======================================================================
+  static Handle(BRepExtrema_EdgeBoxSet) makeBoxSet (const NCollection_Vector<BRepExtrema_EdgeOverlap::EdgeData>& theEdges,
+                                                    const Standard_Boolean theIsFirstSet,
+                                                    const Standard_Real theTolerance)
+  {
+    Handle(BRepExtrema_EdgeBoxSet) aBoxSet = new BRepExtrema_EdgeBoxSet();
+    aBoxSet->SetSize (theEdges.Length());
+    for (Standard_Integer i = 0; i < theEdges.Length(); ++i)
+    {
+      const BRepExtrema_EdgeOverlap::EdgeData& anEdge = theEdges (i);
+      if (!anEdge.HasCurve)
+      {
+        continue;
+      }
+      const Standard_Real anOffset = anEdge.Deflection + (theIsFirstSet ? pairTolerance (anEdge, theTolerance) : 0.0);
+      const BVH_Vec3d anOffsetVec (anOffset, anOffset, anOffset);
+      aBoxSet->Add (i, BVH_Box<Standard_Real, 3> (anEdge.Box.CornerMin() - anOffsetVec,
+                                                  anEdge.Box.CornerMax() + anOffsetVec));
+    }
+    aBoxSet->Build();
+    return aBoxSet;
+  }
+
+  //=======================================================================
+  //class    : BRepExtrema_EdgeOverlapFunctor
+  //purpose  : Checks the pairs of edges for overlapping in parallel
+  //=======================================================================
+  class BRepExtrema_EdgeOverlapFunctor
+  {
+  public:
+
+    //! Function checking the pair of edges (see BRepExtrema_EdgeOverlap::overlap()).
+    typedef Standard_Boolean (*OverlapFunction) (const BRepExtrema_EdgeOverlap::EdgeData&,
+                                                 const BRepExtrema_EdgeOverlap::EdgeData&,
+                                                 const Standard_Real,
+                                                 Standard_Boolean&,
+                                                 BRepExtrema_EdgeOverlap::Result&);
+
+    BRepExtrema_EdgeOverlapFunctor (const NCollection_Vector<BRepExtrema_EdgeOverlap::EdgeData>& theEdges1,
+                                    const NCollection_Vector<BRepExtrema_EdgeOverlap::EdgeData>& theEdges2,
+                                    std::vector<BRepExtrema_EdgeOverlap::Result>& thePairs,
+                                    std::vector<BRepExtrema_OverlapState>& theStates,
+                                    const Standard_Real theTolerance,
+                                    OverlapFunction theFunction)
+    : myEdges1 (theEdges1), myEdges2 (theEdges2), myPairs (thePairs), myStates (theStates),
+      myTolerance (theTolerance), myFunction (theFunction)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepExtrema_EdgeOverlap::Result& aPair = myPairs[theIndex];
+      const BRepExtrema_EdgeOverlap::EdgeData& anEdge1 = myEdges1 (aPair.Edge1 - 1);
+      Standard_Boolean isOverlap = Standard_False;
+      if (!myFunction (anEdge1, myEdges2 (aPair.Edge2 - 1), pairTolerance (anEdge1, myTolerance), isOverlap, aPair))
+      {
+        myStates[theIndex] = BRepExtrema_OverlapState_Rejected;
+      }
+      else
+      {
+        myStates[theIndex] = isOverlap ? BRepExtrema_OverlapState_Overlap : BRepExtrema_OverlapState_Apart;
+      }
+    }
+
+  private:
+
+    const NCollection_Vector<BRepExtrema_EdgeOverlap::EdgeData>& myEdges1;
+    const NCollection_Vector<BRepExtrema_EdgeOverlap::EdgeData>& myEdges2;
+    std::vector<BRepExtrema_EdgeOverlap::Result>& myPairs;
+    std::vector<BRepExtrema_OverlapState>& myStates;
+    Standard_Real myTolerance;
+    OverlapFunction myFunction;
+  };
+}
+
+//=======================================================================
+//function : BRepExtrema_EdgeOverlap
+//purpose  : 
+//=======================================================================
+BRepExtrema_EdgeOverlap::BRepExtrema_EdgeOverlap()
+: myDeflection (0.0),
+  myRunParallel (Standard_False),
+  myNbCheckedPairs (0),
+  myNbExactPairs (0)
+{
+}
+
+//=======================================================================
+//function : AddEdge1
+//purpose  : 
+//=======================================================================
+Standard_Integer BRepExtrema_EdgeOverlap::AddEdge1 (const TopoDS_Edge& theEdge)
+{
+  fillEdgeData (theEdge, myDeflection, myEdges1.Appended());
+  return myEdges1.Length();
+}
+
+//=======================================================================
+//function : AddEdge2
+//purpose  : 
+//=======================================================================
+Standard_Integer BRepExtrema_EdgeOverlap::AddEdge2 (const TopoDS_Edge& theEdge)
+{
+  fillEdgeData (theEdge, myDeflection, myEdges2.Appended());
+  return myEdges2.Length();
+}
+
+//=======================================================================
+//function : Clear
+//purpose  : 
+//=======================================================================
+void BRepExtrema_EdgeOverlap::Clear()
+{
+  myEdges1.Clear();
+  myEdges2.Clear();
+  myResults.Clear();
+  myNbCheckedPairs = 0;
+  myNbExactPairs = 0;
+}
+
+//=======================================================================
+//function : overlap
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepExtrema_EdgeOverlap::overlap (const EdgeData& theEdge1,
+                                                   const EdgeData& theEdge2,
+                                                   const Standard_Real theTolerance,
+                                                   Standard_Boolean& theIsOverlap,
+                                                   Result& theResult)
+{
+  theIsOverlap = Standard_False;
+  if (!theEdge1.HasCurve || !theEdge2.HasCurve)
+  {
+    return Standard_False;
+  }
+
+  // the points of the shorter edge are checked (the second edge is taken
+  // for the edges of equal length as in ShapeAnalysis_Edge::CheckOverlapping())
+  const Standard_Boolean isFirstShort = theEdge1.Length < theEdge2.Length;
+  const EdgeData& aShort = isFirstShort ? theEdge1 : theEdge2;
+  const EdgeData& aLong  = isFirstShort ? theEdge2 : theEdge1;
+
+  // the curve lies within the deflection from the polyline,
+  // the doubled deflection covers the inaccuracy of its estimation
+  Standard_Real aStartParams[NbSamples];
+  const Standard_Real aLimit = theTolerance + 2.0 * aLong.Deflection + Precision::Confusion();
+  for (Standard_Integer i = 0; i < NbSamples; ++i)
+  {
+    if (polylineSqDistance (aShort.Samples[i], aLong, aStartParams[i]) > aLimit * aLimit)
+    {
+      return Standard_False;
+    }
+  }
+
+  BRepAdaptor_Curve aCurve (aLong.Edge);
+  Extrema_LocateExtPC aLocator;
+  aLocator.Initialize (aCurve, aLong.First, aLong.Last, Precision::PConfusion());
+
+  // on the closed edge the parameters of the consecutive samples are unwrapped
+  // through the closure point, so that the overlapped range crossing it is contiguous
+  const Standard_Real aRange = aLong.Last - aLong.First;
+  const Standard_Real aClosureTol = Max (aLong.Tolerance, Precision::Confusion());
+  const Standard_Boolean isClosed =
+    aCurve.Value (aLong.First).SquareDistance (aCurve.Value (aLong.Last)) <= aClosureTol * aClosureTol;
+
+  Standard_Real aFirst = RealLast(), aLast = -RealLast(), aDeviation = 0.0, aPrevParam = 0.0;
+  for (Standard_Integer i = 0; i < NbSamples; ++i)
+  {
+    Standard_Real aParam = 0.0, aDist = 0.0;
+    if (!projectPoint (aShort.Samples[i], aLong, aCurve, aLocator, aStartParams[i], theTolerance, aParam, aDist))
+    {
+      return Standard_True;
+    }
+    if (isClosed && i > 0)
+    {
+      if (aParam - aPrevParam > 0.5 * aRange)
+      {
+        aParam -= aRange;
+      }
+      else if (aPrevParam - aParam > 0.5 * aRange)
+      {
+        aParam += aRange;
+      }
+    }
+    aPrevParam = aParam;
+    aFirst = Min (aFirst, aParam);
+    aLast = Max (aLast, aParam);
+    aDeviation = Max (aDeviation, aDist);
+  }
+  if (isClosed)
+  {
+    // start the range within the edge, only its end may pass the closure point
+    if (aFirst < aLong.First - Precision::PConfusion())
+    {
+      aFirst += aRange;
+      aLast += aRange;
+    }
+    else if (aFirst > aLong.Last - Precision::PConfusion())
+    {
+      aFirst -= aRange;
+      aLast -= aRange;
+    }
+    if (aLast - aFirst > aRange)
+    {
+      aFirst = aLong.First;
+      aLast = aLong.Last;
+    }
+  }
+
+  theIsOverlap = Standard_True;
+  theResult.Deviation = aDeviation;
+  if (isFirstShort)
+  {
+    theResult.First1 = theEdge1.First;
+    theResult.Last1 = theEdge1.Last;
+    theResult.First2 = aFirst;
+    theResult.Last2 = aLast;
+  }
+  else
+  {
+    theResult.First1 = aFirst;
+    theResult.Last1 = aLast;
+    theResult.First2 = theEdge2.First;
+    theResult.Last2 = theEdge2.Last;
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void BRepExtrema_EdgeOverlap::Perform (const Standard_Real theTolerance)
+{
+  myResults.Clear();
+  myNbCheckedPairs = 0;
+  myNbExactPairs = 0;
+  if (myEdges1.IsEmpty() || myEdges2.IsEmpty())
+  {
+    return;
+  }
+
+  // broad phase: the pairs of edges with close bounding boxes
+  std::vector<BRepExtrema_IndexPair> aCandidates;
+  Handle(BRepExtrema_EdgeBoxSet) aBoxSet1 = makeBoxSet (myEdges1, Standard_True, theTolerance);
+  Handle(BRepExtrema_EdgeBoxSet) aBoxSet2 = makeBoxSet (myEdges2, Standard_False, theTolerance);
+  BRepExtrema_EdgePairSelector aSelector (aCandidates);
+  aSelector.SetBVHSets (aBoxSet1.get(), aBoxSet2.get());
+  aSelector.Select();
+  std::sort (aCandidates.begin(), aCandidates.end());
+
+  std::vector<Result> aPairs (aCandidates.size());
+  for (size_t i = 0; i < aCandidates.size(); ++i)
+  {
+    aPairs[i].Edge1 = aCandidates[i].first + 1;
+    aPairs[i].Edge2 = aCandidates[i].second + 1;
+  }
+  myNbCheckedPairs = (Standard_Integer )aPairs.size();
+  if (aPairs.empty())
+  {
+    return;
+  }
+
+  std::vector<BRepExtrema_OverlapState> aStates (aPairs.size(), BRepExtrema_OverlapState_Rejected);
+  BRepExtrema_EdgeOverlapFunctor aFunctor (myEdges1, myEdges2, aPairs, aStates, theTolerance, &overlap);
+  OSD_Parallel::For (0, (Standard_Integer )aPairs.size(), aFunctor, !myRunParallel);
+
+  for (size_t i = 0; i < aPairs.size(); ++i)
+  {
+    if (aStates[i] != BRepExtrema_OverlapState_Rejected)
+    {
+      ++myNbExactPairs;
+    }
+    if (aStates[i] == BRepExtrema_OverlapState_Overlap)
+    {
+      myResults.Append (aPairs[i]);
+    }
+  }
+}
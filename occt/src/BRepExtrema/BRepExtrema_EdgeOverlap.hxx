@@ -0,0 +1,165 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepExtrema_EdgeOverlap_HeaderFile
+#define _BRepExtrema_EdgeOverlap_HeaderFile
+
+#include <BVH_Box.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopoDS_Edge.hxx>
+
+//! @brief Finds the overlapping edges of two sets of edges.
+//!
+//! Two edges overlap if the shorter one lies along the longer one within the tolerance,
+//! i.e. the points of the shorter edge placed evenly by the length (five points including
+//! the ends) are closer to the longer edge than the tolerance. This is the criterion of
+//! ShapeAnalysis_Edge::CheckOverlapping() (with zero domain distance) evaluated for all
+//! pairs of edges of the first and the second sets at once:
+//! - the edges are added once, their lengths, sample points and polylines are computed
+//!   once and shared by all pairs;
+//! - the candidate pairs are selected by the BVH trees of the bounding boxes of the polylines;
+//! - the pairs with a sample point of the shorter edge farther from the polyline of the longer
+//!   edge than the tolerance plus the deflection of the polyline are rejected;
+//! - the remaining pairs are checked by the exact projection of the sample points on the longer edge.
+//!
+//! For each overlapping pair the ranges of parameters of the overlapped parts of the edges are
+//! returned: the whole range of the shorter edge and the range of projections of its sample points
+//! on the longer edge. If the longer edge is closed and the overlapped part passes through its
+//! closure point (e.g. the seam of the circle), the range is kept contiguous: its end exceeds the
+//! last parameter of the edge, the parameter Last + dT standing for the point at First + dT.
+//!
+//! The edges without geometry (degenerated) do not overlap other edges.
+//! The pairs of edges are processed in parallel if the parallel mode is on.
+class BRepExtrema_EdgeOverlap
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Overlapping pair of edges.
+  struct Result
+  {
+    Standard_Integer Edge1;     //!< Index of the edge in the first set
+    Standard_Integer Edge2;     //!< Index of the edge in the second set
+    Standard_Real    First1;    //!< Start of the overlapped range of the first edge
+    Standard_Real    Last1;     //!< End of the overlapped range of the first edge
+    Standard_Real    First2;    //!< Start of the overlapped range of the second edge
+    Standard_Real    Last2;     //!< End of the overlapped range of the second edge
+    Standard_Real    Deviation; //!< Maximal distance from the sample points of the shorter edge to the longer edge
+
+    Result() : Edge1 (0), Edge2 (0), First1 (0.0), Last1 (0.0), First2 (0.0), Last2 (0.0), Deviation (0.0) {}
+  };
+
+public:
+
+  //! Creates empty tool.
+  Standard_EXPORT BRepExtrema_EdgeOverlap();
+
+  //! Adds the edge to the first set.
+  //! @return index of the edge in the set (starting from 1)
+  Standard_EXPORT Standard_Integer AddEdge1 (const TopoDS_Edge& theEdge);
+
+  //! Adds the edge to the second set.
+  //! @return index of the edge in the set (starting from 1)
+  Standard_EXPORT Standard_Integer AddEdge2 (const TopoDS_Edge& theEdge);
+
+  //! Returns the number of edges of the first set.
+  Standard_Integer NbEdges1() const { return myEdges1.Length(); }
+
+  //! Returns the number of edges of the second set.
+  Standard_Integer NbEdges2() const { return myEdges2.Length(); }
+
+  //! Returns the edge of the first set by its index.
+  const TopoDS_Edge& Edge1 (const Standard_Integer theIndex) const { return myEdges1 (theIndex - 1).Edge; }
+
+  //! Returns the edge of the second set by its index.
+  const TopoDS_Edge& Edge2 (const Standard_Integer theIndex) const { return myEdges2 (theIndex - 1).Edge; }
+
+  //! Removes all edges.
+  Standard_EXPORT void Clear();
+
+  //! Sets the deflection of the polylines of the edges added after this call
+  //! (zero value means the deflection of 0.1% of the length of each edge).
+  void SetDeflection (const Standard_Real theDeflection) { myDeflection = theDeflection; }
+
+  //! Returns the deflection of the polylines.
+  Standard_Real Deflection() const { return myDeflection; }
+
+  //! Sets the flag of parallel processing.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
+  //! Finds all overlapping pairs of edges of the first and the second sets.
+  //! The pairs are ordered by the indices of the edges.
+  //! @param theTolerance [in] tolerance of the overlapping, the negative value means
+  //!                          the tolerance of the edge of the first set
+  Standard_EXPORT void Perform (const Standard_Real theTolerance);
+
+  //! Returns the pairs found by the last call to Perform().
+  const NCollection_Vector<Result>& Results() const { return myResults; }
+
+  //! Returns the number of pairs of edges checked by the last call to Perform()
+  //! (not rejected by the bounding boxes).
+  Standard_Integer NbCheckedPairs() const { return myNbCheckedPairs; }
+
+  //! Returns the number of pairs of edges checked exactly by the last call to Perform()
+  //! (not rejected by the polylines).
+  Standard_Integer NbExactPairs() const { return myNbExactPairs; }
+
+public:
+
+  //! Number of sample points of the edge.
+  static const Standard_Integer NbSamples = 5;
+
+  //! Cached data of the edge.
+  struct EdgeData
+  {
+    TopoDS_Edge                       Edge;               //!< The edge
+    Standard_Boolean                  HasCurve;           //!< Flag indicating that the edge has geometry
+    Standard_Real                     First;              //!< First parameter of the edge
+    Standard_Real                     Last;               //!< Last parameter of the edge
+    Standard_Real                     Length;             //!< Length of the edge
+    Standard_Real                     Tolerance;          //!< Tolerance of the edge
+    Standard_Real                     Deflection;         //!< Deflection of the polyline
+    gp_Pnt                            Samples[NbSamples]; //!< Points placed evenly by the length
+    NCollection_Vector<gp_Pnt>        Nodes;              //!< Nodes of the polyline
+    NCollection_Vector<Standard_Real> Parameters;         //!< Parameters of the nodes of the polyline
+    BVH_Box<Standard_Real, 3>         Box;                //!< Bounding box of the polyline
+  };
+
+protected:
+
+  //! Checks if the edges overlap.
+  //! @return FALSE if the pair is rejected by the polyline of the longer edge
+  Standard_EXPORT static Standard_Boolean overlap (const EdgeData& theEdge1,
+                                                   const EdgeData& theEdge2,
+                                                   const Standard_Real theTolerance,
+                                                   Standard_Boolean& theIsOverlap,
+                                                   Result& theResult);
+
+protected:
+
+  NCollection_Vector<EdgeData> myEdges1;
+  NCollection_Vector<EdgeData> myEdges2;
+  NCollection_Vector<Result>   myResults;
+  Standard_Real                myDeflection;
+  Standard_Boolean             myRunParallel;
+  Standard_Integer             myNbCheckedPairs;
+  Standard_Integer             myNbExactPairs;
+
+};
+
+#endif // _BRepExtrema_EdgeOverlap_HeaderFile
@@ -35,8 +35,8 @@ static Standard_Boolean initSubShapes(const TopoDS_Shape&              theShape,
     theSubshapesList.Append(anIter.Current());
   }
 
-  if (theTriangleSet.IsNull())
-    theTriangleSet = new BRepExtrema_TriangleSet;
+  // the new set is created as the previous one may be shared with other tools
+  theTriangleSet = new BRepExtrema_TriangleSet;
   return theTriangleSet->Init(theSubshapesList);
 }
 
@@ -112,6 +112,52 @@ Standard_Boolean BRepExtrema_ShapeProximity::LoadShape2 (const TopoDS_Shape& the
   return myIsInitS2;
 }
 
+//=======================================================================
+//function : LoadShape1
+//purpose  : Loads 1st shape given by the prepared triangle set
+//=======================================================================
+Standard_Boolean BRepExtrema_ShapeProximity::LoadShape1 (const BRepExtrema_ShapeList& theSubShapes1,
+                                                         const Handle(BRepExtrema_TriangleSet)& theElementSet1)
+{
+  myShapeList1  = theSubShapes1;
+  myElementSet1 = theElementSet1;
+  myIsInitS1 = !theElementSet1.IsNull() && theElementSet1->Size() > 0;
+
+  if (myTolerance == Precision::Infinite())
+  {
+    myProxValTool.MarkDirty();
+  }
+  else
+  {
+    myOverlapTool.MarkDirty();
+  }
+
+  return myIsInitS1;
+}
+
+//=======================================================================
+//function : LoadShape2
+//purpose  : Loads 2nd shape given by the prepared triangle set
+//=======================================================================
+Standard_Boolean BRepExtrema_ShapeProximity::LoadShape2 (const BRepExtrema_ShapeList& theSubShapes2,
+                                                         const Handle(BRepExtrema_TriangleSet)& theElementSet2)
+{
+  myShapeList2  = theSubShapes2;
+  myElementSet2 = theElementSet2;
+  myIsInitS2 = !theElementSet2.IsNull() && theElementSet2->Size() > 0;
+
+  if (myTolerance == Precision::Infinite())
+  {
+    myProxValTool.MarkDirty();
+  }
+  else
+  {
+    myOverlapTool.MarkDirty();
+  }
+
+  return myIsInitS2;
+}
+
 //=======================================================================
 //function : Perform
 //purpose  : Performs search of overlapped faces
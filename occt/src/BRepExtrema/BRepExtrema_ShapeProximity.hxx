@@ -85,6 +85,16 @@ public:
   //! Loads 2nd shape into proximity tool.
   Standard_EXPORT Standard_Boolean LoadShape2 (const TopoDS_Shape& theShape2);
 
+  //! Loads 1st shape given by its sub-shapes and the triangle set built on them in advance
+  //! (e.g. shared by several proximity tools). The triangle set is not modified by the tool.
+  Standard_EXPORT Standard_Boolean LoadShape1 (const BRepExtrema_ShapeList& theSubShapes1,
+                                               const Handle(BRepExtrema_TriangleSet)& theElementSet1);
+
+  //! Loads 2nd shape given by its sub-shapes and the triangle set built on them in advance
+  //! (e.g. shared by several proximity tools). The triangle set is not modified by the tool.
+  Standard_EXPORT Standard_Boolean LoadShape2 (const BRepExtrema_ShapeList& theSubShapes2,
+                                               const Handle(BRepExtrema_TriangleSet)& theElementSet2);
+
   //! Set number of sample points on the 1st shape used to compute the proximity value.
   //! In case of 0, all triangulation nodes will be used.
   void SetNbSamples1(const Standard_Integer theNbSamples) { myNbSamples1 = theNbSamples; }
@@ -17,7 +17,9 @@
 #include <DBRep.hxx>
 #include <BRepTest.hxx>
 #include <BRepExtrema_Poly.hxx>
+#include <BRepExtrema_Clearance.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepExtrema_EdgeOverlap.hxx>
 #include <BRepExtrema_ShapeProximity.hxx>
 #include <BRepExtrema_SelfIntersection.hxx>
 #include <BRepLib_MakeVertex.hxx>
@@ -25,6 +27,9 @@
 #include <Draw_ProgressIndicator.hxx>
 #include <TopoDS_Builder.hxx>
 #include <TopoDS_Compound.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <Draw.hxx>
 #include <Message.hxx>
 #include <OSD_Timer.hxx>
@@ -462,6 +467,303 @@ static int ShapeSelfIntersection (Draw_Interpretor& theDI, Standard_Integer theN
   return 0;
 }
 
+//=======================================================================
+//function : ShapeClearance
+//purpose  : 
+//=======================================================================
+static int ShapeClearance (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgs)
+{
+  if (theNbArgs < 3)
+  {
+    Message::SendFail() << "Usage: " << theArgs[0] << " Shape1 Shape2 [Shape3 ...] [-d <value>] [-parallel] [-profile]";
+    return 1;
+  }
+
+  BRepExtrema_Clearance aTool;
+  NCollection_Vector<TCollection_AsciiString> aNames;
+  Standard_Real    aDistance = -1.0;
+  Standard_Boolean aToProfile = Standard_False;
+
+  for (Standard_Integer anArgIdx = 1; anArgIdx < theNbArgs; ++anArgIdx)
+  {
+    TCollection_AsciiString aFlag (theArgs[anArgIdx]);
+    aFlag.LowerCase();
+
+    if (aFlag == "-d")
+    {
+      if (++anArgIdx >= theNbArgs)
+      {
+        Message::SendFail() << "Error: wrong syntax at argument '" << aFlag;
+        return 1;
+      }
+
+      aDistance = Draw::Atof (theArgs[anArgIdx]);
+      if (aDistance < 0.0)
+      {
+        Message::SendFail() << "Error: Distance value should be non-negative";
+        return 1;
+      }
+    }
+    else if (aFlag == "-parallel")
+    {
+      aTool.SetRunParallel (Standard_True);
+    }
+    else if (aFlag == "-profile")
+    {
+      aToProfile = Standard_True;
+    }
+    else
+    {
+      TopoDS_Shape aShape = DBRep::Get (theArgs[anArgIdx]);
+      if (aShape.IsNull())
+      {
+        Message::SendFail() << "Error: Failed to find shape " << theArgs[anArgIdx];
+        return 1;
+      }
+      aTool.AddShape (aShape);
+      aNames.Append (theArgs[anArgIdx]);
+    }
+  }
+
+  if (aTool.NbShapes() < 2)
+  {
+    Message::SendFail() << "Error: At least two shapes should be given";
+    return 1;
+  }
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+
+  if (aDistance < 0.0)
+  {
+    if (aTool.NbShapes() != 2)
+    {
+      Message::SendFail() << "Error: The distance should be given for more than two shapes";
+      return 1;
+    }
+
+    // minimal distance between two shapes
+    BRepExtrema_Clearance::Result aResult;
+    if (!aTool.Distance (1, 2, aResult))
+    {
+      Message::SendFail() << "Error: Failed to compute the distance";
+      return 1;
+    }
+    theDI << aResult.Distance << "\n";
+  }
+  else
+  {
+    // all pairs of shapes closer than the given distance
+    aTool.Perform (aDistance);
+    for (NCollection_Vector<BRepExtrema_Clearance::Result>::Iterator anIt (aTool.Results()); anIt.More(); anIt.Next())
+    {
+      const BRepExtrema_Clearance::Result& aResult = anIt.Value();
+      theDI << aNames (aResult.Shape1 - 1) << " " << aNames (aResult.Shape2 - 1) << " " << aResult.Distance << "\n";
+    }
+  }
+
+  aTimer.Stop();
+  if (aToProfile)
+  {
+    theDI << "Checked pairs of shapes:        " << aTool.NbCheckedPairs() << "\n";
+    theDI << "Exactly refined pairs of faces: " << aTool.NbExactPairs() << "\n";
+    theDI << "Executing clearance query:      " << aTimer.ElapsedTime() << "\n";
+  }
+
+  return 0;
+}
+
+//=======================================================================
+//function : ShapeInterference
+//purpose  : 
+//=======================================================================
+static int ShapeInterference (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgs)
+{
+  if (theNbArgs < 3)
+  {
+    Message::SendFail() << "Usage: " << theArgs[0] << " Shape1 Shape2 [Shape3 ...] [-tol <value>] [-parallel] [-profile]";
+    return 1;
+  }
+
+  BRepExtrema_Clearance aTool;
+  NCollection_Vector<TCollection_AsciiString> aNames;
+  Standard_Real    aTolerance = 0.0;
+  Standard_Boolean aToProfile = Standard_False;
+
+  for (Standard_Integer anArgIdx = 1; anArgIdx < theNbArgs; ++anArgIdx)
+  {
+    TCollection_AsciiString aFlag (theArgs[anArgIdx]);
+    aFlag.LowerCase();
+
+    if (aFlag == "-tol")
+    {
+      if (++anArgIdx >= theNbArgs)
+      {
+        Message::SendFail() << "Error: wrong syntax at argument '" << aFlag;
+        return 1;
+      }
+
+      aTolerance = Draw::Atof (theArgs[anArgIdx]);
+      if (aTolerance < 0.0)
+      {
+        Message::SendFail() << "Error: Tolerance value should be non-negative";
+        return 1;
+      }
+    }
+    else if (aFlag == "-parallel")
+    {
+      aTool.SetRunParallel (Standard_True);
+    }
+    else if (aFlag == "-profile")
+    {
+      aToProfile = Standard_True;
+    }
+    else
+    {
+      TopoDS_Shape aShape = DBRep::Get (theArgs[anArgIdx]);
+      if (aShape.IsNull())
+      {
+        Message::SendFail() << "Error: Failed to find shape " << theArgs[anArgIdx];
+        return 1;
+      }
+      aTool.AddShape (aShape);
+      aNames.Append (theArgs[anArgIdx]);
+    }
+  }
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+
+  aTool.PerformInterference (aTolerance);
+
+  aTimer.Stop();
+
+  static const char* THE_TYPES[] = { "near", "touch", "overlap" };
+  for (NCollection_Vector<BRepExtrema_Clearance::Interference>::Iterator anIt (aTool.Interferences()); anIt.More(); anIt.Next())
+  {
+    const BRepExtrema_Clearance::Interference& anInterf = anIt.Value();
+    theDI << aNames (anInterf.Shape1 - 1) << " " << aNames (anInterf.Shape2 - 1) << " "
+          << THE_TYPES[anInterf.Type] << " " << anInterf.Distance << " " << anInterf.Depth << "\n";
+  }
+
+  if (aToProfile)
+  {
+    theDI << "Checked pairs of shapes:        " << aTool.NbCheckedPairs() << "\n";
+    theDI << "Exactly refined pairs of faces: " << aTool.NbExactPairs() << "\n";
+    theDI << "Executing interference query:   " << aTimer.ElapsedTime() << "\n";
+  }
+
+  return 0;
+}
+
+//=======================================================================
+//function : EdgeOverlap
+//purpose  : 
+//=======================================================================
+static int EdgeOverlap (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgs)
+{
+  if (theNbArgs < 3)
+  {
+    Message::SendFail() << "Usage: " << theArgs[0] << " Shape1 Shape2 [-tol <value>] [-deflection <value>] [-parallel] [-profile]";
+    return 1;
+  }
+
+  TopoDS_Shape aShapes[2];
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    aShapes[i] = DBRep::Get (theArgs[i + 1]);
+    if (aShapes[i].IsNull())
+    {
+      Message::SendFail() << "Error: Failed to find shape " << theArgs[i + 1];
+      return 1;
+    }
+  }
+
+  BRepExtrema_EdgeOverlap aTool;
+  Standard_Real    aTolerance = -1.0;
+  Standard_Boolean aToProfile = Standard_False;
+
+  for (Standard_Integer anArgIdx = 3; anArgIdx < theNbArgs; ++anArgIdx)
+  {
+    TCollection_AsciiString aFlag (theArgs[anArgIdx]);
+    aFlag.LowerCase();
+
+    if (aFlag == "-tol"
+     || aFlag == "-deflection")
+    {
+      if (++anArgIdx >= theNbArgs)
+      {
+        Message::SendFail() << "Error: wrong syntax at argument '" << aFlag;
+        return 1;
+      }
+
+      const Standard_Real aValue = Draw::Atof (theArgs[anArgIdx]);
+      if (aValue < 0.0)
+      {
+        Message::SendFail() << "Error: " << aFlag << " value should be non-negative";
+        return 1;
+      }
+      if (aFlag == "-tol")
+      {
+        aTolerance = aValue;
+      }
+      else
+      {
+        aTool.SetDeflection (aValue);
+      }
+    }
+    else if (aFlag == "-parallel")
+    {
+      aTool.SetRunParallel (Standard_True);
+    }
+    else if (aFlag == "-profile")
+    {
+      aToProfile = Standard_True;
+    }
+    else
+    {
+      Message::SendFail() << "Error: unknown argument '" << theArgs[anArgIdx] << "'";
+      return 1;
+    }
+  }
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+
+  TopTools_IndexedMapOfShape anEdges1, anEdges2;
+  TopExp::MapShapes (aShapes[0], TopAbs_EDGE, anEdges1);
+  TopExp::MapShapes (aShapes[1], TopAbs_EDGE, anEdges2);
+  for (Standard_Integer i = 1; i <= anEdges1.Extent(); ++i)
+  {
+    aTool.AddEdge1 (TopoDS::Edge (anEdges1 (i)));
+  }
+  for (Standard_Integer i = 1; i <= anEdges2.Extent(); ++i)
+  {
+    aTool.AddEdge2 (TopoDS::Edge (anEdges2 (i)));
+  }
+
+  aTool.Perform (aTolerance);
+
+  aTimer.Stop();
+
+  for (NCollection_Vector<BRepExtrema_EdgeOverlap::Result>::Iterator anIt (aTool.Results()); anIt.More(); anIt.Next())
+  {
+    const BRepExtrema_EdgeOverlap::Result& aPair = anIt.Value();
+    theDI << aPair.Edge1 << " " << aPair.Edge2 << " "
+          << aPair.First1 << " " << aPair.Last1 << " "
+          << aPair.First2 << " " << aPair.Last2 << " " << aPair.Deviation << "\n";
+  }
+
+  if (aToProfile)
+  {
+    theDI << "Checked pairs of edges:         " << aTool.NbCheckedPairs() << "\n";
+    theDI << "Exactly checked pairs of edges: " << aTool.NbExactPairs() << "\n";
+    theDI << "Executing overlap query:        " << aTimer.ElapsedTime() << "\n";
+  }
+
+  return 0;
+}
+
 //=======================================================================
 //function : ExtremaCommands
 //purpose  : 
@@ -506,6 +808,51 @@ void BRepTest::ExtremaCommands (Draw_Interpretor& theCommands)
                    ShapeProximity,
                    aGroup);
 
+  theCommands.Add ("clearance",
+                   "clearance Shape1 Shape2 [Shape3 ...] [-d <value>] [-parallel] [-profile]"
+                   "\n\t\t: Computes the minimal distance between two shapes, or with the -d option"
+                   "\n\t\t: searches for all pairs of the given shapes closer than the given distance"
+                   "\n\t\t: and outputs the names of the shapes and the distances."
+                   "\n\t\t: The shape tessellation (should be computed in advance) is used to bound"
+                   "\n\t\t: the distances, the closest faces are refined exactly. The options are:"
+                   "\n\t\t:   -d        : non-negative distance value"
+                   "\n\t\t:   -parallel : process the pairs of shapes in parallel"
+                   "\n\t\t:   -profile  : outputs the statistics and execution time",
+                   __FILE__,
+                   ShapeClearance,
+                   aGroup);
+
+  theCommands.Add ("interference",
+                   "interference Shape1 Shape2 [Shape3 ...] [-tol <value>] [-parallel] [-profile]"
+                   "\n\t\t: Searches for the pairs of the given shapes which overlap, touch or are"
+                   "\n\t\t: located closer than the tolerance, and outputs the names of the shapes,"
+                   "\n\t\t: the kind of interference (near, touch or overlap), the distance and"
+                   "\n\t\t: the estimated depth of penetration. The shape tessellation should be"
+                   "\n\t\t: computed in advance. The options are:"
+                   "\n\t\t:   -tol      : non-negative tolerance value (0 by default)"
+                   "\n\t\t:   -parallel : process the pairs of shapes in parallel"
+                   "\n\t\t:   -profile  : outputs the statistics and execution time",
+                   __FILE__,
+                   ShapeInterference,
+                   aGroup);
+
+  theCommands.Add ("edgeoverlap",
+                   "edgeoverlap Shape1 Shape2 [-tol <value>] [-deflection <value>] [-parallel] [-profile]"
+                   "\n\t\t: Searches for the pairs of overlapping edges of two shapes, i.e. the pairs"
+                   "\n\t\t: where the shorter edge lies along the longer one within the tolerance,"
+                   "\n\t\t: and outputs the indices of the edges (in the order of explode), the ranges"
+                   "\n\t\t: of parameters of the overlapped parts of the edges and the deviation."
+                   "\n\t\t: The options are:"
+                   "\n\t\t:   -tol        : non-negative tolerance value (the tolerance of the"
+                   "\n\t\t:                 edge of the first shape by default)"
+                   "\n\t\t:   -deflection : deflection of the polylines of the edges"
+                   "\n\t\t:                 (0.1% of the length of the edge by default)"
+                   "\n\t\t:   -parallel   : process the pairs of edges in parallel"
+                   "\n\t\t:   -profile    : outputs the statistics and execution time",
+                   __FILE__,
+                   EdgeOverlap,
+                   aGroup);
+
   theCommands.Add ("selfintersect",
                    "selfintersect Shape [-tol <value>] [-profile]"
                    "\n\t\t: Searches for intersected/overlapped faces in the given shape."
@@ -1195,6 +1195,15 @@ public:
   //! of the Bspline normalized between 0 and 1.
   //! Structure of result optimized for BSplCLib_Cache.
   Standard_EXPORT static void BuildCache (const Standard_Real theParameter, const Standard_Real theSpanDomain, const Standard_Boolean thePeriodicFlag, const Standard_Integer theDegree, const Standard_Integer theSpanIndex, const TColStd_Array1OfReal& theFlatKnots, const TColgp_Array1OfPnt2d& thePoles, const TColStd_Array1OfReal* theWeights, TColStd_Array2OfReal& theCacheArray);
+
+  //! Evaluates the points (and the first derivatives if theD1 is not NULL)
+  //! of the 3D B-spline curve at theNbPoints parameters theU.
+  //! The parameters are grouped by the knot spans, the polynomial coefficients
+  //! of each span are computed once (see BuildCache()) and evaluated at two
+  //! parameters at once using SIMD instructions when available.
+  //! The results are stored as the structure of arrays of 3 * theNbPoints values:
+  //! X coordinates of all points, then Y and Z coordinates.
+  Standard_EXPORT static void EvalBatch (const Standard_Integer theNbPoints, const Standard_Real* theU, const Standard_Integer theDegree, const Standard_Boolean thePeriodic, const TColStd_Array1OfReal& theFlatKnots, const TColgp_Array1OfPnt& thePoles, const TColStd_Array1OfReal* theWeights, Standard_Real* thePoints, Standard_Real* theD1 = NULL);
   
     static void PolesCoefficients (const TColgp_Array1OfPnt2d& Poles, TColgp_Array1OfPnt2d& CachePoles);
   
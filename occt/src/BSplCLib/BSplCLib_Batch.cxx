@@ -0,0 +1,98 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplCLib.hxx>
+#include "BSplCLib_Lanes.pxx"
+
+#include <NCollection_Array1.hxx>
+
+//=======================================================================
+//function : EvalBatch
+//purpose  : 
+//=======================================================================
+
+void BSplCLib::EvalBatch (const Standard_Integer theNbPoints,
+                          const Standard_Real* theU,
+                          const Standard_Integer theDegree,
+                          const Standard_Boolean thePeriodic,
+                          const TColStd_Array1OfReal& theFlatKnots,
+                          const TColgp_Array1OfPnt& thePoles,
+                          const TColStd_Array1OfReal* theWeights,
+                          Standard_Real* thePoints,
+                          Standard_Real* theD1)
+{
+  if (theNbPoints <= 0)
+  {
+    return;
+  }
+
+  BSplCLib_CacheParams aSpanParams (theDegree, thePeriodic, theFlatKnots);
+  NCollection_Array1<Standard_Real> aParams (0, theNbPoints - 1);
+  NCollection_Array1<Standard_Integer> aSpans (0, theNbPoints - 1), anOrder (0, theNbPoints - 1);
+  BSplCLib_LocateSpans (theNbPoints, theU, aSpanParams, theFlatKnots, aParams, aSpans);
+  BSplCLib_SortBySpans (aSpans, aSpanParams.SpanIndexMax - aSpanParams.SpanIndexMin + 1, anOrder);
+
+  const Standard_Boolean isRational = theWeights != NULL;
+  const Standard_Integer aDim = isRational ? 4 : 3;
+  TColStd_Array2OfReal aCache (1, theDegree + 1, 1, aDim);
+  const Standard_Real* aCoeffs = &aCache (1, 1);
+  BSplCLib_Lanes aValues[4], aDerivs[4];
+  for (Standard_Integer aFirst = 0; aFirst < theNbPoints;)
+  {
+    const Standard_Integer aKey = aSpans (anOrder (aFirst));
+    Standard_Integer aLast = aFirst + 1;
+    while (aLast < theNbPoints && aSpans (anOrder (aLast)) == aKey)
+    {
+      ++aLast;
+    }
+
+    const Standard_Integer aSpan = aKey + aSpanParams.SpanIndexMin;
+    const Standard_Real aSpanStart  = theFlatKnots (aSpan);
+    const Standard_Real aSpanLength = theFlatKnots (aSpan + 1) - aSpanStart;
+    BSplCLib::BuildCache (aSpanStart, aSpanLength, thePeriodic, theDegree, aSpan,
+                          theFlatKnots, thePoles, theWeights, aCache);
+    const BSplCLib_Lanes aStart = BSplCLib_Lanes::Splat (aSpanStart);
+    const BSplCLib_Lanes anInvLength = BSplCLib_Lanes::Splat (1.0 / aSpanLength);
+
+    // evaluate the parameters of the span by pairs, the last odd parameter is duplicated
+    for (Standard_Integer k = aFirst; k < aLast; k += 2)
+    {
+      const Standard_Integer anIndex0 = anOrder (k);
+      const Standard_Integer anIndex1 = anOrder (Min (k + 1, aLast - 1));
+      const BSplCLib_Lanes aParam = (BSplCLib_Lanes::Set (aParams (anIndex0), aParams (anIndex1)) - aStart) * anInvLength;
+      BSplCLib_EvalLanes (aCoeffs, theDegree, aDim, aDim, aParam, aValues, theD1 != NULL ? aDerivs : NULL);
+      if (isRational)
+      {
+        const BSplCLib_Lanes anInvWeight = BSplCLib_Lanes::Splat (1.0) / aValues[3];
+        for (Standard_Integer j = 0; j < 3; ++j)
+        {
+          aValues[j] = aValues[j] * anInvWeight;
+          if (theD1 != NULL)
+          {
+            aDerivs[j] = (aDerivs[j] - aValues[j] * aDerivs[3]) * anInvWeight;
+          }
+        }
+      }
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        BSplCLib_StoreLanes (aValues[j], thePoints + j * theNbPoints, anIndex0, anIndex1);
+        if (theD1 != NULL)
+        {
+          BSplCLib_StoreLanes (aDerivs[j] * anInvLength, theD1 + j * theNbPoints, anIndex0, anIndex1);
+        }
+      }
+    }
+    aFirst = aLast;
+  }
+}
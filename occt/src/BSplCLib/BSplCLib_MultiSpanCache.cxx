@@ -0,0 +1,111 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplCLib_MultiSpanCache.hxx>
+
+#include <Standard_Atomic.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplCLib_MultiSpanCache,Standard_Transient)
+
+namespace
+{
+  //! States of the cache of a span
+  enum
+  {
+    THE_SPAN_EMPTY    = 0, //!< the cache is not stored
+    THE_SPAN_BUILDING = 1, //!< the cache is being stored by one of the threads
+    THE_SPAN_READY    = 2  //!< the cache is stored and can be read
+  };
+}
+
+BSplCLib_MultiSpanCache::BSplCLib_MultiSpanCache(const Standard_Integer      theDegree,
+                                                 const Standard_Boolean      thePeriodic,
+                                                 const TColStd_Array1OfReal& theFlatKnots,
+                                                 const TColgp_Array1OfPnt&   thePoles,
+                                                 const TColStd_Array1OfReal* theWeights,
+                                                 const Standard_Size         theMaxMemory)
+: myParams (theDegree, thePeriodic, theFlatKnots),
+  myNbSpans (myParams.SpanIndexMax - myParams.SpanIndexMin + 1),
+  myMaxNbCached (0),
+  mySpanMemory (0),
+  myNbCached (0)
+{
+  myFlatKnots = new TColStd_HArray1OfReal (theFlatKnots.Lower(), theFlatKnots.Upper());
+  myFlatKnots->ChangeArray1() = theFlatKnots;
+  myPoles = new TColgp_HArray1OfPnt (thePoles.Lower(), thePoles.Upper());
+  myPoles->ChangeArray1() = thePoles;
+  if (theWeights != NULL)
+  {
+    myWeights = new TColStd_HArray1OfReal (theWeights->Lower(), theWeights->Upper());
+    myWeights->ChangeArray1() = *theWeights;
+  }
+  // the memory of one span includes the cache object and its array of coefficients
+  // (see BSplCLib_Cache constructor)
+  const Standard_Integer aNbCoeffs = (theDegree + 1) * (theWeights != NULL ? 4 : 3);
+  mySpanMemory = aNbCoeffs * sizeof(Standard_Real) + sizeof(BSplCLib_Cache) + sizeof(TColStd_HArray2OfReal);
+
+  // the table of spans is counted against the limit as well
+  const Standard_Size aTableMemory = (Standard_Size )myNbSpans
+                                   * (sizeof(Handle(BSplCLib_Cache)) + sizeof(Standard_Integer));
+  if (theMaxMemory < aTableMemory + mySpanMemory)
+  {
+    return;
+  }
+  const Standard_Size aMaxNbCached = (theMaxMemory - aTableMemory) / mySpanMemory;
+  myMaxNbCached = aMaxNbCached < (Standard_Size )myNbSpans
+                ? (Standard_Integer )aMaxNbCached
+                : myNbSpans;
+  mySpans.Resize (0, myNbSpans - 1, Standard_False);
+  myStates.Resize (0, myNbSpans - 1, Standard_False);
+  myStates.Init (THE_SPAN_EMPTY);
+}
+
+Handle(BSplCLib_Cache) BSplCLib_MultiSpanCache::Cache(const Standard_Real theParameter) const
+{
+  // Locate the span in the same way as BSplCLib_Cache::BuildCache() does
+  Standard_Real aParam = myParams.PeriodicNormalization (theParameter);
+  Standard_Integer aSpan = 0;
+  BSplCLib::LocateParameter (myParams.Degree, myFlatKnots->Array1(), BSplCLib::NoMults(),
+                             aParam, myParams.IsPeriodic, aSpan, aParam);
+  const Standard_Integer anIndex = aSpan - myParams.SpanIndexMin;
+
+  // The acquire load pairs with the atomic publication of the ready state below,
+  // so the stored cache is visible to the thread when the span is seen as ready
+  volatile Standard_Integer* aState = myMaxNbCached > 0 ? &myStates.ChangeValue (anIndex) : NULL;
+  if (aState != NULL && Standard_Atomic_Load (aState) == THE_SPAN_READY)
+  {
+    return mySpans.Value (anIndex);
+  }
+
+  const TColStd_Array1OfReal* aWeights = myWeights.IsNull() ? NULL : &myWeights->Array1();
+  Handle(BSplCLib_Cache) aCache = new BSplCLib_Cache (myParams.Degree, myParams.IsPeriodic,
+                                                      myFlatKnots->Array1(), myPoles->Array1(), aWeights);
+  aCache->BuildCache (theParameter, myFlatKnots->Array1(), myPoles->Array1(), aWeights);
+
+  // Store the cache unless another thread is storing the same span or the memory limit is reached
+  if (myNbCached < myMaxNbCached
+   && Standard_Atomic_CompareAndSwap (aState, THE_SPAN_EMPTY, THE_SPAN_BUILDING))
+  {
+    if (Standard_Atomic_Increment (&myNbCached) <= myMaxNbCached)
+    {
+      mySpans.ChangeValue (anIndex) = aCache;
+      Standard_Atomic_CompareAndSwap (aState, THE_SPAN_BUILDING, THE_SPAN_READY);
+    }
+    else
+    {
+      Standard_Atomic_Decrement (&myNbCached);
+      Standard_Atomic_CompareAndSwap (aState, THE_SPAN_BUILDING, THE_SPAN_EMPTY);
+    }
+  }
+  return aCache;
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplCLib_MultiSpanCache_Headerfile
+#define _BSplCLib_MultiSpanCache_Headerfile
+
+#include <BSplCLib_Cache.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_HArray1OfPnt.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+
+//! \brief A table of caches of all spans of a 3D B-spline curve.
+//!
+//! Unlike BSplCLib_Cache, which holds the data of one span and is recomputed
+//! in going from span to span, the table keeps the caches of the spans once computed.
+//! The cache of a span is built lazily on the first request and never modified
+//! afterwards, thus the table can be shared by several evaluators (e.g. the copies
+//! of GeomAdaptor_Curve) working in different threads without locking.
+//!
+//! The table holds a copy of the poles, weights and knots of the curve.
+//! The memory used by the table of spans and the stored caches is bounded: when the limit
+//! is reached, the caches of the remaining spans are built on each request and not stored.
+//! The table of spans is not allocated at all if it does not fit into the limit itself.
+//!
+//! @sa BSplSLib_MultiSpanCache
+class BSplCLib_MultiSpanCache : public Standard_Transient
+{
+public:
+
+  //! Constructor, copies the data of the curve. The caches are not computed.
+  //! \param theDegree     degree of the curve
+  //! \param thePeriodic   identify whether the curve is periodic
+  //! \param theFlatKnots  knots of the curve (with repetitions)
+  //! \param thePoles      array of poles of the curve
+  //! \param theWeights    array of weights of corresponding poles
+  //! \param theMaxMemory  maximal size in bytes of the table of spans and the stored caches
+  Standard_EXPORT BSplCLib_MultiSpanCache(const Standard_Integer      theDegree,
+                                          const Standard_Boolean      thePeriodic,
+                                          const TColStd_Array1OfReal& theFlatKnots,
+                                          const TColgp_Array1OfPnt&   thePoles,
+                                          const TColStd_Array1OfReal* theWeights = NULL,
+                                          const Standard_Size         theMaxMemory = 16 * 1024 * 1024);
+
+  //! Returns the cache of the span containing the parameter.
+  //! The returned cache must not be rebuilt by the caller.
+  //! Can be called concurrently from several threads.
+  //! \param theParameter  parameter of the point
+  Standard_EXPORT Handle(BSplCLib_Cache) Cache(const Standard_Real theParameter) const;
+
+  //! Returns the number of spans of the curve (including empty spans at multiple knots).
+  Standard_Integer NbSpans() const { return myNbSpans; }
+
+  //! Returns the number of spans which caches are stored in the table.
+  Standard_Integer NbCachedSpans() const { return Min (myNbCached, myMaxNbCached); }
+
+  //! Returns the maximal number of spans which caches can be stored in the table.
+  Standard_Integer MaxNbCachedSpans() const { return myMaxNbCached; }
+
+  //! Returns the memory in bytes used by the table of spans and the stored caches.
+  Standard_Size UsedMemory() const
+  {
+    return (Standard_Size )mySpans.Length() * (sizeof(Handle(BSplCLib_Cache)) + sizeof(Standard_Integer))
+         + NbCachedSpans() * mySpanMemory;
+  }
+
+  DEFINE_STANDARD_RTTIEXT(BSplCLib_MultiSpanCache,Standard_Transient)
+
+private:
+  // copying is prohibited
+  BSplCLib_MultiSpanCache (const BSplCLib_MultiSpanCache&);
+  void operator = (const BSplCLib_MultiSpanCache&);
+
+private:
+  BSplCLib_CacheParams myParams;                //!< parameterization of the curve
+                                                // (the data of the current span are not used)
+  Handle(TColStd_HArray1OfReal) myFlatKnots;    //!< flat knots of the curve
+  Handle(TColgp_HArray1OfPnt)   myPoles;        //!< poles of the curve
+  Handle(TColStd_HArray1OfReal) myWeights;      //!< weights of the poles (null for non-rational curve)
+  Standard_Integer myNbSpans;                   //!< number of spans
+  Standard_Integer myMaxNbCached;               //!< maximal number of stored caches (0 if the table is not allocated)
+  Standard_Size    mySpanMemory;                //!< memory used by the cache of one span
+
+  mutable NCollection_Array1<Handle(BSplCLib_Cache)> mySpans; //!< caches of spans
+  mutable NCollection_Array1<Standard_Integer> myStates;      //!< states of the caches of spans
+  mutable volatile Standard_Integer myNbCached;               //!< number of stored (or being stored) caches
+};
+
+DEFINE_STANDARD_HANDLE(BSplCLib_MultiSpanCache, Standard_Transient)
+
+#endif
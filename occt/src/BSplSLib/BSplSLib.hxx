@@ -272,6 +272,15 @@ public:
   //! of the Bspline normalized between 0 and 1.
   //! Structure of result optimized for BSplSLib_Cache.
   Standard_EXPORT static void BuildCache (const Standard_Real theU, const Standard_Real theV, const Standard_Real theUSpanDomain, const Standard_Real theVSpanDomain, const Standard_Boolean theUPeriodic, const Standard_Boolean theVPeriodic, const Standard_Integer theUDegree, const Standard_Integer theVDegree, const Standard_Integer theUIndex, const Standard_Integer theVIndex, const TColStd_Array1OfReal& theUFlatKnots, const TColStd_Array1OfReal& theVFlatKnots, const TColgp_Array2OfPnt& thePoles, const TColStd_Array2OfReal* theWeights, TColStd_Array2OfReal& theCacheArray);
+
+  //! Evaluates the points (and the first derivatives if theD1U and theD1V are not NULL)
+  //! of the B-spline surface at theNbPoints parameters (theU[i], theV[i]).
+  //! The parameters are grouped by the knot spans, the polynomial coefficients
+  //! of each span are computed once (see BuildCache()) and evaluated at two
+  //! parameters at once using SIMD instructions when available.
+  //! The results are stored as the structure of arrays of 3 * theNbPoints values:
+  //! X coordinates of all points, then Y and Z coordinates.
+  Standard_EXPORT static void EvalBatch (const Standard_Integer theNbPoints, const Standard_Real* theU, const Standard_Real* theV, const Standard_Integer theUDegree, const Standard_Integer theVDegree, const Standard_Boolean theUPeriodic, const Standard_Boolean theVPeriodic, const TColStd_Array1OfReal& theUFlatKnots, const TColStd_Array1OfReal& theVFlatKnots, const TColgp_Array2OfPnt& thePoles, const TColStd_Array2OfReal* theWeights, Standard_Real* thePoints, Standard_Real* theD1U = NULL, Standard_Real* theD1V = NULL);
   
   //! Perform the evaluation of the of the cache
   //! the parameter must be normalized between
@@ -0,0 +1,150 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplSLib.hxx>
+#include <BSplCLib.hxx>
+#include "../BSplCLib/BSplCLib_Lanes.pxx"
+
+#include <NCollection_Array1.hxx>
+
+//! Maximal number of columns of the cache of a span: the dimension (4 for rational surfaces)
+//! multiplied by the number of coefficients (BSplCLib::MaxDegree() + 1)
+static const Standard_Integer THE_MAX_CACHE_COLS = 4 * (25 + 1);
+
+//=======================================================================
+//function : EvalBatch
+//purpose  : 
+//=======================================================================
+
+void BSplSLib::EvalBatch (const Standard_Integer theNbPoints,
+                          const Standard_Real* theU,
+                          const Standard_Real* theV,
+                          const Standard_Integer theUDegree,
+                          const Standard_Integer theVDegree,
+                          const Standard_Boolean theUPeriodic,
+                          const Standard_Boolean theVPeriodic,
+                          const TColStd_Array1OfReal& theUFlatKnots,
+                          const TColStd_Array1OfReal& theVFlatKnots,
+                          const TColgp_Array2OfPnt& thePoles,
+                          const TColStd_Array2OfReal* theWeights,
+                          Standard_Real* thePoints,
+                          Standard_Real* theD1U,
+                          Standard_Real* theD1V)
+{
+  if (theNbPoints <= 0)
+  {
+    return;
+  }
+
+  BSplCLib_CacheParams aUSpanParams (theUDegree, theUPeriodic, theUFlatKnots);
+  BSplCLib_CacheParams aVSpanParams (theVDegree, theVPeriodic, theVFlatKnots);
+  NCollection_Array1<Standard_Real> aUParams (0, theNbPoints - 1), aVParams (0, theNbPoints - 1);
+  NCollection_Array1<Standard_Integer> aUSpans (0, theNbPoints - 1), aVSpans (0, theNbPoints - 1);
+  BSplCLib_LocateSpans (theNbPoints, theU, aUSpanParams, theUFlatKnots, aUParams, aUSpans);
+  BSplCLib_LocateSpans (theNbPoints, theV, aVSpanParams, theVFlatKnots, aVParams, aVSpans);
+
+  // group the parameters by the pairs of spans
+  const Standard_Integer aNbUSpans = aUSpanParams.SpanIndexMax - aUSpanParams.SpanIndexMin + 1;
+  const Standard_Integer aNbVSpans = aVSpanParams.SpanIndexMax - aVSpanParams.SpanIndexMin + 1;
+  NCollection_Array1<Standard_Integer> aKeys (0, theNbPoints - 1), anOrder (0, theNbPoints - 1);
+  for (Standard_Integer i = 0; i < theNbPoints; ++i)
+  {
+    aKeys (i) = aUSpans (i) * aNbVSpans + aVSpans (i);
+  }
+  BSplCLib_SortBySpans (aKeys, aNbUSpans * aNbVSpans, anOrder);
+
+  // the cache stores the coefficients of the polynomial by rows for the powers
+  // of the parameter of maximal degree (see BSplSLib_Cache)
+  const Standard_Boolean isRational = theWeights != NULL;
+  const Standard_Boolean isUMax = theUDegree > theVDegree;
+  const Standard_Integer aMinDegree = Min (theUDegree, theVDegree);
+  const Standard_Integer aMaxDegree = Max (theUDegree, theVDegree);
+  const Standard_Integer aDim = isRational ? 4 : 3;
+  const Standard_Integer aCacheCols = aDim * (aMinDegree + 1);
+  TColStd_Array2OfReal aCache (1, aMaxDegree + 1, 1, aCacheCols);
+  const Standard_Real* aCoeffs = &aCache (1, 1);
+
+  const Standard_Boolean toComputeD1 = theD1U != NULL && theD1V != NULL;
+  BSplCLib_Lanes aTransient[THE_MAX_CACHE_COLS], aTransientD[THE_MAX_CACHE_COLS];
+  BSplCLib_Lanes aValues[4], aDerivsMin[4], aDerivsMax[4];
+  for (Standard_Integer aFirst = 0; aFirst < theNbPoints;)
+  {
+    const Standard_Integer aKey = aKeys (anOrder (aFirst));
+    Standard_Integer aLast = aFirst + 1;
+    while (aLast < theNbPoints && aKeys (anOrder (aLast)) == aKey)
+    {
+      ++aLast;
+    }
+
+    // BSplSLib uses the middle of the span and the half-span as the span parameters
+    const Standard_Integer aUSpan = aUSpans (anOrder (aFirst)) + aUSpanParams.SpanIndexMin;
+    const Standard_Integer aVSpan = aVSpans (anOrder (aFirst)) + aVSpanParams.SpanIndexMin;
+    const Standard_Real aUHalf = 0.5 * (theUFlatKnots (aUSpan + 1) - theUFlatKnots (aUSpan));
+    const Standard_Real aVHalf = 0.5 * (theVFlatKnots (aVSpan + 1) - theVFlatKnots (aVSpan));
+    const Standard_Real aUMid = theUFlatKnots (aUSpan) + aUHalf;
+    const Standard_Real aVMid = theVFlatKnots (aVSpan) + aVHalf;
+    BSplSLib::BuildCache (aUMid, aVMid, aUHalf, aVHalf, theUPeriodic, theVPeriodic,
+                          theUDegree, theVDegree, aUSpan, aVSpan,
+                          theUFlatKnots, theVFlatKnots, thePoles, theWeights, aCache);
+    const BSplCLib_Lanes aUStart = BSplCLib_Lanes::Splat (aUMid), aUInv = BSplCLib_Lanes::Splat (1.0 / aUHalf);
+    const BSplCLib_Lanes aVStart = BSplCLib_Lanes::Splat (aVMid), aVInv = BSplCLib_Lanes::Splat (1.0 / aVHalf);
+
+    // evaluate the parameters of the span by pairs, the last odd parameter is duplicated
+    for (Standard_Integer k = aFirst; k < aLast; k += 2)
+    {
+      const Standard_Integer anIndex0 = anOrder (k);
+      const Standard_Integer anIndex1 = anOrder (Min (k + 1, aLast - 1));
+      const BSplCLib_Lanes aU = (BSplCLib_Lanes::Set (aUParams (anIndex0), aUParams (anIndex1)) - aUStart) * aUInv;
+      const BSplCLib_Lanes aV = (BSplCLib_Lanes::Set (aVParams (anIndex0), aVParams (anIndex1)) - aVStart) * aVInv;
+      const BSplCLib_Lanes& aMaxParam = isUMax ? aU : aV;
+      const BSplCLib_Lanes& aMinParam = isUMax ? aV : aU;
+
+      // intermediate values of the polynomial along the columns, then the total values
+      BSplCLib_EvalLanes (aCoeffs, aMaxDegree, aCacheCols, aCacheCols, aMaxParam,
+                          aTransient, toComputeD1 ? aTransientD : NULL);
+      BSplCLib_EvalLanes (aTransient, aMinDegree, aDim, aDim, aMinParam,
+                          aValues, toComputeD1 ? aDerivsMin : NULL);
+      if (toComputeD1)
+      {
+        BSplCLib_EvalLanes (aTransientD, aMinDegree, aDim, aDim, aMinParam, aDerivsMax, NULL);
+      }
+
+      BSplCLib_Lanes* aDerivsU = isUMax ? aDerivsMax : aDerivsMin;
+      BSplCLib_Lanes* aDerivsV = isUMax ? aDerivsMin : aDerivsMax;
+      if (isRational)
+      {
+        const BSplCLib_Lanes anInvWeight = BSplCLib_Lanes::Splat (1.0) / aValues[3];
+        for (Standard_Integer j = 0; j < 3; ++j)
+        {
+          aValues[j] = aValues[j] * anInvWeight;
+          if (toComputeD1)
+          {
+            aDerivsU[j] = (aDerivsU[j] - aValues[j] * aDerivsU[3]) * anInvWeight;
+            aDerivsV[j] = (aDerivsV[j] - aValues[j] * aDerivsV[3]) * anInvWeight;
+          }
+        }
+      }
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        BSplCLib_StoreLanes (aValues[j], thePoints + j * theNbPoints, anIndex0, anIndex1);
+        if (toComputeD1)
+        {
+          BSplCLib_StoreLanes (aDerivsU[j] * aUInv, theD1U + j * theNbPoints, anIndex0, anIndex1);
+          BSplCLib_StoreLanes (aDerivsV[j] * aVInv, theD1V + j * theNbPoints, anIndex0, anIndex1);
+        }
+      }
+    }
+    aFirst = aLast;
+  }
+}
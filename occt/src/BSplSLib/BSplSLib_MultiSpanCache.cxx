@@ -0,0 +1,128 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplSLib_MultiSpanCache.hxx>
+
+#include <Standard_Atomic.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_MultiSpanCache,Standard_Transient)
+
+namespace
+{
+  //! States of the cache of a span
+  enum
+  {
+    THE_SPAN_EMPTY    = 0, //!< the cache is not stored
+    THE_SPAN_BUILDING = 1, //!< the cache is being stored by one of the threads
+    THE_SPAN_READY    = 2  //!< the cache is stored and can be read
+  };
+}
+
+BSplSLib_MultiSpanCache::BSplSLib_MultiSpanCache(const Standard_Integer      theDegreeU,
+                                                 const Standard_Boolean      thePeriodicU,
+                                                 const TColStd_Array1OfReal& theFlatKnotsU,
+                                                 const Standard_Integer      theDegreeV,
+                                                 const Standard_Boolean      thePeriodicV,
+                                                 const TColStd_Array1OfReal& theFlatKnotsV,
+                                                 const TColgp_Array2OfPnt&   thePoles,
+                                                 const TColStd_Array2OfReal* theWeights,
+                                                 const Standard_Size         theMaxMemory)
+: myParamsU (theDegreeU, thePeriodicU, theFlatKnotsU),
+  myParamsV (theDegreeV, thePeriodicV, theFlatKnotsV),
+  myNbSpansV (myParamsV.SpanIndexMax - myParamsV.SpanIndexMin + 1),
+  myNbSpans ((myParamsU.SpanIndexMax - myParamsU.SpanIndexMin + 1) * myNbSpansV),
+  myMaxNbCached (0),
+  mySpanMemory (0),
+  myNbCached (0)
+{
+  myFlatKnotsU = new TColStd_HArray1OfReal (theFlatKnotsU.Lower(), theFlatKnotsU.Upper());
+  myFlatKnotsU->ChangeArray1() = theFlatKnotsU;
+  myFlatKnotsV = new TColStd_HArray1OfReal (theFlatKnotsV.Lower(), theFlatKnotsV.Upper());
+  myFlatKnotsV->ChangeArray1() = theFlatKnotsV;
+  myPoles = new TColgp_HArray2OfPnt (thePoles.LowerRow(), thePoles.UpperRow(),
+                                     thePoles.LowerCol(), thePoles.UpperCol());
+  myPoles->ChangeArray2() = thePoles;
+  if (theWeights != NULL)
+  {
+    myWeights = new TColStd_HArray2OfReal (theWeights->LowerRow(), theWeights->UpperRow(),
+                                           theWeights->LowerCol(), theWeights->UpperCol());
+    myWeights->ChangeArray2() = *theWeights;
+  }
+  // the memory of one span includes the cache object and its array of coefficients
+  // (see BSplSLib_Cache constructor)
+  const Standard_Integer aNbCoeffs = (Max (theDegreeU, theDegreeV) + 1) * (Min (theDegreeU, theDegreeV) + 1)
+                                   * (theWeights != NULL ? 4 : 3);
+  mySpanMemory = aNbCoeffs * sizeof(Standard_Real) + sizeof(BSplSLib_Cache) + sizeof(TColStd_HArray2OfReal);
+
+  // the table of spans is counted against the limit as well
+  const Standard_Size aTableMemory = (Standard_Size )myNbSpans
+                                   * (sizeof(Handle(BSplSLib_Cache)) + sizeof(Standard_Integer));
+  if (theMaxMemory < aTableMemory + mySpanMemory)
+  {
+    return;
+  }
+  const Standard_Size aMaxNbCached = (theMaxMemory - aTableMemory) / mySpanMemory;
+  myMaxNbCached = aMaxNbCached < (Standard_Size )myNbSpans
+                ? (Standard_Integer )aMaxNbCached
+                : myNbSpans;
+  mySpans.Resize (0, myNbSpans - 1, Standard_False);
+  myStates.Resize (0, myNbSpans - 1, Standard_False);
+  myStates.Init (THE_SPAN_EMPTY);
+}
+
+Handle(BSplSLib_Cache) BSplSLib_MultiSpanCache::Cache(const Standard_Real theParameterU,
+                                                      const Standard_Real theParameterV) const
+{
+  // Locate the span in the same way as BSplSLib_Cache::BuildCache() does
+  Standard_Real aParamU = myParamsU.PeriodicNormalization (theParameterU);
+  Standard_Real aParamV = myParamsV.PeriodicNormalization (theParameterV);
+  Standard_Integer aSpanU = 0, aSpanV = 0;
+  BSplCLib::LocateParameter (myParamsU.Degree, myFlatKnotsU->Array1(), BSplCLib::NoMults(),
+                             aParamU, myParamsU.IsPeriodic, aSpanU, aParamU);
+  BSplCLib::LocateParameter (myParamsV.Degree, myFlatKnotsV->Array1(), BSplCLib::NoMults(),
+                             aParamV, myParamsV.IsPeriodic, aSpanV, aParamV);
+  const Standard_Integer anIndex = (aSpanU - myParamsU.SpanIndexMin) * myNbSpansV
+                                 + (aSpanV - myParamsV.SpanIndexMin);
+
+  // The acquire load pairs with the atomic publication of the ready state below,
+  // so the stored cache is visible to the thread when the span is seen as ready
+  volatile Standard_Integer* aState = myMaxNbCached > 0 ? &myStates.ChangeValue (anIndex) : NULL;
+  if (aState != NULL && Standard_Atomic_Load (aState) == THE_SPAN_READY)
+  {
+    return mySpans.Value (anIndex);
+  }
+
+  const TColStd_Array2OfReal* aWeights = myWeights.IsNull() ? NULL : &myWeights->Array2();
+  Handle(BSplSLib_Cache) aCache = new BSplSLib_Cache (myParamsU.Degree, myParamsU.IsPeriodic, myFlatKnotsU->Array1(),
+                                                      myParamsV.Degree, myParamsV.IsPeriodic, myFlatKnotsV->Array1(),
+                                                      aWeights);
+  aCache->BuildCache (theParameterU, theParameterV, myFlatKnotsU->Array1(), myFlatKnotsV->Array1(),
+                      myPoles->Array2(), aWeights);
+
+  // Store the cache unless another thread is storing the same span or the memory limit is reached
+  if (myNbCached < myMaxNbCached
+   && Standard_Atomic_CompareAndSwap (aState, THE_SPAN_EMPTY, THE_SPAN_BUILDING))
+  {
+    if (Standard_Atomic_Increment (&myNbCached) <= myMaxNbCached)
+    {
+      mySpans.ChangeValue (anIndex) = aCache;
+      Standard_Atomic_CompareAndSwap (aState, THE_SPAN_BUILDING, THE_SPAN_READY);
+    }
+    else
+    {
+      Standard_Atomic_Decrement (&myNbCached);
+      Standard_Atomic_CompareAndSwap (aState, THE_SPAN_BUILDING, THE_SPAN_EMPTY);
+    }
+  }
+  return aCache;
+}
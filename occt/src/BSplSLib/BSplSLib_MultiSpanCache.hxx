@@ -0,0 +1,111 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplSLib_MultiSpanCache_Headerfile
+#define _BSplSLib_MultiSpanCache_Headerfile
+
+#include <BSplSLib_Cache.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_HArray2OfPnt.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+
+//! \brief A table of caches of all spans of a B-spline surface.
+//!
+//! Unlike BSplSLib_Cache, which holds the data of one span and is recomputed
+//! in going from span to span, the table keeps the caches of the spans once computed.
+//! The cache of a span is built lazily on the first request and never modified
+//! afterwards, thus the table can be shared by several evaluators (e.g. the copies
+//! of GeomAdaptor_Surface) working in different threads without locking.
+//!
+//! The table holds a copy of the poles, weights and knots of the surface,
+//! so that it remains valid when the surface is modified (but evaluates
+//! the surface as it was at the creation of the table).
+//!
+//! The memory used by the table of spans and the stored caches is bounded: when the limit
+//! is reached, the caches of the remaining spans are built on each request and not stored.
+//! The table of spans is not allocated at all if it does not fit into the limit itself.
+class BSplSLib_MultiSpanCache : public Standard_Transient
+{
+public:
+
+  //! Constructor, copies the data of the surface. The caches are not computed.
+  //! \param theDegreeU    degree along the first parameter (U) of the surface
+  //! \param thePeriodicU  identify the surface is periodical along U axis
+  //! \param theFlatKnotsU knots of the surface (with repetition) along U axis
+  //! \param theDegreeV    degree along the second parameter (V) of the surface
+  //! \param thePeriodicV  identify the surface is periodical along V axis
+  //! \param theFlatKnotsV knots of the surface (with repetition) along V axis
+  //! \param thePoles      array of poles of the surface
+  //! \param theWeights    array of weights of corresponding poles
+  //! \param theMaxMemory  maximal size in bytes of the table of spans and the stored caches
+  Standard_EXPORT BSplSLib_MultiSpanCache(const Standard_Integer      theDegreeU,
+                                          const Standard_Boolean      thePeriodicU,
+                                          const TColStd_Array1OfReal& theFlatKnotsU,
+                                          const Standard_Integer      theDegreeV,
+                                          const Standard_Boolean      thePeriodicV,
+                                          const TColStd_Array1OfReal& theFlatKnotsV,
+                                          const TColgp_Array2OfPnt&   thePoles,
+                                          const TColStd_Array2OfReal* theWeights = NULL,
+                                          const Standard_Size         theMaxMemory = 16 * 1024 * 1024);
+
+  //! Returns the cache of the span containing the point.
+  //! The returned cache must not be rebuilt by the caller.
+  //! Can be called concurrently from several threads.
+  //! \param theParameterU  first parameter of the point
+  //! \param theParameterV  second parameter of the point
+  Standard_EXPORT Handle(BSplSLib_Cache) Cache(const Standard_Real theParameterU,
+                                               const Standard_Real theParameterV) const;
+
+  //! Returns the number of spans of the surface (including empty spans at multiple knots).
+  Standard_Integer NbSpans() const { return myNbSpans; }
+
+  //! Returns the number of spans which caches are stored in the table.
+  Standard_Integer NbCachedSpans() const { return Min (myNbCached, myMaxNbCached); }
+
+  //! Returns the maximal number of spans which caches can be stored in the table.
+  Standard_Integer MaxNbCachedSpans() const { return myMaxNbCached; }
+
+  //! Returns the memory in bytes used by the table of spans and the stored caches.
+  Standard_Size UsedMemory() const
+  {
+    return (Standard_Size )mySpans.Length() * (sizeof(Handle(BSplSLib_Cache)) + sizeof(Standard_Integer))
+         + NbCachedSpans() * mySpanMemory;
+  }
+
+  DEFINE_STANDARD_RTTIEXT(BSplSLib_MultiSpanCache,Standard_Transient)
+
+private:
+  // copying is prohibited
+  BSplSLib_MultiSpanCache (const BSplSLib_MultiSpanCache&);
+  void operator = (const BSplSLib_MultiSpanCache&);
+
+private:
+  BSplCLib_CacheParams myParamsU, myParamsV;    //!< parameterization by U and V directions
+                                                // (the data of the current span are not used)
+  Handle(TColStd_HArray1OfReal) myFlatKnotsU;   //!< flat knots along U axis
+  Handle(TColStd_HArray1OfReal) myFlatKnotsV;   //!< flat knots along V axis
+  Handle(TColgp_HArray2OfPnt)   myPoles;        //!< poles of the surface
+  Handle(TColStd_HArray2OfReal) myWeights;      //!< weights of the poles (null for non-rational surface)
+  Standard_Integer myNbSpansV;                  //!< number of spans along V axis
+  Standard_Integer myNbSpans;                   //!< number of spans
+  Standard_Integer myMaxNbCached;               //!< maximal number of stored caches (0 if the table is not allocated)
+  Standard_Size    mySpanMemory;                //!< memory used by the cache of one span
+
+  mutable NCollection_Array1<Handle(BSplSLib_Cache)> mySpans; //!< caches of spans (U-major order)
+  mutable NCollection_Array1<Standard_Integer> myStates;      //!< states of the caches of spans
+  mutable volatile Standard_Integer myNbCached;               //!< number of stored (or being stored) caches
+};
+
+DEFINE_STANDARD_HANDLE(BSplSLib_MultiSpanCache, Standard_Transient)
+
+#endif
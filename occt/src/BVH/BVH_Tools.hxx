@@ -332,6 +332,47 @@ public: //! @name Ray-Box Intersection
 
     return hasIntersection;
   }
+
+public: //! @name Ray-Triangle Intersection
+
+  //! Computes hit time of ray-triangle intersection (Moller-Trumbore algorithm).
+  //! The ray is hit if the time is not negative; the triangles parallel to the ray are not hit.
+  static Standard_Boolean RayTriangleIntersection (const BVH_VecNt& theRayOrigin,
+                                                   const BVH_VecNt& theRayDirection,
+                                                   const BVH_VecNt& theNode0,
+                                                   const BVH_VecNt& theNode1,
+                                                   const BVH_VecNt& theNode2,
+                                                   T& theTime)
+  {
+    const BVH_VecNt aE1 = theNode1 - theNode0;
+    const BVH_VecNt aE2 = theNode2 - theNode0;
+    const BVH_VecNt aPV = BVH_VecNt::Cross (theRayDirection, aE2);
+    const T aDet = aE1.Dot (aPV);
+    if (Abs (aDet) < (std::numeric_limits<T>::min)())
+    {
+      return Standard_False;
+    }
+    const T anInvDet = static_cast<T>(1) / aDet;
+    const BVH_VecNt aTV = theRayOrigin - theNode0;
+    const T anU = aTV.Dot (aPV) * anInvDet;
+    if (anU < static_cast<T>(0) || anU > static_cast<T>(1))
+    {
+      return Standard_False;
+    }
+    const BVH_VecNt aQV = BVH_VecNt::Cross (aTV, aE1);
+    const T aV = theRayDirection.Dot (aQV) * anInvDet;
+    if (aV < static_cast<T>(0) || anU + aV > static_cast<T>(1))
+    {
+      return Standard_False;
+    }
+    const T aTime = aE2.Dot (aQV) * anInvDet;
+    if (aTime < static_cast<T>(0))
+    {
+      return Standard_False;
+    }
+    theTime = aTime;
+    return Standard_True;
+  }
 };
 
 #endif
\ No newline at end of file
@@ -15,6 +15,8 @@
 
 
 #include <BinTools.hxx>
+#include <BinTools_MappedFile.hxx>
+#include <BinTools_MappedStreamBuf.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <FSD_FileHeader.hxx>
 #include <OSD_FileSystem.hxx>
@@ -233,6 +235,21 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
 Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString theFile,
                                  const Message_ProgressRange& theRange)
 {
+  // read directly from memory; triangulations may refer to the mapped file without copying
+  Handle(BinTools_MappedFile) aFile = new BinTools_MappedFile();
+  if (aFile->Open (theFile))
+  {
+    Handle(Standard_Transient) anOwner;
+    if (aFile->IsMapped())
+    {
+      anOwner = aFile;
+    }
+    BinTools_MappedStreamBuf aBuffer ((const char* )aFile->Data(), aFile->Size(), anOwner);
+    std::istream aStream (&aBuffer);
+    Read (theShape, aStream, theRange);
+    return aStream.good();
+  }
+
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
   if (aStream.get() == NULL)
@@ -115,6 +115,8 @@ public:
                                                  const Message_ProgressRange& theRange = Message_ProgressRange());
 
   //! Reads a shape from <theFile> and returns it in <theShape>.
+  //! The file is mapped into memory where supported (see BinTools_MappedFile);
+  //! triangulation arrays of the result then refer to the mapped memory instead of copies.
   Standard_EXPORT static Standard_Boolean Read
     (TopoDS_Shape& theShape, const Standard_CString theFile,
      const Message_ProgressRange& theRange = Message_ProgressRange());
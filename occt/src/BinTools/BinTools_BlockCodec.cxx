@@ -0,0 +1,221 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_BlockCodec.hxx>
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+  //! Minimal length of a back-reference.
+  static const size_t THE_MIN_MATCH = 4;
+  //! Maximal distance of a back-reference (16-bit offset).
+  static const size_t THE_MAX_OFFSET = 65535;
+  //! Number of bits of the match finder hash table.
+  static const unsigned int THE_HASH_BITS = 14;
+
+  //! Reads 4 bytes as an unsigned integer (independent of alignment).
+  static inline uint32_t readU32 (const Standard_Byte* thePtr)
+  {
+    uint32_t aValue;
+    memcpy (&aValue, thePtr, sizeof(aValue));
+    return aValue;
+  }
+
+  //! Multiplicative hash of 4 bytes.
+  static inline uint32_t hashU32 (const uint32_t theValue)
+  {
+    return (theValue * 2654435761U) >> (32 - THE_HASH_BITS);
+  }
+
+  //! Writes the length continuation bytes (value above 15 of the token nibble).
+  static inline void putLength (size_t theLength, std::string& theResult)
+  {
+    for (; theLength >= 255; theLength -= 255)
+    {
+      theResult.push_back (char(255));
+    }
+    theResult.push_back (char(theLength));
+  }
+
+  //! Emits a sequence: literals [theLit, theLit + theNbLit) followed by a match (if theMatchLen > 0).
+  static void putSequence (const Standard_Byte* theLit,
+                           const size_t         theNbLit,
+                           const size_t         theOffset,
+                           const size_t         theMatchLen,
+                           std::string&         theResult)
+  {
+    const size_t aMatchCode = theMatchLen > 0 ? theMatchLen - THE_MIN_MATCH : 0;
+    const Standard_Byte aToken = Standard_Byte (((theNbLit    < 15 ? theNbLit   : 15) << 4)
+                                              |  (aMatchCode  < 15 ? aMatchCode : 15));
+    theResult.push_back (char(aToken));
+    if (theNbLit >= 15)
+    {
+      putLength (theNbLit - 15, theResult);
+    }
+    theResult.append (reinterpret_cast<const char*>(theLit), theNbLit);
+    if (theMatchLen == 0)
+    {
+      return;
+    }
+    theResult.push_back (char(theOffset & 0xFF));
+    theResult.push_back (char((theOffset >> 8) & 0xFF));
+    if (aMatchCode >= 15)
+    {
+      putLength (aMatchCode - 15, theResult);
+    }
+  }
+
+  //! Reads the length continuation bytes; returns FALSE on truncated input.
+  static inline Standard_Boolean getLength (const Standard_Byte*& thePtr,
+                                            const Standard_Byte*  theEnd,
+                                            size_t&               theLength)
+  {
+    for (;;)
+    {
+      if (thePtr >= theEnd)
+      {
+        return Standard_False;
+      }
+      const Standard_Byte aByte = *thePtr++;
+      theLength += aByte;
+      if (aByte != 255)
+      {
+        return Standard_True;
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : Compress
+//purpose  :
+//=======================================================================
+void BinTools_BlockCodec::Compress (const Standard_Byte* theData,
+                                    const size_t         theSize,
+                                    std::string&         theResult)
+{
+  theResult.reserve (theResult.size() + theSize / 2 + 16);
+  if (theSize < THE_MIN_MATCH + 1)
+  {
+    putSequence (theData, theSize, 0, 0, theResult);
+    return;
+  }
+
+  // positions (+1) of the last occurrence of 4-byte sequences; 0 means empty slot
+  std::vector<size_t> aTable (size_t(1) << THE_HASH_BITS, 0);
+  const size_t aLastMatchPos = theSize - THE_MIN_MATCH;
+  size_t anAnchor = 0;
+  size_t aPos = 0;
+  while (aPos <= aLastMatchPos)
+  {
+    const uint32_t aSeq  = readU32 (theData + aPos);
+    size_t&        aSlot = aTable[hashU32 (aSeq)];
+    const size_t   aCand = aSlot;
+    aSlot = aPos + 1;
+    if (aCand == 0
+     || aPos - (aCand - 1) > THE_MAX_OFFSET
+     || readU32 (theData + aCand - 1) != aSeq)
+    {
+      ++aPos;
+      continue;
+    }
+
+    // extend the match forward
+    const size_t aRef = aCand - 1;
+    size_t aLen = THE_MIN_MATCH;
+    while (aPos + aLen < theSize
+        && theData[aRef + aLen] == theData[aPos + aLen])
+    {
+      ++aLen;
+    }
+    putSequence (theData + anAnchor, aPos - anAnchor, aPos - aRef, aLen, theResult);
+
+    // register a couple of positions inside the match to keep the table warm
+    const size_t aNext = aPos + aLen;
+    for (size_t aFill = aPos + 1; aFill < aNext && aFill <= aLastMatchPos; aFill += (aLen > 32 ? 8 : 1))
+    {
+      aTable[hashU32 (readU32 (theData + aFill))] = aFill + 1;
+    }
+    aPos = anAnchor = aNext;
+  }
+  if (anAnchor < theSize)
+  {
+    putSequence (theData + anAnchor, theSize - anAnchor, 0, 0, theResult);
+  }
+}
+
+//=======================================================================
+//function : Decompress
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_BlockCodec::Decompress (const Standard_Byte* theData,
+                                                  const size_t         theSize,
+                                                  const size_t         theRawSize,
+                                                  std::string&         theResult)
+{
+  const size_t aBase = theResult.size();
+  theResult.reserve (aBase + theRawSize);
+  const Standard_Byte* aPtr = theData;
+  const Standard_Byte* anEnd = theData + theSize;
+  while (aPtr < anEnd)
+  {
+    const Standard_Byte aToken = *aPtr++;
+    size_t aNbLit = aToken >> 4;
+    if (aNbLit == 15
+    && !getLength (aPtr, anEnd, aNbLit))
+    {
+      return Standard_False;
+    }
+    if (size_t(anEnd - aPtr) < aNbLit
+     || theResult.size() - aBase + aNbLit > theRawSize)
+    {
+      return Standard_False;
+    }
+    theResult.append (reinterpret_cast<const char*>(aPtr), aNbLit);
+    aPtr += aNbLit;
+    if (aPtr == anEnd)
+    {
+      break;
+    }
+
+    if (anEnd - aPtr < 2)
+    {
+      return Standard_False;
+    }
+    const size_t anOffset = size_t(aPtr[0]) | (size_t(aPtr[1]) << 8);
+    aPtr += 2;
+    size_t aLen = aToken & 0x0F;
+    if (aLen == 15
+    && !getLength (aPtr, anEnd, aLen))
+    {
+      return Standard_False;
+    }
+    aLen += THE_MIN_MATCH;
+    const size_t aDecoded = theResult.size() - aBase;
+    if (anOffset == 0
+     || anOffset > aDecoded
+     || aDecoded + aLen > theRawSize)
+    {
+      return Standard_False;
+    }
+    // byte-wise copy: the source may overlap the bytes being produced
+    size_t aSrc = theResult.size() - anOffset;
+    for (size_t anIter = 0; anIter < aLen; ++anIter)
+    {
+      theResult.push_back (theResult[aSrc++]);
+    }
+  }
+  return theResult.size() - aBase == theRawSize;
+}
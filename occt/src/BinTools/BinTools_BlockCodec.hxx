@@ -0,0 +1,50 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_BlockCodec_HeaderFile
+#define _BinTools_BlockCodec_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_TypeDef.hxx>
+
+#include <string>
+
+//! Fast LZ77-style compression of memory blocks.
+//!
+//! The encoded block is a sequence of tokens; each token carries a run of literal bytes
+//! followed by a back-reference (16-bit offset, length >= 4) into the already decoded data.
+//! The codec favours speed over ratio and has no external dependencies,
+//! so that it is available in every build configuration (including WebAssembly).
+class BinTools_BlockCodec
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Compresses theSize bytes starting at theData and appends the encoded block to theResult.
+  Standard_EXPORT static void Compress (const Standard_Byte* theData,
+                                        const size_t         theSize,
+                                        std::string&         theResult);
+
+  //! Decodes the block of theSize bytes starting at theData and appends decoded data to theResult.
+  //! @param theRawSize [in] expected size of the decoded data
+  //! @return FALSE if the block is corrupted or does not decode into theRawSize bytes
+  Standard_EXPORT static Standard_Boolean Decompress (const Standard_Byte* theData,
+                                                      const size_t         theSize,
+                                                      const size_t         theRawSize,
+                                                      std::string&         theResult);
+
+};
+
+#endif // _BinTools_BlockCodec_HeaderFile
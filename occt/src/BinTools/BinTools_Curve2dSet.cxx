@@ -16,6 +16,7 @@
 
 #include <BinTools.hxx>
 #include <BinTools_Curve2dSet.hxx>
+#include <BinTools_StreamBlock.hxx>
 #include <Geom2d_BezierCurve.hxx>
 #include <Geom2d_BSplineCurve.hxx>
 #include <Geom2d_Circle.hxx>
@@ -509,18 +510,23 @@ static Standard_IStream& operator>>(Standard_IStream& IS,
   TColgp_Array1OfPnt2d poles(1,nbpoles);
   TColStd_Array1OfReal weights(1,nbpoles);
   
+  // poles (with weights) and knots (with multiplicities) are decoded by blocks
+  const size_t aPoleSize = rational ? 24 : 16;
+  BinTools_StreamBlock aBlock;
+  aBlock.Fetch (IS, size_t(nbpoles) * aPoleSize);
   for (i = 1; i <= nbpoles; i++) {
-    IS >> poles(i);//Pnt2d
+    poles(i) = aBlock.Pnt2d (size_t(i - 1) * aPoleSize);
     if (rational)
-      BinTools::GetReal(IS, weights(i));
+      weights(i) = aBlock.Real (size_t(i - 1) * aPoleSize + 16);
   }
 
   TColStd_Array1OfReal knots(1,nbknots);
   TColStd_Array1OfInteger mults(1,nbknots);
 
+  aBlock.Fetch (IS, size_t(nbknots) * 12);
   for (i = 1; i <= nbknots; i++) {
-    BinTools::GetReal(IS, knots(i));
-    BinTools::GetInteger(IS, mults(i));
+    knots(i) = aBlock.Real (size_t(i - 1) * 12);
+    mults(i) = aBlock.Integer (size_t(i - 1) * 12 + 8);
   }
 
   if (rational)
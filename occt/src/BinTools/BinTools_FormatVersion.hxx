@@ -26,13 +26,17 @@ enum BinTools_FormatVersion
   BinTools_FormatVersion_VERSION_4 = 4, //!< Stores per-vertex normal information in case
                                         //!  of triangulation-only Faces, because
                                         //!  no analytical geometry to restore normals
+  BinTools_FormatVersion_VERSION_5 = 5, //!< Geometry sections are preceded by the table of their sizes,
+                                        //!  so that they can be decoded concurrently;
+                                        //!  triangulation arrays are aligned to 8 bytes.
+                                        //!  Written only on request, as it is not readable by older versions
   BinTools_FormatVersion_CURRENT = BinTools_FormatVersion_VERSION_4 //!< Current version
 };
 
 enum
 {
   BinTools_FormatVersion_LOWER   = BinTools_FormatVersion_VERSION_1,
-  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_4
+  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_5
 };
 
 #endif
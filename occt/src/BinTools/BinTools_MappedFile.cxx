@@ -0,0 +1,192 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_MappedFile.hxx>
+
+#include <OSD_FileSystem.hxx>
+#include <Standard.hxx>
+#include <TCollection_ExtendedString.hxx>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+  #define BINTOOLS_USE_MMAP
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_MappedFile, Standard_Transient)
+
+//=======================================================================
+//function : BinTools_MappedFile
+//purpose  :
+//=======================================================================
+BinTools_MappedFile::BinTools_MappedFile()
+: myData (NULL),
+  mySize (0),
+  myMapping (NULL),
+  myIsOpen (Standard_False),
+  myIsMapped (Standard_False)
+{
+  //
+}
+
+//=======================================================================
+//function : ~BinTools_MappedFile
+//purpose  :
+//=======================================================================
+BinTools_MappedFile::~BinTools_MappedFile()
+{
+  Close();
+}
+
+//=======================================================================
+//function : Open
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_MappedFile::Open (const TCollection_AsciiString& theFilePath)
+{
+  Close();
+
+#if defined(_WIN32)
+  const TCollection_ExtendedString aPathW (theFilePath, Standard_True);
+  HANDLE aFile = CreateFileW (aPathW.ToWideString(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (aFile != INVALID_HANDLE_VALUE)
+  {
+    LARGE_INTEGER aSize;
+    if (GetFileSizeEx (aFile, &aSize)
+     && aSize.QuadPart == LONGLONG(size_t(aSize.QuadPart)))
+    {
+      mySize = size_t(aSize.QuadPart);
+      if (mySize != 0)
+      {
+        // PAGE_WRITECOPY + FILE_MAP_COPY make the view copy-on-write
+        HANDLE aMapping = CreateFileMappingW (aFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (aMapping != NULL)
+        {
+          myData = (Standard_Byte* )MapViewOfFile (aMapping, FILE_MAP_COPY, 0, 0, 0);
+          if (myData != NULL)
+          {
+            myMapping = aMapping;
+          }
+          else
+          {
+            CloseHandle (aMapping);
+          }
+        }
+      }
+      myIsOpen   = mySize == 0 || myData != NULL;
+      myIsMapped = myData != NULL;
+    }
+    CloseHandle (aFile);
+  }
+#elif defined(BINTOOLS_USE_MMAP)
+  const int aFile = open (theFilePath.ToCString(), O_RDONLY);
+  if (aFile != -1)
+  {
+    struct stat aStat;
+    if (fstat (aFile, &aStat) == 0
+     && S_ISREG(aStat.st_mode))
+    {
+      mySize = size_t(aStat.st_size);
+      if (mySize != 0)
+      {
+        // private writable mapping - pages are copied on the first write only
+        void* aData = mmap (NULL, mySize, PROT_READ | PROT_WRITE, MAP_PRIVATE, aFile, 0);
+        if (aData != MAP_FAILED)
+        {
+          myData = (Standard_Byte* )aData;
+        #if defined(POSIX_MADV_SEQUENTIAL)
+          posix_madvise (aData, mySize, POSIX_MADV_SEQUENTIAL);
+        #endif
+        }
+      }
+      myIsOpen   = mySize == 0 || myData != NULL;
+      myIsMapped = myData != NULL;
+    }
+    close (aFile);
+  }
+#endif
+
+  if (!myIsOpen)
+  {
+    // fallback - read the whole file through the file system
+    myData = NULL;
+    mySize = 0;
+    const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+    std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFilePath, std::ios::in | std::ios::binary);
+    if (aStream.get() == NULL
+     || !aStream->seekg (0, std::ios::end))
+    {
+      return Standard_False;
+    }
+    const std::streamoff aSize = aStream->tellg();
+    if (aSize < 0
+    || !aStream->seekg (0, std::ios::beg))
+    {
+      return Standard_False;
+    }
+    mySize = size_t(aSize);
+    if (mySize != 0)
+    {
+      myData = (Standard_Byte* )Standard::AllocateAligned (mySize, 16);
+      if (myData == NULL
+      || !aStream->read ((char* )myData, std::streamsize(mySize)))
+      {
+        Standard::FreeAligned (myData);
+        myData = NULL;
+        mySize = 0;
+        return Standard_False;
+      }
+    }
+    myIsOpen = Standard_True;
+  }
+  myFilePath = theFilePath;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Close
+//purpose  :
+//=======================================================================
+void BinTools_MappedFile::Close()
+{
+  if (myData != NULL)
+  {
+    if (!myIsMapped)
+    {
+      Standard::FreeAligned (myData);
+    }
+  #if defined(_WIN32)
+    else
+    {
+      UnmapViewOfFile (myData);
+      CloseHandle ((HANDLE )myMapping);
+    }
+  #elif defined(BINTOOLS_USE_MMAP)
+    else
+    {
+      munmap (myData, mySize);
+    }
+  #endif
+  }
+  myFilePath.Clear();
+  myData     = NULL;
+  mySize     = 0;
+  myMapping  = NULL;
+  myIsOpen   = Standard_False;
+  myIsMapped = Standard_False;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_MappedFile_HeaderFile
+#define _BinTools_MappedFile_HeaderFile
+
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Read-only view of the whole file content in memory.
+//!
+//! On platforms supporting memory mapping (mmap() on POSIX systems, file mapping on Windows)
+//! the file is mapped privately: pages are loaded on demand, can be dropped by the system
+//! under memory pressure and are copied only when modified by the process
+//! (modifications are never written back to the file).
+//! Elsewhere (e.g. WebAssembly) the file content is read into an aligned memory block.
+//!
+//! The object should be kept alive as long as any data referring to its memory is in use.
+class BinTools_MappedFile : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_MappedFile, Standard_Transient)
+public:
+
+  //! Creates an empty object.
+  Standard_EXPORT BinTools_MappedFile();
+
+  //! Releases the memory.
+  Standard_EXPORT virtual ~BinTools_MappedFile();
+
+  //! Maps the file into memory (previously opened file is closed).
+  //! @return FALSE if the file cannot be opened
+  Standard_EXPORT Standard_Boolean Open (const TCollection_AsciiString& theFilePath);
+
+  //! Releases the memory.
+  Standard_EXPORT void Close();
+
+  //! Returns TRUE if the file is opened.
+  Standard_Boolean IsOpen() const { return myIsOpen; }
+
+  //! Returns TRUE if the content is mapped (FALSE if it has been read into the memory).
+  Standard_Boolean IsMapped() const { return myIsMapped; }
+
+  //! Returns the beginning of the file content (NULL for empty file).
+  //! The memory is writable but modifications are private to the process.
+  Standard_Byte* Data() const { return myData; }
+
+  //! Returns the size of the file content in bytes.
+  size_t Size() const { return mySize; }
+
+  //! Returns the path of the opened file.
+  const TCollection_AsciiString& FilePath() const { return myFilePath; }
+
+private:
+
+  BinTools_MappedFile (const BinTools_MappedFile& );
+  BinTools_MappedFile& operator= (const BinTools_MappedFile& );
+
+private:
+
+  TCollection_AsciiString myFilePath;
+  Standard_Byte*          myData;
+  size_t                  mySize;
+  void*                   myMapping;  //!< file mapping handle (Windows only)
+  Standard_Boolean        myIsOpen;
+  Standard_Boolean        myIsMapped;
+
+};
+
+DEFINE_STANDARD_HANDLE(BinTools_MappedFile, Standard_Transient)
+
+#endif // _BinTools_MappedFile_HeaderFile
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_MappedStreamBuf.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+//=======================================================================
+//function : BinTools_MappedStreamBuf
+//purpose  :
+//=======================================================================
+BinTools_MappedStreamBuf::BinTools_MappedStreamBuf (const char* theData,
+                                                    const size_t theSize,
+                                                    const Handle(Standard_Transient)& theOwner)
+: myOwner (theOwner)
+{
+  char* aData = const_cast<char*> (theData);
+  setg (aData, aData, aData + theSize);
+}
+
+//=======================================================================
+//function : xsgetn
+//purpose  :
+//=======================================================================
+std::streamsize BinTools_MappedStreamBuf::xsgetn (char* theBuffer, std::streamsize theCount)
+{
+  const std::streamsize aCount = std::min (theCount, std::streamsize(egptr() - gptr()));
+  if (aCount <= 0)
+  {
+    return 0;
+  }
+  memcpy (theBuffer, gptr(), size_t(aCount));
+  setg (eback(), gptr() + aCount, egptr());
+  return aCount;
+}
+
+//=======================================================================
+//function : showmanyc
+//purpose  :
+//=======================================================================
+std::streamsize BinTools_MappedStreamBuf::showmanyc()
+{
+  const std::streamsize aNbLeft = std::streamsize(egptr() - gptr());
+  return aNbLeft > 0 ? aNbLeft : -1;
+}
+
+//=======================================================================
+//function : seekoff
+//purpose  :
+//=======================================================================
+BinTools_MappedStreamBuf::pos_type BinTools_MappedStreamBuf::seekoff (off_type theOff,
+                                                                      std::ios_base::seekdir theWay,
+                                                                      std::ios_base::openmode theWhich)
+{
+  if ((theWhich & std::ios_base::in) == 0)
+  {
+    return pos_type(off_type(-1));
+  }
+
+  off_type aPos = 0;
+  switch (theWay)
+  {
+    case std::ios_base::beg: aPos = theOff; break;
+    case std::ios_base::cur: aPos = off_type(gptr()  - eback()) + theOff; break;
+    case std::ios_base::end: aPos = off_type(egptr() - eback()) + theOff; break;
+    default: return pos_type(off_type(-1));
+  }
+  if (aPos < 0
+   || aPos > off_type(egptr() - eback()))
+  {
+    return pos_type(off_type(-1));
+  }
+  setg (eback(), eback() + aPos, egptr());
+  return pos_type(aPos);
+}
+
+//=======================================================================
+//function : seekpos
+//purpose  :
+//=======================================================================
+BinTools_MappedStreamBuf::pos_type BinTools_MappedStreamBuf::seekpos (pos_type thePosition,
+                                                                      std::ios_base::openmode theWhich)
+{
+  return seekoff (off_type(thePosition), std::ios_base::beg, theWhich);
+}
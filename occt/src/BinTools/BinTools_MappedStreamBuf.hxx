@@ -0,0 +1,84 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_MappedStreamBuf_HeaderFile
+#define _BinTools_MappedStreamBuf_HeaderFile
+
+#include <Standard_Handle.hxx>
+#include <Standard_Transient.hxx>
+
+#include <streambuf>
+
+//! Input stream buffer reading directly from a memory block (e.g. file mapped by BinTools_MappedFile).
+//!
+//! The whole block is exposed as the get area of the buffer, so that reading from std::istream
+//! does not involve any intermediate buffering. Besides, the readers of BinTools package
+//! recognize this buffer and access data arrays in place (see BinTools_StreamBlock).
+//!
+//! The optional owner object keeps the memory block alive;
+//! data referring to the block may hold the owner returned by Owner().
+class BinTools_MappedStreamBuf : public std::streambuf
+{
+public:
+
+  //! Creates the buffer over the memory block [theData, theData + theSize).
+  //! @param theOwner [in] object keeping the memory block alive
+  Standard_EXPORT BinTools_MappedStreamBuf (const char* theData,
+                                            const size_t theSize,
+                                            const Handle(Standard_Transient)& theOwner = Handle(Standard_Transient)());
+
+  //! Returns the object keeping the memory block alive.
+  const Handle(Standard_Transient)& Owner() const { return myOwner; }
+
+  //! Returns the pointer to the current position and advances the position by theSize bytes.
+  //! @return NULL if less than theSize bytes remain (position is not changed)
+  const char* Fetch (const size_t theSize)
+  {
+    if (size_t(egptr() - gptr()) < theSize)
+    {
+      return NULL;
+    }
+    const char* aData = gptr();
+    setg (eback(), gptr() + theSize, egptr());
+    return aData;
+  }
+
+protected:
+
+  //! Copies the data at once.
+  Standard_EXPORT virtual std::streamsize xsgetn (char* theBuffer, std::streamsize theCount) Standard_OVERRIDE;
+
+  //! Returns the number of remaining bytes.
+  Standard_EXPORT virtual std::streamsize showmanyc() Standard_OVERRIDE;
+
+  //! Moves the position relatively.
+  Standard_EXPORT virtual pos_type seekoff (off_type theOff,
+                                            std::ios_base::seekdir theWay,
+                                            std::ios_base::openmode theWhich) Standard_OVERRIDE;
+
+  //! Moves the position to the absolute value.
+  Standard_EXPORT virtual pos_type seekpos (pos_type thePosition,
+                                            std::ios_base::openmode theWhich) Standard_OVERRIDE;
+
+private:
+
+  BinTools_MappedStreamBuf (const BinTools_MappedStreamBuf& );
+  BinTools_MappedStreamBuf& operator= (const BinTools_MappedStreamBuf& );
+
+private:
+
+  Handle(Standard_Transient) myOwner;
+
+};
+
+#endif // _BinTools_MappedStreamBuf_HeaderFile
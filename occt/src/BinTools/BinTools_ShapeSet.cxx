@@ -16,7 +16,9 @@
 
 #include <BinTools.hxx>
 #include <BinTools_Curve2dSet.hxx>
+#include <BinTools_MappedStreamBuf.hxx>
 #include <BinTools_ShapeSet.hxx>
+#include <BinTools_StreamBlock.hxx>
 #include <BinTools_SurfaceSet.hxx>
 #include <BRep_CurveOnClosedSurface.hxx>
 #include <BRep_CurveOnSurface.hxx>
@@ -38,6 +40,7 @@
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <TopoDS.hxx>
@@ -45,9 +48,117 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <Message_ProgressRange.hxx>
+#include <OSD_ThreadPool.hxx>
 
+#include <sstream>
 #include <string.h>
 
+namespace
+{
+  //! Triangulation which arrays refer to the memory of the mapped stream (see BinTools_MappedStreamBuf)
+  //! instead of copies. The triangulation keeps the owner of the memory alive.
+  //! The file is expected to be mapped privately, so that modification of the arrays
+  //! copies the affected memory pages and affects neither the file nor other objects.
+  class BinTools_MappedTriangulation : public Poly_Triangulation
+  {
+  public:
+
+    DEFINE_STANDARD_RTTI_INLINE(BinTools_MappedTriangulation, Poly_Triangulation)
+
+    //! Creates the triangulation referring to the arrays stored in the block.
+    BinTools_MappedTriangulation (const BinTools_StreamBlock& theBlock,
+                                  const Standard_Integer theNbNodes,
+                                  const Standard_Integer theNbTriangles,
+                                  const Standard_Boolean theHasUV,
+                                  const Standard_Boolean theHasNormals,
+                                  const size_t theUVOffset,
+                                  const size_t theTrisOffset,
+                                  const size_t theNormalsOffset)
+    : myOwner (theBlock.Owner())
+    {
+      const char* aData = theBlock.Data();
+      Poly_ArrayOfNodes aNodes (*reinterpret_cast<const gp_Pnt*> (aData), theNbNodes);
+      myNodes.Move (aNodes);
+      if (theHasUV)
+      {
+        Poly_ArrayOfUVNodes anUVNodes (*reinterpret_cast<const gp_Pnt2d*> (aData + theUVOffset), theNbNodes);
+        myUVNodes.Move (anUVNodes);
+      }
+      Poly_Array1OfTriangle aTriangles (*reinterpret_cast<const Poly_Triangle*> (aData + theTrisOffset), 1, theNbTriangles);
+      myTriangles.Move (aTriangles);
+      if (theHasNormals)
+      {
+        NCollection_Array1<gp_Vec3f> aNormals (*reinterpret_cast<const gp_Vec3f*> (aData + theNormalsOffset), 0, theNbNodes - 1);
+        myNormals.Move (aNormals);
+      }
+    }
+
+  private:
+
+    Handle(Standard_Transient) myOwner; //!< owner of the mapped memory
+  };
+
+  //! Number of geometry sections listed in the table of format BinTools_FormatVersion_VERSION_5:
+  //! 2D curves, 3D curves, 3D polygons, polygons on triangulation, surfaces and triangulations.
+  static const Standard_Integer THE_NB_SECTIONS = 6;
+
+  //! Returns the number of zero bytes to be inserted at the given stream position to align it to 8 bytes.
+  static size_t paddingSize (const std::streamoff thePosition)
+  {
+    return thePosition < 0 ? 0 : size_t((8 - thePosition % 8) % 8);
+  }
+}
+
+//! Functor writing geometry sections into separate buffers.
+struct BinTools_ShapeSet::SectionWriter
+{
+  const BinTools_ShapeSet* ShapeSet;
+  std::ostringstream*      Sections;
+  Message_ProgressRange*   Ranges;
+
+  void operator() (int /*theThreadIndex*/, int theSection) const
+  {
+    Standard_OStream& aStream = Sections[theSection];
+    const Message_ProgressRange& aRange = Ranges[theSection];
+    switch (theSection)
+    {
+      case 0: ShapeSet->myCurves2d.Write (aStream, aRange); break;
+      case 1: ShapeSet->myCurves.Write (aStream, aRange); break;
+      case 2: ShapeSet->WritePolygon3D (aStream, aRange); break;
+      case 3: ShapeSet->WritePolygonOnTriangulation (aStream, aRange); break;
+      case 4: ShapeSet->mySurfaces.Write (aStream, aRange); break;
+      case 5: ShapeSet->WriteTriangulation (aStream, aRange); break;
+    }
+  }
+};
+
+//! Functor decoding geometry sections from memory.
+struct BinTools_ShapeSet::SectionReader
+{
+  BinTools_ShapeSet*                ShapeSet;
+  const char*                       Data;
+  const uint64_t*                   Offsets;
+  const Handle(Standard_Transient)* Owner;
+  Message_ProgressRange*            Ranges;
+
+  void operator() (int /*theThreadIndex*/, int theSection) const
+  {
+    BinTools_MappedStreamBuf aBuffer (Data + Offsets[theSection],
+                                      size_t(Offsets[theSection + 1] - Offsets[theSection]), *Owner);
+    std::istream aStream (&aBuffer);
+    const Message_ProgressRange& aRange = Ranges[theSection];
+    switch (theSection)
+    {
+      case 0: ShapeSet->myCurves2d.Read (aStream, aRange); break;
+      case 1: ShapeSet->myCurves.Read (aStream, aRange); break;
+      case 2: ShapeSet->ReadPolygon3D (aStream, aRange); break;
+      case 3: ShapeSet->ReadPolygonOnTriangulation (aStream, aRange); break;
+      case 4: ShapeSet->mySurfaces.Read (aStream, aRange); break;
+      case 5: ShapeSet->ReadTriangulation (aStream, aRange); break;
+    }
+  }
+};
+
 //=======================================================================
 //function : BinTools_ShapeSet
 //purpose  :
@@ -268,6 +379,47 @@ void  BinTools_ShapeSet::WriteGeometry (Standard_OStream& OS,
                                         const Message_ProgressRange& theRange)const
 {
   Message_ProgressScope aPS(theRange, "Writing geometry", 6);
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    // sections are written concurrently into separate buffers
+    // and stored after the table of their sizes (padded to 8 bytes)
+    std::ostringstream aSections[THE_NB_SECTIONS];
+    Message_ProgressRange aRanges[THE_NB_SECTIONS];
+    for (Standard_Integer aSectionIter = 0; aSectionIter < THE_NB_SECTIONS; ++aSectionIter)
+    {
+      aRanges[aSectionIter] = aPS.Next();
+    }
+    SectionWriter aWriter = { this, aSections, aRanges };
+    OSD_ThreadPool::Launcher aLauncher (*OSD_ThreadPool::DefaultPool(), THE_NB_SECTIONS);
+    aLauncher.Perform (0, THE_NB_SECTIONS, aWriter);
+    if (!aPS.More())
+      return;
+
+    std::string aData[THE_NB_SECTIONS];
+    OS << "Sections " << THE_NB_SECTIONS << "\n";
+    for (Standard_Integer aSectionIter = 0; aSectionIter < THE_NB_SECTIONS; ++aSectionIter)
+    {
+      aData[aSectionIter] = aSections[aSectionIter].str();
+      aSections[aSectionIter].str (std::string());
+      aData[aSectionIter].append (paddingSize (std::streamoff(aData[aSectionIter].size())), '\0');
+      const uint64_t aSize = uint64_t(aData[aSectionIter].size());
+      OS.write ((const char* )&aSize, sizeof(uint64_t));
+    }
+    // sections start at aligned position of the stream (if the position is known)
+    const size_t aPadding = paddingSize (std::streamoff(OS.tellp()) + 1);
+    OS.put (char(aPadding));
+    for (size_t aPadIter = 0; aPadIter < aPadding; ++aPadIter)
+    {
+      OS.put ('\0');
+    }
+    for (Standard_Integer aSectionIter = 0; aSectionIter < THE_NB_SECTIONS; ++aSectionIter)
+    {
+      OS.write (aData[aSectionIter].data(), std::streamsize(aData[aSectionIter].size()));
+      aData[aSectionIter].clear();
+    }
+    return;
+  }
+
   myCurves2d.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
@@ -533,6 +685,69 @@ void BinTools_ShapeSet::ReadGeometry (Standard_IStream& IS,
 {
 
   Message_ProgressScope aPS(theRange, "Reading geometry", 6);
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    char aHeader[255];
+    Standard_Integer aNbSections = 0;
+    IS >> aHeader >> aNbSections;
+    if (IS.fail() || strcmp (aHeader, "Sections") || aNbSections != THE_NB_SECTIONS)
+    {
+      throw Standard_Failure ("BinTools_ShapeSet::ReadGeometry: Not a table of sections");
+    }
+    IS.get(); // remove LF
+    uint64_t anOffsets[THE_NB_SECTIONS + 1] = {};
+    for (Standard_Integer aSectionIter = 0; aSectionIter < THE_NB_SECTIONS; ++aSectionIter)
+    {
+      uint64_t aSize = 0;
+      if (!IS.read ((char* )&aSize, sizeof(uint64_t)))
+      {
+        throw Storage_StreamTypeMismatchError();
+      }
+      anOffsets[aSectionIter + 1] = anOffsets[aSectionIter] + aSize;
+    }
+    const int aPadding = IS.get();
+    IS.ignore (aPadding);
+    const uint64_t aTotalSize = anOffsets[THE_NB_SECTIONS];
+    if (IS.fail() || aTotalSize != uint64_t(size_t(aTotalSize)))
+    {
+      throw Storage_StreamTypeMismatchError();
+    }
+
+    // sections are decoded in place when reading from memory, otherwise they are read into a buffer;
+    // triangulations may refer to the memory only when it is owned by a mapped file
+    const char* aData = NULL;
+    Handle(Standard_Transient) anOwner;
+    std::string aBuffer;
+    if (BinTools_MappedStreamBuf* aMapped = dynamic_cast<BinTools_MappedStreamBuf*> (IS.rdbuf()))
+    {
+      aData   = aMapped->Fetch (size_t(aTotalSize));
+      anOwner = aMapped->Owner();
+    }
+    else
+    {
+      aBuffer.resize (size_t(aTotalSize));
+      if (aTotalSize == 0 || IS.read (&aBuffer[0], std::streamsize(aTotalSize)))
+      {
+        aData = aBuffer.data();
+      }
+    }
+    if (aData == NULL)
+    {
+      IS.setstate (std::ios::failbit);
+      throw Storage_StreamTypeMismatchError();
+    }
+
+    Message_ProgressRange aRanges[THE_NB_SECTIONS];
+    for (Standard_Integer aSectionIter = 0; aSectionIter < THE_NB_SECTIONS; ++aSectionIter)
+    {
+      aRanges[aSectionIter] = aPS.Next();
+    }
+    SectionReader aReader = { this, aData, anOffsets, &anOwner, aRanges };
+    OSD_ThreadPool::Launcher aLauncher (*OSD_ThreadPool::DefaultPool(), THE_NB_SECTIONS);
+    aLauncher.Perform (0, THE_NB_SECTIONS, aReader);
+    return;
+  }
+
   myCurves2d.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
@@ -1446,6 +1661,14 @@ void BinTools_ShapeSet::WriteTriangulation (Standard_OStream& OS,
         BinTools::PutBool(OS, (aTriangulation->HasNormals() && NeedToWriteNormals) ? 1 : 0);
       }
       BinTools::PutReal(OS, aTriangulation->Deflection());
+      if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+      {
+        // align the arrays so that they can be used in place when read from memory
+        for (size_t aPadding = paddingSize (OS.tellp()); aPadding > 0; --aPadding)
+        {
+          OS.put ('\0');
+        }
+      }
 
       // write the 3d nodes
       for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
@@ -1521,6 +1744,7 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
   {
     OCC_CATCH_SIGNALS
     Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
+    BinTools_StreamBlock aBlock;
     for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
     {
       Standard_Integer aNbNodes = 0, aNbTriangles = 0;
@@ -1535,51 +1759,54 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
         BinTools::GetBool(IS, hasNormals);
       }
       BinTools::GetReal(IS, aDefl); //deflection
-      Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection (aDefl);
-
-      gp_Pnt aNode;
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
       {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
-        aTriangulation->SetNode (aNodeIter, aNode);
+        IS.ignore (std::streamsize(paddingSize (IS.tellg())));
       }
-
-      if (hasUV)
+      // all arrays of the triangulation are stored consecutively
+      const size_t aNodesSize   = size_t(aNbNodes) * 3 * sizeof(Standard_Real);
+      const size_t anUVSize     = hasUV ? size_t(aNbNodes) * 2 * sizeof(Standard_Real) : 0;
+      const size_t aTrisSize    = size_t(aNbTriangles) * 3 * sizeof(Standard_Integer);
+      const size_t aNormalsSize = hasNormals ? size_t(aNbNodes) * 3 * sizeof(Standard_ShortReal) : 0;
+      const size_t aNodesOffset = 0, anUVOffset = aNodesSize, aTrisOffset = anUVOffset + anUVSize,
+                   aNormalsOffset = aTrisOffset + aTrisSize;
+      aBlock.Fetch (IS, aNormalsOffset + aNormalsSize);
+
+      Handle(Poly_Triangulation) aTriangulation;
+      if (aNbNodes > 0 && aNbTriangles > 0
+       && aBlock.IsAliasable<gp_Pnt> (aNodesOffset)
+       && aBlock.IsAliasable<Poly_Triangle> (aTrisOffset))
       {
-        gp_Pnt2d aNode2d;
+        aTriangulation = new BinTools_MappedTriangulation (aBlock, aNbNodes, aNbTriangles,
+                                                           hasUV, hasNormals, anUVOffset, aTrisOffset, aNormalsOffset);
+      }
+      else
+      {
+        aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
         for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
         {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
-          aTriangulation->SetUVNode (aNodeIter, aNode2d);
+          aTriangulation->SetNode (aNodeIter, aBlock.Pnt (aNodesOffset + size_t(aNodeIter - 1) * 24));
         }
-      }
-
-      // read the triangles
-      Standard_Integer aTriNodes[3] = {};
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
-      }
-      //IS.ignore(sizeof(Standard_Real) * (hasUV ? 5 : 3) * aNbNodes + sizeof(Standard_Integer) * 3 * aNbTriangles);
-
-      if (hasNormals)
-      {
-        gp_Vec3f aNormal;
-        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+        for (Standard_Integer aNodeIter = 1; hasUV && aNodeIter <= aNbNodes; ++aNodeIter)
         {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal (aNormalIter, aNormal);
+          aTriangulation->SetUVNode (aNodeIter, aBlock.Pnt2d (anUVOffset + size_t(aNodeIter - 1) * 16));
+        }
+        for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+        {
+          const size_t anOffset = aTrisOffset + size_t(aTriIter - 1) * 12;
+          aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aBlock.Integer (anOffset),
+                                                                aBlock.Integer (anOffset + 4),
+                                                                aBlock.Integer (anOffset + 8)));
+        }
+        for (Standard_Integer aNormalIter = 1; hasNormals && aNormalIter <= aNbNodes; ++aNormalIter)
+        {
+          const size_t anOffset = aNormalsOffset + size_t(aNormalIter - 1) * 12;
+          aTriangulation->SetNormal (aNormalIter, gp_Vec3f (aBlock.ShortReal (anOffset),
+                                                            aBlock.ShortReal (anOffset + 4),
+                                                            aBlock.ShortReal (anOffset + 8)));
         }
       }
+      aTriangulation->Deflection (aDefl);
 
       myTriangulations.Add (aTriangulation, hasNormals);
     }
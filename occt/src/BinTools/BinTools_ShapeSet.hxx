@@ -175,6 +175,11 @@ public:
     (Standard_OStream& OS,
         const Message_ProgressRange& theRange = Message_ProgressRange()) const;
 
+private:
+
+  struct SectionWriter;
+  struct SectionReader;
+
 private:
 
   TopTools_IndexedMapOfShape myShapes; ///< index and its shape (started from 1)
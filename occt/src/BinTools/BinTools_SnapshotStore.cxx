@@ -0,0 +1,1256 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_SnapshotStore.hxx>
+
+#include <BinTools.hxx>
+#include <BinTools_BlockCodec.hxx>
+#include <BinTools_Curve2dSet.hxx>
+#include <BinTools_CurveSet.hxx>
+#include <BinTools_IStream.hxx>
+#include <BinTools_OStream.hxx>
+#include <BinTools_SurfaceSet.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_GCurve.hxx>
+#include <BRep_PointOnCurve.hxx>
+#include <BRep_PointOnCurveOnSurface.hxx>
+#include <BRep_PointOnSurface.hxx>
+#include <BRep_Polygon3D.hxx>
+#include <BRep_PolygonOnTriangulation.hxx>
+#include <BRep_TEdge.hxx>
+#include <BRep_TFace.hxx>
+#include <BRep_Tool.hxx>
+#include <BRep_TVertex.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <Geom2d_Curve.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <TopLoc_Datum3D.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+
+#include <sstream>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_SnapshotStore, Standard_Transient)
+
+namespace
+{
+  //! Header of the store file.
+  static const char THE_STORE_HEADER[] = "Open CASCADE Snapshot Store V1\n";
+
+  //! Marker of the snapshot block in the store file.
+  static const char THE_SNAPSHOT_MARKER = 'S';
+
+  //! Kinds of records (the first byte of each record).
+  enum RecordKind
+  {
+    RecordKind_Shape = 1,
+    RecordKind_Datum,
+    RecordKind_Curve,
+    RecordKind_Curve2d,
+    RecordKind_Surface,
+    RecordKind_Polygon3d,
+    RecordKind_PolygonOnTriangulation,
+    RecordKind_Triangulation
+  };
+
+  //! FNV-1a hash of the record content; zero is reserved for null references.
+  static uint64_t hashRecord (const std::string& theData)
+  {
+    uint64_t aHash = 14695981039346656037ULL;
+    for (std::string::const_iterator anIter = theData.begin(); anIter != theData.end(); ++anIter)
+    {
+      aHash ^= uint64_t (Standard_Byte (*anIter));
+      aHash *= 1099511628211ULL;
+    }
+    return aHash != 0 ? aHash : 1;
+  }
+
+  //! Writes the 64-bit key as two integers.
+  static void writeKey (BinTools_OStream& theStream, const uint64_t theKey)
+  {
+    theStream << Standard_Integer (theKey & 0xFFFFFFFF) << Standard_Integer (theKey >> 32);
+  }
+
+  //! Reads the 64-bit key written by writeKey().
+  static uint64_t readKey (BinTools_IStream& theStream)
+  {
+    const uint64_t aLow  = uint32_t (theStream.ReadInteger());
+    const uint64_t aHigh = uint32_t (theStream.ReadInteger());
+    return aLow | (aHigh << 32);
+  }
+
+  //! Writes the 64-bit key as two integers to the standard stream.
+  static void putKey (Standard_OStream& theStream, const uint64_t theKey)
+  {
+    BinTools::PutInteger (theStream, Standard_Integer (theKey & 0xFFFFFFFF));
+    BinTools::PutInteger (theStream, Standard_Integer (theKey >> 32));
+  }
+
+  //! Reads the 64-bit key from the standard stream.
+  static uint64_t getKey (Standard_IStream& theStream)
+  {
+    Standard_Integer aLow = 0, aHigh = 0;
+    BinTools::GetInteger (theStream, aLow);
+    BinTools::GetInteger (theStream, aHigh);
+    return uint64_t (uint32_t (aLow)) | (uint64_t (uint32_t (aHigh)) << 32);
+  }
+}
+
+//=======================================================================
+//function : BinTools_SnapshotStore
+//purpose  :
+//=======================================================================
+BinTools_SnapshotStore::BinTools_SnapshotStore()
+: myRecordsSize (0),
+  myNewRecords (NULL),
+  myWithTriangles (Standard_False),
+  myWithNormals (Standard_False)
+{}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BinTools_SnapshotStore::Clear()
+{
+  myRecords.Clear();
+  mySnapshots.Clear();
+  myRecordsSize = 0;
+  myShapes.Clear();
+  myGeometry.Clear();
+  myDatums.Clear();
+  myObjectKeys.Clear();
+  myKeyShapes.Clear();
+  myRestored.Clear();
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+Standard_Integer BinTools_SnapshotStore::Add (const TopoDS_Shape& theShape)
+{
+  SnapshotInfo aSnapshot;
+  myNewRecords = &aSnapshot.NewRecords;
+  myObjectKeys.Clear();
+  myKeyShapes.Clear();
+  try
+  {
+    OCC_CATCH_SIGNALS
+    std::ostringstream aRoot;
+    BinTools_OStream aStream (aRoot);
+    writeRef (aStream, theShape);
+    aSnapshot.Root = aRoot.str();
+  }
+  catch (Standard_Failure const& anException)
+  {
+    myNewRecords = NULL;
+    myObjectKeys.Clear();
+    myKeyShapes.Clear();
+    Standard_SStream aMsg;
+    aMsg << "EXCEPTION in BinTools_SnapshotStore::Add" << std::endl;
+    aMsg << anException << std::endl;
+    throw Standard_Failure (aMsg.str().c_str());
+  }
+  myNewRecords = NULL;
+  myObjectKeys.Clear();
+  myKeyShapes.Clear();
+  mySnapshots.Append (aSnapshot);
+  return mySnapshots.Length();
+}
+
+//=======================================================================
+//function : Snapshot
+//purpose  :
+//=======================================================================
+TopoDS_Shape BinTools_SnapshotStore::Snapshot (const Standard_Integer theIndex)
+{
+  if (theIndex < 1 || theIndex > mySnapshots.Length())
+  {
+    throw Standard_OutOfRange ("BinTools_SnapshotStore::Snapshot: index is out of range");
+  }
+  std::istringstream aRoot (mySnapshots.Value (theIndex).Root);
+  BinTools_IStream aStream (aRoot);
+  myObjectKeys.Clear();
+  myRestored.Clear();
+  TopoDS_Shape aResult;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    aResult = readRef (aStream);
+  }
+  catch (Standard_Failure const&)
+  {
+    myObjectKeys.Clear();
+    myRestored.Clear();
+    throw;
+  }
+  myObjectKeys.Clear();
+  myRestored.Clear();
+  return aResult;
+}
+
+//=======================================================================
+//function : NbNewRecords
+//purpose  :
+//=======================================================================
+Standard_Integer BinTools_SnapshotStore::NbNewRecords (const Standard_Integer theIndex) const
+{
+  return mySnapshots.Value (theIndex).NewRecords.Length();
+}
+
+//=======================================================================
+//function : addRecord
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::addRecord (const std::string& theData)
+{
+  uint64_t aKey = hashRecord (theData);
+  for (const std::string* aStored = myRecords.Seek (aKey); aStored != NULL; aStored = myRecords.Seek (aKey))
+  {
+    if (*aStored == theData)
+    {
+      return aKey;
+    }
+    // hash collision: probe the next key
+    aKey = (aKey + 1 != 0) ? aKey + 1 : 1;
+  }
+  myRecords.Bind (aKey, theData);
+  myRecordsSize += theData.size();
+  if (myNewRecords != NULL)
+  {
+    myNewRecords->Append (aKey);
+  }
+  return aKey;
+}
+
+//=======================================================================
+//function : writeRef
+//purpose  :
+//=======================================================================
+void BinTools_SnapshotStore::writeRef (BinTools_OStream& theStream, const TopoDS_Shape& theShape)
+{
+  if (theShape.IsNull())
+  {
+    writeKey (theStream, 0);
+    return;
+  }
+  writeKey (theStream, addShape (theShape.Located (TopLoc_Location()).Oriented (TopAbs_FORWARD)));
+  writeLocation (theStream, theShape.Location());
+  theStream << Standard_Byte (theShape.Orientation());
+}
+
+//=======================================================================
+//function : writeLocation
+//purpose  :
+//=======================================================================
+void BinTools_SnapshotStore::writeLocation (BinTools_OStream& theStream, const TopLoc_Location& theLocation)
+{
+  Standard_Integer aNbItems = 0;
+  for (TopLoc_Location aLoc = theLocation; !aLoc.IsIdentity(); aLoc = aLoc.NextLocation())
+  {
+    ++aNbItems;
+  }
+  theStream << aNbItems;
+  for (TopLoc_Location aLoc = theLocation; !aLoc.IsIdentity(); aLoc = aLoc.NextLocation())
+  {
+    const Handle(TopLoc_Datum3D)& aDatum = aLoc.FirstDatum();
+    uint64_t aKey = 0;
+    if (const uint64_t* aKnown = myObjectKeys.Seek (aDatum))
+    {
+      aKey = *aKnown;
+    }
+    else
+    {
+      std::ostringstream aBuffer;
+      BinTools_OStream aDatumStream (aBuffer);
+      aDatumStream << Standard_Byte (RecordKind_Datum) << aDatum->Transformation();
+      aKey = addRecord (aBuffer.str());
+      myObjectKeys.Bind (aDatum, aKey);
+    }
+    writeKey (theStream, aKey);
+    theStream << aLoc.FirstPower();
+  }
+}
+
+//=======================================================================
+//function : curveKey
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::curveKey (const Handle(Geom_Curve)& theCurve)
+{
+  if (theCurve.IsNull())
+  {
+    return 0;
+  }
+  if (const uint64_t* aKnown = myObjectKeys.Seek (theCurve))
+  {
+    return *aKnown;
+  }
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_Curve);
+  BinTools_CurveSet::WriteCurve (theCurve, aStream);
+  const uint64_t aKey = addRecord (aBuffer.str());
+  myObjectKeys.Bind (theCurve, aKey);
+  return aKey;
+}
+
+//=======================================================================
+//function : curveKey
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::curveKey (const Handle(Geom2d_Curve)& theCurve)
+{
+  if (theCurve.IsNull())
+  {
+    return 0;
+  }
+  if (const uint64_t* aKnown = myObjectKeys.Seek (theCurve))
+  {
+    return *aKnown;
+  }
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_Curve2d);
+  BinTools_Curve2dSet::WriteCurve2d (theCurve, aStream);
+  const uint64_t aKey = addRecord (aBuffer.str());
+  myObjectKeys.Bind (theCurve, aKey);
+  return aKey;
+}
+
+//=======================================================================
+//function : surfaceKey
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::surfaceKey (const Handle(Geom_Surface)& theSurface)
+{
+  if (theSurface.IsNull())
+  {
+    return 0;
+  }
+  if (const uint64_t* aKnown = myObjectKeys.Seek (theSurface))
+  {
+    return *aKnown;
+  }
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_Surface);
+  BinTools_SurfaceSet::WriteSurface (theSurface, aStream);
+  const uint64_t aKey = addRecord (aBuffer.str());
+  myObjectKeys.Bind (theSurface, aKey);
+  return aKey;
+}
+
+//=======================================================================
+//function : polygonKey
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::polygonKey (const Handle(Poly_Polygon3D)& thePolygon)
+{
+  if (thePolygon.IsNull())
+  {
+    return 0;
+  }
+  if (const uint64_t* aKnown = myObjectKeys.Seek (thePolygon))
+  {
+    return *aKnown;
+  }
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_Polygon3d);
+  const Standard_Integer aNbNodes = thePolygon->NbNodes();
+  aStream << aNbNodes << thePolygon->HasParameters() << thePolygon->Deflection();
+  const TColgp_Array1OfPnt& aNodes = thePolygon->Nodes();
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    aStream << aNodes.Value (aNodeIter);
+  if (thePolygon->HasParameters())
+  {
+    const TColStd_Array1OfReal& aParam = thePolygon->Parameters();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      aStream << aParam.Value (aNodeIter);
+  }
+  const uint64_t aKey = addRecord (aBuffer.str());
+  myObjectKeys.Bind (thePolygon, aKey);
+  return aKey;
+}
+
+//=======================================================================
+//function : polygonKey
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::polygonKey (const Handle(Poly_PolygonOnTriangulation)& thePolygon)
+{
+  if (thePolygon.IsNull())
+  {
+    return 0;
+  }
+  if (const uint64_t* aKnown = myObjectKeys.Seek (thePolygon))
+  {
+    return *aKnown;
+  }
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_PolygonOnTriangulation);
+  const TColStd_Array1OfInteger& aNodes = thePolygon->Nodes();
+  aStream << aNodes.Length();
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNodes.Length(); ++aNodeIter)
+    aStream << aNodes.Value (aNodeIter);
+  aStream << thePolygon->Deflection();
+  if (const Handle(TColStd_HArray1OfReal)& aParam = thePolygon->Parameters())
+  {
+    aStream << Standard_True;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aParam->Length(); ++aNodeIter)
+      aStream << aParam->Value (aNodeIter);
+  }
+  else
+    aStream << Standard_False;
+  const uint64_t aKey = addRecord (aBuffer.str());
+  myObjectKeys.Bind (thePolygon, aKey);
+  return aKey;
+}
+
+//=======================================================================
+//function : triangulationKey
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::triangulationKey (const Handle(Poly_Triangulation)& theTriangulation,
+                                                   const Standard_Boolean theNeedToWriteNormals)
+{
+  if (theTriangulation.IsNull())
+  {
+    return 0;
+  }
+  // the same triangulation object must be referenced by the face and by the polygons of its edges,
+  // so the first written variant is reused
+  if (const uint64_t* aKnown = myObjectKeys.Seek (theTriangulation))
+  {
+    return *aKnown;
+  }
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_Triangulation);
+  const Standard_Integer aNbNodes = theTriangulation->NbNodes();
+  const Standard_Integer aNbTriangles = theTriangulation->NbTriangles();
+  aStream << aNbNodes << aNbTriangles << theTriangulation->HasUVNodes();
+  aStream << theNeedToWriteNormals << theTriangulation->Deflection();
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    aStream << theTriangulation->Node (aNodeIter);
+  if (theTriangulation->HasUVNodes())
+  {
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      aStream << theTriangulation->UVNode (aNodeIter);
+  }
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    aStream << theTriangulation->Triangle (aTriIter);
+  if (theNeedToWriteNormals)
+  {
+    gp_Vec3f aNormal;
+    for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+    {
+      theTriangulation->Normal (aNormalIter, aNormal);
+      aStream << aNormal;
+    }
+  }
+  const uint64_t aKey = addRecord (aBuffer.str());
+  myObjectKeys.Bind (theTriangulation, aKey);
+  return aKey;
+}
+
+//=======================================================================
+//function : addShape
+//purpose  :
+//=======================================================================
+uint64_t BinTools_SnapshotStore::addShape (const TopoDS_Shape& theShape)
+{
+  if (const uint64_t* aKnown = myObjectKeys.Seek (theShape.TShape()))
+  {
+    return *aKnown;
+  }
+
+  std::ostringstream aBuffer;
+  BinTools_OStream aStream (aBuffer);
+  aStream << Standard_Byte (RecordKind_Shape) << Standard_Byte (theShape.ShapeType());
+  switch (theShape.ShapeType())
+  {
+    case TopAbs_VERTEX:
+    {
+      const TopoDS_Vertex& aV = TopoDS::Vertex (theShape);
+      aStream << BRep_Tool::Tolerance (aV) << BRep_Tool::Pnt (aV);
+      Handle(BRep_TVertex) aTV = Handle(BRep_TVertex)::DownCast (theShape.TShape());
+      for (BRep_ListIteratorOfListOfPointRepresentation anIter (aTV->Points()); anIter.More(); anIter.Next())
+      {
+        const Handle(BRep_PointRepresentation)& aPR = anIter.Value();
+        if (aPR->IsPointOnCurve())
+        {
+          aStream << (Standard_Byte)1 << aPR->Parameter();
+          writeKey (aStream, curveKey (aPR->Curve()));
+        }
+        else if (aPR->IsPointOnCurveOnSurface())
+        {
+          aStream << (Standard_Byte)2 << aPR->Parameter();
+          writeKey (aStream, curveKey (aPR->PCurve()));
+          writeKey (aStream, surfaceKey (aPR->Surface()));
+        }
+        else if (aPR->IsPointOnSurface())
+        {
+          aStream << (Standard_Byte)3 << aPR->Parameter2() << aPR->Parameter();
+          writeKey (aStream, surfaceKey (aPR->Surface()));
+        }
+        else
+        {
+          continue;
+        }
+        writeLocation (aStream, aPR->Location());
+      }
+      aStream << (Standard_Byte)0;
+      break;
+    }
+    case TopAbs_EDGE:
+    {
+      Handle(BRep_TEdge) aTE = Handle(BRep_TEdge)::DownCast (theShape.TShape());
+      aStream << aTE->Tolerance();
+      aStream.PutBools (aTE->SameParameter(), aTE->SameRange(), aTE->Degenerated());
+      Standard_Real aFirst, aLast;
+      for (BRep_ListIteratorOfListOfCurveRepresentation anIter (aTE->Curves()); anIter.More(); anIter.Next())
+      {
+        const Handle(BRep_CurveRepresentation)& aCR = anIter.Value();
+        if (aCR->IsCurve3D())
+        {
+          if (!aCR->Curve3D().IsNull())
+          {
+            Handle(BRep_GCurve)::DownCast (aCR)->Range (aFirst, aLast);
+            aStream << (Standard_Byte)1;
+            writeKey (aStream, curveKey (aCR->Curve3D()));
+            writeLocation (aStream, aCR->Location());
+            aStream << aFirst << aLast;
+          }
+        }
+        else if (aCR->IsCurveOnSurface())
+        {
+          Handle(BRep_GCurve)::DownCast (aCR)->Range (aFirst, aLast);
+          const Standard_Boolean isClosed = aCR->IsCurveOnClosedSurface();
+          aStream << (Standard_Byte)(isClosed ? 3 : 2);
+          writeKey (aStream, curveKey (aCR->PCurve()));
+          if (isClosed)
+          {
+            writeKey (aStream, curveKey (aCR->PCurve2()));
+            aStream << (Standard_Byte)aCR->Continuity();
+          }
+          writeKey (aStream, surfaceKey (aCR->Surface()));
+          writeLocation (aStream, aCR->Location());
+          aStream << aFirst << aLast;
+        }
+        else if (aCR->IsRegularity())
+        {
+          aStream << (Standard_Byte)4 << (Standard_Byte)aCR->Continuity();
+          writeKey (aStream, surfaceKey (aCR->Surface()));
+          writeLocation (aStream, aCR->Location());
+          writeKey (aStream, surfaceKey (aCR->Surface2()));
+          writeLocation (aStream, aCR->Location2());
+        }
+        else if (myWithTriangles)
+        {
+          if (aCR->IsPolygon3D())
+          {
+            if (!aCR->Polygon3D().IsNull())
+            {
+              aStream << (Standard_Byte)5;
+              writeKey (aStream, polygonKey (aCR->Polygon3D()));
+              writeLocation (aStream, aCR->Location());
+            }
+          }
+          else if (aCR->IsPolygonOnTriangulation())
+          {
+            const Standard_Boolean isClosed = aCR->IsPolygonOnClosedTriangulation();
+            aStream << (Standard_Byte)(isClosed ? 7 : 6);
+            writeKey (aStream, polygonKey (aCR->PolygonOnTriangulation()));
+            if (isClosed)
+            {
+              writeKey (aStream, polygonKey (aCR->PolygonOnTriangulation2()));
+            }
+            writeKey (aStream, triangulationKey (aCR->Triangulation(), Standard_False));
+            writeLocation (aStream, aCR->Location());
+          }
+        }
+      }
+      aStream << (Standard_Byte)0;
+      break;
+    }
+    case TopAbs_FACE:
+    {
+      Handle(BRep_TFace) aTF = Handle(BRep_TFace)::DownCast (theShape.TShape());
+      aStream << aTF->NaturalRestriction() << aTF->Tolerance();
+      writeKey (aStream, surfaceKey (aTF->Surface()));
+      writeLocation (aStream, aTF->Location());
+      const Handle(Poly_Triangulation)& aTriangulation = aTF->Triangulation();
+      if ((myWithTriangles || aTF->Surface().IsNull())
+       && !aTriangulation.IsNull())
+      {
+        aStream << (Standard_Byte)1;
+        writeKey (aStream, triangulationKey (aTriangulation,
+          aTriangulation->HasNormals() && (myWithNormals || aTF->Surface().IsNull())));
+      }
+      else
+      {
+        aStream << (Standard_Byte)0;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  aStream.PutBools (theShape.Free(), theShape.Modified(), theShape.Checked(),
+    theShape.Orientable(), theShape.Closed(), theShape.Infinite(), theShape.Convex());
+  aStream << theShape.NbChildren();
+  for (TopoDS_Iterator aSub (theShape, Standard_False, Standard_False); aSub.More(); aSub.Next())
+  {
+    writeRef (aStream, aSub.Value());
+  }
+
+  // distinct TShapes with equal content get distinct records: the copy number
+  // is appended to the record (and ignored on reading) until the key is free in the snapshot
+  const std::string aData = aBuffer.str();
+  uint64_t aKey = addRecord (aData);
+  for (Standard_Integer aCopyIter = 1; myKeyShapes.IsBound (aKey); ++aCopyIter)
+  {
+    std::ostringstream aCopyBuffer;
+    BinTools_OStream aCopyStream (aCopyBuffer);
+    aCopyStream << aCopyIter;
+    aKey = addRecord (aData + aCopyBuffer.str());
+  }
+  myKeyShapes.Bind (aKey, theShape.TShape());
+  myObjectKeys.Bind (theShape.TShape(), aKey);
+  if (!myShapes.IsBound (aKey))
+  {
+    // share the TShape already present in memory with the restored snapshots
+    myShapes.Bind (aKey, theShape);
+  }
+  return aKey;
+}
+
+//=======================================================================
+//function : record
+//purpose  :
+//=======================================================================
+const std::string& BinTools_SnapshotStore::record (const uint64_t theKey) const
+{
+  const std::string* aRecord = myRecords.Seek (theKey);
+  if (aRecord == NULL)
+  {
+    throw Standard_Failure ("BinTools_SnapshotStore: reference to the missing record");
+  }
+  return *aRecord;
+}
+
+//=======================================================================
+//function : readRef
+//purpose  :
+//=======================================================================
+TopoDS_Shape BinTools_SnapshotStore::readRef (BinTools_IStream& theStream)
+{
+  const uint64_t aKey = readKey (theStream);
+  if (aKey == 0)
+  {
+    return TopoDS_Shape();
+  }
+  TopoDS_Shape aResult = readShape (aKey);
+  aResult.Location (readLocation (theStream), Standard_False);
+  aResult.Orientation (TopAbs_Orientation (theStream.ReadByte()));
+  return aResult;
+}
+
+//=======================================================================
+//function : readLocation
+//purpose  :
+//=======================================================================
+TopLoc_Location BinTools_SnapshotStore::readLocation (BinTools_IStream& theStream)
+{
+  TopLoc_Location aLoc;
+  const Standard_Integer aNbItems = theStream.ReadInteger();
+  for (Standard_Integer anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+  {
+    const uint64_t aKey = readKey (theStream);
+    const Standard_Integer aPower = theStream.ReadInteger();
+    const TopLoc_Location* aDatum = myDatums.Seek (aKey);
+    if (aDatum == NULL)
+    {
+      std::istringstream aBuffer (record (aKey));
+      BinTools_IStream aDatumStream (aBuffer);
+      if (aDatumStream.ReadByte() != RecordKind_Datum)
+      {
+        throw Standard_Failure ("BinTools_SnapshotStore: location datum is expected");
+      }
+      gp_Trsf aTrsf;
+      aDatumStream >> aTrsf;
+      aDatum = myDatums.Bound (aKey, TopLoc_Location (aTrsf));
+    }
+    aLoc = aDatum->Powered (aPower) * aLoc;
+  }
+  return aLoc;
+}
+
+//=======================================================================
+//function : readGeometry
+//purpose  :
+//=======================================================================
+Handle(Standard_Transient) BinTools_SnapshotStore::readGeometry (const uint64_t theKey)
+{
+  if (theKey == 0)
+  {
+    return Handle(Standard_Transient)();
+  }
+  if (const Handle(Standard_Transient)* aKnown = myGeometry.Seek (theKey))
+  {
+    return *aKnown;
+  }
+
+  std::istringstream aBuffer (record (theKey));
+  BinTools_IStream aStream (aBuffer);
+  Handle(Standard_Transient) aResult;
+  switch (aStream.ReadByte())
+  {
+    case RecordKind_Curve:
+    {
+      Handle(Geom_Curve) aCurve;
+      BinTools_CurveSet::ReadCurve (aBuffer, aCurve);
+      aResult = aCurve;
+      break;
+    }
+    case RecordKind_Curve2d:
+    {
+      Handle(Geom2d_Curve) aCurve;
+      BinTools_Curve2dSet::ReadCurve2d (aBuffer, aCurve);
+      aResult = aCurve;
+      break;
+    }
+    case RecordKind_Surface:
+    {
+      Handle(Geom_Surface) aSurface;
+      BinTools_SurfaceSet::ReadSurface (aBuffer, aSurface);
+      aResult = aSurface;
+      break;
+    }
+    case RecordKind_Polygon3d:
+    {
+      const Standard_Integer aNbNodes = aStream.ReadInteger();
+      const Standard_Boolean aHasParameters = aStream.ReadBool();
+      Handle(Poly_Polygon3D) aPolygon = new Poly_Polygon3D (aNbNodes, aHasParameters);
+      aPolygon->Deflection (aStream.ReadReal());
+      TColgp_Array1OfPnt& aNodes = aPolygon->ChangeNodes();
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+        aStream >> aNodes.ChangeValue (aNodeIter);
+      if (aHasParameters)
+      {
+        TColStd_Array1OfReal& aParam = aPolygon->ChangeParameters();
+        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+          aStream >> aParam.ChangeValue (aNodeIter);
+      }
+      aResult = aPolygon;
+      break;
+    }
+    case RecordKind_PolygonOnTriangulation:
+    {
+      const Standard_Integer aNbNodes = aStream.ReadInteger();
+      Handle(Poly_PolygonOnTriangulation) aPolygon = new Poly_PolygonOnTriangulation (aNbNodes, Standard_False);
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+        aPolygon->SetNode (aNodeIter, aStream.ReadInteger());
+      aPolygon->Deflection (aStream.ReadReal());
+      if (aStream.ReadBool())
+      {
+        Handle(TColStd_HArray1OfReal) aParams = new TColStd_HArray1OfReal (1, aNbNodes);
+        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+          aStream >> aParams->ChangeValue (aNodeIter);
+        aPolygon->SetParameters (aParams);
+      }
+      aResult = aPolygon;
+      break;
+    }
+    case RecordKind_Triangulation:
+    {
+      const Standard_Integer aNbNodes = aStream.ReadInteger();
+      const Standard_Integer aNbTriangles = aStream.ReadInteger();
+      const Standard_Boolean aHasUV = aStream.ReadBool();
+      const Standard_Boolean aHasNormals = aStream.ReadBool();
+      Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, aHasUV, aHasNormals);
+      aTriangulation->Deflection (aStream.ReadReal());
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+        aTriangulation->SetNode (aNodeIter, aStream.ReadPnt());
+      if (aHasUV)
+      {
+        gp_Pnt2d anUV;
+        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+        {
+          aStream >> anUV.ChangeCoord().ChangeCoord (1);
+          aStream >> anUV.ChangeCoord().ChangeCoord (2);
+          aTriangulation->SetUVNode (aNodeIter, anUV);
+        }
+      }
+      Poly_Triangle aTriangle;
+      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+      {
+        aStream >> aTriangle.ChangeValue (1);
+        aStream >> aTriangle.ChangeValue (2);
+        aStream >> aTriangle.ChangeValue (3);
+        aTriangulation->SetTriangle (aTriIter, aTriangle);
+      }
+      if (aHasNormals)
+      {
+        gp_Vec3f aNormal;
+        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+        {
+          aStream >> aNormal.x();
+          aStream >> aNormal.y();
+          aStream >> aNormal.z();
+          aTriangulation->SetNormal (aNormalIter, aNormal);
+        }
+      }
+      aResult = aTriangulation;
+      break;
+    }
+    default:
+      throw Standard_Failure ("BinTools_SnapshotStore: geometry record is expected");
+  }
+  myGeometry.Bind (theKey, aResult);
+  return aResult;
+}
+
+//=======================================================================
+//function : readShape
+//purpose  :
+//=======================================================================
+TopoDS_Shape BinTools_SnapshotStore::readShape (const uint64_t theKey)
+{
+  if (const TopoDS_Shape* aRestored = myRestored.Seek (theKey))
+  {
+    return *aRestored;
+  }
+
+  // the TShape in memory is reused unless it is already taken by another record of the snapshot
+  // (a TShape may be bound to several records equal in content added in different snapshots)
+  TopoDS_Shape aResult;
+  const TopoDS_Shape* aKnown = myShapes.Seek (theKey);
+  if (aKnown != NULL
+  && !myObjectKeys.IsBound (aKnown->TShape()))
+  {
+    aResult = *aKnown;
+  }
+  else
+  {
+    aResult = buildShape (theKey);
+    if (aKnown == NULL)
+    {
+      myShapes.Bind (theKey, aResult);
+    }
+  }
+  myRestored.Bind (theKey, aResult);
+  myObjectKeys.Bind (aResult.TShape(), theKey);
+  return aResult;
+}
+
+//=======================================================================
+//function : buildShape
+//purpose  :
+//=======================================================================
+TopoDS_Shape BinTools_SnapshotStore::buildShape (const uint64_t theKey)
+{
+  std::istringstream aBuffer (record (theKey));
+  BinTools_IStream aStream (aBuffer);
+  if (aStream.ReadByte() != RecordKind_Shape)
+  {
+    throw Standard_Failure ("BinTools_SnapshotStore: shape record is expected");
+  }
+
+  TopoDS_Shape aResult;
+  BRep_Builder aBuilder;
+  const TopAbs_ShapeEnum aShapeType = TopAbs_ShapeEnum (aStream.ReadByte());
+  switch (aShapeType)
+  {
+    case TopAbs_VERTEX:
+    {
+      TopoDS_Vertex& aV = TopoDS::Vertex (aResult);
+      const Standard_Real aTol = aStream.ReadReal();
+      const gp_Pnt aPnt = aStream.ReadPnt();
+      aBuilder.MakeVertex (aV, aPnt, aTol);
+      Handle(BRep_TVertex) aTV = Handle(BRep_TVertex)::DownCast (aV.TShape());
+      BRep_ListOfPointRepresentation& aLpr = aTV->ChangePoints();
+      for (Standard_Byte aPrsType = aStream.ReadByte(); aPrsType != 0 && aStream; aPrsType = aStream.ReadByte())
+      {
+        const Standard_Real aParam = aStream.ReadReal();
+        Handle(BRep_PointRepresentation) aPR;
+        switch (aPrsType)
+        {
+          case 1:
+          {
+            Handle(Geom_Curve) aCurve = Handle(Geom_Curve)::DownCast (readGeometry (readKey (aStream)));
+            if (!aCurve.IsNull())
+              aPR = new BRep_PointOnCurve (aParam, aCurve, TopLoc_Location());
+            break;
+          }
+          case 2:
+          {
+            Handle(Geom2d_Curve) aCurve2d = Handle(Geom2d_Curve)::DownCast (readGeometry (readKey (aStream)));
+            Handle(Geom_Surface) aSurface = Handle(Geom_Surface)::DownCast (readGeometry (readKey (aStream)));
+            if (!aCurve2d.IsNull() && !aSurface.IsNull())
+              aPR = new BRep_PointOnCurveOnSurface (aParam, aCurve2d, aSurface, TopLoc_Location());
+            break;
+          }
+          case 3:
+          {
+            const Standard_Real aParam2 = aStream.ReadReal();
+            Handle(Geom_Surface) aSurface = Handle(Geom_Surface)::DownCast (readGeometry (readKey (aStream)));
+            if (!aSurface.IsNull())
+              aPR = new BRep_PointOnSurface (aParam, aParam2, aSurface, TopLoc_Location());
+            break;
+          }
+          default:
+            throw Standard_Failure ("BinTools_SnapshotStore: unexpected point representation");
+        }
+        const TopLoc_Location aPRLoc = readLocation (aStream);
+        if (!aPR.IsNull())
+        {
+          aPR->Location (aPRLoc);
+          aLpr.Append (aPR);
+        }
+      }
+      break;
+    }
+    case TopAbs_EDGE:
+    {
+      TopoDS_Edge& aE = TopoDS::Edge (aResult);
+      aBuilder.MakeEdge (aE);
+      const Standard_Real aTol = aStream.ReadReal();
+      Standard_Boolean aSameParameter, aSameRange, aDegenerated;
+      aStream.ReadBools (aSameParameter, aSameRange, aDegenerated);
+      aBuilder.SameParameter (aE, aSameParameter);
+      aBuilder.SameRange (aE, aSameRange);
+      aBuilder.Degenerated (aE, aDegenerated);
+      Standard_Real aFirst, aLast;
+      for (Standard_Byte aPrsType = aStream.ReadByte(); aPrsType != 0 && aStream; aPrsType = aStream.ReadByte())
+      {
+        switch (aPrsType)
+        {
+          case 1:
+          {
+            Handle(Geom_Curve) aCurve = Handle(Geom_Curve)::DownCast (readGeometry (readKey (aStream)));
+            const TopLoc_Location aLoc = readLocation (aStream);
+            aStream >> aFirst >> aLast;
+            if (!aCurve.IsNull())
+            {
+              aBuilder.UpdateEdge (aE, aCurve, aLoc, aTol);
+              aBuilder.Range (aE, aFirst, aLast, Standard_True);
+            }
+            break;
+          }
+          case 2:
+          case 3:
+          {
+            const Standard_Boolean isClosed = (aPrsType == 3);
+            Handle(Geom2d_Curve) aCurve2d_2, aCurve2d_1 = Handle(Geom2d_Curve)::DownCast (readGeometry (readKey (aStream)));
+            GeomAbs_Shape aReg = GeomAbs_C0;
+            if (isClosed)
+            {
+              aCurve2d_2 = Handle(Geom2d_Curve)::DownCast (readGeometry (readKey (aStream)));
+              aReg = (GeomAbs_Shape)aStream.ReadByte();
+            }
+            Handle(Geom_Surface) aSurface = Handle(Geom_Surface)::DownCast (readGeometry (readKey (aStream)));
+            const TopLoc_Location aLoc = readLocation (aStream);
+            aStream >> aFirst >> aLast;
+            if (!aCurve2d_1.IsNull() && (!isClosed || !aCurve2d_2.IsNull()) && !aSurface.IsNull())
+            {
+              if (isClosed)
+              {
+                aBuilder.UpdateEdge (aE, aCurve2d_1, aCurve2d_2, aSurface, aLoc, aTol);
+                aBuilder.Continuity (aE, aSurface, aSurface, aLoc, aLoc, aReg);
+              }
+              else
+                aBuilder.UpdateEdge (aE, aCurve2d_1, aSurface, aLoc, aTol);
+              aBuilder.Range (aE, aSurface, aLoc, aFirst, aLast);
+            }
+            break;
+          }
+          case 4:
+          {
+            const GeomAbs_Shape aReg = (GeomAbs_Shape)aStream.ReadByte();
+            Handle(Geom_Surface) aSurface1 = Handle(Geom_Surface)::DownCast (readGeometry (readKey (aStream)));
+            const TopLoc_Location aLoc1 = readLocation (aStream);
+            Handle(Geom_Surface) aSurface2 = Handle(Geom_Surface)::DownCast (readGeometry (readKey (aStream)));
+            const TopLoc_Location aLoc2 = readLocation (aStream);
+            if (!aSurface1.IsNull() && !aSurface2.IsNull())
+              aBuilder.Continuity (aE, aSurface1, aSurface2, aLoc1, aLoc2, aReg);
+            break;
+          }
+          case 5:
+          {
+            Handle(Poly_Polygon3D) aPolygon = Handle(Poly_Polygon3D)::DownCast (readGeometry (readKey (aStream)));
+            const TopLoc_Location aLoc = readLocation (aStream);
+            aBuilder.UpdateEdge (aE, aPolygon, aLoc);
+            break;
+          }
+          case 6:
+          case 7:
+          {
+            const Standard_Boolean isClosed = (aPrsType == 7);
+            Handle(Poly_PolygonOnTriangulation) aPoly2, aPoly1 =
+              Handle(Poly_PolygonOnTriangulation)::DownCast (readGeometry (readKey (aStream)));
+            if (isClosed)
+              aPoly2 = Handle(Poly_PolygonOnTriangulation)::DownCast (readGeometry (readKey (aStream)));
+            Handle(Poly_Triangulation) aTriangulation = Handle(Poly_Triangulation)::DownCast (readGeometry (readKey (aStream)));
+            const TopLoc_Location aLoc = readLocation (aStream);
+            if (isClosed)
+              aBuilder.UpdateEdge (aE, aPoly1, aPoly2, aTriangulation, aLoc);
+            else
+              aBuilder.UpdateEdge (aE, aPoly1, aTriangulation, aLoc);
+            break;
+          }
+          default:
+            throw Standard_Failure ("BinTools_SnapshotStore: unexpected curve representation");
+        }
+      }
+      break;
+    }
+    case TopAbs_WIRE:
+      aBuilder.MakeWire (TopoDS::Wire (aResult));
+      break;
+    case TopAbs_FACE:
+    {
+      TopoDS_Face& aF = TopoDS::Face (aResult);
+      aBuilder.MakeFace (aF);
+      const Standard_Boolean aNatRes = aStream.ReadBool();
+      const Standard_Real aTol = aStream.ReadReal();
+      Handle(Geom_Surface) aSurface = Handle(Geom_Surface)::DownCast (readGeometry (readKey (aStream)));
+      const TopLoc_Location aLoc = readLocation (aStream);
+      aBuilder.UpdateFace (aF, aSurface, aLoc, aTol);
+      aBuilder.NaturalRestriction (aF, aNatRes);
+      if (aStream.ReadByte() == 1)
+        aBuilder.UpdateFace (aF, Handle(Poly_Triangulation)::DownCast (readGeometry (readKey (aStream))));
+      break;
+    }
+    case TopAbs_SHELL:
+      aBuilder.MakeShell (TopoDS::Shell (aResult));
+      break;
+    case TopAbs_SOLID:
+      aBuilder.MakeSolid (TopoDS::Solid (aResult));
+      break;
+    case TopAbs_COMPSOLID:
+      aBuilder.MakeCompSolid (TopoDS::CompSolid (aResult));
+      break;
+    case TopAbs_COMPOUND:
+      aBuilder.MakeCompound (TopoDS::Compound (aResult));
+      break;
+    default:
+      throw Standard_Failure ("BinTools_SnapshotStore: unexpected topology type");
+  }
+
+  Standard_Boolean aFree, aMod, aChecked, anOrient, aClosed, anInf, aConv;
+  aStream.ReadBools (aFree, aMod, aChecked, anOrient, aClosed, anInf, aConv);
+  const Standard_Integer aNbChildren = aStream.ReadInteger();
+  for (Standard_Integer aChildIter = 0; aChildIter < aNbChildren; ++aChildIter)
+  {
+    aBuilder.Add (aResult, readRef (aStream));
+  }
+  if (!aStream)
+  {
+    throw Standard_Failure ("BinTools_SnapshotStore: truncated shape record");
+  }
+  aResult.Free (aFree);
+  aResult.Modified (aMod);
+  aResult.Checked (aChecked);
+  aResult.Orientable (anOrient);
+  aResult.Closed (aClosed);
+  aResult.Infinite (anInf);
+  aResult.Convex (aConv);
+  return aResult;
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_SnapshotStore::Write (Standard_OStream& theStream) const
+{
+  theStream << THE_STORE_HEADER;
+  for (Standard_Integer aSnapIter = 1; aSnapIter <= mySnapshots.Length(); ++aSnapIter)
+  {
+    if (!WriteSnapshot (theStream, aSnapIter))
+    {
+      return Standard_False;
+    }
+  }
+  return theStream.good();
+}
+
+//=======================================================================
+//function : WriteSnapshot
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_SnapshotStore::WriteSnapshot (Standard_OStream& theStream,
+                                                        const Standard_Integer theIndex) const
+{
+  const SnapshotInfo& aSnapshot = mySnapshots.Value (theIndex);
+
+  // block content: new records (key, size, data) followed by the root reference
+  std::ostringstream aRawBuffer;
+  for (NCollection_Vector<uint64_t>::Iterator aKeyIter (aSnapshot.NewRecords); aKeyIter.More(); aKeyIter.Next())
+  {
+    const std::string& aRecord = record (aKeyIter.Value());
+    putKey (aRawBuffer, aKeyIter.Value());
+    BinTools::PutInteger (aRawBuffer, Standard_Integer (aRecord.size()));
+    aRawBuffer.write (aRecord.data(), std::streamsize (aRecord.size()));
+  }
+  aRawBuffer.write (aSnapshot.Root.data(), std::streamsize (aSnapshot.Root.size()));
+
+  const std::string aRaw = aRawBuffer.str();
+  std::string aPacked;
+  BinTools_BlockCodec::Compress (reinterpret_cast<const Standard_Byte*>(aRaw.data()), aRaw.size(), aPacked);
+  if (aRaw.size() > size_t (IntegerLast())
+   || aPacked.size() > size_t (IntegerLast()))
+  {
+    // the sizes are written as 32-bit integers
+    return Standard_False;
+  }
+
+  theStream.put (THE_SNAPSHOT_MARKER);
+  BinTools::PutInteger (theStream, aSnapshot.NewRecords.Length());
+  BinTools::PutInteger (theStream, Standard_Integer (aSnapshot.Root.size()));
+  BinTools::PutInteger (theStream, Standard_Integer (aRaw.size()));
+  BinTools::PutInteger (theStream, Standard_Integer (aPacked.size()));
+  theStream.write (aPacked.data(), std::streamsize (aPacked.size()));
+  return theStream.good();
+}
+
+//=======================================================================
+//function : Read
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_SnapshotStore::Read (Standard_IStream& theStream)
+{
+  char aHeader[sizeof(THE_STORE_HEADER)] = {};
+  theStream.read (aHeader, sizeof(THE_STORE_HEADER) - 1);
+  if (!theStream
+   || strcmp (aHeader, THE_STORE_HEADER) != 0)
+  {
+    return Standard_False;
+  }
+
+  // the read records and snapshots are added to the store only if the whole stream is valid
+  NCollection_DataMap<uint64_t, std::string> aReadRecords;
+  NCollection_Sequence<SnapshotInfo> aReadSnapshots;
+  size_t aReadSize = 0;
+  for (int aMarker = theStream.get(); aMarker != std::char_traits<char>::eof(); aMarker = theStream.get())
+  {
+    if (aMarker != THE_SNAPSHOT_MARKER)
+    {
+      return Standard_False;
+    }
+    Standard_Integer aNbRecords = 0, aRootSize = 0, aRawSize = 0, aPackedSize = 0;
+    BinTools::GetInteger (theStream, aNbRecords);
+    BinTools::GetInteger (theStream, aRootSize);
+    BinTools::GetInteger (theStream, aRawSize);
+    BinTools::GetInteger (theStream, aPackedSize);
+    if (!theStream
+     || aNbRecords < 0 || aRootSize < 0 || aPackedSize < 0 || aRawSize < aRootSize)
+    {
+      return Standard_False;
+    }
+    std::string aPacked (size_t (aPackedSize), '\0');
+    theStream.read (&aPacked[0], aPackedSize);
+    std::string aRaw;
+    if (!theStream
+     || !BinTools_BlockCodec::Decompress (reinterpret_cast<const Standard_Byte*>(aPacked.data()),
+                                          aPacked.size(), size_t (aRawSize), aRaw))
+    {
+      return Standard_False;
+    }
+
+    SnapshotInfo aSnapshot;
+    std::istringstream aRawBuffer (aRaw);
+    for (Standard_Integer aRecIter = 0; aRecIter < aNbRecords; ++aRecIter)
+    {
+      const uint64_t aKey = getKey (aRawBuffer);
+      Standard_Integer aSize = 0;
+      BinTools::GetInteger (aRawBuffer, aSize);
+      if (!aRawBuffer
+       || aSize < 0
+       || aRawBuffer.tellg() + std::streamoff (aSize) > std::streamoff (aRawSize - aRootSize))
+      {
+        return Standard_False;
+      }
+      std::string aRecord (size_t (aSize), '\0');
+      aRawBuffer.read (&aRecord[0], aSize);
+      const std::string* aStored = myRecords.Seek (aKey);
+      if (aStored == NULL)
+      {
+        aStored = aReadRecords.Seek (aKey);
+      }
+      if (aStored != NULL)
+      {
+        if (*aStored != aRecord)
+        {
+          // the key is occupied by other content; stores can be merged only when keys agree
+          return Standard_False;
+        }
+        continue;
+      }
+      aReadRecords.Bind (aKey, aRecord);
+      aReadSize += aRecord.size();
+      aSnapshot.NewRecords.Append (aKey);
+    }
+    aSnapshot.Root = aRaw.substr (size_t (aRawSize - aRootSize));
+    aReadSnapshots.Append (aSnapshot);
+  }
+
+  for (NCollection_DataMap<uint64_t, std::string>::Iterator aRecIter (aReadRecords); aRecIter.More(); aRecIter.Next())
+  {
+    myRecords.Bind (aRecIter.Key(), aRecIter.Value());
+  }
+  myRecordsSize += aReadSize;
+  mySnapshots.Append (aReadSnapshots);
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_SnapshotStore::Write (const Standard_CString theFile) const
+{
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  opencascade::std::shared_ptr<std::ostream> aStream = aFileSystem->OpenOStream (theFile, std::ios::out | std::ios::binary);
+  if (aStream.get() == NULL || !aStream->good())
+  {
+    return Standard_False;
+  }
+  return Write (*aStream);
+}
+
+//=======================================================================
+//function : Read
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_SnapshotStore::Read (const Standard_CString theFile)
+{
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  opencascade::std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
+  if (aStream.get() == NULL)
+  {
+    return Standard_False;
+  }
+  return Read (*aStream);
+}
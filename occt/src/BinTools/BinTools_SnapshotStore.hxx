@@ -0,0 +1,183 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_SnapshotStore_HeaderFile
+#define _BinTools_SnapshotStore_HeaderFile
+
+#include <BinTools_ShapeSetBase.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <string>
+
+class BinTools_IStream;
+class BinTools_OStream;
+class Geom_Curve;
+class Geom2d_Curve;
+class Geom_Surface;
+class Poly_Polygon3D;
+class Poly_PolygonOnTriangulation;
+class Poly_Triangulation;
+
+//! Content-addressed store of versioned shape snapshots.
+//!
+//! Every TShape, geometry object (curves, surfaces, polygons, triangulations) and location datum
+//! is serialized into a record with BinTools primitives and identified by a 64-bit hash of its content.
+//! A TShape record refers to its sub-shapes and geometry by these keys, so a sub-tree which is
+//! identical in two snapshots is stored only once, regardless of whether the TShape objects are
+//! the same in memory or were rebuilt.
+//!
+//! Geometry with equal content is shared by the restored shapes, while the TShapes keep their identity
+//! within a snapshot: distinct TShapes with equal content (e.g. two coincident vertices) get distinct
+//! records numbered by the order of their appearance, so the restored snapshot has the same topology.
+//!
+//! Each snapshot keeps the root reference and the list of records it introduced (its delta).
+//! On writing, the delta of each snapshot is packed by BinTools_BlockCodec into a single block;
+//! therefore appending a snapshot to a file costs only the size of its new sub-shapes.
+//!
+//! Rebuilding a snapshot reuses TShapes already present in memory: those passed to Add() and those
+//! restored by previous calls to Snapshot(). Shapes passed to Add() should not be modified in place
+//! afterwards, otherwise restored snapshots will share the modified TShapes.
+class BinTools_SnapshotStore : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_SnapshotStore, Standard_Transient)
+public:
+
+  //! Creates an empty store.
+  Standard_EXPORT BinTools_SnapshotStore();
+
+  //! Return true if triangulations and polygons are stored.
+  Standard_Boolean IsWithTriangles() const { return myWithTriangles; }
+
+  //! Define if triangulations and polygons are stored (FALSE by default).
+  //! Triangulation of a face without surface is always stored.
+  void SetWithTriangles (const Standard_Boolean theWithTriangles) { myWithTriangles = theWithTriangles; }
+
+  //! Return true if triangulations are stored with normals.
+  Standard_Boolean IsWithNormals() const { return myWithNormals; }
+
+  //! Define if triangulations are stored with normals (FALSE by default).
+  void SetWithNormals (const Standard_Boolean theWithNormals) { myWithNormals = theWithNormals; }
+
+  //! Removes all snapshots and records.
+  Standard_EXPORT void Clear();
+
+  //! Adds a snapshot of the shape.
+  //! @return index of the new snapshot, starting from 1
+  Standard_EXPORT Standard_Integer Add (const TopoDS_Shape& theShape);
+
+  //! Returns the number of snapshots.
+  Standard_Integer NbSnapshots() const { return mySnapshots.Length(); }
+
+  //! Rebuilds the snapshot with the given index (1 <= theIndex <= NbSnapshots()).
+  //! TShapes already present in memory are shared by the result.
+  Standard_EXPORT TopoDS_Shape Snapshot (const Standard_Integer theIndex);
+
+  //! Returns the number of records introduced by the snapshot with the given index.
+  Standard_EXPORT Standard_Integer NbNewRecords (const Standard_Integer theIndex) const;
+
+  //! Returns the number of unique records in the store.
+  Standard_Integer NbRecords() const { return myRecords.Extent(); }
+
+  //! Returns the total size of unique records (uncompressed) in bytes.
+  size_t RecordsSize() const { return myRecordsSize; }
+
+  //! Writes the header and all snapshots to the stream.
+  Standard_EXPORT Standard_Boolean Write (Standard_OStream& theStream) const;
+
+  //! Writes a single compressed snapshot (root and records introduced by it) to the stream.
+  //! Appending the snapshots one by one to a stream started by Write() produces a valid store.
+  Standard_EXPORT Standard_Boolean WriteSnapshot (Standard_OStream& theStream,
+                                                  const Standard_Integer theIndex) const;
+
+  //! Reads the snapshots from the stream and appends them to the store.
+  //! Records already present in the store are shared with the read ones.
+  Standard_EXPORT Standard_Boolean Read (Standard_IStream& theStream);
+
+  //! Writes the store into the file.
+  Standard_EXPORT Standard_Boolean Write (const Standard_CString theFile) const;
+
+  //! Reads the store from the file.
+  Standard_EXPORT Standard_Boolean Read (const Standard_CString theFile);
+
+private:
+
+  //! Snapshot description: root reference and keys of the records introduced by the snapshot.
+  struct SnapshotInfo
+  {
+    std::string                  Root;
+    NCollection_Vector<uint64_t> NewRecords;
+  };
+
+  //! Registers the record and returns its key; the key of the equal record is returned if it exists.
+  uint64_t addRecord (const std::string& theData);
+
+  //! Stores the TShape of the shape (taken with identity location and forward orientation).
+  uint64_t addShape (const TopoDS_Shape& theShape);
+
+  //! Writes the reference to the shape (key, location, orientation).
+  void writeRef (BinTools_OStream& theStream, const TopoDS_Shape& theShape);
+
+  //! Writes the location as a list of datum keys with powers.
+  void writeLocation (BinTools_OStream& theStream, const TopLoc_Location& theLocation);
+
+  uint64_t curveKey (const Handle(Geom_Curve)& theCurve);
+  uint64_t curveKey (const Handle(Geom2d_Curve)& theCurve);
+  uint64_t surfaceKey (const Handle(Geom_Surface)& theSurface);
+  uint64_t polygonKey (const Handle(Poly_Polygon3D)& thePolygon);
+  uint64_t polygonKey (const Handle(Poly_PolygonOnTriangulation)& thePolygon);
+  uint64_t triangulationKey (const Handle(Poly_Triangulation)& theTriangulation,
+                             const Standard_Boolean theNeedToWriteNormals);
+
+  //! Rebuilds the TShape record.
+  TopoDS_Shape readShape (const uint64_t theKey);
+
+  //! Rebuilds the TShape record ignoring the TShapes in memory.
+  TopoDS_Shape buildShape (const uint64_t theKey);
+
+  //! Reads the reference to the shape.
+  TopoDS_Shape readRef (BinTools_IStream& theStream);
+
+  //! Reads the location written by writeLocation().
+  TopLoc_Location readLocation (BinTools_IStream& theStream);
+
+  //! Rebuilds the geometry record.
+  Handle(Standard_Transient) readGeometry (const uint64_t theKey);
+
+  //! Returns the record with the given key or throws an exception.
+  const std::string& record (const uint64_t theKey) const;
+
+private:
+
+  NCollection_DataMap<uint64_t, std::string>                myRecords;      //!< unique records by key
+  NCollection_Sequence<SnapshotInfo>                        mySnapshots;    //!< snapshots
+  size_t                                                    myRecordsSize;  //!< total size of records
+  NCollection_DataMap<uint64_t, TopoDS_Shape>               myShapes;       //!< TShapes in memory by key
+  NCollection_DataMap<uint64_t, Handle(Standard_Transient)> myGeometry;     //!< geometry in memory by key
+  NCollection_DataMap<uint64_t, TopLoc_Location>            myDatums;       //!< elementary locations by key
+  NCollection_DataMap<Handle(Standard_Transient), uint64_t> myObjectKeys;   //!< keys of objects of the snapshot being added or restored
+  NCollection_DataMap<uint64_t, Handle(Standard_Transient)> myKeyShapes;    //!< TShapes of the snapshot being added by keys
+  NCollection_DataMap<uint64_t, TopoDS_Shape>               myRestored;     //!< TShapes of the snapshot being restored by keys
+  NCollection_Vector<uint64_t>*                             myNewRecords;   //!< delta of the snapshot being added
+  Standard_Boolean                                          myWithTriangles;
+  Standard_Boolean                                          myWithNormals;
+
+};
+
+DEFINE_STANDARD_HANDLE(BinTools_SnapshotStore, Standard_Transient)
+
+#endif // _BinTools_SnapshotStore_HeaderFile
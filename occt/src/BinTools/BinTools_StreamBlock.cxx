@@ -0,0 +1,62 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BinTools_StreamBlock.hxx>
+
+#include <BinTools_MappedStreamBuf.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
+
+//=======================================================================
+//function : Fetch
+//purpose  :
+//=======================================================================
+void BinTools_StreamBlock::Fetch (Standard_IStream& theStream, const size_t theSize)
+{
+  myData = NULL;
+  mySize = 0;
+  myIsMapped = Standard_False;
+  myOwner.Nullify();
+  if (theSize == 0)
+  {
+    return;
+  }
+
+  if (BinTools_MappedStreamBuf* aMapped = dynamic_cast<BinTools_MappedStreamBuf*> (theStream.rdbuf()))
+  {
+    if (theStream.good())
+    {
+      myData = aMapped->Fetch (theSize);
+    }
+    if (myData == NULL)
+    {
+      theStream.setstate (std::ios::failbit);
+      throw Storage_StreamTypeMismatchError();
+    }
+    mySize     = theSize;
+    myIsMapped = Standard_True;
+    myOwner    = aMapped->Owner();
+    return;
+  }
+
+  if (myBuffer.size() < theSize)
+  {
+    myBuffer.resize (theSize);
+  }
+  if (!theStream.read (&myBuffer[0], std::streamsize(theSize)))
+  {
+    throw Storage_StreamTypeMismatchError();
+  }
+  myData = &myBuffer[0];
+  mySize = theSize;
+}
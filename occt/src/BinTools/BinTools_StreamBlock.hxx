@@ -0,0 +1,132 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_StreamBlock_HeaderFile
+#define _BinTools_StreamBlock_HeaderFile
+
+#include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+#include <Standard_Handle.hxx>
+#include <Standard_Transient.hxx>
+
+#include <cstring>
+#include <vector>
+
+#if DO_INVERSE
+#include <FSD_BinaryFile.hxx>
+#endif
+
+//! Block of consecutive bytes of the input stream, used for decoding data arrays at once.
+//!
+//! When the stream reads from BinTools_MappedStreamBuf, the block points directly into
+//! the mapped memory and no data is copied; otherwise the block is read by a single call
+//! into the internal buffer (reused by subsequent calls to Fetch()).
+//! Values are decoded at byte offsets and have no alignment requirements;
+//! the byte order is inversed in the same way as by BinTools::GetReal() etc.
+class BinTools_StreamBlock
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty block.
+  BinTools_StreamBlock() : myData (NULL), mySize (0), myIsMapped (Standard_False) {}
+
+  //! Takes the next theSize bytes of the stream and advances the stream position.
+  //! Throws Storage_StreamTypeMismatchError if the stream is too short.
+  Standard_EXPORT void Fetch (Standard_IStream& theStream, const size_t theSize);
+
+  //! Returns the data of the block.
+  const char* Data() const { return myData; }
+
+  //! Returns the size of the block.
+  size_t Size() const { return mySize; }
+
+  //! Returns TRUE if the block refers to the memory of the stream buffer rather than to a copy.
+  Standard_Boolean IsMapped() const { return myIsMapped; }
+
+  //! Returns the object keeping alive the memory of the mapped block (NULL if the block is a copy
+  //! or the stream buffer has no owner).
+  const Handle(Standard_Transient)& Owner() const { return myOwner; }
+
+  //! Decodes the real value at the given offset.
+  Standard_Real Real (const size_t theOffset) const
+  {
+    Standard_Real aValue;
+    memcpy (&aValue, myData + theOffset, sizeof(aValue));
+#if DO_INVERSE
+    aValue = FSD_BinaryFile::InverseReal (aValue);
+#endif
+    return aValue;
+  }
+
+  //! Decodes the short real value at the given offset.
+  Standard_ShortReal ShortReal (const size_t theOffset) const
+  {
+    Standard_ShortReal aValue;
+    memcpy (&aValue, myData + theOffset, sizeof(aValue));
+#if DO_INVERSE
+    aValue = FSD_BinaryFile::InverseShortReal (aValue);
+#endif
+    return aValue;
+  }
+
+  //! Decodes the integer value at the given offset.
+  Standard_Integer Integer (const size_t theOffset) const
+  {
+    Standard_Integer aValue;
+    memcpy (&aValue, myData + theOffset, sizeof(aValue));
+#if DO_INVERSE
+    aValue = FSD_BinaryFile::InverseInt (aValue);
+#endif
+    return aValue;
+  }
+
+  //! Decodes the 3D point (three reals) at the given offset.
+  gp_Pnt Pnt (const size_t theOffset) const
+  {
+    return gp_Pnt (Real (theOffset), Real (theOffset + 8), Real (theOffset + 16));
+  }
+
+  //! Decodes the 2D point (two reals) at the given offset.
+  gp_Pnt2d Pnt2d (const size_t theOffset) const
+  {
+    return gp_Pnt2d (Real (theOffset), Real (theOffset + 8));
+  }
+
+  //! Returns TRUE if the value of type Type_t can be accessed in place at the given offset,
+  //! i.e. the block is mapped, its memory has an owner and the address is properly aligned.
+  //! The values are never accessed in place when the byte order has to be inversed.
+  template<typename Type_t>
+  Standard_Boolean IsAliasable (const size_t theOffset) const
+  {
+#if DO_INVERSE
+    (void )theOffset;
+    return Standard_False;
+#else
+    return !myOwner.IsNull()
+        && (reinterpret_cast<size_t> (myData + theOffset) % alignof(Type_t)) == 0;
+#endif
+  }
+
+private:
+
+  const char*                myData;
+  size_t                     mySize;
+  Handle(Standard_Transient) myOwner;  //!< owner of the mapped memory
+  Standard_Boolean           myIsMapped;
+  std::vector<char>          myBuffer; //!< storage for the block read from the non-mapped stream
+
+};
+
+#endif // _BinTools_StreamBlock_HeaderFile
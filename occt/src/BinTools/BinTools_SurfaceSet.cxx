@@ -16,6 +16,7 @@
 
 #include <BinTools.hxx>
 #include <BinTools_CurveSet.hxx>
+#include <BinTools_StreamBlock.hxx>
 #include <BinTools_SurfaceSet.hxx>
 #include <Geom_BezierSurface.hxx>
 #include <Geom_ConicalSurface.hxx>
@@ -650,27 +651,35 @@ static Standard_IStream& operator>>(Standard_IStream& IS,
   TColgp_Array2OfPnt poles(1,nbupoles,1,nbvpoles);
   TColStd_Array2OfReal weights(1,nbupoles,1,nbvpoles);
   
+  // poles (with weights) and knots (with multiplicities) are decoded by blocks
+  const Standard_Boolean isRational = urational || vrational;
+  const size_t aPoleSize = isRational ? 32 : 24;
+  BinTools_StreamBlock aBlock;
+  aBlock.Fetch (IS, size_t(nbupoles) * size_t(nbvpoles) * aPoleSize);
   Standard_Integer i,j;
+  size_t anOffset = 0;
   for (i = 1; i <= nbupoles; i++) {
-    for (j = 1; j <= nbvpoles; j++) {
-      IS >> poles(i,j);//Pnt
-      if (urational || vrational)
-	BinTools::GetReal(IS, weights(i,j)); 
+    for (j = 1; j <= nbvpoles; j++, anOffset += aPoleSize) {
+      poles(i,j) = aBlock.Pnt (anOffset);
+      if (isRational)
+        weights(i,j) = aBlock.Real (anOffset + 24);
     }
   }
 
   TColStd_Array1OfReal uknots(1,nbuknots);
   TColStd_Array1OfInteger umults(1,nbuknots);
+  aBlock.Fetch (IS, size_t(nbuknots) * 12);
   for (i = 1; i <= nbuknots; i++) {
-    BinTools::GetReal(IS, uknots(i));
-    BinTools::GetInteger(IS, umults(i));
+    uknots(i) = aBlock.Real (size_t(i - 1) * 12);
+    umults(i) = aBlock.Integer (size_t(i - 1) * 12 + 8);
   }
 
   TColStd_Array1OfReal vknots(1,nbvknots);
   TColStd_Array1OfInteger vmults(1,nbvknots);
+  aBlock.Fetch (IS, size_t(nbvknots) * 12);
   for (i = 1; i <= nbvknots; i++) {
-    BinTools::GetReal(IS, vknots(i));
-    BinTools::GetInteger(IS, vmults(i));
+    vknots(i) = aBlock.Real (size_t(i - 1) * 12);
+    vmults(i) = aBlock.Integer (size_t(i - 1) * 12 + 8);
   }
 
   if (urational || vrational)
@@ -23,12 +23,14 @@
 #include <BRepTools_ShapeSet.hxx>
 #include <BRepTools_WireExplorer.hxx>
 #include <BinTools.hxx>
+#include <BinTools_SnapshotStore.hxx>
 #include <Draw.hxx>
 #include <Draw_ProgressIndicator.hxx>
 #include <Message_ProgressRange.hxx>
 #include <gp_Ax2.hxx>
 #include <GProp.hxx>
 #include <GProp_GProps.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_Vector.hxx>
 #include <OSD_FileSystem.hxx>
 #include <Precision.hxx>
@@ -1035,6 +1037,123 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+// snapshot
+//=======================================================================
+static Standard_Integer snapshot (Draw_Interpretor& theDI,
+                                  Standard_Integer theNbArgs,
+                                  const char** theArgVec)
+{
+  // named snapshot stores living for the whole session
+  static NCollection_DataMap<TCollection_AsciiString, Handle(BinTools_SnapshotStore)> THE_STORES;
+  if (theNbArgs < 3)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const TCollection_AsciiString aStoreName (theArgVec[1]);
+  Handle(BinTools_SnapshotStore) aStore;
+  if (!THE_STORES.Find (aStoreName, aStore))
+  {
+    aStore = new BinTools_SnapshotStore();
+    THE_STORES.Bind (aStoreName, aStore);
+  }
+
+  TCollection_AsciiString aMode (theArgVec[2]);
+  aMode.LowerCase();
+  if (aMode == "-add"
+   && theNbArgs >= 4)
+  {
+    TopoDS_Shape aShape = DBRep::Get (theArgVec[3]);
+    if (aShape.IsNull())
+    {
+      theDI << "Syntax error: " << theArgVec[3] << " is not a shape";
+      return 1;
+    }
+    for (Standard_Integer anArgIter = 4; anArgIter < theNbArgs; ++anArgIter)
+    {
+      TCollection_AsciiString aParam (theArgVec[anArgIter]);
+      aParam.LowerCase();
+      if (aParam == "-triangles"
+       || aParam == "-notriangles")
+      {
+        aStore->SetWithTriangles (Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter));
+      }
+      else if (aParam == "-normals"
+            || aParam == "-nonormals")
+      {
+        aStore->SetWithNormals (Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter));
+      }
+      else
+      {
+        theDI << "Syntax error: unknown argument '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    const Standard_Integer anIndex = aStore->Add (aShape);
+    theDI << anIndex;
+    return 0;
+  }
+  else if (aMode == "-get"
+        && theNbArgs == 5)
+  {
+    const Standard_Integer anIndex = Draw::Atoi (theArgVec[3]);
+    if (anIndex < 1 || anIndex > aStore->NbSnapshots())
+    {
+      theDI << "Error: store " << aStoreName << " has no snapshot " << theArgVec[3];
+      return 1;
+    }
+    DBRep::Set (theArgVec[4], aStore->Snapshot (anIndex));
+    theDI << theArgVec[4];
+    return 0;
+  }
+  else if (aMode == "-save"
+        && theNbArgs == 4)
+  {
+    if (!aStore->Write (theArgVec[3]))
+    {
+      theDI << "Cannot write to the file " << theArgVec[3];
+      return 1;
+    }
+    return 0;
+  }
+  else if (aMode == "-load"
+        && theNbArgs == 4)
+  {
+    if (!aStore->Read (theArgVec[3]))
+    {
+      theDI << "Error: cannot read from the file '" << theArgVec[3] << "'";
+      return 1;
+    }
+    theDI << aStore->NbSnapshots();
+    return 0;
+  }
+  else if (aMode == "-info"
+        && theNbArgs == 3)
+  {
+    theDI << "Snapshots: " << aStore->NbSnapshots() << "\n";
+    theDI << "Records: " << aStore->NbRecords() << "\n";
+    Standard_SStream aSize;
+    aSize << aStore->RecordsSize();
+    theDI << "Records size: " << aSize << "\n";
+    for (Standard_Integer aSnapIter = 1; aSnapIter <= aStore->NbSnapshots(); ++aSnapIter)
+    {
+      theDI << "Snapshot " << aSnapIter << ": " << aStore->NbNewRecords (aSnapIter) << " new records\n";
+    }
+    return 0;
+  }
+  else if (aMode == "-clear"
+        && theNbArgs == 3)
+  {
+    THE_STORES.UnBind (aStoreName);
+    return 0;
+  }
+
+  theDI << "Syntax error: unknown argument '" << theArgVec[2] << "'";
+  return 1;
+}
+
 //=======================================================================
 // removeinternals
 //=======================================================================
@@ -1129,7 +1248,7 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
                   "\n\t\t:  -binary  write into the binary format (ASCII when unspecified)"
                   "\n\t\t:  -version a number of format version to save;"
                   "\n\t\t:           ASCII  versions: 1, 2 and 3    (3 for ASCII  when unspecified);"
-                  "\n\t\t:           Binary versions: 1, 2, 3 and 4 (4 for Binary when unspecified)."
+                  "\n\t\t:           Binary versions: 1, 2, 3, 4 and 5 (4 for Binary when unspecified)."
                   "\n\t\t:  -triangles write triangulation data (TRUE when unspecified)."
                   "\n\t\t:           Ignored (always written) if face defines only triangulation (no surface)."
                   "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified).",
@@ -1142,6 +1261,20 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
   theCommands.Add("binrestore",
                   "alias to readbrep command",
                   __FILE__, readbrep, g);
+  theCommands.Add("snapshot",
+                  "snapshot store -add shape [-triangles {0|1}]=0 [-normals {0|1}]=0"
+                  "\n\t\t:          store -get index result"
+                  "\n\t\t:          store {-save|-load} filename"
+                  "\n\t\t:          store {-info|-clear}"
+                  "\n\t\t: Manage the named content-addressed store of shape snapshots."
+                  "\n\t\t: Sub-shapes and geometry equal in several snapshots are stored once;"
+                  "\n\t\t: restored snapshots share TShapes already present in memory."
+                  "\n\t\t:  -add   add a snapshot of the shape; returns its index"
+                  "\n\t\t:  -get   restore the snapshot with the given index"
+                  "\n\t\t:  -save  write the store with compressed per-snapshot deltas"
+                  "\n\t\t:  -load  append the snapshots read from the file"
+                  "\n\t\t:  -info  print the number of snapshots and records",
+                  __FILE__, snapshot, g);
 
   theCommands.Add ("removeinternals", "removeinternals shape [force flag {0/1}]"
                    "\n\t\t             Removes sub-shapes with internal orientation from the shape.\n"
@@ -4,6 +4,7 @@
 #include <Draw_Interpretor.hxx>
 #include <TopoEngineCommands.hxx>>
 #include <IOEngineCommands.hxx>>
+#include <ExtremaEngineCommands.hxx>
 #include <Data.hxx>
 
 namespace EngineInterface {
@@ -36,6 +37,8 @@ namespace EngineInterface {
 
         functions["topo.echo"] = EngineInterface::topo::echo;       
         functions["io.pushModel"] = EngineInterface::io::pushModel;       
+        functions["extrema.clearance"] = EngineInterface::extrema::clearance;
+        functions["extrema.interference"] = EngineInterface::extrema::interference;
 
     }
 }
@@ -0,0 +1,101 @@
+#ifndef ExtremaEngineCommands_H
+#define ExtremaEngineCommands_H
+
+#include <Data.hxx>
+#include <Draw_Interpretor.hxx>
+#include <TopoDS_Shape.hxx>
+#include <DBRep.hxx>
+#include <BRepExtrema_Clearance.hxx>
+
+
+namespace EngineInterface {
+
+    namespace extrema {
+
+        static DATA pntWrite(const gp_Pnt& pnt) {
+            return Array(pnt.X(), pnt.Y(), pnt.Z());
+        }
+
+        // {"shapes": [names], "distance": d, "parallel": bool}
+        // outputs the pairs of shapes closer than the distance (or the distance between two shapes
+        // if it is not given) as [{"a": i, "b": j, "distance": d, "pa": [x, y, z], "pb": [x, y, z]}]
+        static Standard_Integer clearance(Draw_Interpretor& di, DATA& data) {
+            BRepExtrema_Clearance tool;
+            tool.SetRunParallel(data["parallel"].ToBool());
+
+            for (auto& name : data["shapes"].ArrayRange()) {
+                std::string shapeName = name.ToString();
+                Standard_CString shapeNamePtr = shapeName.c_str();
+                TopoDS_Shape shape = DBRep::Get(shapeNamePtr);
+                if (shape.IsNull()) {
+                    di << "Error: shape " << shapeNamePtr << " is not found" << "\n";
+                    return 1;
+                }
+                tool.AddShape(shape);
+            }
+
+            DATA out = Array();
+            auto writeResult = [&out](const BRepExtrema_Clearance::Result& result) {
+                DATA pair = Object();
+                pair["a"] = result.Shape1 - 1;
+                pair["b"] = result.Shape2 - 1;
+                pair["distance"] = result.Distance;
+                pair["pa"] = pntWrite(result.Point1);
+                pair["pb"] = pntWrite(result.Point2);
+                out.append(pair);
+            };
+
+            if (data.hasKey("distance")) {
+                tool.Perform(data["distance"].ToFloat());
+                for (NCollection_Vector<BRepExtrema_Clearance::Result>::Iterator it(tool.Results()); it.More(); it.Next()) {
+                    writeResult(it.Value());
+                }
+            } else if (tool.NbShapes() == 2) {
+                BRepExtrema_Clearance::Result result;
+                if (tool.Distance(1, 2, result)) {
+                    writeResult(result);
+                }
+            } else {
+                di << "Error: the distance should be given for more than two shapes" << "\n";
+                return 1;
+            }
+
+            di << out.dumpJSON().c_str();
+            return 0;
+        }
+
+        // {"shapes": [names], "tolerance": t, "parallel": bool}
+        // outputs the pairs of shapes which overlap, touch or are closer than the tolerance
+        // packed as [a, b, type, distance, depth, ...] (type: 0 - near, 1 - touch, 2 - overlap)
+        static Standard_Integer interference(Draw_Interpretor& di, DATA& data) {
+            BRepExtrema_Clearance tool;
+            tool.SetRunParallel(data["parallel"].ToBool());
+
+            for (auto& name : data["shapes"].ArrayRange()) {
+                std::string shapeName = name.ToString();
+                Standard_CString shapeNamePtr = shapeName.c_str();
+                TopoDS_Shape shape = DBRep::Get(shapeNamePtr);
+                if (shape.IsNull()) {
+                    di << "Error: shape " << shapeNamePtr << " is not found" << "\n";
+                    return 1;
+                }
+                tool.AddShape(shape);
+            }
+
+            tool.PerformInterference(data["tolerance"].ToFloat());
+
+            DATA out = Array();
+            for (NCollection_Vector<BRepExtrema_Clearance::Interference>::Iterator it(tool.Interferences()); it.More(); it.Next()) {
+                const BRepExtrema_Clearance::Interference& pair = it.Value();
+                out.append(pair.Shape1 - 1, pair.Shape2 - 1, int(pair.Type), pair.Distance, pair.Depth);
+            }
+
+            di << out.dumpJSON().c_str();
+            return 0;
+        }
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,694 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Extrema_SurfaceProjector.hxx>
+
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <gp_Vec.hxx>
+#include <Standard_ConstructionError.hxx>
+#include <Standard_DimensionError.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array2OfReal.hxx>
+
+namespace
+{
+  typedef BVH_Tools<Standard_Real, 3> BVH_Tools3d;
+
+  //! Minimal number of the patches in each parametric direction
+  static const Standard_Integer THE_MIN_NB_PATCHES = 8;
+
+  //! Maximal number of the Newton iterations
+  static const Standard_Integer THE_MAX_NB_ITERATIONS = 30;
+
+  //! Maximal number of the step halvings in one iteration
+  static const Standard_Integer THE_MAX_NB_HALVINGS = 8;
+
+  //! Converts the point to the BVH vector.
+  static BVH_Vec3d toVec (const gp_Pnt& thePnt)
+  {
+    return BVH_Vec3d (thePnt.X(), thePnt.Y(), thePnt.Z());
+  }
+
+  //! Returns the bound of the deviation of the surface patch from the bilinear
+  //! interpolation of its corners: (dU^2 * max|D2U| + dV^2 * max|D2V|) / 8.
+  //! The bounds of the second derivatives are exact for the elementary surfaces;
+  //! for other surfaces they are estimated by the values at the 3x3 grid of the patch
+  //! doubled, thus the bound may be underestimated on the strongly varying curvature.
+  static Standard_Real deviationBound (const Adaptor3d_Surface& theSurface,
+                                       const Standard_Real theU1, const Standard_Real theU2,
+                                       const Standard_Real theV1, const Standard_Real theV2)
+  {
+    Standard_Real aMaxD2U = 0.0, aMaxD2V = 0.0;
+    switch (theSurface.GetType())
+    {
+      case GeomAbs_Plane:
+        break;
+      case GeomAbs_Cylinder:
+        aMaxD2U = theSurface.Cylinder().Radius();
+        break;
+      case GeomAbs_Cone:
+      {
+        // the radius of the section is linear in V
+        const gp_Cone aCone = theSurface.Cone();
+        const Standard_Real aSin = Sin (aCone.SemiAngle());
+        aMaxD2U = Max (Abs (aCone.RefRadius() + theV1 * aSin), Abs (aCone.RefRadius() + theV2 * aSin));
+        break;
+      }
+      case GeomAbs_Sphere:
+        aMaxD2U = aMaxD2V = theSurface.Sphere().Radius();
+        break;
+      case GeomAbs_Torus:
+        aMaxD2U = theSurface.Torus().MajorRadius() + theSurface.Torus().MinorRadius();
+        aMaxD2V = theSurface.Torus().MinorRadius();
+        break;
+      default:
+      {
+        gp_Pnt aP;
+        gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
+        for (Standard_Integer i = 0; i < 3; ++i)
+        {
+          for (Standard_Integer j = 0; j < 3; ++j)
+          {
+            theSurface.D2 (theU1 + (theU2 - theU1) * 0.5 * i, theV1 + (theV2 - theV1) * 0.5 * j,
+                           aP, aD1U, aD1V, aD2U, aD2V, aD2UV);
+            aMaxD2U = Max (aMaxD2U, aD2U.Magnitude());
+            aMaxD2V = Max (aMaxD2V, aD2V.Magnitude());
+          }
+        }
+        aMaxD2U *= 2.0;
+        aMaxD2V *= 2.0;
+        break;
+      }
+    }
+    const Standard_Real aDU = theU2 - theU1, aDV = theV2 - theV1;
+    return 0.125 * (aDU * aDU * aMaxD2U + aDV * aDV * aMaxD2V);
+  }
+
+  //! Returns the B-spline representation of the spline surface.
+  static Handle(Geom_BSplineSurface) toBSpline (const Adaptor3d_Surface& theSurface)
+  {
+    if (theSurface.GetType() == GeomAbs_BSplineSurface)
+    {
+      return Handle(Geom_BSplineSurface)::DownCast (theSurface.BSpline()->Copy());
+    }
+
+    Handle(Geom_BezierSurface) aBezier = theSurface.Bezier();
+    TColgp_Array2OfPnt aPoles (1, aBezier->NbUPoles(), 1, aBezier->NbVPoles());
+    TColStd_Array2OfReal aWeights (1, aBezier->NbUPoles(), 1, aBezier->NbVPoles());
+    aBezier->Poles (aPoles);
+    aBezier->Weights (aWeights);
+
+    TColStd_Array1OfReal aKnots (1, 2);
+    aKnots (1) = 0.0;
+    aKnots (2) = 1.0;
+    TColStd_Array1OfInteger aUMults (1, 2), aVMults (1, 2);
+    aUMults.Init (aBezier->UDegree() + 1);
+    aVMults.Init (aBezier->VDegree() + 1);
+    return new Geom_BSplineSurface (aPoles, aWeights, aKnots, aKnots, aUMults, aVMults,
+                                    aBezier->UDegree(), aBezier->VDegree());
+  }
+
+  //! Computes the knots splitting the spans overlapping the range
+  //! so that the range contains at least THE_MIN_NB_PATCHES spans.
+  static void refinementKnots (const TColStd_Array1OfReal& theKnots,
+                               const Standard_Real theMin,
+                               const Standard_Real theMax,
+                               NCollection_Vector<Standard_Real>& theNewKnots)
+  {
+    Standard_Integer aNbSpans = 0;
+    for (Standard_Integer i = theKnots.Lower(); i < theKnots.Upper(); ++i)
+    {
+      if (theKnots (i + 1) > theMin && theKnots (i) < theMax)
+      {
+        ++aNbSpans;
+      }
+    }
+    if (aNbSpans == 0 || aNbSpans >= THE_MIN_NB_PATCHES)
+    {
+      return;
+    }
+
+    const Standard_Integer aNbSplits = (THE_MIN_NB_PATCHES + aNbSpans - 1) / aNbSpans;
+    for (Standard_Integer i = theKnots.Lower(); i < theKnots.Upper(); ++i)
+    {
+      if (theKnots (i + 1) > theMin && theKnots (i) < theMax)
+      {
+        for (Standard_Integer j = 1; j < aNbSplits; ++j)
+        {
+          theNewKnots.Append (theKnots (i) + (theKnots (i + 1) - theKnots (i)) * j / aNbSplits);
+        }
+      }
+    }
+  }
+
+  //! Inserts the knots into the surface in U or V direction.
+  static void insertKnots (const Handle(Geom_BSplineSurface)& theSurface,
+                           const NCollection_Vector<Standard_Real>& theKnots,
+                           const Standard_Boolean isU)
+  {
+    if (theKnots.IsEmpty())
+    {
+      return;
+    }
+
+    TColStd_Array1OfReal aKnots (1, theKnots.Length());
+    TColStd_Array1OfInteger aMults (1, theKnots.Length());
+    for (Standard_Integer i = 0; i < theKnots.Length(); ++i)
+    {
+      aKnots (i + 1) = theKnots (i);
+    }
+    aMults.Init (1);
+    if (isU)
+    {
+      theSurface->InsertUKnots (aKnots, aMults);
+    }
+    else
+    {
+      theSurface->InsertVKnots (aKnots, aMults);
+    }
+  }
+}
+
+//=======================================================================
+//class    : PatchSelector
+//purpose  : Visits the patches closer to the point than the best solution
+//=======================================================================
+class Extrema_SurfaceProjector::PatchSelector
+  : public BVH_Traverse<Standard_Real, 3, Extrema_SurfaceProjector::PatchSet>
+{
+public:
+
+  PatchSelector (Extrema_SurfaceProjector& theProjector, const gp_Pnt& thePnt)
+  : myProjector (theProjector),
+    myPnt (thePnt),
+    myVec (toVec (thePnt))
+  {
+    SetBVHSet (theProjector.myPatchSet.get());
+  }
+
+  virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin, const BVH_Vec3d& theMax,
+                                       Standard_Real& theMetric) const Standard_OVERRIDE
+  {
+    theMetric = BVH_Tools3d::PointBoxSquareDistance (myVec, theMin, theMax);
+    return RejectMetric (theMetric);
+  }
+
+  //! Rejects the patches which cannot improve the solution by more than the tolerance.
+  virtual Standard_Boolean RejectMetric (const Standard_Real& theMetric) const Standard_OVERRIDE
+  {
+    if (myProjector.mySqDist == RealLast())
+    {
+      return Standard_False;
+    }
+    const Standard_Real aLimit = Sqrt (myProjector.mySqDist) - myProjector.myTol;
+    return aLimit <= 0.0 || theMetric >= aLimit * aLimit;
+  }
+
+  virtual Standard_Boolean IsMetricBetter (const Standard_Real& theLeft,
+                                           const Standard_Real& theRight) const Standard_OVERRIDE
+  {
+    return theLeft < theRight;
+  }
+
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                   const Standard_Real&) Standard_OVERRIDE
+  {
+    const BVH_Box<Standard_Real, 3> aBox = myBVHSet->Box (theIndex);
+    if (RejectMetric (BVH_Tools3d::PointBoxSquareDistance (myVec, aBox.CornerMin(), aBox.CornerMax())))
+    {
+      return Standard_False;
+    }
+
+    // the patch containing the current solution inside has been already refined
+    const Standard_Integer aPatchIndex = myBVHSet->Element (theIndex);
+    const Patch& aPatch = myProjector.myPatches (aPatchIndex);
+    if (myProjector.myIsDone
+     && myProjector.myU > aPatch.UMin && myProjector.myU < aPatch.UMax
+     && myProjector.myV > aPatch.VMin && myProjector.myV < aPatch.VMax)
+    {
+      return Standard_False;
+    }
+
+    myProjector.searchPatch (myPnt, aPatchIndex);
+    return Standard_True;
+  }
+
+private:
+
+  Extrema_SurfaceProjector& myProjector;
+  gp_Pnt myPnt;
+  BVH_Vec3d myVec;
+};
+
+//=======================================================================
+//function : Extrema_SurfaceProjector
+//purpose  : 
+//=======================================================================
+Extrema_SurfaceProjector::Extrema_SurfaceProjector()
+: myUMin (0.0), myUMax (0.0), myVMin (0.0), myVMax (0.0),
+  myTol (Precision::Confusion()), myTolU (0.0), myTolV (0.0),
+  myToWarmStart (Standard_True),
+  myHasSolution (Standard_False),
+  myIsDone (Standard_False),
+  myU (0.0), myV (0.0), mySqDist (RealLast()),
+  myNbRuns (0)
+{
+}
+
+//=======================================================================
+//function : Extrema_SurfaceProjector
+//purpose  : 
+//=======================================================================
+Extrema_SurfaceProjector::Extrema_SurfaceProjector (const Adaptor3d_Surface& theSurface,
+                                                    const Standard_Real theTolerance)
+: Extrema_SurfaceProjector()
+{
+  Init (theSurface, theTolerance);
+}
+
+//=======================================================================
+//function : Extrema_SurfaceProjector
+//purpose  : 
+//=======================================================================
+Extrema_SurfaceProjector::Extrema_SurfaceProjector (const Adaptor3d_Surface& theSurface,
+                                                    const Standard_Real theUMin,
+                                                    const Standard_Real theUMax,
+                                                    const Standard_Real theVMin,
+                                                    const Standard_Real theVMax,
+                                                    const Standard_Real theTolerance)
+: Extrema_SurfaceProjector()
+{
+  Init (theSurface, theUMin, theUMax, theVMin, theVMax, theTolerance);
+}
+
+//=======================================================================
+//function : Init
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::Init (const Adaptor3d_Surface& theSurface,
+                                     const Standard_Real theTolerance)
+{
+  Init (theSurface,
+        theSurface.FirstUParameter(), theSurface.LastUParameter(),
+        theSurface.FirstVParameter(), theSurface.LastVParameter(),
+        theTolerance);
+}
+
+//=======================================================================
+//function : Init
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::Init (const Adaptor3d_Surface& theSurface,
+                                     const Standard_Real theUMin,
+                                     const Standard_Real theUMax,
+                                     const Standard_Real theVMin,
+                                     const Standard_Real theVMax,
+                                     const Standard_Real theTolerance)
+{
+  if (Precision::IsInfinite (theUMin) || Precision::IsInfinite (theUMax)
+   || Precision::IsInfinite (theVMin) || Precision::IsInfinite (theVMax))
+  {
+    throw Standard_ConstructionError ("Extrema_SurfaceProjector::Init(), infinite bounds of the surface");
+  }
+
+  mySurf = theSurface.ShallowCopy();
+  myUMin = theUMin;
+  myUMax = theUMax;
+  myVMin = theVMin;
+  myVMax = theVMax;
+  myTol  = theTolerance;
+  myTolU = mySurf->UResolution (myTol);
+  myTolV = mySurf->VResolution (myTol);
+  myHasSolution = Standard_False;
+  myIsDone = Standard_False;
+  mySqDist = RealLast();
+  myNbRuns = 0;
+
+  myPatches.Clear();
+  myPatchSet = new PatchSet();
+  if (mySurf->GetType() == GeomAbs_BSplineSurface
+   || mySurf->GetType() == GeomAbs_BezierSurface)
+  {
+    makeSplinePatches();
+  }
+  if (myPatches.IsEmpty())
+  {
+    makeGridPatches();
+  }
+  myPatchSet->Build();
+}
+
+//=======================================================================
+//function : makeSplinePatches
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::makeSplinePatches()
+{
+  Handle(Geom_BSplineSurface) aSurf = toBSpline (*mySurf);
+  if (aSurf.IsNull())
+  {
+    return;
+  }
+  if (aSurf->IsUPeriodic())
+  {
+    aSurf->SetUNotPeriodic();
+  }
+  if (aSurf->IsVPeriodic())
+  {
+    aSurf->SetVNotPeriodic();
+  }
+
+  // refine the surface having few spans to get the tighter control hulls
+  NCollection_Vector<Standard_Real> aUKnots, aVKnots;
+  refinementKnots (aSurf->UKnots(), myUMin, myUMax, aUKnots);
+  refinementKnots (aSurf->VKnots(), myVMin, myVMax, aVKnots);
+  insertKnots (aSurf, aUKnots, Standard_True);
+  insertKnots (aSurf, aVKnots, Standard_False);
+
+  // each span is bounded by the box of the poles defining it
+  const TColgp_Array2OfPnt& aPoles = aSurf->Poles();
+  const TColStd_Array1OfReal& aUFlat = aSurf->UKnotSequence();
+  const TColStd_Array1OfReal& aVFlat = aSurf->VKnotSequence();
+  const Standard_Integer aUDeg = aSurf->UDegree();
+  const Standard_Integer aVDeg = aSurf->VDegree();
+  for (Standard_Integer iU = aUFlat.Lower() + aUDeg; iU < aUFlat.Lower() + aSurf->NbUPoles(); ++iU)
+  {
+    const Standard_Real aU1 = Max (aUFlat (iU), myUMin);
+    const Standard_Real aU2 = Min (aUFlat (iU + 1), myUMax);
+    if (aU2 - aU1 <= Precision::PConfusion())
+    {
+      continue;
+    }
+
+    for (Standard_Integer iV = aVFlat.Lower() + aVDeg; iV < aVFlat.Lower() + aSurf->NbVPoles(); ++iV)
+    {
+      const Standard_Real aV1 = Max (aVFlat (iV), myVMin);
+      const Standard_Real aV2 = Min (aVFlat (iV + 1), myVMax);
+      if (aV2 - aV1 <= Precision::PConfusion())
+      {
+        continue;
+      }
+
+      BVH_Box<Standard_Real, 3> aHull;
+      for (Standard_Integer i = iU - aUDeg; i <= iU; ++i)
+      {
+        for (Standard_Integer j = iV - aVDeg; j <= iV; ++j)
+        {
+          aHull.Add (toVec (aPoles (aPoles.LowerRow() + i - aUFlat.Lower(),
+                                    aPoles.LowerCol() + j - aVFlat.Lower())));
+        }
+      }
+      addPatch (aU1, aU2, aV1, aV2, aHull);
+    }
+  }
+}
+
+//=======================================================================
+//function : makeGridPatches
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::makeGridPatches()
+{
+  const Standard_Integer aNbU = mySurf->GetType() == GeomAbs_Plane ? 1 : THE_MIN_NB_PATCHES;
+  const Standard_Integer aNbV = mySurf->GetType() == GeomAbs_Plane ? 1 : THE_MIN_NB_PATCHES;
+  const Standard_Real aDU = (myUMax - myUMin) / aNbU;
+  const Standard_Real aDV = (myVMax - myVMin) / aNbV;
+  for (Standard_Integer i = 0; i < aNbU; ++i)
+  {
+    for (Standard_Integer j = 0; j < aNbV; ++j)
+    {
+      addPatch (myUMin + aDU * i, i == aNbU - 1 ? myUMax : myUMin + aDU * (i + 1),
+                myVMin + aDV * j, j == aNbV - 1 ? myVMax : myVMin + aDV * (j + 1),
+                BVH_Box<Standard_Real, 3>());
+    }
+  }
+}
+
+//=======================================================================
+//function : addPatch
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::addPatch (const Standard_Real theU1, const Standard_Real theU2,
+                                         const Standard_Real theV1, const Standard_Real theV2,
+                                         const BVH_Box<Standard_Real, 3>& theHullBox)
+{
+  Patch aPatch;
+  aPatch.UMin = theU1;
+  aPatch.UMax = theU2;
+  aPatch.VMin = theV1;
+  aPatch.VMax = theV2;
+  for (Standard_Integer i = 0; i < 3; ++i)
+  {
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      aPatch.Samples[i * 3 + j] = mySurf->Value (theU1 + (theU2 - theU1) * 0.5 * i,
+                                                 theV1 + (theV2 - theV1) * 0.5 * j);
+    }
+  }
+
+  BVH_Box<Standard_Real, 3> aBox = theHullBox;
+  if (!aBox.IsValid())
+  {
+    // the bilinear interpolation of the corners is inside the box of the samples,
+    // the patch deviates from it not more than by the bound given by the second derivatives
+    for (Standard_Integer i = 0; i < 9; ++i)
+    {
+      aBox.Add (toVec (aPatch.Samples[i]));
+    }
+    const Standard_Real anOffset = deviationBound (*mySurf, theU1, theU2, theV1, theV2) + myTol;
+    const BVH_Vec3d anOffsetVec (anOffset, anOffset, anOffset);
+    aBox = BVH_Box<Standard_Real, 3> (aBox.CornerMin() - anOffsetVec, aBox.CornerMax() + anOffsetVec);
+  }
+
+  myPatchSet->Add (myPatches.Length(), aBox);
+  myPatches.Append (aPatch);
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+Standard_Boolean Extrema_SurfaceProjector::Perform (const gp_Pnt& thePnt)
+{
+  myIsDone = Standard_False;
+  mySqDist = RealLast();
+  if (!IsInitialized())
+  {
+    return Standard_False;
+  }
+
+  if (myToWarmStart && myHasSolution)
+  {
+    Standard_Real aU = myU, aV = myV, aSqDist = RealLast();
+    gp_Pnt aPnt;
+    refine (thePnt, myUMin, myUMax, myVMin, myVMax, aU, aV, aPnt, aSqDist);
+    myU = aU;
+    myV = aV;
+    myPnt = aPnt;
+    mySqDist = aSqDist;
+    myIsDone = Standard_True;
+  }
+
+  PatchSelector aSelector (*this, thePnt);
+  aSelector.Select();
+
+  myHasSolution = myIsDone;
+  return myIsDone;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::Perform (const TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfPnt2d& theParams,
+                                        TColStd_Array1OfReal& theDistances)
+{
+  if (theParams.Length() != thePoints.Length()
+   || theDistances.Length() != thePoints.Length())
+  {
+    throw Standard_DimensionError ("Extrema_SurfaceProjector::Perform(), wrong size of the output arrays");
+  }
+
+  for (Standard_Integer i = 0; i < thePoints.Length(); ++i)
+  {
+    if (Perform (thePoints (thePoints.Lower() + i)))
+    {
+      theParams (theParams.Lower() + i).SetCoord (myU, myV);
+      theDistances (theDistances.Lower() + i) = Distance();
+    }
+    else
+    {
+      theParams (theParams.Lower() + i).SetCoord (0.0, 0.0);
+      theDistances (theDistances.Lower() + i) = RealLast();
+    }
+  }
+}
+
+//=======================================================================
+//function : searchPatch
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::searchPatch (const gp_Pnt& thePnt,
+                                            const Standard_Integer thePatch)
+{
+  const Patch& aPatch = myPatches (thePatch);
+  Standard_Integer aBest = 0;
+  Standard_Real aSqDist = RealLast();
+  for (Standard_Integer i = 0; i < 9; ++i)
+  {
+    const Standard_Real aD = aPatch.Samples[i].SquareDistance (thePnt);
+    if (aD < aSqDist)
+    {
+      aSqDist = aD;
+      aBest = i;
+    }
+  }
+
+  Standard_Real aU = aPatch.UMin + (aPatch.UMax - aPatch.UMin) * 0.5 * (aBest / 3);
+  Standard_Real aV = aPatch.VMin + (aPatch.VMax - aPatch.VMin) * 0.5 * (aBest % 3);
+  gp_Pnt aPnt = aPatch.Samples[aBest];
+  refine (thePnt, aPatch.UMin, aPatch.UMax, aPatch.VMin, aPatch.VMax, aU, aV, aPnt, aSqDist);
+  if (aSqDist < mySqDist
+   && ((aU <= aPatch.UMin && aU > myUMin) || (aU >= aPatch.UMax && aU < myUMax)
+    || (aV <= aPatch.VMin && aV > myVMin) || (aV >= aPatch.VMax && aV < myVMax)))
+  {
+    // the best point is stopped by the patch boundary, continue in the neighbor patch
+    refine (thePnt, myUMin, myUMax, myVMin, myVMax, aU, aV, aPnt, aSqDist);
+  }
+  if (aSqDist < mySqDist)
+  {
+    myU = aU;
+    myV = aV;
+    myPnt = aPnt;
+    mySqDist = aSqDist;
+    myIsDone = Standard_True;
+  }
+}
+
+//=======================================================================
+//function : refine
+//purpose  : 
+//=======================================================================
+void Extrema_SurfaceProjector::refine (const gp_Pnt& thePnt,
+                                       const Standard_Real theUMin, const Standard_Real theUMax,
+                                       const Standard_Real theVMin, const Standard_Real theVMax,
+                                       Standard_Real& theU, Standard_Real& theV,
+                                       gp_Pnt& theSurfPnt, Standard_Real& theSqDist)
+{
+  ++myNbRuns;
+
+  gp_Pnt aPnt;
+  gp_Vec aDU, aDV, aDUU, aDVV, aDUV;
+  mySurf->D2 (theU, theV, aPnt, aDU, aDV, aDUU, aDVV, aDUV);
+  theSurfPnt = aPnt;
+  theSqDist = aPnt.SquareDistance (thePnt);
+
+  for (Standard_Integer anIter = 0; anIter < THE_MAX_NB_ITERATIONS && theSqDist > 0.0; ++anIter)
+  {
+    // gradient and Hessian of the half square distance
+    const gp_Vec aR (thePnt, aPnt);
+    const Standard_Real aGU = aR.Dot (aDU);
+    const Standard_Real aGV = aR.Dot (aDV);
+    const Standard_Real aUU = aDU.SquareMagnitude();
+    const Standard_Real aVV = aDV.SquareMagnitude();
+    const Standard_Real aUV = aDU.Dot (aDV);
+    Standard_Real aA = aUU + aR.Dot (aDUU);
+    Standard_Real aB = aUV + aR.Dot (aDUV);
+    Standard_Real aC = aVV + aR.Dot (aDVV);
+    Standard_Real aDet = aA * aC - aB * aB;
+    if (aA <= 0.0 || aDet <= Epsilon (aA * aC))
+    {
+      // the Hessian is not positive definite, use Gauss-Newton step
+      aA = aUU;
+      aB = aUV;
+      aC = aVV;
+      aDet = aA * aC - aB * aB;
+    }
+
+    Standard_Real aStepU, aStepV;
+    if (aDet > Epsilon (aA * aC))
+    {
+      aStepU = -(aC * aGU - aB * aGV) / aDet;
+      aStepV = -(aA * aGV - aB * aGU) / aDet;
+    }
+    else
+    {
+      // degenerated point, move along the non-degenerated direction
+      aStepU = aUU > gp::Resolution() ? -aGU / aUU : 0.0;
+      aStepV = aVV > gp::Resolution() ? -aGV / aVV : 0.0;
+    }
+
+    // the coordinate at the bound is fixed if the descent direction leads outside,
+    // the other one is refined by one-dimensional step
+    const Standard_Boolean isUFixed = (theU <= theUMin && aGU > 0.0) || (theU >= theUMax && aGU < 0.0);
+    const Standard_Boolean isVFixed = (theV <= theVMin && aGV > 0.0) || (theV >= theVMax && aGV < 0.0);
+    if (isUFixed && isVFixed)
+    {
+      break;
+    }
+    else if (isUFixed)
+    {
+      aStepU = 0.0;
+      aStepV = aC > gp::Resolution() ? -aGV / aC : 0.0;
+    }
+    else if (isVFixed)
+    {
+      aStepU = aA > gp::Resolution() ? -aGU / aA : 0.0;
+      aStepV = 0.0;
+    }
+
+    // damped step within the bounds
+    Standard_Boolean isImproved = Standard_False;
+    Standard_Real aNewU = theU, aNewV = theV;
+    for (Standard_Integer aHalving = 0; aHalving < THE_MAX_NB_HALVINGS; ++aHalving)
+    {
+      aNewU = Min (Max (theU + aStepU, theUMin), theUMax);
+      aNewV = Min (Max (theV + aStepV, theVMin), theVMax);
+      if (Abs (aNewU - theU) <= myTolU && Abs (aNewV - theV) <= myTolV)
+      {
+        break;
+      }
+
+      mySurf->D2 (aNewU, aNewV, aPnt, aDU, aDV, aDUU, aDVV, aDUV);
+      const Standard_Real aSqDist = aPnt.SquareDistance (thePnt);
+      if (aSqDist < theSqDist)
+      {
+        isImproved = Standard_True;
+        theSqDist = aSqDist;
+        theSurfPnt = aPnt;
+        break;
+      }
+      aStepU *= 0.5;
+      aStepV *= 0.5;
+    }
+
+    if (!isImproved)
+    {
+      break;
+    }
+
+    const Standard_Boolean isConverged = Abs (aNewU - theU) <= myTolU && Abs (aNewV - theV) <= myTolV;
+    theU = aNewU;
+    theV = aNewV;
+    if (isConverged)
+    {
+      break;
+    }
+  }
+}
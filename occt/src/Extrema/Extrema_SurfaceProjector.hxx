@@ -0,0 +1,186 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _Extrema_SurfaceProjector_HeaderFile
+#define _Extrema_SurfaceProjector_HeaderFile
+
+#include <Adaptor3d_Surface.hxx>
+#include <BVH_BoxSet.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Vector.hxx>
+#include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+//! Projection of points on one surface, intended for projecting large number of points.
+//!
+//! Contrary to Extrema_GenExtPS, which samples the surface by the regular grid
+//! and looks for all extrema of the distance function for each point, the projector
+//! is bound to the surface and prepares the bounded hierarchy of the surface patches
+//! once, on initialization:
+//! - for B-spline and Bezier surfaces the patches are the spans of the surface
+//!   (refined by knot insertion if the surface has few spans), bounded by the boxes
+//!   of their control polygons (the convex hull property of the B-spline patches);
+//! - for other surfaces the patches are the cells of the regular grid, bounded by
+//!   the boxes of their sample points enlarged by the bound of the deviation of the cell
+//!   from the bilinear interpolation of its corners, computed from the bounds of the second
+//!   derivatives. The bounds are exact for the elementary surfaces (plane, cylinder, cone,
+//!   sphere and torus); for other surfaces they are estimated on the samples of the cell,
+//!   thus the result is approximate: the nearest point may be missed on the cells
+//!   with strongly varying curvature.
+//!
+//! The nearest point of the bounded surface is then found by Newton iterations
+//! on the square distance function started from the samples of the patches
+//! in the order of the distance to their boxes, the patches farther than the best
+//! found solution are skipped. The solution of the previous point is used as
+//! the first starting point (warm start), thus the consecutive points close to each
+//! other (e.g. the nodes of the polygon) are projected with the few evaluations.
+//!
+//! Note that the solution is the nearest point of the surface restricted by the bounds,
+//! which may be on the boundary and thus not be an orthogonal projection.
+//! The projector is not thread-safe, use separate projectors in the parallel threads.
+class Extrema_SurfaceProjector
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor.
+  Standard_EXPORT Extrema_SurfaceProjector();
+
+  //! Creates the projector on the surface within its natural bounds.
+  Standard_EXPORT Extrema_SurfaceProjector (const Adaptor3d_Surface& theSurface,
+                                            const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Creates the projector on the surface within the given bounds.
+  Standard_EXPORT Extrema_SurfaceProjector (const Adaptor3d_Surface& theSurface,
+                                            const Standard_Real theUMin,
+                                            const Standard_Real theUMax,
+                                            const Standard_Real theVMin,
+                                            const Standard_Real theVMax,
+                                            const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Initializes the projector on the surface within its natural bounds.
+  Standard_EXPORT void Init (const Adaptor3d_Surface& theSurface,
+                             const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Initializes the projector on the surface within the given bounds (should be finite).
+  //! @param theTolerance [in] 3D tolerance used to stop the iterations
+  Standard_EXPORT void Init (const Adaptor3d_Surface& theSurface,
+                             const Standard_Real theUMin,
+                             const Standard_Real theUMax,
+                             const Standard_Real theVMin,
+                             const Standard_Real theVMax,
+                             const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Returns TRUE if the projector is initialized.
+  Standard_Boolean IsInitialized() const { return !mySurf.IsNull(); }
+
+  //! Returns the number of the patches of the surface.
+  Standard_Integer NbPatches() const { return myPatches.Length(); }
+
+  //! Projects the point.
+  //! @return FALSE if the projector is not initialized
+  Standard_EXPORT Standard_Boolean Perform (const gp_Pnt& thePnt);
+
+  //! Projects the points in the given order, the parameters of the nearest points
+  //! and the distances are returned in the arrays of the same size.
+  //! The points should be ordered so that the consecutive points are close to each other
+  //! to take advantage of the warm start.
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints,
+                                TColgp_Array1OfPnt2d& theParams,
+                                TColStd_Array1OfReal& theDistances);
+
+  //! Returns TRUE if the last point has been projected.
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns the distance from the last point to the nearest point of the surface.
+  Standard_Real Distance() const { return Sqrt (mySqDist); }
+
+  //! Returns the square distance from the last point to the nearest point of the surface.
+  Standard_Real SquareDistance() const { return mySqDist; }
+
+  //! Returns the parameters of the nearest point of the surface.
+  void Parameters (Standard_Real& theU, Standard_Real& theV) const
+  {
+    theU = myU;
+    theV = myV;
+  }
+
+  //! Returns the nearest point of the surface.
+  const gp_Pnt& Point() const { return myPnt; }
+
+  //! Enables/disables the warm start from the solution of the previous point (enabled by default).
+  void SetWarmStart (const Standard_Boolean theToUse) { myToWarmStart = theToUse; }
+
+  //! Returns the number of Newton runs since initialization (for benchmarking).
+  Standard_Integer NbRuns() const { return myNbRuns; }
+
+protected:
+
+  //! Patch of the surface.
+  struct Patch
+  {
+    Standard_Real UMin, UMax, VMin, VMax; //!< Parametric range of the patch
+    gp_Pnt Samples[9];                   //!< Points of the 3x3 grid on the patch
+  };
+
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> PatchSet;
+
+  class PatchSelector;
+
+protected:
+
+  //! Splits the B-spline or Bezier surface on the patches by the spans.
+  Standard_EXPORT void makeSplinePatches();
+
+  //! Splits the surface on the patches by the regular grid.
+  Standard_EXPORT void makeGridPatches();
+
+  //! Adds the patch with the given range. If the hull box is not valid, the patch is
+  //! bounded by the box of its samples enlarged by the bound of its deviation.
+  Standard_EXPORT void addPatch (const Standard_Real theU1, const Standard_Real theU2,
+                                 const Standard_Real theV1, const Standard_Real theV2,
+                                 const BVH_Box<Standard_Real, 3>& theHullBox);
+
+  //! Looks for the nearest point of the patch starting from its nearest sample,
+  //! updates the solution if the found point is closer.
+  Standard_EXPORT void searchPatch (const gp_Pnt& thePnt, const Standard_Integer thePatch);
+
+  //! Runs Newton iterations minimizing the square distance to the point
+  //! within the given parametric range.
+  Standard_EXPORT void refine (const gp_Pnt& thePnt,
+                               const Standard_Real theUMin, const Standard_Real theUMax,
+                               const Standard_Real theVMin, const Standard_Real theVMax,
+                               Standard_Real& theU, Standard_Real& theV,
+                               gp_Pnt& theSurfPnt, Standard_Real& theSqDist);
+
+protected:
+
+  Handle(Adaptor3d_Surface) mySurf;
+  Standard_Real myUMin, myUMax, myVMin, myVMax;
+  Standard_Real myTol, myTolU, myTolV;
+  NCollection_Vector<Patch> myPatches;
+  opencascade::handle<PatchSet> myPatchSet;
+  Standard_Boolean myToWarmStart;
+  Standard_Boolean myHasSolution;  //!< Solution available for the warm start
+  Standard_Boolean myIsDone;
+  Standard_Real myU, myV, mySqDist;
+  gp_Pnt myPnt;
+  Standard_Integer myNbRuns;
+
+};
+
+#endif // _Extrema_SurfaceProjector_HeaderFile
@@ -493,6 +493,18 @@ public:
   //! Raised if the continuity of the curve is not C1.
   Standard_EXPORT void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1) const Standard_OVERRIDE;
   
+  //! Computes the points of the curve at the parameters theU(i) at once,
+  //! grouping the parameters by the knot spans (see BSplCLib::EvalBatch()).
+  //! The points are stored as the structure of arrays: thePoints contains X coordinates
+  //! of all points, then Y and Z coordinates, and its length is 3 * theU.Length().
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT void D0Batch (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints) const;
+  
+  //! Computes the points and the first derivatives of the curve at the parameters
+  //! theU(i) at once, the results are stored as in D0Batch().
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT void D1Batch (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1) const;
+  
   //! Raised if the continuity of the curve is not C2.
   Standard_EXPORT void D2 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const Standard_OVERRIDE;
   
@@ -210,6 +210,51 @@ void Geom_BSplineCurve::D1 (const Standard_Real U,
                 P, V1);
 }
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineCurve::D0Batch (const TColStd_Array1OfReal& theU,
+                                 TColStd_Array1OfReal&       thePoints) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (thePoints.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Geom_BSplineCurve::D0Batch(), inconsistent lengths of arrays");
+  }
+  if (aNbPoints == 0)
+  {
+    return;
+  }
+  BSplCLib::EvalBatch (aNbPoints, &theU.First(), deg, periodic, FKNOTS, POLES,
+                       rational ? &weights->Array1() : BSplCLib::NoWeights(),
+                       &thePoints.ChangeFirst());
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineCurve::D1Batch (const TColStd_Array1OfReal& theU,
+                                 TColStd_Array1OfReal&       thePoints,
+                                 TColStd_Array1OfReal&       theD1) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (thePoints.Length() != 3 * aNbPoints || theD1.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Geom_BSplineCurve::D1Batch(), inconsistent lengths of arrays");
+  }
+  if (aNbPoints == 0)
+  {
+    return;
+  }
+  BSplCLib::EvalBatch (aNbPoints, &theU.First(), deg, periodic, FKNOTS, POLES,
+                       rational ? &weights->Array1() : BSplCLib::NoWeights(),
+                       &thePoints.ChangeFirst(), &theD1.ChangeFirst());
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -1067,6 +1067,18 @@ public:
   //! Raised if the continuity of the surface is not C1.
   Standard_EXPORT void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const Standard_OVERRIDE;
   
+  //! Computes the points of the surface at the parameters (theU(i), theV(i)) at once,
+  //! grouping the parameters by the knot spans (see BSplSLib::EvalBatch()).
+  //! The points are stored as the structure of arrays: thePoints contains X coordinates
+  //! of all points, then Y and Z coordinates, and its length is 3 * theU.Length().
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT void D0Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints) const;
+  
+  //! Computes the points and the first derivatives of the surface at the parameters
+  //! (theU(i), theV(i)) at once, the results are stored as in D0Batch().
+  //! Raised if the lengths of the arrays are not consistent.
+  Standard_EXPORT void D1Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1U, TColStd_Array1OfReal& theD1V) const;
+  
   //! Raised if the continuity of the surface is not C2.
   Standard_EXPORT void D2 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV) const Standard_OVERRIDE;
   
@@ -146,6 +146,57 @@ void Geom_BSplineSurface::D1(const Standard_Real U,
        P, D1U, D1V);
 }
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineSurface::D0Batch (const TColStd_Array1OfReal& theU,
+                                   const TColStd_Array1OfReal& theV,
+                                   TColStd_Array1OfReal&       thePoints) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (theV.Length() != aNbPoints || thePoints.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Geom_BSplineSurface::D0Batch(), inconsistent lengths of arrays");
+  }
+  if (aNbPoints == 0)
+  {
+    return;
+  }
+  BSplSLib::EvalBatch (aNbPoints, &theU.First(), &theV.First(), udeg, vdeg, uperiodic, vperiodic,
+                       UFKNOTS, VFKNOTS, POLES, (urational || vrational) ? &WEIGHTS : BSplSLib::NoWeights(),
+                       &thePoints.ChangeFirst());
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineSurface::D1Batch (const TColStd_Array1OfReal& theU,
+                                   const TColStd_Array1OfReal& theV,
+                                   TColStd_Array1OfReal&       thePoints,
+                                   TColStd_Array1OfReal&       theD1U,
+                                   TColStd_Array1OfReal&       theD1V) const
+{
+  const Standard_Integer aNbPoints = theU.Length();
+  if (theV.Length() != aNbPoints
+   || thePoints.Length() != 3 * aNbPoints
+   || theD1U.Length() != 3 * aNbPoints
+   || theD1V.Length() != 3 * aNbPoints)
+  {
+    throw Standard_DimensionError ("Geom_BSplineSurface::D1Batch(), inconsistent lengths of arrays");
+  }
+  if (aNbPoints == 0)
+  {
+    return;
+  }
+  BSplSLib::EvalBatch (aNbPoints, &theU.First(), &theV.First(), udeg, vdeg, uperiodic, vperiodic,
+                       UFKNOTS, VFKNOTS, POLES, (urational || vrational) ? &WEIGHTS : BSplSLib::NoWeights(),
+                       &thePoints.ChangeFirst(), &theD1U.ChangeFirst(), &theD1V.ChangeFirst());
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -131,6 +131,7 @@ Handle(Adaptor3d_Curve) GeomAdaptor_Curve::ShallowCopy() const
   aCopy->myFirst           = myFirst;
   aCopy->myLast            = myLast;
   aCopy->myBSplineCurve    = myBSplineCurve;
+  aCopy->mySpanCache       = mySpanCache;
   if (!myNestedEvaluator.IsNull())
   {
     aCopy->myNestedEvaluator = myNestedEvaluator->ShallowCopy();
@@ -210,6 +211,7 @@ void GeomAdaptor_Curve::Reset()
   myCurve.Nullify();
   myNestedEvaluator.Nullify();
   myBSplineCurve.Nullify();
+  mySpanCache.Nullify();
   myCurveCache.Nullify();
   myFirst = myLast = 0.0;
 }
@@ -231,6 +233,7 @@ void GeomAdaptor_Curve::load(const Handle(Geom_Curve)& C,
     myCurve = C;
     myNestedEvaluator.Nullify();
     myBSplineCurve.Nullify();
+    mySpanCache.Nullify();
     
     const Handle(Standard_Type)& TheType = C->DynamicType();
     if ( TheType == STANDARD_TYPE(Geom_TrimmedCurve)) {
@@ -1165,6 +1168,12 @@ void GeomAdaptor_Curve::RebuildCache(const Standard_Real theParameter) const
 }
   else if (myTypeCurve == GeomAbs_BSplineCurve)
 {
+    if (!mySpanCache.IsNull())
+    {
+      // Take the cache from the shared table (the cache is never rebuilt by the adaptor)
+      myCurveCache = mySpanCache->Cache (theParameter);
+      return;
+    }
     // Create cache for B-spline
     if (myCurveCache.IsNull())
       myCurveCache = new BSplCLib_Cache(myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
@@ -1174,6 +1183,45 @@ void GeomAdaptor_Curve::RebuildCache(const Standard_Real theParameter) const
 }
 }
 
+//=======================================================================
+//function : CreateSpanCache
+//purpose  : 
+//=======================================================================
+void GeomAdaptor_Curve::CreateSpanCache (const Standard_Size theMaxMemory)
+{
+  if (myTypeCurve != GeomAbs_BSplineCurve || myBSplineCurve.IsNull())
+  {
+    return;
+  }
+
+  mySpanCache = new BSplCLib_MultiSpanCache (myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
+                                             myBSplineCurve->KnotSequence(), myBSplineCurve->Poles(),
+                                             myBSplineCurve->Weights(), theMaxMemory);
+  myCurveCache.Nullify();
+}
+
+//=======================================================================
+//function : SetSpanCache
+//purpose  : 
+//=======================================================================
+void GeomAdaptor_Curve::SetSpanCache (const Handle(BSplCLib_MultiSpanCache)& theSpanCache)
+{
+  if (!theSpanCache.IsNull())
+  {
+    if (myTypeCurve != GeomAbs_BSplineCurve || myBSplineCurve.IsNull())
+    {
+      throw Standard_ConstructionError ("GeomAdaptor_Curve::SetSpanCache(), the curve is not a B-spline");
+    }
+    const Standard_Integer aNbSpans = myBSplineCurve->KnotSequence().Length() - 2 * myBSplineCurve->Degree() - 1;
+    if (theSpanCache->NbSpans() != aNbSpans)
+    {
+      throw Standard_ConstructionError ("GeomAdaptor_Curve::SetSpanCache(), the table does not match the curve");
+    }
+  }
+  mySpanCache = theSpanCache;
+  myCurveCache.Nullify();
+}
+
 //=======================================================================
 //function : IsBoundary
 //purpose  : 
@@ -1289,6 +1337,80 @@ void GeomAdaptor_Curve::D1(const Standard_Real U, gp_Pnt& P, gp_Vec& V) const
 }
 }
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D0Batch (const TColStd_Array1OfReal& theU,
+                                 TColStd_Array1OfReal& thePoints) const
+{
+  if (myTypeCurve != GeomAbs_BSplineCurve || myBSplineCurve.IsNull())
+  {
+    Adaptor3d_Curve::D0Batch (theU, thePoints);
+    return;
+  }
+  myBSplineCurve->D0Batch (theU, thePoints);
+  fixBoundaries (theU, thePoints, NULL);
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D1Batch (const TColStd_Array1OfReal& theU,
+                                 TColStd_Array1OfReal& thePoints,
+                                 TColStd_Array1OfReal& theD1) const
+{
+  if (myTypeCurve != GeomAbs_BSplineCurve || myBSplineCurve.IsNull())
+  {
+    Adaptor3d_Curve::D1Batch (theU, thePoints, theD1);
+    return;
+  }
+  myBSplineCurve->D1Batch (theU, thePoints, theD1);
+  fixBoundaries (theU, thePoints, &theD1);
+}
+
+//=======================================================================
+//function : fixBoundaries
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::fixBoundaries (const TColStd_Array1OfReal& theU,
+                                       TColStd_Array1OfReal& thePoints,
+                                       TColStd_Array1OfReal* theD1) const
+{
+  // the values on the boundaries are computed on the current interval
+  const Standard_Integer aNbPoints = theU.Length();
+  gp_Pnt aP;
+  gp_Vec aV;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    const Standard_Real aU = theU (theU.Lower() + i);
+    if (aU != myFirst && aU != myLast)
+    {
+      continue;
+    }
+    if (theD1 != NULL)
+    {
+      D1 (aU, aP, aV);
+    }
+    else
+    {
+      D0 (aU, aP);
+    }
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      thePoints (thePoints.Lower() + j * aNbPoints + i) = aP.Coord (j + 1);
+      if (theD1 != NULL)
+      {
+        theD1->ChangeValue (theD1->Lower() + j * aNbPoints + i) = aV.Coord (j + 1);
+      }
+    }
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Curve.hxx>
 #include <BSplCLib_Cache.hxx>
+#include <BSplCLib_MultiSpanCache.hxx>
 #include <Geom_Curve.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <GeomEvaluator_Curve.hxx>
@@ -80,6 +81,22 @@ public:
   //! This is inherited to provide easy to use constructors.
   const Handle(Geom_Curve)& Curve() const { return myCurve; }
 
+  //! Creates the table of caches of spans of the B-spline curve (see BSplCLib_MultiSpanCache),
+  //! shared by the shallow copies of the adaptor made afterwards.
+  //! Does nothing for curves of other types.
+  //! The table keeps the state of the curve at its creation, thus it should be recreated
+  //! when the curve is modified.
+  //! @param theMaxMemory [in] maximal size in bytes of the stored caches of spans
+  Standard_EXPORT void CreateSpanCache (const Standard_Size theMaxMemory = 16 * 1024 * 1024);
+
+  //! Sets the table of caches of spans created by the adaptor of the same B-spline curve.
+  //! The null handle switches the adaptor back to its own cache of one span.
+  //! Standard_ConstructionError is raised if the table does not match the curve.
+  Standard_EXPORT void SetSpanCache (const Handle(BSplCLib_MultiSpanCache)& theSpanCache);
+
+  //! Returns the table of caches of spans (null if not set).
+  const Handle(BSplCLib_MultiSpanCache)& SpanCache() const { return mySpanCache; }
+
   virtual Standard_Real FirstParameter() const Standard_OVERRIDE { return myFirst; }
 
   virtual Standard_Real LastParameter() const Standard_OVERRIDE { return myLast; }
@@ -124,6 +141,15 @@ public:
   //! else the derivatives are computed on the basis curve.
   Standard_EXPORT void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const Standard_OVERRIDE;
   
+  //! Computes the points of the curve at the parameters theU(i) at once.
+  //! B-spline curves are evaluated by Geom_BSplineCurve::D0Batch().
+  Standard_EXPORT void D0Batch (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives of the curve at the parameters theU(i)
+  //! at once. B-spline curves are evaluated by Geom_BSplineCurve::D1Batch(),
+  //! the points on the boundaries of the adaptor are computed by D1() as described above.
+  Standard_EXPORT void D1Batch (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1) const Standard_OVERRIDE;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
@@ -224,6 +250,10 @@ private:
   //! \param theParameter the value on the knot axis which identifies the caching span
   void RebuildCache (const Standard_Real theParameter) const;
 
+  //! Recomputes the results of the batch evaluation for the parameters
+  //! equal to the first or the last parameter of the adaptor
+  void fixBoundaries (const TColStd_Array1OfReal& theU, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal* theD1) const;
+
 private:
 
   Handle(Geom_Curve) myCurve;
@@ -233,6 +263,7 @@ private:
   
   Handle(Geom_BSplineCurve) myBSplineCurve; ///< B-spline representation to prevent castings
   mutable Handle(BSplCLib_Cache) myCurveCache; ///< Cached data for B-spline or Bezier curve
+  Handle(BSplCLib_MultiSpanCache) mySpanCache; ///< Table of caches of spans shared by the copies of adaptor
   Handle(GeomEvaluator_Curve) myNestedEvaluator; ///< Calculates value of offset curve
 
 };
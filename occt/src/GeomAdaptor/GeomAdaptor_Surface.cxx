@@ -124,6 +124,7 @@ Handle(Adaptor3d_Surface) GeomAdaptor_Surface::ShallowCopy() const
   aCopy->myTolU            = myTolU;
   aCopy->myTolV            = myTolV;
   aCopy->myBSplineSurface  = myBSplineSurface;
+  aCopy->mySpanCache       = mySpanCache;
 
   aCopy->mySurfaceType     = mySurfaceType;
   if (!myNestedEvaluator.IsNull())
@@ -159,6 +160,7 @@ void GeomAdaptor_Surface::load(const Handle(Geom_Surface)& S,
     mySurface = S;
     myNestedEvaluator.Nullify();
     myBSplineSurface.Nullify();
+    mySpanCache.Nullify();
 
     const Handle(Standard_Type)& TheType = S->DynamicType();
     if (TheType == STANDARD_TYPE(Geom_RectangularTrimmedSurface)) {
@@ -701,6 +703,12 @@ void GeomAdaptor_Surface::RebuildCache(const Standard_Real theU,
   }
   else if (mySurfaceType == GeomAbs_BSplineSurface)
   {
+    if (!mySpanCache.IsNull())
+    {
+      // Take the cache from the shared table (the cache is never rebuilt by the adaptor)
+      mySurfaceCache = mySpanCache->Cache (theU, theV);
+      return;
+    }
     // Create cache for B-spline
     if (mySurfaceCache.IsNull())
       mySurfaceCache = new BSplSLib_Cache(
@@ -712,6 +720,47 @@ void GeomAdaptor_Surface::RebuildCache(const Standard_Real theU,
   }
 }
 
+//=======================================================================
+//function : CreateSpanCache
+//purpose  : 
+//=======================================================================
+void GeomAdaptor_Surface::CreateSpanCache (const Standard_Size theMaxMemory)
+{
+  if (mySurfaceType != GeomAbs_BSplineSurface || myBSplineSurface.IsNull())
+  {
+    return;
+  }
+
+  mySpanCache = new BSplSLib_MultiSpanCache (
+    myBSplineSurface->UDegree(), myBSplineSurface->IsUPeriodic(), myBSplineSurface->UKnotSequence(),
+    myBSplineSurface->VDegree(), myBSplineSurface->IsVPeriodic(), myBSplineSurface->VKnotSequence(),
+    myBSplineSurface->Poles(), myBSplineSurface->Weights(), theMaxMemory);
+  mySurfaceCache.Nullify();
+}
+
+//=======================================================================
+//function : SetSpanCache
+//purpose  : 
+//=======================================================================
+void GeomAdaptor_Surface::SetSpanCache (const Handle(BSplSLib_MultiSpanCache)& theSpanCache)
+{
+  if (!theSpanCache.IsNull())
+  {
+    if (mySurfaceType != GeomAbs_BSplineSurface || myBSplineSurface.IsNull())
+    {
+      throw Standard_ConstructionError ("GeomAdaptor_Surface::SetSpanCache(), the surface is not a B-spline");
+    }
+    const Standard_Integer aNbSpansU = myBSplineSurface->UKnotSequence().Length() - 2 * myBSplineSurface->UDegree() - 1;
+    const Standard_Integer aNbSpansV = myBSplineSurface->VKnotSequence().Length() - 2 * myBSplineSurface->VDegree() - 1;
+    if (theSpanCache->NbSpans() != aNbSpansU * aNbSpansV)
+    {
+      throw Standard_ConstructionError ("GeomAdaptor_Surface::SetSpanCache(), the table does not match the surface");
+    }
+  }
+  mySpanCache = theSpanCache;
+  mySurfaceCache.Nullify();
+}
+
 //=======================================================================
 //function : Value
 //purpose  : 
@@ -803,6 +852,64 @@ void GeomAdaptor_Surface::D1(const Standard_Real U,
   }
 }
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D0Batch (const TColStd_Array1OfReal& theU,
+                                   const TColStd_Array1OfReal& theV,
+                                   TColStd_Array1OfReal& thePoints) const
+{
+  if (mySurfaceType != GeomAbs_BSplineSurface || myBSplineSurface.IsNull())
+  {
+    Adaptor3d_Surface::D0Batch (theU, theV, thePoints);
+    return;
+  }
+  myBSplineSurface->D0Batch (theU, theV, thePoints);
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D1Batch (const TColStd_Array1OfReal& theU,
+                                   const TColStd_Array1OfReal& theV,
+                                   TColStd_Array1OfReal& thePoints,
+                                   TColStd_Array1OfReal& theD1U,
+                                   TColStd_Array1OfReal& theD1V) const
+{
+  if (mySurfaceType != GeomAbs_BSplineSurface || myBSplineSurface.IsNull())
+  {
+    Adaptor3d_Surface::D1Batch (theU, theV, thePoints, theD1U, theD1V);
+    return;
+  }
+  myBSplineSurface->D1Batch (theU, theV, thePoints, theD1U, theD1V);
+
+  // the derivatives on the boundaries are computed on the current interval
+  const Standard_Integer aNbPoints = theU.Length();
+  gp_Pnt aP;
+  gp_Vec aDU, aDV;
+  for (Standard_Integer i = 0; i < aNbPoints; ++i)
+  {
+    const Standard_Real aU = theU (theU.Lower() + i);
+    const Standard_Real aV = theV (theV.Lower() + i);
+    if (Abs (aU - myUFirst) > myTolU && Abs (aU - myULast) > myTolU
+     && Abs (aV - myVFirst) > myTolV && Abs (aV - myVLast) > myTolV)
+    {
+      continue;
+    }
+    D1 (aU, aV, aP, aDU, aDV);
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      thePoints (thePoints.Lower() + j * aNbPoints + i) = aP.Coord (j + 1);
+      theD1U (theD1U.Lower() + j * aNbPoints + i) = aDU.Coord (j + 1);
+      theD1V (theD1V.Lower() + j * aNbPoints + i) = aDV.Coord (j + 1);
+    }
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
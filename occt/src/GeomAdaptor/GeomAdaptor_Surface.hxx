@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Surface.hxx>
 #include <BSplSLib_Cache.hxx>
+#include <BSplSLib_MultiSpanCache.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <GeomEvaluator_Surface.hxx>
 #include <Geom_Surface.hxx>
@@ -87,6 +88,24 @@ public:
 
   const Handle(Geom_Surface)& Surface() const { return mySurface; }
 
+  //! Creates the table of caches of spans of the B-spline surface (see BSplSLib_MultiSpanCache),
+  //! shared by the shallow copies of the adaptor made afterwards.
+  //! The copies evaluating the surface in different threads take the caches of spans
+  //! from the table instead of recomputing their own caches in going from span to span.
+  //! Does nothing for surfaces of other types.
+  //! The table keeps the state of the surface at its creation, thus it should be recreated
+  //! when the surface is modified.
+  //! @param theMaxMemory [in] maximal size in bytes of the stored caches of spans
+  Standard_EXPORT void CreateSpanCache (const Standard_Size theMaxMemory = 16 * 1024 * 1024);
+
+  //! Sets the table of caches of spans created by the adaptor of the same B-spline surface.
+  //! The null handle switches the adaptor back to its own cache of one span.
+  //! Standard_ConstructionError is raised if the table does not match the surface.
+  Standard_EXPORT void SetSpanCache (const Handle(BSplSLib_MultiSpanCache)& theSpanCache);
+
+  //! Returns the table of caches of spans (null if not set).
+  const Handle(BSplSLib_MultiSpanCache)& SpanCache() const { return mySpanCache; }
+
   virtual Standard_Real FirstUParameter() const Standard_OVERRIDE { return myUFirst; }
 
   virtual Standard_Real LastUParameter() const Standard_OVERRIDE { return myULast; }
@@ -155,6 +174,15 @@ public:
   //! else the derivatives are computed on the basis surface.
   Standard_EXPORT void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const Standard_OVERRIDE;
   
+  //! Computes the points of the surface at the parameters (theU(i), theV(i)) at once.
+  //! B-spline surfaces are evaluated by Geom_BSplineSurface::D0Batch().
+  Standard_EXPORT void D0Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives of the surface at the parameters
+  //! (theU(i), theV(i)) at once. B-spline surfaces are evaluated by Geom_BSplineSurface::D1Batch(),
+  //! the points on the boundaries of the adaptor are computed by D1() as described above.
+  Standard_EXPORT void D1Batch (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColStd_Array1OfReal& thePoints, TColStd_Array1OfReal& theD1U, TColStd_Array1OfReal& theD1V) const Standard_OVERRIDE;
+  
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //!
@@ -272,6 +300,7 @@ private:
   
   Handle(Geom_BSplineSurface) myBSplineSurface; ///< B-spline representation to prevent downcasts
   mutable Handle(BSplSLib_Cache) mySurfaceCache; ///< Cached data for B-spline or Bezier surface
+  Handle(BSplSLib_MultiSpanCache) mySpanCache; ///< Table of caches of spans shared by the copies of adaptor
 
   GeomAbs_SurfaceType mySurfaceType;
   Handle(GeomEvaluator_Surface) myNestedEvaluator; ///< Calculates values of nested complex surfaces (offset surface, surface of extrusion or revolution)
@@ -39,6 +39,7 @@
 #include <Geom2d_OffsetCurve.hxx>
 
 #include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <TColgp_Array2OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
@@ -68,6 +69,13 @@
 #include <GeomLib_Tool.hxx>
 #include <Geom_Curve.hxx>
 #include <Message.hxx>
+#include <GeomAdaptor_Curve.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <Extrema_GenExtPS.hxx>
+#include <Extrema_SurfaceProjector.hxx>
+#include <math_BullardGenerator.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_Timer.hxx>
 
 #include <stdio.h>
 
@@ -1696,6 +1704,409 @@ Standard_Integer bounds(Draw_Interpretor&, Standard_Integer n, const char** a)
   return 0;
 }
 
+//=======================================================================
+//function : evalbatch
+//purpose  : compares the batch evaluation of the curve or the surface with the scalar one
+//=======================================================================
+
+static Standard_Integer evalbatch (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n != 3)
+  {
+    Message::SendFail() << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbPoints = Draw::Atoi (a[2]);
+  if (aNbPoints < 1)
+  {
+    Message::SendFail() << "Syntax error: wrong number of points";
+    return 1;
+  }
+
+  // the parameters are spread over the whole domain in the order mixing the knot spans
+  Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (a[1]);
+  Handle(Geom_Curve) aCurve = aSurf.IsNull() ? DrawTrSurf::GetCurve (a[1]) : Handle(Geom_Curve)();
+  if (aSurf.IsNull() && aCurve.IsNull())
+  {
+    Message::SendFail() << "Syntax error: " << a[1] << " is not a curve or a surface";
+    return 1;
+  }
+
+  Standard_Real aMaxDev = 0.0, aMaxDerDev = 0.0;
+  OSD_Timer aBatchTimer, aScalarTimer;
+  TColStd_Array1OfReal aU (1, aNbPoints), aV (1, aNbPoints);
+  TColStd_Array1OfReal aPnts (1, 3 * aNbPoints), aD1U (1, 3 * aNbPoints), aD1V (1, 3 * aNbPoints);
+  gp_Pnt aP;
+  gp_Vec aDU, aDV;
+  if (!aSurf.IsNull())
+  {
+    GeomAdaptor_Surface anAdaptor (aSurf);
+    if (Precision::IsInfinite (anAdaptor.FirstUParameter()) || Precision::IsInfinite (anAdaptor.LastUParameter())
+     || Precision::IsInfinite (anAdaptor.FirstVParameter()) || Precision::IsInfinite (anAdaptor.LastVParameter()))
+    {
+      Message::SendFail() << "Error: the surface is infinite";
+      return 1;
+    }
+    for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+    {
+      const Standard_Real aFracU = i * 0.6180339887498949 - Floor (i * 0.6180339887498949);
+      const Standard_Real aFracV = i * 0.7548776662466927 - Floor (i * 0.7548776662466927);
+      aU (i) = anAdaptor.FirstUParameter() + aFracU * (anAdaptor.LastUParameter() - anAdaptor.FirstUParameter());
+      aV (i) = anAdaptor.FirstVParameter() + aFracV * (anAdaptor.LastVParameter() - anAdaptor.FirstVParameter());
+    }
+
+    aBatchTimer.Start();
+    anAdaptor.D1Batch (aU, aV, aPnts, aD1U, aD1V);
+    aBatchTimer.Stop();
+
+    aScalarTimer.Start();
+    for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+    {
+      anAdaptor.D1 (aU (i), aV (i), aP, aDU, aDV);
+    }
+    aScalarTimer.Stop();
+
+    for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+    {
+      anAdaptor.D1 (aU (i), aV (i), aP, aDU, aDV);
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        aMaxDev = Max (aMaxDev, Abs (aPnts (j * aNbPoints + i) - aP.Coord (j + 1)));
+        aMaxDerDev = Max (aMaxDerDev, Abs (aD1U (j * aNbPoints + i) - aDU.Coord (j + 1)) / Max (1.0, aDU.Magnitude()));
+        aMaxDerDev = Max (aMaxDerDev, Abs (aD1V (j * aNbPoints + i) - aDV.Coord (j + 1)) / Max (1.0, aDV.Magnitude()));
+      }
+    }
+  }
+  else
+  {
+    GeomAdaptor_Curve anAdaptor (aCurve);
+    if (Precision::IsInfinite (anAdaptor.FirstParameter()) || Precision::IsInfinite (anAdaptor.LastParameter()))
+    {
+      Message::SendFail() << "Error: the curve is infinite";
+      return 1;
+    }
+    for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+    {
+      const Standard_Real aFracU = i * 0.6180339887498949 - Floor (i * 0.6180339887498949);
+      aU (i) = anAdaptor.FirstParameter() + aFracU * (anAdaptor.LastParameter() - anAdaptor.FirstParameter());
+    }
+
+    aBatchTimer.Start();
+    anAdaptor.D1Batch (aU, aPnts, aD1U);
+    aBatchTimer.Stop();
+
+    aScalarTimer.Start();
+    for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+    {
+      anAdaptor.D1 (aU (i), aP, aDU);
+    }
+    aScalarTimer.Stop();
+
+    for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+    {
+      anAdaptor.D1 (aU (i), aP, aDU);
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        aMaxDev = Max (aMaxDev, Abs (aPnts (j * aNbPoints + i) - aP.Coord (j + 1)));
+        aMaxDerDev = Max (aMaxDerDev, Abs (aD1U (j * aNbPoints + i) - aDU.Coord (j + 1)) / Max (1.0, aDU.Magnitude()));
+      }
+    }
+  }
+
+  di << "Max deviation of points: " << aMaxDev << "\n";
+  di << "Max relative deviation of derivatives: " << aMaxDerDev << "\n";
+  di << "Batch evaluation: " << aBatchTimer.ElapsedTime() << " s\n";
+  di << "Scalar evaluation: " << aScalarTimer.ElapsedTime() << " s\n";
+  return 0;
+}
+
+namespace
+{
+  //! Evaluates the points and first derivatives at the chunks of parameters,
+  //! each chunk by its own shallow copy of the surface or curve adaptor.
+  class EvalSpansFunctor
+  {
+  public:
+    EvalSpansFunctor (const Handle(Adaptor3d_Surface)& theSurf,
+                      const Handle(Adaptor3d_Curve)& theCurve,
+                      const TColStd_Array1OfReal& theU,
+                      const TColStd_Array1OfReal& theV,
+                      TColgp_Array1OfPnt& thePnts,
+                      TColgp_Array1OfVec& theD1,
+                      const Standard_Integer theNbChunks)
+    : mySurf (theSurf), myCurve (theCurve), myU (theU), myV (theV),
+      myPnts (thePnts), myD1 (theD1), myNbChunks (theNbChunks) {}
+
+    void operator() (const Standard_Integer theChunk) const
+    {
+      const Standard_Integer aNbPoints = myU.Length();
+      const Standard_Integer aLower = myU.Lower() + aNbPoints * theChunk / myNbChunks;
+      const Standard_Integer anUpper = myU.Lower() + aNbPoints * (theChunk + 1) / myNbChunks - 1;
+      gp_Vec aD1V;
+      if (!mySurf.IsNull())
+      {
+        Handle(Adaptor3d_Surface) aCopy = mySurf->ShallowCopy();
+        for (Standard_Integer i = aLower; i <= anUpper; ++i)
+        {
+          aCopy->D1 (myU (i), myV (i), myPnts (i), myD1 (i), aD1V);
+        }
+      }
+      else
+      {
+        Handle(Adaptor3d_Curve) aCopy = myCurve->ShallowCopy();
+        for (Standard_Integer i = aLower; i <= anUpper; ++i)
+        {
+          aCopy->D1 (myU (i), myPnts (i), myD1 (i));
+        }
+      }
+    }
+
+  private:
+    Handle(Adaptor3d_Surface) mySurf;
+    Handle(Adaptor3d_Curve) myCurve;
+    const TColStd_Array1OfReal& myU;
+    const TColStd_Array1OfReal& myV;
+    TColgp_Array1OfPnt& myPnts;
+    TColgp_Array1OfVec& myD1;
+    Standard_Integer myNbChunks;
+  };
+}
+
+//=======================================================================
+//function : evalspans
+//purpose  : evaluates B-spline in parallel by the adaptors sharing the table of caches of spans
+//=======================================================================
+static Standard_Integer evalspans (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n != 3 && n != 5)
+  {
+    Message::SendFail() << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbPoints = Draw::Atoi (a[2]);
+  if (aNbPoints < 1)
+  {
+    Message::SendFail() << "Syntax error: wrong number of points";
+    return 1;
+  }
+  Standard_Size aMaxMemory = 16 * 1024 * 1024;
+  if (n == 5)
+  {
+    TCollection_AsciiString aFlag (a[3]);
+    aFlag.LowerCase();
+    if (aFlag != "-memory" || Draw::Atoi (a[4]) < 0)
+    {
+      Message::SendFail() << "Syntax error at '" << a[3] << "'";
+      return 1;
+    }
+    aMaxMemory = (Standard_Size )Draw::Atoi (a[4]);
+  }
+
+  Handle(Geom_BSplineSurface) aSurf = Handle(Geom_BSplineSurface)::DownCast (DrawTrSurf::GetSurface (a[1]));
+  Handle(Geom_BSplineCurve) aCurve = aSurf.IsNull() ? Handle(Geom_BSplineCurve)::DownCast (DrawTrSurf::GetCurve (a[1]))
+                                                    : Handle(Geom_BSplineCurve)();
+  if (aSurf.IsNull() && aCurve.IsNull())
+  {
+    Message::SendFail() << "Syntax error: " << a[1] << " is not a B-spline curve or surface";
+    return 1;
+  }
+
+  // the parameters are spread over the whole domain in the order mixing the knot spans
+  TColStd_Array1OfReal aU (1, aNbPoints), aV (1, aNbPoints);
+  Handle(GeomAdaptor_Surface) aSurfAdaptor;
+  Handle(GeomAdaptor_Curve) aCurveAdaptor;
+  Standard_Real aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+  if (!aSurf.IsNull())
+  {
+    aSurfAdaptor = new GeomAdaptor_Surface (aSurf);
+    aSurf->Bounds (aUMin, aUMax, aVMin, aVMax);
+  }
+  else
+  {
+    aCurveAdaptor = new GeomAdaptor_Curve (aCurve);
+    aUMin = aCurve->FirstParameter();
+    aUMax = aCurve->LastParameter();
+  }
+  for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+  {
+    const Standard_Real aFracU = i * 0.6180339887498949 - Floor (i * 0.6180339887498949);
+    const Standard_Real aFracV = i * 0.7548776662466927 - Floor (i * 0.7548776662466927);
+    aU (i) = aUMin + aFracU * (aUMax - aUMin);
+    aV (i) = aVMin + aFracV * (aVMax - aVMin);
+  }
+
+  // evaluation by the copies having their own caches
+  const Standard_Integer aNbChunks = 4 * Max (1, OSD_Parallel::NbLogicalProcessors());
+  TColgp_Array1OfPnt aPnts (1, aNbPoints), aRefPnts (1, aNbPoints);
+  TColgp_Array1OfVec aD1 (1, aNbPoints), aRefD1 (1, aNbPoints);
+  OSD_Timer anOwnTimer, aSharedTimer;
+  anOwnTimer.Start();
+  OSD_Parallel::For (0, aNbChunks, EvalSpansFunctor (aSurfAdaptor, aCurveAdaptor, aU, aV, aRefPnts, aRefD1, aNbChunks));
+  anOwnTimer.Stop();
+
+  // evaluation by the copies sharing the table of caches
+  aSharedTimer.Start();
+  Standard_Integer aNbSpans = 0, aNbCachedSpans = 0;
+  if (!aSurfAdaptor.IsNull())
+  {
+    aSurfAdaptor->CreateSpanCache (aMaxMemory);
+  }
+  else
+  {
+    aCurveAdaptor->CreateSpanCache (aMaxMemory);
+  }
+  OSD_Parallel::For (0, aNbChunks, EvalSpansFunctor (aSurfAdaptor, aCurveAdaptor, aU, aV, aPnts, aD1, aNbChunks));
+  aSharedTimer.Stop();
+  if (!aSurfAdaptor.IsNull())
+  {
+    aNbSpans = aSurfAdaptor->SpanCache()->NbSpans();
+    aNbCachedSpans = aSurfAdaptor->SpanCache()->NbCachedSpans();
+  }
+  else
+  {
+    aNbSpans = aCurveAdaptor->SpanCache()->NbSpans();
+    aNbCachedSpans = aCurveAdaptor->SpanCache()->NbCachedSpans();
+  }
+
+  Standard_Real aMaxDev = 0.0;
+  for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+  {
+    aMaxDev = Max (aMaxDev, aPnts (i).Distance (aRefPnts (i)));
+    aMaxDev = Max (aMaxDev, (aD1 (i) - aRefD1 (i)).Magnitude());
+  }
+
+  di << "Max deviation: " << aMaxDev << "\n";
+  di << "Cached spans: " << aNbCachedSpans << " of " << aNbSpans << "\n";
+  di << "Own caches: " << anOwnTimer.ElapsedTime() << " s\n";
+  di << "Shared table: " << aSharedTimer.ElapsedTime() << " s\n";
+  return 0;
+}
+
+//=======================================================================
+//function : projpoints
+//purpose  : projects the points near the surface by Extrema_SurfaceProjector
+//=======================================================================
+
+static Standard_Integer projpoints (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 3)
+  {
+    di.PrintHelp (a[0]);
+    return 1;
+  }
+
+  Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (a[1]);
+  if (aSurf.IsNull())
+  {
+    di << "Error: " << a[1] << " is not a surface\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbPoints = Draw::Atoi (a[2]);
+  Standard_Real aDeviation = 0.0;
+  Standard_Boolean toCompare = Standard_False;
+  for (Standard_Integer i = 3; i < n; ++i)
+  {
+    TCollection_AsciiString anArg (a[i]);
+    anArg.LowerCase();
+    if (anArg == "-dev" && i + 1 < n)
+    {
+      aDeviation = Draw::Atof (a[++i]);
+    }
+    else if (anArg == "-compare")
+    {
+      toCompare = Standard_True;
+    }
+    else
+    {
+      di << "Error: unknown option " << a[i] << "\n";
+      return 1;
+    }
+  }
+
+  Standard_Real aU1, aU2, aV1, aV2;
+  aSurf->Bounds (aU1, aU2, aV1, aV2);
+  if (aNbPoints < 1
+   || Precision::IsInfinite (aU1) || Precision::IsInfinite (aU2)
+   || Precision::IsInfinite (aV1) || Precision::IsInfinite (aV2))
+  {
+    di << "Error: the surface should be bounded and the number of points should be positive\n";
+    return 1;
+  }
+
+  // the points along the closed path on the surface moved by the random deviations
+  math_BullardGenerator aRandom;
+  TColgp_Array1OfPnt aPoints (1, aNbPoints);
+  for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+  {
+    const Standard_Real aT = 2.0 * M_PI * i / aNbPoints;
+    const gp_Pnt aP = aSurf->Value (aU1 + (aU2 - aU1) * (0.5 + 0.45 * Sin (7.0 * aT)),
+                                    aV1 + (aV2 - aV1) * (0.5 + 0.45 * Cos (5.0 * aT)));
+    const gp_XYZ aDev (aRandom.NextReal() - 0.5, aRandom.NextReal() - 0.5, aRandom.NextReal() - 0.5);
+    aPoints (i) = aP.XYZ() + aDev * (2.0 * aDeviation);
+  }
+
+  GeomAdaptor_Surface aGAS (aSurf, aU1, aU2, aV1, aV2);
+  TColgp_Array1OfPnt2d aParams (1, aNbPoints);
+  TColStd_Array1OfReal aDistances (1, aNbPoints);
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+  Extrema_SurfaceProjector aProjector (aGAS, aU1, aU2, aV1, aV2);
+  aProjector.Perform (aPoints, aParams, aDistances);
+  aTimer.Stop();
+  const Standard_Real aTime = aTimer.ElapsedTime();
+
+  di << "Projector: " << aProjector.NbPatches() << " patches, "
+     << Standard_Real (aProjector.NbRuns()) / aNbPoints << " Newton runs per point, "
+     << aTime << " s\n";
+
+  if (!toCompare)
+  {
+    return 0;
+  }
+
+  aTimer.Reset();
+  aTimer.Start();
+  Extrema_GenExtPS anExtPS;
+  anExtPS.Initialize (aGAS, 32, 32, aU1, aU2, aV1, aV2, Precision::PConfusion(), Precision::PConfusion());
+  anExtPS.SetFlag (Extrema_ExtFlag_MIN);
+  TColStd_Array1OfReal anExtDistances (1, aNbPoints);
+  for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+  {
+    anExtPS.Perform (aPoints (i));
+    Standard_Real aSqDist = RealLast();
+    for (Standard_Integer j = 1; anExtPS.IsDone() && j <= anExtPS.NbExt(); ++j)
+    {
+      aSqDist = Min (aSqDist, anExtPS.SquareDistance (j));
+    }
+    anExtDistances (i) = Sqrt (aSqDist);
+  }
+  aTimer.Stop();
+  const Standard_Real anExtTime = aTimer.ElapsedTime();
+
+  // the projector gives the nearest point of the bounded surface, which may be closer
+  // than the extrema found by Extrema_GenExtPS in the interior of the surface
+  Standard_Integer aNbFarther = 0;
+  Standard_Real aMaxDiff = 0.0;
+  for (Standard_Integer i = 1; i <= aNbPoints; ++i)
+  {
+    const Standard_Real aDiff = aDistances (i) - anExtDistances (i);
+    if (aDiff > Precision::Confusion())
+    {
+      ++aNbFarther;
+      aMaxDiff = Max (aMaxDiff, aDiff);
+    }
+  }
+
+  di << "Extrema_GenExtPS: " << anExtTime << " s\n";
+  di << "Speedup: " << (aTime > 0.0 ? anExtTime / aTime : 0.0) << "\n";
+  di << "Nb farther points: " << aNbFarther << " (max difference " << aMaxDiff << ")\n";
+  return 0;
+}
+
 //=======================================================================
 //function : SurfaceCommands
 //purpose  : 
@@ -1999,6 +2410,26 @@ void  GeomliteTest::SurfaceCommands(Draw_Interpretor& theCommands)
                   __FILE__,
 		  surface_radius,g);
   theCommands.Add("compBsplSur","BsplSurf1 BSplSurf2",__FILE__,compBsplSur,g);
+  theCommands.Add("evalbatch",
+                  "evalbatch surf/curve nbpoints : compares the batch evaluation of points and first derivatives"
+                  "\n\t\twith the evaluation point by point, prints the deviations and the time",
+                  __FILE__,
+                  evalbatch,g);
+
+  theCommands.Add("evalspans",
+                  "evalspans bspline nbpoints [-memory bytes] : evaluates the B-spline surface or curve in parallel"
+                  "\n\t\tby the adaptors sharing the table of caches of spans, compares the result"
+                  "\n\t\twith the adaptors having their own caches, prints the deviation and the time",
+                  __FILE__,
+                  evalspans,g);
+
+  theCommands.Add("projpoints",
+                  "projpoints surf nbpoints [-dev d] [-compare] : projects the points distributed near the bounded surface"
+                  "\n\t\t(moved from it by the random vectors with coordinates within [-d, d]) by Extrema_SurfaceProjector"
+                  "\n\t\tand prints the time; -compare also projects the points by Extrema_GenExtPS"
+                  "\n\t\tand prints the number of points projected farther by the projector",
+                  __FILE__,
+                  projpoints,g);
   
   
 }
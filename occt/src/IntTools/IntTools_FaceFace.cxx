@@ -15,6 +15,7 @@
 
 #include <IntTools_FaceFace.hxx>
 
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepTools.hxx>
 #include <BRep_Tool.hxx>
 #include <ElCLib.hxx>
@@ -25,6 +26,7 @@
 #include <Geom2d_Line.hxx>
 #include <Geom2d_TrimmedCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <GeomAdaptor_Curve.hxx>
 #include <GeomAdaptor_Surface.hxx>
 #include <GeomInt_IntSS.hxx>
 #include <GeomInt_WLApprox.hxx>
@@ -39,6 +41,8 @@
 #include <Geom_Parabola.hxx>
 #include <Geom_RectangularTrimmedSurface.hxx>
 #include <Geom_TrimmedCurve.hxx>
+#include <IntAna2d_AnaIntersection.hxx>
+#include <IntAna2d_IntPoint.hxx>
 #include <IntAna_QuadQuadGeo.hxx>
 #include <IntPatch_GLine.hxx>
 #include <IntPatch_RLine.hxx>
@@ -48,11 +52,14 @@
 #include <IntTools_Tools.hxx>
 #include <IntTools_TopolTool.hxx>
 #include <IntTools_WLineTool.hxx>
+#include <ProjLib_Cylinder.hxx>
 #include <ProjLib_Plane.hxx>
+#include <TColStd_SequenceOfReal.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <gp_Elips.hxx>
+#include <gp_Vec2d.hxx>
 #include <ApproxInt_KnotTools.hxx>
 
 static 
@@ -156,6 +163,16 @@ static
                               Standard_Real& aVmin, 
                               Standard_Real& aVmax);
 
+static
+  Standard_Boolean ClipByFaces(const Handle(Geom_Curve)& theC3D,
+                               const Standard_Real theT1,
+                               const Standard_Real theT2,
+                               const TopoDS_Face& theF1,
+                               const TopoDS_Face& theF2,
+                               const Standard_Real theTol,
+                               const Handle(IntTools_Context)& theContext,
+                               TColStd_SequenceOfReal& theParts);
+
 //=======================================================================
 //function : 
 //purpose  : 
@@ -171,6 +188,7 @@ IntTools_FaceFace::IntTools_FaceFace()
   myTolF2 = 0.;
   myTol = 0.;
   myFuzzyValue = Precision::Confusion();
+  myFastPlanar = Standard_True;
   SetParameters(Standard_True, Standard_True, Standard_True, 1.e-07);
 }
 //=======================================================================
@@ -271,6 +289,22 @@ Standard_Real IntTools_FaceFace::FuzzyValue() const
   return myFuzzyValue;
 }
 
+//=======================================================================
+//function : SetFastPlanar
+//purpose  : 
+//=======================================================================
+void IntTools_FaceFace::SetFastPlanar(const Standard_Boolean theFastPlanar)
+{
+  myFastPlanar = theFastPlanar;
+}
+//=======================================================================
+//function : FastPlanar
+//purpose  : 
+//=======================================================================
+Standard_Boolean IntTools_FaceFace::FastPlanar() const
+{
+  return myFastPlanar;
+}
 //=======================================================================
 //function : SetList
 //purpose  : 
@@ -440,6 +474,19 @@ void IntTools_FaceFace::Perform (const TopoDS_Face& aF1,
     //
     myIsDone = Standard_True;
     //
+    if (myFastPlanar && !myTangentFaces && mySeqOfCurve.Length() == 1) {
+      // Check that the line really passes through both faces
+      Handle(Geom_TrimmedCurve) aTC =
+        Handle(Geom_TrimmedCurve)::DownCast(mySeqOfCurve(1).Curve());
+      TColStd_SequenceOfReal aParts;
+      if (!aTC.IsNull() &&
+          ClipByFaces(aTC->BasisCurve(), aTC->FirstParameter(), aTC->LastParameter(),
+                      myFace1, myFace2, myTol, myContext, aParts) &&
+          aParts.IsEmpty()) {
+        mySeqOfCurve.Clear();
+      }
+    }
+    //
     if (!myTangentFaces) {
       const Standard_Integer NbLinPP = mySeqOfCurve.Length();
       if (NbLinPP && bReverse) {
@@ -492,6 +539,29 @@ void IntTools_FaceFace::Perform (const TopoDS_Face& aF1,
     myHS2->Load(S2, umin, umax, vmin, vmax);
   }
 
+  if (myFastPlanar &&
+      aType1 == GeomAbs_Cylinder && aType2 == GeomAbs_Plane &&
+      !aF1.IsSame(aF2) && PerformPlaneCylinder())
+  {
+    myIsDone = Standard_True;
+    ComputeTolReached3d (theToRunParallel);
+    //
+    if (bReverse) {
+      Handle(Geom2d_Curve) aC2D1, aC2D2;
+      //
+      const Standard_Integer aNbLin = mySeqOfCurve.Length();
+      for (Standard_Integer i = 1; i <= aNbLin; ++i)
+      {
+        IntTools_Curve& aIC = mySeqOfCurve(i);
+        aC2D1 = aIC.FirstCurve2d();
+        aC2D2 = aIC.SecondCurve2d();
+        aIC.SetFirstCurve2d(aC2D2);
+        aIC.SetSecondCurve2d(aC2D1);
+      }
+    }
+    return;
+  }
+
   const Handle(IntTools_TopolTool) dom1 = new IntTools_TopolTool(myHS1);
   const Handle(IntTools_TopolTool) dom2 = new IntTools_TopolTool(myHS2);
 
@@ -698,6 +768,117 @@ void IntTools_FaceFace::ComputeTolReached3d (const Standard_Boolean theToRunPara
   }
 }
 
+//=======================================================================
+//function : PerformPlaneCylinder
+//purpose  : 
+//=======================================================================
+Standard_Boolean IntTools_FaceFace::PerformPlaneCylinder()
+{
+  const Standard_Real aTolAng = 1.e-8;
+  //
+  const gp_Cylinder aCyl = myHS1->Cylinder();
+  const gp_Pln aPln = myHS2->Plane();
+  //
+  const gp_Ax3& aPosC = aCyl.Position();
+  const gp_Pnt& aPC = aPosC.Location();
+  const gp_Dir& aDA = aPosC.Direction();
+  const gp_Dir& aDN = aPln.Axis().Direction();
+  const Standard_Real aR = aCyl.Radius();
+  //
+  Handle(Geom_Curve) aCurves[2];
+  Standard_Integer i, aNbC = 0;
+  Standard_Real aT1, aT2;
+  //
+  if (aDA.IsParallel(aDN, aTolAng)) {
+    // The axis is normal to the plane - the circle with
+    // the parametrization of the cylinder in U direction
+    const Standard_Real aV = gp_Vec(aPC, aPln.Location()).Dot(aDN) / aDA.Dot(aDN);
+    const gp_Pnt aCenter = aPC.Translated(gp_Vec(aDA) * aV);
+    const gp_Ax2 anAx2(aCenter,
+                       aPosC.XDirection().Crossed(aPosC.YDirection()),
+                       aPosC.XDirection());
+    aCurves[aNbC++] = new Geom_Circle(anAx2, aR);
+    aT1 = 0.;
+    aT2 = M_PI + M_PI;
+  }
+  else if (aDA.IsNormal(aDN, aTolAng)) {
+    // The axis is parallel to the plane - two lines along the axis
+    const Standard_Real aD = gp_Vec(aPln.Location(), aPC).Dot(aDN);
+    if (Abs(aD) > aR + myTol) {
+      return Standard_True;
+    }
+    if (Abs(Abs(aD) - aR) <= myTol) {
+      // tangent case
+      return Standard_False;
+    }
+    //
+    Standard_Real aUMin, aUMax, aVMin, aVMax;
+    myContext->UVBounds(myFace1, aUMin, aUMax, aVMin, aVMax);
+    if (Precision::IsInfinite(aVMin) || Precision::IsInfinite(aVMax)) {
+      return Standard_False;
+    }
+    //
+    // The lines are parametrized as the cylinder in V direction
+    const gp_Pnt aPF = aPC.Translated(gp_Vec(aDN) * (-aD));
+    const gp_Vec aVW = gp_Vec(aDA.Crossed(aDN)) * Sqrt(aR * aR - aD * aD);
+    aCurves[aNbC++] = new Geom_Line(aPF.Translated(aVW), aDA);
+    aCurves[aNbC++] = new Geom_Line(aPF.Translated(-aVW), aDA);
+    //
+    const Standard_Real aDV = 0.1 * (aVMax - aVMin) + myTol;
+    aT1 = aVMin - aDV;
+    aT2 = aVMax + aDV;
+  }
+  else {
+    // ellipse
+    return Standard_False;
+  }
+  //
+  IntTools_SequenceOfCurves aSeqOfCurve;
+  for (i = 0; i < aNbC; ++i) {
+    const Handle(Geom_Curve)& aC3D = aCurves[i];
+    //
+    TColStd_SequenceOfReal aParts;
+    if (!ClipByFaces(aC3D, aT1, aT2, myFace1, myFace2, myTol, myContext, aParts)) {
+      return Standard_False;
+    }
+    //
+    const Standard_Boolean bLine = (aC3D->DynamicType() == STANDARD_TYPE(Geom_Line));
+    const Standard_Integer aNbParts = aParts.Length();
+    for (Standard_Integer j = 1; j < aNbParts; j += 2) {
+      const Standard_Real aTF = aParts(j), aTL = aParts(j + 1);
+      //
+      IntTools_Curve aCurve;
+      aCurve.SetCurve(new Geom_TrimmedCurve(aC3D, aTF, aTL));
+      //
+      for (Standard_Integer k = 0; k < 2; ++k) {
+        if (!(k ? myApprox2 : myApprox1)) {
+          continue;
+        }
+        Standard_Real aTolPC = myTolApprox;
+        Handle(Geom2d_Curve) aC2D;
+        GeomInt_IntSS::BuildPCurves(aTF, aTL, aTolPC,
+                                    (k ? myHS2 : myHS1)->Surface(), aC3D, aC2D);
+        if (aC2D.IsNull()) {
+          return Standard_False;
+        }
+        if (bLine) {
+          aC2D = new Geom2d_TrimmedCurve(aC2D, aTF, aTL);
+        }
+        if (k) {
+          aCurve.SetSecondCurve2d(aC2D);
+        }
+        else {
+          aCurve.SetFirstCurve2d(aC2D);
+        }
+      }
+      aSeqOfCurve.Append(aCurve);
+    }
+  }
+  //
+  mySeqOfCurve.Append(aSeqOfCurve);
+  return Standard_True;
+}
+
 //=======================================================================
 //function : MakeCurve
 //purpose  : 
@@ -2816,3 +2997,264 @@ Standard_Real MaxDistance(const Handle(Geom_Curve)& theC,
     aVmax=aVmax+dV;
   }
 }
+
+//=======================================================================
+//function : ClipByFace
+//purpose  : Computes the parts of the line or circle lying inside
+//           the face bounded by lines and circles in 2D.
+//           Returns FALSE if the parts cannot be computed exactly.
+//=======================================================================
+static Standard_Boolean ClipByFace(const Handle(Geom_Curve)& theC3D,
+                                   const Standard_Real theT1,
+                                   const Standard_Real theT2,
+                                   const TopoDS_Face& theF,
+                                   const Standard_Real theTol,
+                                   const Standard_Real theTolT,
+                                   const Handle(IntTools_Context)& theContext,
+                                   TColStd_SequenceOfReal& theParts)
+{
+  const BRepAdaptor_Surface& aBAS = theContext->SurfaceAdaptor(theF);
+  const GeomAdaptor_Curve aGAC(theC3D);
+  const GeomAbs_CurveType aTypeC = aGAC.GetType();
+  const Standard_Boolean bCPeriodic = (aTypeC == GeomAbs_Circle);
+  //
+  // Project the curve on the surface keeping its parametrization
+  ProjLib_Plane aProjPln;
+  ProjLib_Cylinder aProjCyl;
+  ProjLib_Projector* pProj = NULL;
+  if (aBAS.GetType() == GeomAbs_Plane) {
+    aProjPln.Init(aBAS.Plane());
+    pProj = &aProjPln;
+  }
+  else if (aBAS.GetType() == GeomAbs_Cylinder) {
+    aProjCyl.Init(aBAS.Cylinder());
+    pProj = &aProjCyl;
+  }
+  else {
+    return Standard_False;
+  }
+  //
+  if (aTypeC == GeomAbs_Line) {
+    pProj->Project(aGAC.Line());
+  }
+  else if (aTypeC == GeomAbs_Circle) {
+    pProj->Project(aGAC.Circle());
+  }
+  else {
+    return Standard_False;
+  }
+  //
+  if (!pProj->IsDone()) {
+    return Standard_False;
+  }
+  const GeomAbs_CurveType aType2D = pProj->GetType();
+  if (aType2D != GeomAbs_Line && aType2D != GeomAbs_Circle) {
+    return Standard_False;
+  }
+  gp_Lin2d aLin2D;
+  gp_Circ2d aCirc2D;
+  if (aType2D == GeomAbs_Line) {
+    aLin2D = pProj->Line();
+  }
+  else {
+    aCirc2D = pProj->Circle();
+  }
+  //
+  Standard_Real aUMin, aUMax, aVMin, aVMax;
+  theContext->UVBounds(theF, aUMin, aUMax, aVMin, aVMax);
+  //
+  const Standard_Boolean bUPeriodic = aBAS.IsUPeriodic();
+  const Standard_Real aUPeriod = bUPeriodic ? aBAS.UPeriod() : 0.;
+  if (bUPeriodic) {
+    // Only the lines along the parametric directions are allowed
+    if (aType2D != GeomAbs_Line) {
+      return Standard_False;
+    }
+    const gp_Dir2d& aD2D = aLin2D.Direction();
+    if (Abs(aD2D.X()) <= Precision::Angular()) {
+      // move the line into the domain of the face
+      const Standard_Real aU0 = aLin2D.Location().X();
+      const Standard_Real aU = ElCLib::InPeriod(aU0, aUMin, aUMin + aUPeriod);
+      aLin2D.Translate(gp_Vec2d(aU - aU0, 0.));
+    }
+    else if (Abs(aD2D.Y()) > Precision::Angular()) {
+      return Standard_False;
+    }
+  }
+  //
+  const Standard_Real aTol2D = Max(aBAS.UResolution(theTol), aBAS.VResolution(theTol));
+  //
+  // Parameters of the intersection points of the curve with the boundary
+  TColStd_SequenceOfReal aParams;
+  //
+  TopExp_Explorer aExp(theF, TopAbs_EDGE);
+  for (; aExp.More(); aExp.Next()) {
+    const TopoDS_Edge& aE = TopoDS::Edge(aExp.Current());
+    if (BRep_Tool::Degenerated(aE)) {
+      continue;
+    }
+    //
+    Standard_Real aTF, aTL;
+    const Handle(Geom2d_Curve) aPC = BRep_Tool::CurveOnSurface(aE, theF, aTF, aTL);
+    if (aPC.IsNull()) {
+      return Standard_False;
+    }
+    //
+    const Geom2dAdaptor_Curve aGAE(aPC, aTF, aTL);
+    const GeomAbs_CurveType aTypeE = aGAE.GetType();
+    //
+    IntAna2d_AnaIntersection anInter;
+    Standard_Real aTolE = aTol2D;
+    if (aTypeE == GeomAbs_Line) {
+      const gp_Lin2d aLinE = aGAE.Line();
+      if (aType2D == GeomAbs_Line) {
+        anInter.Perform(aLin2D, aLinE);
+        if (anInter.IsDone() && anInter.ParallelElements() &&
+            aLin2D.Distance(aLinE.Location()) <= aTol2D) {
+          return Standard_False;
+        }
+      }
+      else {
+        if (Abs(aLinE.Distance(aCirc2D.Location()) - aCirc2D.Radius()) <= aTol2D) {
+          return Standard_False;
+        }
+        anInter.Perform(aLinE, aCirc2D);
+      }
+    }
+    else if (aTypeE == GeomAbs_Circle) {
+      const gp_Circ2d aCircE = aGAE.Circle();
+      aTolE = aTol2D / aCircE.Radius();
+      if (aType2D == GeomAbs_Line) {
+        if (Abs(aLin2D.Distance(aCircE.Location()) - aCircE.Radius()) <= aTol2D) {
+          return Standard_False;
+        }
+        anInter.Perform(aLin2D, aCircE);
+      }
+      else {
+        const Standard_Real aD = aCirc2D.Location().Distance(aCircE.Location());
+        if (Abs(aD - (aCirc2D.Radius() + aCircE.Radius())) <= aTol2D ||
+            Abs(aD - Abs(aCirc2D.Radius() - aCircE.Radius())) <= aTol2D) {
+          return Standard_False;
+        }
+        anInter.Perform(aCirc2D, aCircE);
+      }
+    }
+    else {
+      return Standard_False;
+    }
+    //
+    if (!anInter.IsDone() || anInter.IdenticalElements()) {
+      return Standard_False;
+    }
+    //
+    const Standard_Integer aNbP = anInter.NbPoints();
+    for (Standard_Integer i = 1; i <= aNbP; ++i) {
+      const gp_Pnt2d aP2D = anInter.Point(i).Value();
+      //
+      // check that the point is on the edge
+      if (aTypeE == GeomAbs_Line) {
+        const Standard_Real aT = ElCLib::Parameter(aGAE.Line(), aP2D);
+        if (aT < aTF - aTolE || aT > aTL + aTolE) {
+          continue;
+        }
+      }
+      else {
+        const Standard_Real aT = ElCLib::InPeriod(ElCLib::Parameter(aGAE.Circle(), aP2D),
+                                                  aTF, aTF + M_PI + M_PI);
+        if (aT > aTL + aTolE && aT - (M_PI + M_PI) < aTF - aTolE) {
+          continue;
+        }
+      }
+      //
+      Standard_Real aT = (aType2D == GeomAbs_Line) ?
+        ElCLib::Parameter(aLin2D, aP2D) : ElCLib::Parameter(aCirc2D, aP2D);
+      if (bCPeriodic) {
+        aT = ElCLib::InPeriod(aT, theT1, theT1 + M_PI + M_PI);
+      }
+      if (aT <= theT1 || aT >= theT2) {
+        continue;
+      }
+      //
+      // keep the parameters sorted
+      Standard_Integer j = aParams.Length();
+      for (; j > 0 && aParams(j) > aT; --j) {}
+      aParams.InsertAfter(j, aT);
+    }
+  }
+  //
+  // Classify the parts of the curve between the intersection points
+  Standard_Real aTPrev = theT1;
+  const Standard_Integer aNbParams = aParams.Length();
+  for (Standard_Integer i = 1; i <= aNbParams + 1; ++i) {
+    const Standard_Real aT = (i <= aNbParams) ? aParams(i) : theT2;
+    if (aT - aTPrev > theTolT) {
+      const Standard_Real aTm = 0.5 * (aTPrev + aT);
+      gp_Pnt2d aP2D = (aType2D == GeomAbs_Line) ?
+        ElCLib::Value(aTm, aLin2D) : ElCLib::Value(aTm, aCirc2D);
+      if (bUPeriodic) {
+        aP2D.SetX(ElCLib::InPeriod(aP2D.X(), aUMin, aUMin + aUPeriod));
+      }
+      //
+      const TopAbs_State aState = theContext->StatePointFace(theF, aP2D);
+      if (aState == TopAbs_ON) {
+        // the curve passes along the boundary
+        return Standard_False;
+      }
+      if (aState == TopAbs_IN) {
+        const Standard_Integer aNbParts = theParts.Length();
+        if (aNbParts && (aTPrev - theParts(aNbParts)) <= theTolT) {
+          theParts(aNbParts) = aT;
+        }
+        else {
+          theParts.Append(aTPrev);
+          theParts.Append(aT);
+        }
+      }
+    }
+    aTPrev = aT;
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : ClipByFaces
+//purpose  : Computes the parts of the line or circle lying inside
+//           both faces. Returns FALSE if the parts cannot be computed
+//           exactly.
+//=======================================================================
+Standard_Boolean ClipByFaces(const Handle(Geom_Curve)& theC3D,
+                             const Standard_Real theT1,
+                             const Standard_Real theT2,
+                             const TopoDS_Face& theF1,
+                             const TopoDS_Face& theF2,
+                             const Standard_Real theTol,
+                             const Handle(IntTools_Context)& theContext,
+                             TColStd_SequenceOfReal& theParts)
+{
+  Handle(Geom_Circle) aCirc = Handle(Geom_Circle)::DownCast(theC3D);
+  const Standard_Real aTolT = aCirc.IsNull() ? theTol : theTol / aCirc->Radius();
+  //
+  TColStd_SequenceOfReal aParts1, aParts2;
+  if (!ClipByFace(theC3D, theT1, theT2, theF1, theTol, aTolT, theContext, aParts1) ||
+      !ClipByFace(theC3D, theT1, theT2, theF2, theTol, aTolT, theContext, aParts2)) {
+    return Standard_False;
+  }
+  //
+  // Common parts
+  Standard_Integer i = 1, j = 1;
+  while (i < aParts1.Length() && j < aParts2.Length()) {
+    const Standard_Real aTF = Max(aParts1(i), aParts2(j));
+    const Standard_Real aTL = Min(aParts1(i + 1), aParts2(j + 1));
+    if (aTL - aTF > aTolT) {
+      theParts.Append(aTF);
+      theParts.Append(aTL);
+    }
+    if (aParts1(i + 1) < aParts2(j + 1)) {
+      i += 2;
+    }
+    else {
+      j += 2;
+    }
+  }
+  return Standard_True;
+}
@@ -96,8 +96,26 @@ public:
   //! Gets the intersection context
   Standard_EXPORT const Handle(IntTools_Context)& Context() const;
 
+  //! Enables/Disables the fast path for the Plane/Plane and Plane/Cylinder
+  //! pairs of faces bounded by lines and circles in 2D.<br>
+  //! The intersection curves of such faces are computed in closed form and
+  //! clipped exactly by the boundaries of the faces, so that the general
+  //! surface/surface intersection is not involved. The pairs which cannot be
+  //! treated exactly (e.g. ellipses, tangent cases, curves passing along the
+  //! boundaries) are passed to the general algorithm.<br>
+  //! Enabled by default.
+  Standard_EXPORT void SetFastPlanar (const Standard_Boolean theFastPlanar);
+
+  //! Returns the flag defining usage of the fast path
+  Standard_EXPORT Standard_Boolean FastPlanar() const;
+
 protected:
 
+  //! Intersects the cylindrical face myFace1 with the planar face myFace2
+  //! when the axis of the cylinder is parallel or normal to the plane.
+  //! Returns FALSE if the pair cannot be treated in closed form.
+  Standard_EXPORT Standard_Boolean PerformPlaneCylinder();
+
   //! Creates curves from the IntPatch_Line.
   Standard_EXPORT void MakeCurve (const Standard_Integer Index,
                                   const Handle(Adaptor3d_TopolTool)& D1,
@@ -133,6 +151,7 @@ protected:
   IntTools_SequenceOfPntOn2Faces myPnts;
   IntSurf_ListOfPntOn2S myListOfPnts;
   Handle(IntTools_Context) myContext;
+  Standard_Boolean myFastPlanar;
 
 };
 
@@ -0,0 +1,814 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <MeshCSG_Boolean.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
+#include <BVH_Triangulation.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_MergeNodesTool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  typedef BVH_Triangulation<Standard_Real, 3> MeshCSG_BVHSet;
+  typedef BVH_Tree<Standard_Real, 3>          MeshCSG_BVHTree;
+
+  //! Polygon (convex piece of the triangle).
+  typedef std::vector<gp_XYZ> MeshCSG_Polygon;
+
+  //! Directions of the rays used for classification of the points,
+  //! chosen with the irrational ratios of the coordinates to avoid passing
+  //! through the edges of the regular (e.g. axis aligned) triangulations.
+  static const gp_XYZ THE_RAY_DIRS[3] =
+  {
+    gp_XYZ ( 1.0,        1.41421356,  1.73205081).Normalized(),
+    gp_XYZ (-2.23606798, 1.0,        -2.64575131).Normalized(),
+    gp_XYZ ( 3.14159265, -2.71828183, -1.0).Normalized()
+  };
+
+  //=======================================================================
+  //class    : MeshCSG_Mesh
+  //purpose  : Operand of the operation prepared for processing
+  //=======================================================================
+  struct MeshCSG_Mesh
+  {
+    std::vector<gp_XYZ>                  Nodes;
+    std::vector<BVH_Vec3i>               Triangles;
+    opencascade::handle<MeshCSG_BVHSet>  Set;
+    opencascade::handle<MeshCSG_BVHTree> Tree;
+    BVH_Box<Standard_Real, 3>            Box;
+
+    //! Copies the nodes and triangles of the triangulation and builds the BVH tree.
+    void Init (const Handle(Poly_Triangulation)& theMesh)
+    {
+      const Standard_Integer aNbNodes = theMesh->NbNodes();
+      const Standard_Integer aNbTris = theMesh->NbTriangles();
+      // the linear builder is preferred as the tree is used once
+      Set = new MeshCSG_BVHSet (new BVH_LinearBuilder<Standard_Real, 3>());
+      Nodes.resize (aNbNodes);
+      Set->Vertices.resize (aNbNodes);
+      for (Standard_Integer i = 0; i < aNbNodes; ++i)
+      {
+        Nodes[i] = theMesh->Node (i + 1).XYZ();
+        Set->Vertices[i] = BVH_Vec3d (Nodes[i].X(), Nodes[i].Y(), Nodes[i].Z());
+      }
+      Triangles.resize (aNbTris);
+      Set->Elements.resize (aNbTris);
+      for (Standard_Integer i = 0; i < aNbTris; ++i)
+      {
+        Standard_Integer n1, n2, n3;
+        theMesh->Triangle (i + 1).Get (n1, n2, n3);
+        Triangles[i] = BVH_Vec3i (n1 - 1, n2 - 1, n3 - 1);
+        Set->Elements[i] = BVH_Vec4i (n1 - 1, n2 - 1, n3 - 1, i);
+      }
+      // build the tree at once to share it between threads
+      Set->MarkDirty();
+      Tree = Set->BVH();
+      Box = Set->Box();
+    }
+
+    //! Returns the nodes of the triangle.
+    void Triangle (const Standard_Integer theIndex, gp_XYZ thePnts[3]) const
+    {
+      const BVH_Vec3i& aTri = Triangles[theIndex];
+      thePnts[0] = Nodes[aTri.x()];
+      thePnts[1] = Nodes[aTri.y()];
+      thePnts[2] = Nodes[aTri.z()];
+    }
+  };
+
+  //=======================================================================
+  //function : isOut
+  //purpose  : Checks if the boxes are separated by more than the tolerance
+  //=======================================================================
+  static Standard_Boolean isOut (const BVH_Vec3d& theMin1, const BVH_Vec3d& theMax1,
+                                 const BVH_Vec3d& theMin2, const BVH_Vec3d& theMax2,
+                                 const Standard_Real theTol)
+  {
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (theMin1[i] > theMax2[i] + theTol || theMin2[i] > theMax1[i] + theTol)
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //=======================================================================
+  //class    : MeshCSG_PairSelector
+  //purpose  : Selects the pairs of triangles of two meshes with interfering boxes
+  //=======================================================================
+  class MeshCSG_PairSelector : public BVH_PairTraverse<Standard_Real, 3, MeshCSG_BVHSet>
+  {
+  public:
+
+    MeshCSG_PairSelector (const Standard_Real theTol) : myTol (theTol) {}
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin1, const BVH_Vec3d& theMax1,
+                                         const BVH_Vec3d& theMin2, const BVH_Vec3d& theMax2,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      return isOut (theMin1, theMax1, theMin2, theMax2, myTol);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      const BVH_Box<Standard_Real, 3> aBox1 = myBVHSet1->Box (theIndex1);
+      const BVH_Box<Standard_Real, 3> aBox2 = myBVHSet2->Box (theIndex2);
+      if (isOut (aBox1.CornerMin(), aBox1.CornerMax(), aBox2.CornerMin(), aBox2.CornerMax(), myTol))
+      {
+        return Standard_False;
+      }
+      myPairs.push_back (std::make_pair (myBVHSet1->Elements[theIndex1].w(),
+                                         myBVHSet2->Elements[theIndex2].w()));
+      return Standard_True;
+    }
+
+    const std::vector<std::pair<Standard_Integer, Standard_Integer> >& Pairs() const { return myPairs; }
+
+  private:
+
+    Standard_Real myTol;
+    std::vector<std::pair<Standard_Integer, Standard_Integer> > myPairs;
+  };
+
+  //=======================================================================
+  //class    : MeshCSG_RayCounter
+  //purpose  : Counts the intersections of the ray with the triangles of the mesh
+  //=======================================================================
+  class MeshCSG_RayCounter : public BVH_Traverse<Standard_Real, 3, MeshCSG_BVHSet>
+  {
+  public:
+
+    MeshCSG_RayCounter (const MeshCSG_Mesh& theMesh, const gp_XYZ& theOrigin, const gp_XYZ& theDir)
+    : myMesh (theMesh), myOrigin (theOrigin), myDir (theDir),
+      myInvDir (1.0 / theDir.X(), 1.0 / theDir.Y(), 1.0 / theDir.Z()),
+      myNbHits (0)
+    {}
+
+    //! Slab test of the box.
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theMin, const BVH_Vec3d& theMax,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      Standard_Real aTMin = 0.0, aTMax = RealLast();
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        Standard_Real aT1 = (theMin[i] - myOrigin.Coord (i + 1)) * myInvDir.Coord (i + 1);
+        Standard_Real aT2 = (theMax[i] - myOrigin.Coord (i + 1)) * myInvDir.Coord (i + 1);
+        if (aT1 > aT2)
+        {
+          std::swap (aT1, aT2);
+        }
+        aTMin = Max (aTMin, aT1);
+        aTMax = Min (aTMax, aT2);
+        if (aTMin > aTMax)
+        {
+          return Standard_True;
+        }
+      }
+      return Standard_False;
+    }
+
+    //! Moller-Trumbore intersection of the ray with the triangle.
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      gp_XYZ aP[3];
+      myMesh.Triangle (myMesh.Set->Elements[theIndex].w(), aP);
+      const gp_XYZ anE1 = aP[1] - aP[0];
+      const gp_XYZ anE2 = aP[2] - aP[0];
+      const gp_XYZ aPV = myDir ^ anE2;
+      const Standard_Real aDet = anE1.Dot (aPV);
+      if (Abs (aDet) < RealSmall())
+      {
+        return Standard_False;
+      }
+      const Standard_Real anInvDet = 1.0 / aDet;
+      const gp_XYZ aTV = myOrigin - aP[0];
+      const Standard_Real anU = aTV.Dot (aPV) * anInvDet;
+      if (anU < 0.0 || anU > 1.0)
+      {
+        return Standard_False;
+      }
+      const gp_XYZ aQV = aTV ^ anE1;
+      const Standard_Real aV = myDir.Dot (aQV) * anInvDet;
+      if (aV < 0.0 || anU + aV > 1.0)
+      {
+        return Standard_False;
+      }
+      if (anE2.Dot (aQV) * anInvDet <= 0.0)
+      {
+        return Standard_False;
+      }
+      ++myNbHits;
+      return Standard_True;
+    }
+
+    Standard_Integer NbHits() const { return myNbHits; }
+
+  private:
+
+    const MeshCSG_Mesh& myMesh;
+    gp_XYZ              myOrigin;
+    gp_XYZ              myDir;
+    gp_XYZ              myInvDir;
+    Standard_Integer    myNbHits;
+  };
+
+  //=======================================================================
+  //function : isInside
+  //purpose  : Classifies the point relatively the closed mesh by the parity
+  //           of the numbers of intersections of the rays (majority of three)
+  //=======================================================================
+  static Standard_Boolean isInside (const gp_XYZ& thePnt, const MeshCSG_Mesh& theMesh)
+  {
+    const BVH_Vec3d aP (thePnt.X(), thePnt.Y(), thePnt.Z());
+    if (theMesh.Box.IsOut (aP))
+    {
+      return Standard_False;
+    }
+    Standard_Integer aNbIn = 0, aNbOut = 0;
+    for (Standard_Integer i = 0; i < 3 && aNbIn < 2 && aNbOut < 2; ++i)
+    {
+      MeshCSG_RayCounter aCounter (theMesh, thePnt, THE_RAY_DIRS[i]);
+      aCounter.Select (theMesh.Tree);
+      ++((aCounter.NbHits() % 2) ? aNbIn : aNbOut);
+    }
+    return aNbIn >= 2;
+  }
+
+  //=======================================================================
+  //function : planeSection
+  //purpose  : Computes the segment of the triangle lying on the plane,
+  //           the signed distances of the nodes to the plane are given
+  //=======================================================================
+  static Standard_Boolean planeSection (const gp_XYZ thePnts[3],
+                                        const Standard_Real theDist[3],
+                                        gp_XYZ& theP1,
+                                        gp_XYZ& theP2)
+  {
+    gp_XYZ aPnts[3];
+    Standard_Integer aNb = 0;
+    for (Standard_Integer i = 0; i < 3 && aNb < 3; ++i)
+    {
+      const Standard_Integer j = (i + 1) % 3;
+      if (theDist[i] == 0.0)
+      {
+        aPnts[aNb++] = thePnts[i];
+      }
+      else if (theDist[i] * theDist[j] < 0.0)
+      {
+        const Standard_Real aT = theDist[i] / (theDist[i] - theDist[j]);
+        aPnts[aNb++] = thePnts[i] + (thePnts[j] - thePnts[i]) * aT;
+      }
+    }
+    if (aNb < 2)
+    {
+      return Standard_False;
+    }
+    theP1 = aPnts[0];
+    theP2 = aPnts[1];
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : planeDistances
+  //purpose  : Computes the signed distances of the nodes of the triangle
+  //           to the plane of the other one, snapping small values to zero.
+  //           Returns FALSE if the triangle is on one side of the plane.
+  //=======================================================================
+  static Standard_Boolean planeDistances (const gp_XYZ thePlane[3],
+                                          const gp_XYZ thePnts[3],
+                                          const Standard_Real theTol,
+                                          Standard_Real theDist[3])
+  {
+    gp_XYZ aNorm = (thePlane[1] - thePlane[0]) ^ (thePlane[2] - thePlane[0]);
+    const Standard_Real aMod = aNorm.Modulus();
+    if (aMod < RealSmall())
+    {
+      return Standard_False;
+    }
+    aNorm /= aMod;
+    Standard_Integer aNbPos = 0, aNbNeg = 0;
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      theDist[i] = aNorm.Dot (thePnts[i] - thePlane[0]);
+      if (Abs (theDist[i]) <= theTol)
+      {
+        theDist[i] = 0.0;
+      }
+      aNbPos += (theDist[i] > 0.0);
+      aNbNeg += (theDist[i] < 0.0);
+    }
+    // the triangles lying in the same plane are not processed
+    return aNbPos < 3 && aNbNeg < 3 && aNbPos + aNbNeg > 0;
+  }
+
+  //=======================================================================
+  //function : intersectTriangles
+  //purpose  : Computes the segment of intersection of two triangles
+  //=======================================================================
+  static Standard_Boolean intersectTriangles (const gp_XYZ theTri1[3],
+                                              const gp_XYZ theTri2[3],
+                                              const Standard_Real theTol,
+                                              gp_XYZ& theP1,
+                                              gp_XYZ& theP2)
+  {
+    Standard_Real aDist1[3], aDist2[3];
+    if (!planeDistances (theTri2, theTri1, theTol, aDist1)
+     || !planeDistances (theTri1, theTri2, theTol, aDist2))
+    {
+      return Standard_False;
+    }
+    gp_XYZ aA1, aB1, aA2, aB2;
+    if (!planeSection (theTri1, aDist1, aA1, aB1)
+     || !planeSection (theTri2, aDist2, aA2, aB2))
+    {
+      return Standard_False;
+    }
+    // both sections lie on the line of intersection of the planes,
+    // the result is their overlapping part
+    gp_XYZ aDir = aB1 - aA1;
+    const Standard_Real aLen = aDir.Modulus();
+    if (aLen <= theTol)
+    {
+      return Standard_False;
+    }
+    aDir /= aLen;
+    Standard_Real aT1 = aDir.Dot (aA2 - aA1);
+    Standard_Real aT2 = aDir.Dot (aB2 - aA1);
+    if (aT1 > aT2)
+    {
+      std::swap (aT1, aT2);
+    }
+    aT1 = Max (aT1, 0.0);
+    aT2 = Min (aT2, aLen);
+    if (aT2 - aT1 <= theTol)
+    {
+      return Standard_False;
+    }
+    theP1 = aA1 + aDir * aT1;
+    theP2 = aA1 + aDir * aT2;
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : splitTriangle
+  //purpose  : Splits the triangle into convex pieces by the lines of the
+  //           segments lying on it. Only the pieces crossed by the segment
+  //           are split by its line.
+  //=======================================================================
+  static void splitTriangle (const gp_XYZ thePnts[3],
+                             const std::vector<gp_XYZ>& theSegments,
+                             const std::vector<Standard_Integer>& theIndices,
+                             const Standard_Real theTol,
+                             std::vector<MeshCSG_Polygon>& thePieces)
+  {
+    const gp_XYZ aNorm = (thePnts[1] - thePnts[0]) ^ (thePnts[2] - thePnts[0]);
+    thePieces.assign (1, MeshCSG_Polygon (thePnts, thePnts + 3));
+
+    std::vector<MeshCSG_Polygon> aSplit;
+    std::vector<Standard_Real> aDist;
+    for (std::vector<Standard_Integer>::const_iterator anIt = theIndices.begin(); anIt != theIndices.end(); ++anIt)
+    {
+      const gp_XYZ& aP1 = theSegments[2 * (*anIt)];
+      const gp_XYZ& aP2 = theSegments[2 * (*anIt) + 1];
+      gp_XYZ aDir = aP2 - aP1;
+      const Standard_Real aLen = aDir.Modulus();
+      gp_XYZ aCutNorm = aNorm ^ aDir;
+      const Standard_Real aMod = aCutNorm.Modulus();
+      if (aLen <= theTol || aMod < RealSmall())
+      {
+        continue;
+      }
+      aDir /= aLen;
+      aCutNorm /= aMod;
+
+      aSplit.clear();
+      for (size_t i = 0; i < thePieces.size(); ++i)
+      {
+        const MeshCSG_Polygon& aPoly = thePieces[i];
+        const size_t aNbPnts = aPoly.size();
+        aDist.resize (aNbPnts);
+        Standard_Boolean hasPos = Standard_False, hasNeg = Standard_False;
+        Standard_Real aTMin = RealLast(), aTMax = RealFirst();
+        for (size_t j = 0; j < aNbPnts; ++j)
+        {
+          const gp_XYZ aVec = aPoly[j] - aP1;
+          aDist[j] = aCutNorm.Dot (aVec);
+          if (Abs (aDist[j]) <= theTol)
+          {
+            aDist[j] = 0.0;
+          }
+          hasPos = hasPos || aDist[j] > 0.0;
+          hasNeg = hasNeg || aDist[j] < 0.0;
+          const Standard_Real aT = aDir.Dot (aVec);
+          aTMin = Min (aTMin, aT);
+          aTMax = Max (aTMax, aT);
+        }
+        if (!hasPos || !hasNeg || aTMax < -theTol || aTMin > aLen + theTol)
+        {
+          aSplit.push_back (aPoly);
+          continue;
+        }
+
+        MeshCSG_Polygon aPos, aNeg;
+        for (size_t j = 0; j < aNbPnts; ++j)
+        {
+          const size_t k = (j + 1) % aNbPnts;
+          if (aDist[j] >= 0.0)
+          {
+            aPos.push_back (aPoly[j]);
+          }
+          if (aDist[j] <= 0.0)
+          {
+            aNeg.push_back (aPoly[j]);
+          }
+          if (aDist[j] * aDist[k] < 0.0)
+          {
+            const gp_XYZ aPnt = aPoly[j] + (aPoly[k] - aPoly[j]) * (aDist[j] / (aDist[j] - aDist[k]));
+            aPos.push_back (aPnt);
+            aNeg.push_back (aPnt);
+          }
+        }
+        aSplit.push_back (aPos);
+        aSplit.push_back (aNeg);
+      }
+      thePieces.swap (aSplit);
+    }
+
+    // remove the degenerated pieces
+    const Standard_Real aMinArea = theTol * theTol;
+    size_t aNbPieces = 0;
+    for (size_t i = 0; i < thePieces.size(); ++i)
+    {
+      const MeshCSG_Polygon& aPoly = thePieces[i];
+      gp_XYZ anArea;
+      for (size_t j = 2; j < aPoly.size(); ++j)
+      {
+        anArea += (aPoly[j - 1] - aPoly[0]) ^ (aPoly[j] - aPoly[0]);
+      }
+      if (anArea.Modulus() > aMinArea)
+      {
+        if (aNbPieces != i)
+        {
+          thePieces[aNbPieces].swap (thePieces[i]);
+        }
+        ++aNbPieces;
+      }
+    }
+    thePieces.resize (aNbPieces);
+  }
+
+  //=======================================================================
+  //function : findRoot
+  //purpose  : Finds the root of the set in the union-find structure
+  //=======================================================================
+  static Standard_Integer findRoot (std::vector<Standard_Integer>& theParents, Standard_Integer theIndex)
+  {
+    while (theParents[theIndex] != theIndex)
+    {
+      theParents[theIndex] = theParents[theParents[theIndex]];
+      theIndex = theParents[theIndex];
+    }
+    return theIndex;
+  }
+
+  //=======================================================================
+  //class    : MeshCSG_Parts
+  //purpose  : Parts of the operand classified relatively the other operand
+  //=======================================================================
+  struct MeshCSG_Parts
+  {
+    std::vector<char>                          States;     //!< states of the not intersected triangles (1 - inside)
+    std::vector<Standard_Integer>              Intersected; //!< indices of the intersected triangles
+    std::vector<std::vector<MeshCSG_Polygon> > Pieces;     //!< pieces of the intersected triangles
+    std::vector<std::vector<char> >            PieceStates; //!< states of the pieces
+  };
+
+  //=======================================================================
+  //function : classifyParts
+  //purpose  : Splits the intersected triangles of the operand and classifies
+  //           all parts of the operand relatively the other one
+  //=======================================================================
+  static void classifyParts (const MeshCSG_Mesh& theMesh,
+                             const MeshCSG_Mesh& theOther,
+                             const std::vector<char>& theTouched,
+                             const std::vector<std::vector<Standard_Integer> >& theTriSegments,
+                             const std::vector<gp_XYZ>& theSegments,
+                             const Standard_Real theTol,
+                             const Standard_Boolean theRunParallel,
+                             MeshCSG_Parts& theParts)
+  {
+    const Standard_Integer aNbTris = (Standard_Integer )theMesh.Triangles.size();
+
+    // the triangles close to the other operand are split and classified by pieces
+    for (Standard_Integer i = 0; i < aNbTris; ++i)
+    {
+      if (theTouched[i])
+      {
+        theParts.Intersected.push_back (i);
+      }
+    }
+    const Standard_Integer aNbIntersected = (Standard_Integer )theParts.Intersected.size();
+    theParts.Pieces.resize (aNbIntersected);
+    theParts.PieceStates.resize (aNbIntersected);
+    OSD_Parallel::For (0, aNbIntersected, [&] (const Standard_Integer theIndex)
+    {
+      const Standard_Integer aTri = theParts.Intersected[theIndex];
+      gp_XYZ aPnts[3];
+      theMesh.Triangle (aTri, aPnts);
+      std::vector<MeshCSG_Polygon>& aPieces = theParts.Pieces[theIndex];
+      splitTriangle (aPnts, theSegments, theTriSegments[aTri], theTol, aPieces);
+      std::vector<char>& aStates = theParts.PieceStates[theIndex];
+      aStates.resize (aPieces.size());
+      for (size_t j = 0; j < aPieces.size(); ++j)
+      {
+        gp_XYZ aCenter;
+        for (size_t k = 0; k < aPieces[j].size(); ++k)
+        {
+          aCenter += aPieces[j][k];
+        }
+        aCenter /= (Standard_Real )aPieces[j].size();
+        aStates[j] = isInside (aCenter, theOther);
+      }
+    }, !theRunParallel);
+
+    // the connected regions of the other triangles have the same state,
+    // thus a single triangle of each region is classified
+    std::vector<Standard_Integer> aParents (aNbTris);
+    std::vector<std::pair<uint64_t, Standard_Integer> > anEdges;
+    anEdges.reserve (3 * (aNbTris - aNbIntersected));
+    for (Standard_Integer i = 0; i < aNbTris; ++i)
+    {
+      aParents[i] = i;
+      if (theTouched[i])
+      {
+        continue;
+      }
+      const BVH_Vec3i& aTri = theMesh.Triangles[i];
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        const uint64_t aN1 = (uint64_t )aTri[j], aN2 = (uint64_t )aTri[(j + 1) % 3];
+        anEdges.push_back (std::make_pair (aN1 < aN2 ? (aN1 << 32) | aN2 : (aN2 << 32) | aN1, i));
+      }
+    }
+    std::sort (anEdges.begin(), anEdges.end());
+    for (size_t i = 1; i < anEdges.size(); ++i)
+    {
+      if (anEdges[i].first == anEdges[i - 1].first)
+      {
+        const Standard_Integer aRoot1 = findRoot (aParents, anEdges[i - 1].second);
+        const Standard_Integer aRoot2 = findRoot (aParents, anEdges[i].second);
+        aParents[Max (aRoot1, aRoot2)] = Min (aRoot1, aRoot2);
+      }
+    }
+
+    std::vector<Standard_Integer> aRoots;
+    for (Standard_Integer i = 0; i < aNbTris; ++i)
+    {
+      if (!theTouched[i] && findRoot (aParents, i) == i)
+      {
+        aRoots.push_back (i);
+      }
+    }
+    theParts.States.assign (aNbTris, 0);
+    OSD_Parallel::For (0, (Standard_Integer )aRoots.size(), [&] (const Standard_Integer theIndex)
+    {
+      const Standard_Integer aTri = aRoots[theIndex];
+      gp_XYZ aPnts[3];
+      theMesh.Triangle (aTri, aPnts);
+      theParts.States[aTri] = isInside ((aPnts[0] + aPnts[1] + aPnts[2]) / 3.0, theOther);
+    }, !theRunParallel);
+    for (Standard_Integer i = 0; i < aNbTris; ++i)
+    {
+      if (!theTouched[i])
+      {
+        theParts.States[i] = theParts.States[findRoot (aParents, i)];
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : MeshCSG_Boolean
+//purpose  :
+//=======================================================================
+MeshCSG_Boolean::MeshCSG_Boolean()
+: myOperation (MeshCSG_Fuse),
+  myRunParallel (Standard_False),
+  myIsDone (Standard_False),
+  myNbIntersections (0)
+{
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void MeshCSG_Boolean::Perform()
+{
+  myIsDone = Standard_False;
+  myResult.Nullify();
+  myNbIntersections = 0;
+  if (myObject.IsNull() || myTool.IsNull()
+   || myObject->NbTriangles() == 0 || myTool->NbTriangles() == 0)
+  {
+    return;
+  }
+
+  MeshCSG_Mesh aMeshes[2];
+  aMeshes[0].Init (myObject);
+  aMeshes[1].Init (myTool);
+
+  // tolerance for the computations relative to the size of the operands
+  BVH_Box<Standard_Real, 3> aBox = aMeshes[0].Box;
+  aBox.Combine (aMeshes[1].Box);
+  const Standard_Real aTol = 1.e-10 * aBox.Size().Modulus();
+
+  // pairs of triangles with interfering boxes
+  MeshCSG_PairSelector aSelector (aTol);
+  aSelector.SetBVHSets (aMeshes[0].Set.get(), aMeshes[1].Set.get());
+  aSelector.Select();
+  const std::vector<std::pair<Standard_Integer, Standard_Integer> >& aPairs = aSelector.Pairs();
+  const Standard_Integer aNbPairs = (Standard_Integer )aPairs.size();
+
+  // segments of intersection of the triangles
+  std::vector<gp_XYZ> aSegments (2 * aNbPairs);
+  std::vector<char> hasSegment (aNbPairs, 0);
+  OSD_Parallel::For (0, aNbPairs, [&] (const Standard_Integer theIndex)
+  {
+    gp_XYZ aTri1[3], aTri2[3];
+    aMeshes[0].Triangle (aPairs[theIndex].first, aTri1);
+    aMeshes[1].Triangle (aPairs[theIndex].second, aTri2);
+    hasSegment[theIndex] = intersectTriangles (aTri1, aTri2, aTol,
+                                               aSegments[2 * theIndex], aSegments[2 * theIndex + 1]);
+  }, !myRunParallel);
+
+  std::vector<char> aTouched[2];
+  std::vector<std::vector<Standard_Integer> > aTriSegments[2];
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    aTouched[k].assign (aMeshes[k].Triangles.size(), 0);
+    aTriSegments[k].resize (aMeshes[k].Triangles.size());
+  }
+  for (Standard_Integer i = 0; i < aNbPairs; ++i)
+  {
+    const Standard_Integer aTri1 = aPairs[i].first, aTri2 = aPairs[i].second;
+    aTouched[0][aTri1] = aTouched[1][aTri2] = 1;
+    if (hasSegment[i])
+    {
+      ++myNbIntersections;
+      aTriSegments[0][aTri1].push_back (i);
+      aTriSegments[1][aTri2].push_back (i);
+    }
+  }
+
+  // classification of the parts of the operands
+  MeshCSG_Parts aParts[2];
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    classifyParts (aMeshes[k], aMeshes[1 - k], aTouched[k], aTriSegments[k],
+                   aSegments, aTol, myRunParallel, aParts[k]);
+  }
+
+  // selection of the parts: the parts of the object outside the tool are kept
+  // for Fuse and Cut; the parts of the tool inside the object are kept for
+  // Common and Cut (reversed for Cut)
+  std::vector<gp_XYZ> aNodes;
+  std::vector<BVH_Vec3i> aTris;
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    const char aKeepState = (k == 0) ? (myOperation == MeshCSG_Common) : (myOperation != MeshCSG_Fuse);
+    const Standard_Boolean toReverse = (k == 1 && myOperation == MeshCSG_Cut);
+    const MeshCSG_Mesh& aMesh = aMeshes[k];
+    const MeshCSG_Parts& aPart = aParts[k];
+
+    std::vector<Standard_Integer> aNodeMap (aMesh.Nodes.size(), -1);
+    for (size_t i = 0; i < aMesh.Triangles.size(); ++i)
+    {
+      if (aTouched[k][i] || aPart.States[i] != aKeepState)
+      {
+        continue;
+      }
+      BVH_Vec3i aTri;
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        const Standard_Integer aNode = aMesh.Triangles[i][j];
+        if (aNodeMap[aNode] < 0)
+        {
+          aNodeMap[aNode] = (Standard_Integer )aNodes.size();
+          aNodes.push_back (aMesh.Nodes[aNode]);
+        }
+        aTri[j] = aNodeMap[aNode];
+      }
+      aTris.push_back (toReverse ? BVH_Vec3i (aTri.x(), aTri.z(), aTri.y()) : aTri);
+    }
+
+    for (size_t i = 0; i < aPart.Pieces.size(); ++i)
+    {
+      for (size_t j = 0; j < aPart.Pieces[i].size(); ++j)
+      {
+        if (aPart.PieceStates[i][j] != aKeepState)
+        {
+          continue;
+        }
+        const MeshCSG_Polygon& aPoly = aPart.Pieces[i][j];
+        const Standard_Integer aFirst = (Standard_Integer )aNodes.size();
+        aNodes.insert (aNodes.end(), aPoly.begin(), aPoly.end());
+        for (Standard_Integer n = 2; n < (Standard_Integer )aPoly.size(); ++n)
+        {
+          aTris.push_back (toReverse ? BVH_Vec3i (aFirst, aFirst + n, aFirst + n - 1)
+                                     : BVH_Vec3i (aFirst, aFirst + n - 1, aFirst + n));
+        }
+      }
+    }
+  }
+
+  myResult = new Poly_Triangulation ((Standard_Integer )aNodes.size(), (Standard_Integer )aTris.size(), Standard_False);
+  for (size_t i = 0; i < aNodes.size(); ++i)
+  {
+    myResult->SetNode ((Standard_Integer )i + 1, aNodes[i]);
+  }
+  for (size_t i = 0; i < aTris.size(); ++i)
+  {
+    myResult->SetTriangle ((Standard_Integer )i + 1, Poly_Triangle (aTris[i].x() + 1, aTris[i].y() + 1, aTris[i].z() + 1));
+  }
+  myIsDone = Standard_True;
+}
+
+//=======================================================================
+//function : Triangulation
+//purpose  :
+//=======================================================================
+Handle(Poly_Triangulation) MeshCSG_Boolean::Triangulation (const TopoDS_Shape& theShape,
+                                                           const Standard_Real theTolerance)
+{
+  Standard_Integer aNbTris = 0;
+  for (TopExp_Explorer anExp (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (TopoDS::Face (anExp.Current()), aLoc);
+    if (aTris.IsNull())
+    {
+      return Handle(Poly_Triangulation)();
+    }
+    aNbTris += aTris->NbTriangles();
+  }
+
+  Poly_MergeNodesTool aMerger (M_PI, theTolerance, aNbTris);
+  aMerger.SetMergeOpposite (true);
+  for (TopExp_Explorer anExp (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (aFace, aLoc);
+    const gp_Trsf& aTrsf = aLoc.Transformation();
+    const Standard_Boolean toReverse = (aFace.Orientation() == TopAbs_REVERSED) != aTrsf.IsNegative();
+    aMerger.AddTriangulation (aTris, aTrsf, toReverse);
+  }
+  return aMerger.Result();
+}
+
+//=======================================================================
+//function : Volume
+//purpose  :
+//=======================================================================
+Standard_Real MeshCSG_Boolean::Volume (const Handle(Poly_Triangulation)& theMesh)
+{
+  Standard_Real aVolume = 0.0;
+  if (theMesh.IsNull())
+  {
+    return aVolume;
+  }
+  for (Standard_Integer i = 1; i <= theMesh->NbTriangles(); ++i)
+  {
+    Standard_Integer n1, n2, n3;
+    theMesh->Triangle (i).Get (n1, n2, n3);
+    const gp_XYZ aP1 = theMesh->Node (n1).XYZ();
+    const gp_XYZ aP2 = theMesh->Node (n2).XYZ();
+    const gp_XYZ aP3 = theMesh->Node (n3).XYZ();
+    aVolume += aP1.Dot (aP2 ^ aP3);
+  }
+  return aVolume / 6.0;
+}
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _MeshCSG_Boolean_HeaderFile
+#define _MeshCSG_Boolean_HeaderFile
+
+#include <MeshCSG_Operation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+class TopoDS_Shape;
+
+//! Approximate Boolean operation on closed triangle meshes, intended for the fast preview
+//! of the result of the exact Boolean operation (see BRepAlgoAPI_BooleanOperation).
+//!
+//! The operands are closed triangulations with outward oriented triangles given in the global
+//! coordinate system, e.g. the triangulations of the shapes meshed by BRepMesh_IncrementalMesh
+//! gathered by Triangulation(). The algorithm:
+//! - selects the pairs of triangles of the operands with interfering boxes using the BVH trees
+//!   built on the triangles (BVH_Triangulation);
+//! - computes the segments of intersection of the triangles of each pair;
+//! - splits each intersected triangle by the lines of its segments into convex pieces;
+//! - classifies the pieces relatively the other operand by casting rays, and propagates the
+//!   state over the connected regions of the not intersected triangles, so that a single point
+//!   is classified for each region;
+//! - collects the parts of the operands required by the operation into the result.
+//!
+//! The result is intended for display only: it is not stitched along the lines of intersection
+//! and the coinciding parts of the operands (coplanar triangles) are not processed.
+//! The time of the operation is proportional to the number of triangles of the operands
+//! and does not depend on the complexity of the underlying surfaces.
+class MeshCSG_Boolean
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor.
+  Standard_EXPORT MeshCSG_Boolean();
+
+  //! Sets the object of the operation.
+  void SetObject (const Handle(Poly_Triangulation)& theMesh) { myObject = theMesh; }
+
+  //! Sets the tool of the operation.
+  void SetTool (const Handle(Poly_Triangulation)& theMesh) { myTool = theMesh; }
+
+  //! Sets the type of the operation.
+  void SetOperation (const MeshCSG_Operation theOperation) { myOperation = theOperation; }
+
+  //! Returns the type of the operation.
+  MeshCSG_Operation Operation() const { return myOperation; }
+
+  //! Sets the flag of parallel processing.
+  void SetRunParallel (const Standard_Boolean theFlag) { myRunParallel = theFlag; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
+  //! Performs the operation.
+  Standard_EXPORT void Perform();
+
+  //! Returns TRUE if the operation has been performed successfully.
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns the resulting triangulation.
+  const Handle(Poly_Triangulation)& Result() const { return myResult; }
+
+  //! Returns the number of intersecting pairs of triangles of the last operation.
+  Standard_Integer NbIntersections() const { return myNbIntersections; }
+
+public:
+
+  //! Gathers the triangulations of the faces of the shape into a single triangulation
+  //! in the global coordinate system, taking into account the orientations of the faces.
+  //! The coinciding nodes of the adjacent faces are merged with the given tolerance.
+  //! Returns NULL handle if any face of the shape has no triangulation.
+  Standard_EXPORT static Handle(Poly_Triangulation) Triangulation (const TopoDS_Shape& theShape,
+                                                                   const Standard_Real theTolerance = 1.e-7);
+
+  //! Computes the volume enclosed by the closed triangulation.
+  Standard_EXPORT static Standard_Real Volume (const Handle(Poly_Triangulation)& theMesh);
+
+protected:
+
+  Handle(Poly_Triangulation) myObject;
+  Handle(Poly_Triangulation) myTool;
+  Handle(Poly_Triangulation) myResult;
+  MeshCSG_Operation          myOperation;
+  Standard_Boolean           myRunParallel;
+  Standard_Boolean           myIsDone;
+  Standard_Integer           myNbIntersections;
+
+};
+
+#endif // _MeshCSG_Boolean_HeaderFile
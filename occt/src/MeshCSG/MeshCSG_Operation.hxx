@@ -0,0 +1,25 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _MeshCSG_Operation_HeaderFile
+#define _MeshCSG_Operation_HeaderFile
+
+//! Type of the Boolean operation on meshes.
+enum MeshCSG_Operation
+{
+  MeshCSG_Fuse,   //!< union of the volumes of the operands
+  MeshCSG_Common, //!< intersection of the volumes of the operands
+  MeshCSG_Cut     //!< volume of the object minus the volume of the tool
+};
+
+#endif // _MeshCSG_Operation_HeaderFile
@@ -43,6 +43,12 @@ inline int Standard_Atomic_Decrement (volatile int* theValue);
 //! @return TRUE if theNewValue has been set to *theValue
 inline bool Standard_Atomic_CompareAndSwap (volatile int* theValue, int theOldValue, int theNewValue);
 
+//! Reads atomically integer variable pointed by theValue with acquire semantics:
+//! the writes made by another thread before it has modified the variable by atomic operation
+//! are visible to the calling thread once the modified value is read.
+//! Unlike Standard_Atomic_CompareAndSwap(), it does not lock the variable for writing.
+inline int Standard_Atomic_Load (volatile int* theValue);
+
 // Platform-dependent implementation
 #if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4) || defined(__EMSCRIPTEN__)
 // gcc explicitly defines the macros __GCC_HAVE_SYNC_COMPARE_AND_SWAP_*
@@ -68,11 +74,23 @@ bool Standard_Atomic_CompareAndSwap (volatile int* theValue, int theOldValue, in
   return __sync_val_compare_and_swap (theValue, theOldValue, theNewValue) == theOldValue;
 }
 
+int Standard_Atomic_Load (volatile int* theValue)
+{
+#if defined(__ATOMIC_ACQUIRE)
+  return __atomic_load_n (theValue, __ATOMIC_ACQUIRE);
+#else
+  const int aValue = *theValue;
+  __sync_synchronize();
+  return aValue;
+#endif
+}
+
 #elif defined(_WIN32)
 extern "C" {
   long _InterlockedIncrement (volatile long* lpAddend);
   long _InterlockedDecrement (volatile long* lpAddend);
   long _InterlockedCompareExchange (long volatile* Destination, long Exchange, long Comparand);
+  void _ReadWriteBarrier (void);
 }
 
 #if defined(_MSC_VER) && ! defined(__INTEL_COMPILER)
@@ -80,6 +98,7 @@ extern "C" {
   #pragma intrinsic (_InterlockedIncrement)
   #pragma intrinsic (_InterlockedDecrement)
   #pragma intrinsic (_InterlockedCompareExchange)
+  #pragma intrinsic (_ReadWriteBarrier)
 #endif
 
 // WinAPI function or MSVC intrinsic
@@ -100,6 +119,18 @@ bool Standard_Atomic_CompareAndSwap (volatile int* theValue, int theOldValue, in
   return _InterlockedCompareExchange (reinterpret_cast<volatile long*>(theValue), theNewValue, theOldValue) == theOldValue;
 }
 
+int Standard_Atomic_Load (volatile int* theValue)
+{
+#if defined(_M_IX86) || defined(_M_X64)
+  // loads are not reordered with other loads on x86, only the compiler should be prevented from it
+  const int aValue = *theValue;
+  _ReadWriteBarrier();
+  return aValue;
+#else
+  return _InterlockedCompareExchange (reinterpret_cast<volatile long*>(theValue), 0, 0);
+#endif
+}
+
 #elif defined(__APPLE__)
 // use atomic operations provided by MacOS
 
@@ -120,6 +151,13 @@ bool Standard_Atomic_CompareAndSwap (volatile int* theValue, int theOldValue, in
   return OSAtomicCompareAndSwapInt (theOldValue, theNewValue, theValue);
 }
 
+int Standard_Atomic_Load (volatile int* theValue)
+{
+  const int aValue = *theValue;
+  OSMemoryBarrier();
+  return aValue;
+}
+
 #elif defined(__ANDROID__)
 
 // Atomic operations that were exported by the C library didn't
@@ -144,6 +182,13 @@ bool Standard_Atomic_CompareAndSwap (volatile int* theValue, int theOldValue, in
   return __atomic_cmpxchg (theOldValue, theNewValue, theValue) == 0;
 }
 
+int Standard_Atomic_Load (volatile int* theValue)
+{
+  const int aValue = *theValue;
+  __sync_synchronize();
+  return aValue;
+}
+
 #else
 
 #ifndef IGNORE_NO_ATOMICS
@@ -169,6 +214,11 @@ bool Standard_Atomic_CompareAndSwap (volatile int* theValue, int theOldValue, in
   return false;
 }
 
+int Standard_Atomic_Load (volatile int* theValue)
+{
+  return *theValue;
+}
+
 #endif
 
 #endif //_Standard_Atomic_HeaderFile
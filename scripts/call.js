@@ -38,6 +38,167 @@ function Interogate(shapeName, args) {
   _free(shapeNamePtr);
 }
 
+// Returns the profile of the boolean operations performed since CallCommand("bopprofile", ["1"]);
+// clear resets the collected data for the next operation.
+function BooleanProfile(clear = false) {
+  Module._BooleanProfile(clear);
+  return __OCI_EXCHANGE_VAL;
+}
+
+function TakeBlob(blobPtr) {
+  const data = Module._BlobData(blobPtr);
+  const size = Module._BlobSize(blobPtr);
+  const bytes = HEAPU8.slice(data, data + size);
+  Module._FreeBlob(blobPtr);
+  return bytes;
+}
+
+function ExportGLB(shapeName, deflection = 2, quantize = false, normals = true) {
+  const shapeNamePtr = str2C(shapeName);
+  const blobPtr = Module._ExportGLB(shapeNamePtr, deflection, quantize, normals);
+  _free(shapeNamePtr);
+  return TakeBlob(blobPtr);
+}
+
+// format: "stl" or "3mf"; non-positive deflection and angle select print-quality defaults
+function ExportMesh(shapeName, format = "stl", deflection = 0, angle = 0, mergeTolerance = 0) {
+  const shapeNamePtr = str2C(shapeName);
+  const blobPtr = Module._ExportMesh(shapeNamePtr, format === "3mf" ? 1 : 0, deflection, angle, mergeTolerance);
+  _free(shapeNamePtr);
+  return TakeBlob(blobPtr);
+}
+
+// Approximate boolean of the meshes for real-time preview; op: "fuse", "common" or "cut".
+// Returns { positions: Float32Array, indices: Uint32Array } (empty if the shapes are not meshed).
+function BooleanPreview(objectName, toolName, op = "cut", deflection = 0) {
+  const objectNamePtr = str2C(objectName);
+  const toolNamePtr = str2C(toolName);
+  const opIndex = op === "common" ? 1 : (op === "cut" ? 2 : 0);
+  const blobPtr = Module._BooleanPreview(objectNamePtr, toolNamePtr, opIndex, deflection);
+  _free(objectNamePtr);
+  _free(toolNamePtr);
+  const bytes = TakeBlob(blobPtr);
+  if (bytes.length < 8) {
+    return { positions: new Float32Array(0), indices: new Uint32Array(0) };
+  }
+  const header = new Uint32Array(bytes.buffer, 0, 2);
+  return {
+    positions: new Float32Array(bytes.buffer, 8, 3 * header[0]),
+    indices: new Uint32Array(bytes.buffer, 8 + 12 * header[0], 3 * header[1])
+  };
+}
+
+// Classifies the points (Float64Array of x, y, z) relatively the solid.
+// Returns Uint8Array of states per point: 0 - in, 1 - out, 2 - on, 3 - unknown (empty on failure).
+function ClassifyPoints(shapeName, coords, tol = 1e-7, deflection = 0) {
+  const shapeNamePtr = str2C(shapeName);
+  const coordsPtr = _malloc(coords.length * 8);
+  HEAPF64.set(coords, coordsPtr / 8);
+  const blobPtr = Module._ClassifyPoints(shapeNamePtr, coordsPtr, Math.floor(coords.length / 3), tol, deflection);
+  _free(coordsPtr);
+  _free(shapeNamePtr);
+  return TakeBlob(blobPtr);
+}
+
+// Spatial index of the shape for picking and snapping, built once and updated after the shape changes.
+// The results refer to the sub-shapes by the "ref" values of the interrogation.
+const SPATIAL_INDEX_KINDS = ["face", "edge", "vertex"];
+
+function CreateSpatialIndex(shapeName, deflection = 0) {
+  const shapeNamePtr = str2C(shapeName);
+  const indexPtr = Module._CreateSpatialIndex(shapeNamePtr, deflection);
+  _free(shapeNamePtr);
+  return indexPtr;
+}
+
+function UpdateSpatialIndex(indexPtr, shapeName) {
+  const shapeNamePtr = str2C(shapeName);
+  const nbRebuilt = Module._UpdateSpatialIndex(indexPtr, shapeNamePtr);
+  _free(shapeNamePtr);
+  return nbRebuilt;
+}
+
+function DisposeSpatialIndex(indexPtr) {
+  Module._DisposeSpatialIndex(indexPtr);
+}
+
+function TakeSpatialHit(blobPtr) {
+  const bytes = TakeBlob(blobPtr);
+  if (bytes.length < 48) {
+    return null;
+  }
+  const values = new Float64Array(bytes.buffer, 0, 6);
+  return {
+    kind: SPATIAL_INDEX_KINDS[values[0]],
+    ref: values[1],
+    distance: values[2],
+    point: [values[3], values[4], values[5]]
+  };
+}
+
+// Closest face hit by the ray: { kind, ref, distance, point } or null.
+function SpatialIndexPick(indexPtr, origin, dir) {
+  return TakeSpatialHit(Module._SpatialIndexPick(indexPtr, origin[0], origin[1], origin[2], dir[0], dir[1], dir[2]));
+}
+
+// Nearest vertex within the radius, otherwise the nearest point of the edges: { kind, ref, distance, point } or null.
+function SpatialIndexSnap(indexPtr, point, radius) {
+  return TakeSpatialHit(Module._SpatialIndexSnap(indexPtr, point[0], point[1], point[2], radius));
+}
+
+// Refs of the sub-shapes overlapping the box: { faces, edges, vertices }.
+function SpatialIndexBoxQuery(indexPtr, min, max) {
+  const bytes = TakeBlob(Module._SpatialIndexBoxQuery(indexPtr, min[0], min[1], min[2], max[0], max[1], max[2]));
+  const values = new Float64Array(bytes.buffer, 0, bytes.length / 8);
+  const nbFaces = values[0], nbEdges = values[1];
+  return {
+    faces: Array.from(values.subarray(3, 3 + nbFaces)),
+    edges: Array.from(values.subarray(3 + nbFaces, 3 + nbFaces + nbEdges)),
+    vertices: Array.from(values.subarray(3 + nbFaces + nbEdges))
+  };
+}
+
+// Interference matrix of the shapes: the pairs which overlap, touch or are closer than the tolerance.
+// Returns [{ a, b, type, distance, depth }] with the indices of the shapes in the list
+// and the type "near", "touch" or "overlap".
+const INTERFERENCE_TYPES = ["near", "touch", "overlap"];
+
+function InterferenceMatrix(shapeNames, tol = 0, deflection = 0) {
+  const shapeNamesPtr = str2C(shapeNames.join(" "));
+  const bytes = TakeBlob(Module._InterferenceMatrix(shapeNamesPtr, tol, deflection));
+  _free(shapeNamesPtr);
+  const values = new Float64Array(bytes.buffer, 0, bytes.length / 8);
+  const pairs = [];
+  for (let i = 1; i + 5 <= values.length; i += 5) {
+    pairs.push({
+      a: values[i], b: values[i + 1], type: INTERFERENCE_TYPES[values[i + 2]],
+      distance: values[i + 3], depth: values[i + 4]
+    });
+  }
+  return pairs;
+}
+
+// Overlapping pairs of edges of two sets (arrays of pointers to the edges), e.g. the edges before and after a boolean.
+// Returns [{ a, b, range1: [first, last], range2: [first, last], deviation }] with the indices of the edges
+// in the sets and the overlapped ranges of parameters; the negative tolerance means the tolerance of the edge "a".
+function EdgesOverlap(edges1, edges2, tol = -1) {
+  const edges1Ptr = _malloc(Math.max(edges1.length, 1) * 4);
+  const edges2Ptr = _malloc(Math.max(edges2.length, 1) * 4);
+  HEAP32.set(edges1, edges1Ptr / 4);
+  HEAP32.set(edges2, edges2Ptr / 4);
+  const bytes = TakeBlob(Module._EdgesOverlap(edges1Ptr, edges1.length, edges2Ptr, edges2.length, tol));
+  _free(edges2Ptr);
+  _free(edges1Ptr);
+  const values = new Float64Array(bytes.buffer, 0, bytes.length / 8);
+  const pairs = [];
+  for (let i = 1; i + 7 <= values.length; i += 7) {
+    pairs.push({
+      a: values[i], b: values[i + 1], range1: [values[i + 2], values[i + 3]],
+      range2: [values[i + 4], values[i + 5]], deviation: values[i + 6]
+    });
+  }
+  return pairs;
+}
 
 window.__OCI_EXCHANGE_VAL = null;
 window.__OCI_EXCHANGE = function(objStr) {
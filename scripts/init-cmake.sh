@@ -1,6 +1,22 @@
 cd /build/
 
+# WASM_THREADS=1 builds the libraries with pthreads, so that the parallel algorithms
+# (e.g. Boolean operations with SetRunParallel) use the workers (see wasm-link.sh)
+THREAD_FLAGS=""
+if [ "$WASM_THREADS" = "1" ]; then
+  THREAD_FLAGS="-pthread"
+fi
+
+# WASM_SIMD=1 builds the libraries with 128-bit SIMD instructions, used by the batch
+# evaluation of B-splines (BSplSLib::EvalBatch, BSplCLib::EvalBatch)
+SIMD_FLAGS=""
+if [ "$WASM_SIMD" = "1" ]; then
+  SIMD_FLAGS="-msimd128"
+fi
+
 emcmake cmake \
+  -DCMAKE_C_FLAGS="$THREAD_FLAGS $SIMD_FLAGS" \
+  -DCMAKE_CXX_FLAGS="$THREAD_FLAGS $SIMD_FLAGS" \
   -DCMAKE_SUPPRESS_REGENERATION:BOOL=ON  \
   -DBUILD_USE_PCH:BOOLEAN=OFF \
   -DUSE_TBB:BOOLEAN=OFF \
@@ -3,6 +3,21 @@ INC=/build/include/opencascade
 LIB=/build/lin32/clang/lib/
 export LD_LIBRARY_PATH=$LIB
 
+# WASM_THREADS=1 links with the pool of workers sized by the number of cores of the client;
+# the libraries should be configured with the same setting (see init-cmake.sh), and the page
+# should be cross-origin isolated to provide SharedArrayBuffer
+THREAD_FLAGS=""
+if [ "$WASM_THREADS" = "1" ]; then
+  THREAD_FLAGS="-pthread -s USE_PTHREADS=1 -s PTHREAD_POOL_SIZE=navigator.hardwareConcurrency"
+fi
+
+# WASM_SIMD=1 compiles the bindings with 128-bit SIMD instructions,
+# the libraries should be configured with the same setting (see init-cmake.sh)
+SIMD_FLAGS=""
+if [ "$WASM_SIMD" = "1" ]; then
+  SIMD_FLAGS="-msimd128"
+fi
+
 printf "\n\n\n\n\n\n\n\n\n\n\n\n\n\n"
 
 em++ \
@@ -39,6 +54,8 @@ em++ \
   -DHAVE_IOMANIP \
   -DNDEBUG \
   -s ALLOW_MEMORY_GROWTH=1 \
+  $THREAD_FLAGS \
+  $SIMD_FLAGS \
   -s WASM=1 \
   -std=c++0x -Wall -Wextra \
   -s LLD_REPORT_UNDEFINED \
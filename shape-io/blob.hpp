@@ -0,0 +1,39 @@
+#ifndef E0_IO_BLOB_H
+#define E0_IO_BLOB_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace e0 {
+namespace io {
+
+// Binary result handed over to the caller by pointer.
+// JS reads the bytes from HEAPU8 at [BlobData(ptr), BlobData(ptr) + BlobSize(ptr)) and releases it with FreeBlob(ptr).
+typedef std::vector<char> Blob;
+
+// Appends raw bytes of the value (little-endian on all supported targets).
+template<typename T>
+void blobAppend(Blob& blob, const T& value) {
+  const size_t offset = blob.size();
+  blob.resize(offset + sizeof(T));
+  memcpy(&blob[offset], &value, sizeof(T));
+}
+
+// Appends bytes of the memory block.
+void blobAppendBytes(Blob& blob, const void* data, size_t size) {
+  const char* bytes = static_cast<const char*>(data);
+  blob.insert(blob.end(), bytes, bytes + size);
+}
+
+// Pads the blob with the given byte to the multiple of alignment.
+void blobAlign(Blob& blob, size_t alignment, char filler = 0) {
+  while (blob.size() % alignment != 0) {
+    blob.push_back(filler);
+  }
+}
+
+}
+}
+
+#endif // E0_IO_BLOB_H
@@ -1,12 +1,21 @@
 #ifndef E0_CLASSIFY_H
 #define E0_CLASSIFY_H
 
-#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Extrema_SurfaceProjector.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
 #include <BRepClass_FaceClassifier.hxx>
+#include <IntTools_FClass2d.hxx>
 #include <TopoDS_Shape.hxx>
 #include <ShapeAnalysis_Edge.hxx>
+#include <BRepExtrema_EdgeOverlap.hxx>
 #include <BOPTools_AlgoTools2D.hxx>
 
+#include <list>
+#include <memory>
+#include <vector>
+
 
 namespace e0 {
 
@@ -18,39 +27,136 @@ namespace e0 {
   static const int LOGICAL_CLASSIFICATION_ALL = 1;
   static const int LOGICAL_CLASSIFICATION_PARTIAL = 2;
 
-  int classifyPointToFace(const TopoDS_Face& face, const gp_Pnt& p3d, float tol = -1) {
-    Handle(Geom_Surface) surf = BRep_Tool::Surface(TopoDS::Face(face));
-    if (tol < 0) {
-        tol = BRep_Tool::Tolerance(face);        
+  // Classifies the points relatively the face. The surface projector and the polygonal
+  // classifier of the face boundaries are built once and reused for all points.
+  // The projector is restricted to the parametric box of the face (slightly enlarged), the
+  // points are projected in the order given, each one starting from the previous solution.
+  class FaceClassifier {
+  public:
+
+    FaceClassifier(const TopoDS_Face& face, double tol = -1) : face(face) {
+      this->tol = tol < 0 ? BRep_Tool::Tolerance(face) : tol;
+      Handle(Geom_Surface) surf = BRep_Tool::Surface(face);
+      GeomAdaptor_Surface adaptor(surf);
+      Standard_Real u1, u2, v1, v2, su1, su2, sv1, sv2;
+      BRepTools::UVBounds(face, u1, u2, v1, v2);
+      surf->Bounds(su1, su2, sv1, sv2);
+      const Standard_Real du = adaptor.UResolution(this->tol);
+      const Standard_Real dv = adaptor.VResolution(this->tol);
+      u1 -= du; u2 += du; v1 -= dv; v2 += dv;
+      if (!surf->IsUPeriodic()) {
+        u1 = Max(u1, su1); u2 = Min(u2, su2);
+      }
+      if (!surf->IsVPeriodic()) {
+        v1 = Max(v1, sv1); v2 = Min(v2, sv2);
+      }
+      proj.Init(adaptor, u1, u2, v1, v2, Precision::Confusion());
+      class2d.Init(face, this->tol);
+    }
+
+    const TopoDS_Face& getFace() const {
+      return face;
+    }
+
+    double getTolerance() const {
+      return tol;
+    }
+
+    int classify(const gp_Pnt& p3d) {
+      if (!proj.Perform(p3d) || proj.Distance() > tol) {
+        return GEOM_CLASSIFICATION_UNRELATED;
+      }
+      Standard_Real u, v;
+      proj.Parameters(u, v);
+      switch (class2d.Perform(gp_Pnt2d(u, v))) {
+        case TopAbs_IN: return GEOM_CLASSIFICATION_INSIDE;
+        case TopAbs_ON: return GEOM_CLASSIFICATION_BOUNDS;
+        case TopAbs_OUT:
+        case TopAbs_UNKNOWN:
+        default:
+          return GEOM_CLASSIFICATION_UNRELATED;
+      }
     }
-    
-    GeomAPI_ProjectPointOnSurf proj(p3d, surf);
-
-    if (proj.LowerDistance() <= tol) {
-        Standard_Real u, v;
-        proj.LowerDistanceParameters(u,v);
-        BRepClass_FaceClassifier classifier;
-        const gp_Pnt2d uv(u, v);
-        classifier.Perform(face, uv, tol);
-        switch (classifier.State()) {
-          case TopAbs_IN: return GEOM_CLASSIFICATION_INSIDE;
-          case TopAbs_ON: return GEOM_CLASSIFICATION_BOUNDS;
-          case TopAbs_OUT: 
-          case TopAbs_UNKNOWN: 
+
+    // Logical classification of the batch of points: all of them are on the face, some of them
+    // or none. Stops as soon as both matching and mismatching points have been found.
+    int classify(const std::vector<gp_Pnt>& points) {
+      bool wasMatch = false;
+      bool wasMissMatch = false;
+      for (size_t i = 0; i < points.size() && !(wasMatch && wasMissMatch); ++i) {
+        switch (classify(points[i])) {
+          case GEOM_CLASSIFICATION_BOUNDS:
+          case GEOM_CLASSIFICATION_INSIDE:
+            wasMatch = true;
+            break;
+          case GEOM_CLASSIFICATION_UNRELATED:
           default:
-            return GEOM_CLASSIFICATION_UNRELATED;
+            wasMissMatch = true;
         }
-    } else {
-      return GEOM_CLASSIFICATION_UNRELATED;    
-    }    
-  }
+      }
+      if (wasMatch && !wasMissMatch) {
+        return LOGICAL_CLASSIFICATION_ALL;
+      } else if (wasMatch && wasMissMatch) {
+        return LOGICAL_CLASSIFICATION_PARTIAL;
+      } else {
+        return LOGICAL_CLASSIFICATION_UNRELATED;
+      }
+    }
 
-  int classifyFaceToFace(const TopoDS_Face& face1, const TopoDS_Face& face2, float tol = -1) {
+  private:
+    TopoDS_Face face;
+    double tol;
+    Extrema_SurfaceProjector proj;
+    IntTools_FClass2d class2d;
+  };
 
-    if (tol < 0) {
-        tol = BRep_Tool::Tolerance(face1);        
+  // The classifiers of the recently used faces, the face matching after a boolean classifies
+  // the faces of the result against the same few faces of the operands over and over.
+  class FaceClassifierCache {
+  public:
+
+    static const size_t MAX_SIZE = 32;
+
+    static FaceClassifierCache& instance() {
+      static FaceClassifierCache cache;
+      return cache;
     }
 
+    FaceClassifier& get(const TopoDS_Face& face, double tol) {
+      if (tol < 0) {
+        tol = BRep_Tool::Tolerance(face);
+      }
+      for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if ((*it)->getFace().IsSame(face) && (*it)->getTolerance() == tol) {
+          entries.splice(entries.begin(), entries, it);
+          return *entries.front();
+        }
+      }
+      entries.emplace_front(new FaceClassifier(face, tol));
+      if (entries.size() > MAX_SIZE) {
+        entries.pop_back();
+      }
+      return *entries.front();
+    }
+
+    void clear() {
+      entries.clear();
+    }
+
+  private:
+    std::list<std::unique_ptr<FaceClassifier>> entries;
+  };
+
+  void clearFaceClassifierCache() {
+    FaceClassifierCache::instance().clear();
+  }
+
+  int classifyPointToFace(const TopoDS_Face& face, const gp_Pnt& p3d, float tol = -1) {
+    return FaceClassifierCache::instance().get(face, tol).classify(p3d);
+  }
+
+  int classifyFaceToFace(const TopoDS_Face& face1, const TopoDS_Face& face2, float tol = -1) {
+
     TopLoc_Location aLocation;  
     Handle(Poly_Triangulation) aTr = BRep_Tool::Triangulation(face2, aLocation);  
 
@@ -65,9 +171,9 @@ namespace e0 {
     Standard_Integer nnn = aTr->NbTriangles(); 
     Standard_Integer nt,n1,n2,n3; 
 
-    bool wasMatch = false;
-    bool wasMissMatch = false;
-
+    // the centroids of the triangles of face2 lifted to its surface
+    std::vector<gp_Pnt> points;
+    points.reserve(nnn);
     for( nt = 1 ; nt < nnn+1 ; nt++) { 
       // takes the node indices of each triangle in n1,n2,n3: 
       triangles(nt).Get(n1,n2,n3); 
@@ -78,28 +184,10 @@ namespace e0 {
 
       gp_Pnt2d centroidUV = gp_Pnt2d((uv1.X()+uv2.X()+uv3.X())/3, (uv1.Y()+uv2.Y()+uv3.Y())/3);
 
-      gp_Pnt evalPoint = surface->Value(centroidUV.X(), centroidUV.Y());
-
-      auto pfClassification = classifyPointToFace(face1, evalPoint, tol);
-
-      switch (pfClassification) {
-        case GEOM_CLASSIFICATION_BOUNDS:
-        case GEOM_CLASSIFICATION_INSIDE:
-          wasMatch = true;
-          break;
-        case GEOM_CLASSIFICATION_UNRELATED:
-        default:
-          wasMissMatch = true;
-      }
+      points.push_back(surface->Value(centroidUV.X(), centroidUV.Y()));
     }   
 
-    if (wasMatch && !wasMissMatch) {
-      return LOGICAL_CLASSIFICATION_ALL;
-    } else if (wasMatch && wasMissMatch) {
-      return LOGICAL_CLASSIFICATION_PARTIAL;
-    } else {
-      return LOGICAL_CLASSIFICATION_UNRELATED;
-    }
+    return FaceClassifierCache::instance().get(face1, tol).classify(points);
   }
 
   int classifyEdgeToFace(const TopoDS_Edge& edge, const TopoDS_Face& face, float tol = -1) {
@@ -112,47 +200,36 @@ namespace e0 {
 
     Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
 
+    if (curve.IsNull()) {
+      // degenerated edge
+      return LOGICAL_CLASSIFICATION_UNRELATED;
+    }
+
     intr = BOPTools_AlgoTools2D::IntermediatePoint(first, last);
 
     Standard_Real params[3] = {first, intr, last};
 
-    bool wasMatch = false;
-    bool wasMissMatch = false;
-
+    std::vector<gp_Pnt> points(3);
     for(int i  = 0 ; i < 3 ; i++) { 
-      
-      Standard_Real u = params[i];
-      
-      gp_Pnt evalPoint;
-  
-      curve->D0(u, evalPoint);
-
-      auto pfClassification = classifyPointToFace(face, evalPoint, tol);
-
-      switch (pfClassification) {
-        case GEOM_CLASSIFICATION_BOUNDS:
-        case GEOM_CLASSIFICATION_INSIDE:
-          wasMatch = true;
-          break;
-        case GEOM_CLASSIFICATION_UNRELATED:
-        default:
-          wasMissMatch = true;
-      }
+      curve->D0(params[i], points[i]);
     }   
 
-    if (wasMatch && !wasMissMatch) {
-      return LOGICAL_CLASSIFICATION_ALL;
-    } else if (wasMatch && wasMissMatch) {
-      return LOGICAL_CLASSIFICATION_PARTIAL;
-    } else {
-      return LOGICAL_CLASSIFICATION_UNRELATED;
-    }
+    return FaceClassifierCache::instance().get(face, tol).classify(points);
   }
 
+  // the overlapping on the whole edges is checked by BRepExtrema_EdgeOverlap
+  // (see io::edgesOverlap for the bulk check of many pairs)
   bool isEdgesOverlap(const TopoDS_Edge& e1, const TopoDS_Edge& e2, double tol = -1, double domainDist = 0.0) {
       if (tol < 0) {
         tol = BRep_Tool::Tolerance(e1);        
       }
+      if (domainDist == 0.0) {
+        BRepExtrema_EdgeOverlap overlap;
+        overlap.AddEdge1(e1);
+        overlap.AddEdge2(e2);
+        overlap.Perform(tol);
+        return !overlap.Results().IsEmpty();
+      }
       ShapeAnalysis_Edge sae;
       return sae.CheckOverlapping(e1, e2, tol, domainDist);
   } 
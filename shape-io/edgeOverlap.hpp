@@ -0,0 +1,51 @@
+#ifndef E0_IO_EDGE_OVERLAP_H
+#define E0_IO_EDGE_OVERLAP_H
+
+#include <vector>
+
+#include <TopoDS_Edge.hxx>
+#include <BRepExtrema_EdgeOverlap.hxx>
+
+#include "blob.hpp"
+
+namespace e0 {
+namespace io {
+
+// Overlapping pairs of edges of two sets, e.g. the edges of the operands and of the result of a boolean.
+// The edges overlap if the shorter one lies along the longer one within the tolerance (a negative tolerance
+// means the tolerance of the edge of the first set), as checked by ShapeAnalysis_Edge::CheckOverlapping.
+// The blob holds float64 values: the number of pairs followed by the packed pairs
+//   [edge1, edge2, first1, last1, first2, last2, deviation]
+// with zero-based indices of the edges in the sets and the overlapped ranges of parameters of the edges.
+// The candidate pairs are selected by the BVH trees of the edge polylines, the pairs are processed in parallel.
+void edgesOverlap(const std::vector<TopoDS_Edge>& edges1, const std::vector<TopoDS_Edge>& edges2, double tol, Blob& out) {
+  BRepExtrema_EdgeOverlap overlap;
+  overlap.SetRunParallel(Standard_True);
+  for (const TopoDS_Edge& edge : edges1) {
+    overlap.AddEdge1(edge);
+  }
+  for (const TopoDS_Edge& edge : edges2) {
+    overlap.AddEdge2(edge);
+  }
+  overlap.Perform(tol);
+
+  const NCollection_Vector<BRepExtrema_EdgeOverlap::Result>& pairs = overlap.Results();
+  out.clear();
+  out.reserve(8 * (1 + 7 * pairs.Length()));
+  blobAppend(out, double(pairs.Length()));
+  for (NCollection_Vector<BRepExtrema_EdgeOverlap::Result>::Iterator it(pairs); it.More(); it.Next()) {
+    const BRepExtrema_EdgeOverlap::Result& pair = it.Value();
+    blobAppend(out, double(pair.Edge1 - 1));
+    blobAppend(out, double(pair.Edge2 - 1));
+    blobAppend(out, pair.First1);
+    blobAppend(out, pair.Last1);
+    blobAppend(out, pair.First2);
+    blobAppend(out, pair.Last2);
+    blobAppend(out, pair.Deviation);
+  }
+}
+
+}
+}
+
+#endif // E0_IO_EDGE_OVERLAP_H
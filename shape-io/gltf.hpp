@@ -0,0 +1,336 @@
+#ifndef E0_IO_GLTF_H
+#define E0_IO_GLTF_H
+
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
+#include <GeomLib.hxx>
+#include <Geom_Surface.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <gp_Trsf.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "blob.hpp"
+#include "commonIO.hpp"
+
+namespace e0 {
+namespace io {
+
+// Encoding of vertex attributes in the binary buffer.
+enum GlbEncoding {
+  GLB_FLOAT = 0,     // 32-bit float positions and normals
+  GLB_QUANTIZED = 1  // 16-bit integer positions and 8-bit normalized normals (KHR_mesh_quantization)
+};
+
+struct GlbOptions {
+  Standard_Real deflection;  // meshing deflection, existing triangulation is used as is when <= 0
+  GlbEncoding encoding;
+  bool normals;
+
+  GlbOptions() : deflection(2), encoding(GLB_FLOAT), normals(true) {}
+};
+
+// Triangulated face to be written as a separate primitive.
+struct GlbFace {
+  TopoDS_Face face;
+  Handle(Poly_Triangulation) tr;
+  gp_Trsf trsf;
+  bool flip;  // triangle winding should be reversed (reversed face or mirroring location)
+};
+
+// Computes normals of the triangulation nodes in the triangulation coordinate system
+// oriented along the natural normal of the surface (the same way triangles are wound by the mesher).
+void glbNodeNormals(const TopoDS_Face& aFace, const Handle(Poly_Triangulation)& aTr, std::vector<gp_XYZ>& out) {
+  const Standard_Integer nbNodes = aTr->NbNodes();
+  out.assign(nbNodes, gp_XYZ());
+  if (aTr->HasNormals()) {
+    for (Standard_Integer i = 1; i <= nbNodes; ++i) {
+      out[i - 1] = aTr->Normal(i).XYZ();
+    }
+    return;
+  }
+
+  // averaged facet normals are used where the surface normal is undefined
+  std::vector<gp_XYZ> facets(nbNodes, gp_XYZ());
+  for (Standard_Integer t = 1; t <= aTr->NbTriangles(); ++t) {
+    Standard_Integer n1, n2, n3;
+    aTr->Triangle(t).Get(n1, n2, n3);
+    const gp_XYZ p1 = aTr->Node(n1).XYZ();
+    const gp_XYZ v = (aTr->Node(n2).XYZ() - p1).Crossed(aTr->Node(n3).XYZ() - p1);
+    facets[n1 - 1] += v;
+    facets[n2 - 1] += v;
+    facets[n3 - 1] += v;
+  }
+
+  // the triangulation is defined in the coordinate system of the face surface without face location
+  Handle(Geom_Surface) aSurface;
+  if (aTr->HasUVNodes()) {
+    aSurface = BRep_Tool::Surface(TopoDS::Face(aFace.Located(TopLoc_Location())));
+  }
+  for (Standard_Integer i = 1; i <= nbNodes; ++i) {
+    gp_Dir aNorm;
+    if (!aSurface.IsNull() && GeomLib::NormEstim(aSurface, aTr->UVNode(i), Precision::Confusion(), aNorm) <= 1) {
+      out[i - 1] = aNorm.XYZ();
+    } else if (facets[i - 1].Modulus() > gp::Resolution()) {
+      out[i - 1] = facets[i - 1] / facets[i - 1].Modulus();
+    } else {
+      out[i - 1] = gp::DZ().XYZ();
+    }
+  }
+}
+
+void glbJsonFloat(std::ostream& os, double value) {
+  os << (std::isfinite(value) ? value : 0.0);
+}
+
+// Writes the shape triangulation as binary glTF 2.0, one mesh primitive per face.
+// Nodes are written in the absolute coordinate system, face references are written to the primitive extras.
+void writeGlb(const TopoDS_Shape& aShape, const GlbOptions& options, Blob& out) {
+  if (options.deflection > 0) {
+    BRepMesh_IncrementalMesh(aShape, options.deflection);
+  }
+
+  std::vector<GlbFace> faces;
+  Bnd_Box aBox;
+  for (TopExp_Explorer aExpFace(aShape, TopAbs_FACE); aExpFace.More(); aExpFace.Next()) {
+    GlbFace glbFace;
+    glbFace.face = TopoDS::Face(aExpFace.Current());
+    TopLoc_Location aLocation;
+    glbFace.tr = BRep_Tool::Triangulation(glbFace.face, aLocation);
+    if (glbFace.tr.IsNull() || glbFace.tr->NbTriangles() == 0) {
+      continue;
+    }
+    glbFace.trsf = aLocation.Transformation();
+    glbFace.flip = (glbFace.face.Orientation() == TopAbs_REVERSED) != glbFace.trsf.IsNegative();
+    for (Standard_Integer i = 1; i <= glbFace.tr->NbNodes(); ++i) {
+      aBox.Add(glbFace.tr->Node(i).Transformed(glbFace.trsf));
+    }
+    faces.push_back(glbFace);
+  }
+
+  const bool quantized = options.encoding == GLB_QUANTIZED;
+
+  // quantized positions are integers within [-32767, 32767] covering the bounding cube,
+  // real coordinates are restored by the node transformation
+  gp_XYZ center;
+  double scale = 1.0;
+  if (quantized && !aBox.IsVoid()) {
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    aBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    center.SetCoord((xMin + xMax) / 2, (yMin + yMax) / 2, (zMin + zMax) / 2);
+    scale = std::max(xMax - xMin, std::max(yMax - yMin, zMax - zMin)) / 2 / 32767.0;
+    if (scale <= gp::Resolution()) {
+      scale = 1.0;
+    }
+  }
+
+  const size_t posStride = quantized ? 4 * sizeof(int16_t) : 3 * sizeof(float);
+  const size_t normStride = quantized ? 4 * sizeof(int8_t) : 3 * sizeof(float);
+
+  Blob positions, normals, indices;
+  std::ostringstream accessors, primitives;
+  accessors.precision(std::numeric_limits<float>::max_digits10);
+  int nbAccessors = 0;
+  std::vector<gp_XYZ> nodeNormals;
+  for (size_t f = 0; f < faces.size(); ++f) {
+    const GlbFace& glbFace = faces[f];
+    const Handle(Poly_Triangulation)& aTr = glbFace.tr;
+    const Standard_Integer nbNodes = aTr->NbNodes();
+    const size_t posOffset = positions.size();
+    const size_t normOffset = normals.size();
+    const size_t indexOffset = indices.size();
+
+    double minPos[3] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+    double maxPos[3] = { -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max() };
+    for (Standard_Integer i = 1; i <= nbNodes; ++i) {
+      const gp_XYZ p = aTr->Node(i).Transformed(glbFace.trsf).XYZ();
+      for (int k = 0; k < 3; ++k) {
+        double value;
+        if (quantized) {
+          const int16_t q = (int16_t) std::lround(std::min(32767.0, std::max(-32767.0, (p.Coord(k + 1) - center.Coord(k + 1)) / scale)));
+          blobAppend(positions, q);
+          value = q;
+        } else {
+          const float v = (float) p.Coord(k + 1);
+          blobAppend(positions, v);
+          value = v;
+        }
+        minPos[k] = std::min(minPos[k], value);
+        maxPos[k] = std::max(maxPos[k], value);
+      }
+      if (quantized) {
+        blobAppend(positions, (int16_t) 0);
+      }
+    }
+
+    if (options.normals) {
+      glbNodeNormals(glbFace.face, aTr, nodeNormals);
+      const bool reversed = glbFace.face.Orientation() == TopAbs_REVERSED;
+      for (Standard_Integer i = 1; i <= nbNodes; ++i) {
+        gp_XYZ n = nodeNormals[i - 1];
+        n.Multiply(glbFace.trsf.HVectorialPart());  // locations are rigid, no inverse transpose needed
+        if (reversed) {
+          n.Reverse();
+        }
+        if (quantized) {
+          for (int k = 1; k <= 3; ++k) {
+            blobAppend(normals, (int8_t) std::lround(std::min(1.0, std::max(-1.0, n.Coord(k))) * 127.0));
+          }
+          blobAppend(normals, (int8_t) 0);
+        } else {
+          for (int k = 1; k <= 3; ++k) {
+            blobAppend(normals, (float) n.Coord(k));
+          }
+        }
+      }
+    }
+
+    const bool shortIndices = nbNodes <= 65535;
+    const Standard_Integer nbTriangles = aTr->NbTriangles();
+    for (Standard_Integer t = 1; t <= nbTriangles; ++t) {
+      Standard_Integer n[3];
+      aTr->Triangle(t).Get(n[0], n[1], n[2]);
+      if (glbFace.flip) {
+        std::swap(n[1], n[2]);
+      }
+      for (int k = 0; k < 3; ++k) {
+        if (shortIndices) {
+          blobAppend(indices, (uint16_t) (n[k] - 1));
+        } else {
+          blobAppend(indices, (uint32_t) (n[k] - 1));
+        }
+      }
+    }
+    blobAlign(indices, 4);
+
+    const int posAccessor = nbAccessors++;
+    accessors << (posAccessor == 0 ? "" : ",")
+              << "{\"bufferView\":0,\"byteOffset\":" << posOffset
+              << ",\"componentType\":" << (quantized ? 5122 : 5126)
+              << ",\"count\":" << nbNodes << ",\"type\":\"VEC3\",\"min\":[";
+    for (int k = 0; k < 3; ++k) {
+      accessors << (k == 0 ? "" : ",");
+      glbJsonFloat(accessors, minPos[k]);
+    }
+    accessors << "],\"max\":[";
+    for (int k = 0; k < 3; ++k) {
+      accessors << (k == 0 ? "" : ",");
+      glbJsonFloat(accessors, maxPos[k]);
+    }
+    accessors << "]}";
+
+    int normAccessor = -1;
+    if (options.normals) {
+      normAccessor = nbAccessors++;
+      accessors << ",{\"bufferView\":1,\"byteOffset\":" << normOffset
+                << ",\"componentType\":" << (quantized ? 5120 : 5126)
+                << (quantized ? ",\"normalized\":true" : "")
+                << ",\"count\":" << nbNodes << ",\"type\":\"VEC3\"}";
+    }
+
+    const int indexAccessor = nbAccessors++;
+    accessors << ",{\"bufferView\":" << (options.normals ? 2 : 1) << ",\"byteOffset\":" << indexOffset
+              << ",\"componentType\":" << (shortIndices ? 5123 : 5125)
+              << ",\"count\":" << nbTriangles * 3 << ",\"type\":\"SCALAR\"}";
+
+    primitives << (f == 0 ? "" : ",")
+               << "{\"attributes\":{\"POSITION\":" << posAccessor;
+    if (normAccessor >= 0) {
+      primitives << ",\"NORMAL\":" << normAccessor;
+    }
+    primitives << "},\"indices\":" << indexAccessor << ",\"mode\":4"
+               << ",\"extras\":{\"ref\":" << getStableRefernce(glbFace.face) << "}}";
+  }
+
+  // binary chunk: positions, normals and indices, each section is 4-byte aligned
+  const size_t normViewOffset = positions.size();
+  const size_t indexViewOffset = normViewOffset + normals.size();
+  const size_t binLength = indexViewOffset + indices.size();
+
+  std::ostringstream json;
+  json.precision(std::numeric_limits<double>::max_digits10);
+  json << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"occt-interpreter shape-io\"}";
+  if (quantized) {
+    json << ",\"extensionsUsed\":[\"KHR_mesh_quantization\"],\"extensionsRequired\":[\"KHR_mesh_quantization\"]";
+  }
+  json << ",\"scene\":0";
+  if (faces.empty()) {
+    json << ",\"scenes\":[{}]}";
+  } else {
+    json << ",\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0";
+    if (quantized) {
+      json << ",\"translation\":[" << center.X() << "," << center.Y() << "," << center.Z() << "]"
+           << ",\"scale\":[" << scale << "," << scale << "," << scale << "]";
+    }
+    json << "}],\"meshes\":[{\"primitives\":[" << primitives.str() << "]}]"
+         << ",\"accessors\":[" << accessors.str() << "]"
+         << ",\"bufferViews\":[{\"buffer\":0,\"byteOffset\":0,\"byteLength\":" << positions.size()
+         << ",\"byteStride\":" << posStride << ",\"target\":34962}";
+    if (options.normals) {
+      json << ",{\"buffer\":0,\"byteOffset\":" << normViewOffset << ",\"byteLength\":" << normals.size()
+           << ",\"byteStride\":" << normStride << ",\"target\":34962}";
+    }
+    json << ",{\"buffer\":0,\"byteOffset\":" << indexViewOffset << ",\"byteLength\":" << indices.size()
+         << ",\"target\":34963}]"
+         << ",\"buffers\":[{\"byteLength\":" << binLength << "}]}";
+  }
+
+  std::string jsonChunk = json.str();
+  while (jsonChunk.size() % 4 != 0) {
+    jsonChunk.push_back(' ');
+  }
+
+  // all GLB lengths and offsets are 32-bit, the total bounds every chunk length and view offset
+  const size_t totalSize = 12 + 8 + jsonChunk.size() + (faces.empty() ? 0 : 8 + binLength);
+  out.clear();
+  if (totalSize > UINT32_MAX) {
+    std::cerr << "ERROR: GLB: size " << totalSize << " exceeds the 4 GB limit of the format\n";
+    return;
+  }
+  const uint32_t totalLength = uint32_t(totalSize);
+  out.reserve(totalLength);
+  blobAppend(out, (uint32_t) 0x46546C67);  // "glTF"
+  blobAppend(out, (uint32_t) 2);
+  blobAppend(out, totalLength);
+  blobAppend(out, (uint32_t) jsonChunk.size());
+  blobAppend(out, (uint32_t) 0x4E4F534A);  // "JSON"
+  blobAppendBytes(out, jsonChunk.data(), jsonChunk.size());
+  if (!faces.empty()) {
+    blobAppend(out, (uint32_t) binLength);
+    blobAppend(out, (uint32_t) 0x004E4942);  // "BIN"
+    blobAppendBytes(out, positions.data(), positions.size());
+    blobAppendBytes(out, normals.data(), normals.size());
+    blobAppendBytes(out, indices.data(), indices.size());
+  }
+}
+
+// Writes the shape triangulation as binary glTF 2.0 into the stream (e.g. file opened by the native tool).
+bool writeGlb(const TopoDS_Shape& aShape, const GlbOptions& options, std::ostream& os) {
+  Blob glb;
+  writeGlb(aShape, options, glb);
+  if (glb.empty()) {
+    return false;
+  }
+  os.write(glb.data(), std::streamsize(glb.size()));
+  return os.good();
+}
+
+}
+}
+
+#endif // E0_IO_GLTF_H
@@ -0,0 +1,49 @@
+#ifndef E0_IO_INTERFERENCE_H
+#define E0_IO_INTERFERENCE_H
+
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepExtrema_Clearance.hxx>
+
+#include "blob.hpp"
+
+namespace e0 {
+namespace io {
+
+// Sparse interference matrix of the shapes: the pairs which overlap, touch or are closer than the tolerance.
+// The blob holds float64 values: the number of pairs followed by the packed pairs
+//   [shape1, shape2, type, distance, depth]
+// with zero-based indices of the shapes in the list and the type 0 - near, 1 - touch, 2 - overlap.
+// The shapes are meshed with the given deflection if it is positive, otherwise the existing meshes are used;
+// the triangle sets of the shapes are built once and shared by all pairs, the pairs are processed in parallel.
+void interferenceMatrix(const std::vector<TopoDS_Shape>& shapes, double tol, double deflection, Blob& out) {
+  BRepExtrema_Clearance clearance;
+  clearance.SetRunParallel(Standard_True);
+  for (const TopoDS_Shape& shape : shapes) {
+    if (deflection > 0) {
+      BRepMesh_IncrementalMesh(shape, deflection);
+    }
+    clearance.AddShape(shape);
+  }
+  clearance.PerformInterference(tol);
+
+  const NCollection_Vector<BRepExtrema_Clearance::Interference>& pairs = clearance.Interferences();
+  out.clear();
+  out.reserve(8 * (1 + 5 * pairs.Length()));
+  blobAppend(out, double(pairs.Length()));
+  for (NCollection_Vector<BRepExtrema_Clearance::Interference>::Iterator it(pairs); it.More(); it.Next()) {
+    const BRepExtrema_Clearance::Interference& pair = it.Value();
+    blobAppend(out, double(pair.Shape1 - 1));
+    blobAppend(out, double(pair.Shape2 - 1));
+    blobAppend(out, double(pair.Type));
+    blobAppend(out, pair.Distance);
+    blobAppend(out, pair.Depth);
+  }
+}
+
+}
+}
+
+#endif // E0_IO_INTERFERENCE_H
@@ -34,6 +34,9 @@
 #include <GeomConvert.hxx>
 #include <Geom_BSplineSurface.hxx>
 #include <Geom_Surface.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <vector>
 #include "data.hpp"
 #include "commonIO.hpp"
 #include "surfaceIO.hpp"
@@ -81,15 +84,31 @@ PolygonOnTriangulation(const TopoDS_Edge&                E,
   return nullArray;
 }
 
-gp_Vec computeNormal(const gp_Pnt2d& aUVNode, const Handle(Geom_Surface)& aSurface)
+// computes the normals of the surface at all nodes of the triangulation at once,
+// the surface is evaluated by the batch of parameters sorted by the knot spans
+void computeNodeNormals(const Handle(Poly_Triangulation)& aTr, const Handle(Geom_Surface)& aSurface,
+  const TopLoc_Location& aLocation, std::vector<gp_Vec>& normals)
 {
-  gp_Pnt aDummyPnt;
-  gp_Vec aV1, aV2;
-  aSurface->D1 (aUVNode.X(), aUVNode.Y(), aDummyPnt, aV1, aV2);
-  gp_Vec aNormal = aV1.Crossed (aV2);
-  
-  aNormal.Multiply (1 / aNormal.Magnitude());
-  return aNormal;
+  const Standard_Integer nbNodes = aTr->NbNodes();
+  TColStd_Array1OfReal aU(1, nbNodes), aV(1, nbNodes);
+  for (Standard_Integer i = 1; i <= nbNodes; i++) {
+    const gp_Pnt2d aUVNode = aTr->UVNode(i);
+    aU(i) = aUVNode.X();
+    aV(i) = aUVNode.Y();
+  }
+
+  TColStd_Array1OfReal aPnts(1, 3 * nbNodes), aD1U(1, 3 * nbNodes), aD1V(1, 3 * nbNodes);
+  GeomAdaptor_Surface(aSurface).D1Batch(aU, aV, aPnts, aD1U, aD1V);
+
+  normals.resize(nbNodes + 1);
+  for (Standard_Integer i = 1; i <= nbNodes; i++) {
+    gp_Vec aV1(aD1U(i), aD1U(nbNodes + i), aD1U(2 * nbNodes + i));
+    gp_Vec aV2(aD1V(i), aD1V(nbNodes + i), aD1V(2 * nbNodes + i));
+    gp_Vec aNormal = aV1.Crossed (aV2);
+
+    aNormal.Multiply (1 / aNormal.Magnitude());
+    normals[i] = aNormal.Transformed(aLocation);
+  }
 }
 
 void writeFaceTessellation(const Handle(Poly_Triangulation)& aTr, const TopLoc_Location& aLocation, 
@@ -99,6 +118,10 @@ void writeFaceTessellation(const Handle(Poly_Triangulation)& aTr, const TopLoc_L
   Standard_Integer nnn = aTr->NbTriangles(); 
   Standard_Integer nt,n1,n2,n3; 
   bool isPlane = aSurface->IsKind("Geom_Plane");
+  std::vector<gp_Vec> normals;
+  if (!isPlane) {
+    computeNodeNormals(aTr, aSurface, aLocation, normals);
+  }
 
   for( nt = 1 ; nt < nnn+1 ; nt++) { 
     // takes the node indices of each triangle in n1,n2,n3: 
@@ -119,9 +142,9 @@ void writeFaceTessellation(const Handle(Poly_Triangulation)& aTr, const TopLoc_L
 
     if (!isPlane) {
       DATA norms = Array();
-      norms.append(dirWrite(computeNormal(aTr->UVNode(n1), aSurface).Transformed(aLocation)));  
-      norms.append(dirWrite(computeNormal(aTr->UVNode(n2), aSurface).Transformed(aLocation)));  
-      norms.append(dirWrite(computeNormal(aTr->UVNode(n3), aSurface).Transformed(aLocation)));
+      norms.append(dirWrite(normals[n1]));  
+      norms.append(dirWrite(normals[n2]));  
+      norms.append(dirWrite(normals[n3]));
       def.append(norms);  
     }
     
@@ -1,12 +1,21 @@
 #include <iostream>
+#include <sstream>
 
 #include <emscripten.h>
+#include <BOPTest_Objects.hxx>
 #include <DBRep.hxx>
 #include <gp_Trsf.hxx>
 #include "interrogate.hpp"
 #include "historyIO.hpp"
 #include "classify.hpp"
 #include "step.hpp"
+#include "gltf.hpp"
+#include "meshExport.hpp"
+#include "meshPreview.hpp"
+#include "pointClassify.hpp"
+#include "spatialIndex.hpp"
+#include "interference.hpp"
+#include "edgeOverlap.hpp"
 
 
 using namespace std;
@@ -39,6 +48,24 @@ extern "C" {
     SPI_publish_result(out);
   }
 
+  // Publishes the profile of the boolean operations collected since "bopprofile 1"
+  // (stage timings, candidate/interference counters, slowest face/face intersections).
+  EMSCRIPTEN_KEEPALIVE
+  void BooleanProfile(bool clear = false) {
+    const Handle(BOPAlgo_Profile)& profile = BOPTest_Objects::Profile();
+    io::DATA out = io::DATA::Make(io::DATA::Class::Object);
+    if (!profile.IsNull()) {
+      std::ostringstream json;
+      profile->Dump(json);
+      out = io::DATA::Load(json.str());
+      if (clear) {
+        profile->Clear();
+      }
+    }
+    out["enabled"] = !profile.IsNull();
+    SPI_publish_result(out);
+  }
+
   EMSCRIPTEN_KEEPALIVE
   std::uintptr_t GetRef(const char* shapeName) {
     TopoDS_Shape shape = DBRep::Get(shapeName);
@@ -59,6 +86,13 @@ extern "C" {
     return e0::classifyFaceToFace(*f1, *f2, tol);
   }
 
+  // Releases the classifiers of the faces kept between the classification calls
+  // (e.g. once the face matching after a boolean is finished).
+  EMSCRIPTEN_KEEPALIVE
+  void ClearFaceClassifierCache() {
+    e0::clearFaceClassifierCache();
+  }
+
   EMSCRIPTEN_KEEPALIVE
   int ClassifyEdgeToFace(int edgePtr, int facePtr, double tol) {
     TopoDS_Edge* e = reinterpret_cast<TopoDS_Edge*>(edgePtr);
@@ -80,6 +114,194 @@ extern "C" {
     e0::io::UpdateTessellation(*shape, deflection);
   }
 
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t ExportGLB(const char* shapeName, double deflection, bool quantize, bool normals) {
+    TopoDS_Shape shape = DBRep::Get(shapeName);
+    io::Blob* blob = new io::Blob();
+    try {
+      io::GlbOptions options;
+      options.deflection = deflection;
+      options.encoding = quantize ? io::GLB_QUANTIZED : io::GLB_FLOAT;
+      options.normals = normals;
+      io::writeGlb(shape, options, *blob);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      blob->clear();
+    }
+    return (std::uintptr_t) blob;
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t ExportMesh(const char* shapeName, int format, double deflection, double angle, double mergeTolerance) {
+    TopoDS_Shape shape = DBRep::Get(shapeName);
+    io::Blob* blob = new io::Blob();
+    try {
+      io::MeshExportOptions options;
+      if (deflection > 0) {
+        options.deflection = deflection;
+      }
+      if (angle > 0) {
+        options.angle = angle;
+      }
+      options.mergeTolerance = mergeTolerance;
+      io::exportMesh(shape, format == io::MESH_3MF ? io::MESH_3MF : io::MESH_STL, options, *blob);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      blob->clear();
+    }
+    return (std::uintptr_t) blob;
+  }
+
+  // op: 0 - fuse, 1 - common, 2 - cut
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t BooleanPreview(const char* objectName, const char* toolName, int op, double deflection) {
+    TopoDS_Shape object = DBRep::Get(objectName);
+    TopoDS_Shape tool = DBRep::Get(toolName);
+    io::Blob* blob = new io::Blob();
+    try {
+      io::booleanPreview(object, tool, op == 1 ? MeshCSG_Common : (op == 2 ? MeshCSG_Cut : MeshCSG_Fuse), deflection, *blob);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      blob->clear();
+    }
+    return (std::uintptr_t) blob;
+  }
+
+  // coords: x, y, z of the points; the blob holds one TopAbs_State byte per point
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t ClassifyPoints(const char* shapeName, const double* coords, int nbPoints, double tol, double deflection) {
+    TopoDS_Shape shape = DBRep::Get(shapeName);
+    io::Blob* blob = new io::Blob();
+    try {
+      io::classifyPoints(shape, coords, nbPoints, tol, deflection, *blob);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      blob->clear();
+    }
+    return (std::uintptr_t) blob;
+  }
+
+  // shapeNames: the names of the shapes separated by spaces; the blob is written by io::interferenceMatrix
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t InterferenceMatrix(const char* shapeNames, double tol, double deflection) {
+    std::vector<TopoDS_Shape> shapes;
+    std::istringstream names(shapeNames);
+    std::string name;
+    while (names >> name) {
+      Standard_CString namePtr = name.c_str();
+      shapes.push_back(DBRep::Get(namePtr));
+    }
+    io::Blob* blob = new io::Blob();
+    try {
+      io::interferenceMatrix(shapes, tol, deflection, *blob);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      blob->clear();
+    }
+    return (std::uintptr_t) blob;
+  }
+
+  // edges1, edges2: the pointers to the edges of two sets; the blob is written by io::edgesOverlap
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t EdgesOverlap(const int* edges1, int nbEdges1, const int* edges2, int nbEdges2, double tol) {
+    std::vector<TopoDS_Edge> set1, set2;
+    for (int i = 0; i < nbEdges1; i++) {
+      set1.push_back(*reinterpret_cast<TopoDS_Edge*>(edges1[i]));
+    }
+    for (int i = 0; i < nbEdges2; i++) {
+      set2.push_back(*reinterpret_cast<TopoDS_Edge*>(edges2[i]));
+    }
+    io::Blob* blob = new io::Blob();
+    try {
+      io::edgesOverlap(set1, set2, tol, *blob);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      blob->clear();
+    }
+    return (std::uintptr_t) blob;
+  }
+
+  // Spatial index of the faces, edges and vertices of the shape; the queries return the blobs
+  // written by writeSpatialHit / writeSpatialRefs referring to the sub-shapes by the stable references.
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t CreateSpatialIndex(const char* shapeName, double deflection) {
+    TopoDS_Shape shape = DBRep::Get(shapeName);
+    io::SpatialIndex* index = new io::SpatialIndex(deflection);
+    try {
+      index->update(shape);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+    }
+    return (std::uintptr_t) index;
+  }
+
+  // Reindexes the changed sub-shapes of the shape, returns the number of the rebuilt faces and edges.
+  EMSCRIPTEN_KEEPALIVE
+  int UpdateSpatialIndex(std::uintptr_t indexPtr, const char* shapeName) {
+    io::SpatialIndex* index = reinterpret_cast<io::SpatialIndex*>(indexPtr);
+    TopoDS_Shape shape = DBRep::Get(shapeName);
+    try {
+      return index->update(shape);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+      return -1;
+    }
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  void DisposeSpatialIndex(std::uintptr_t indexPtr) {
+    delete reinterpret_cast<io::SpatialIndex*>(indexPtr);
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t SpatialIndexPick(std::uintptr_t indexPtr, double ox, double oy, double oz, double dx, double dy, double dz) {
+    const io::SpatialIndex* index = reinterpret_cast<io::SpatialIndex*>(indexPtr);
+    io::Blob* blob = new io::Blob();
+    io::SpatialIndex::Hit hit;
+    const gp_Vec dir(dx, dy, dz);
+    const bool found = dir.Magnitude() > gp::Resolution() && index->pick(gp_Pnt(ox, oy, oz), gp_Dir(dir), hit);
+    io::writeSpatialHit(found, hit, *blob);
+    return (std::uintptr_t) blob;
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t SpatialIndexSnap(std::uintptr_t indexPtr, double x, double y, double z, double radius) {
+    const io::SpatialIndex* index = reinterpret_cast<io::SpatialIndex*>(indexPtr);
+    io::Blob* blob = new io::Blob();
+    io::SpatialIndex::Hit hit;
+    const bool found = index->snap(gp_Pnt(x, y, z), radius, hit);
+    io::writeSpatialHit(found, hit, *blob);
+    return (std::uintptr_t) blob;
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t SpatialIndexBoxQuery(std::uintptr_t indexPtr, double x1, double y1, double z1, double x2, double y2, double z2) {
+    const io::SpatialIndex* index = reinterpret_cast<io::SpatialIndex*>(indexPtr);
+    io::Blob* blob = new io::Blob();
+    std::vector<std::uintptr_t> faceRefs, edgeRefs, vertexRefs;
+    index->boxQuery(gp_Pnt(Min(x1, x2), Min(y1, y2), Min(z1, z2)), gp_Pnt(Max(x1, x2), Max(y1, y2), Max(z1, z2)),
+                    faceRefs, edgeRefs, vertexRefs);
+    io::writeSpatialRefs(faceRefs, edgeRefs, vertexRefs, *blob);
+    return (std::uintptr_t) blob;
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  std::uintptr_t BlobData(std::uintptr_t blobPtr) {
+    io::Blob* blob = reinterpret_cast<io::Blob*>(blobPtr);
+    return (std::uintptr_t) blob->data();
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  std::size_t BlobSize(std::uintptr_t blobPtr) {
+    io::Blob* blob = reinterpret_cast<io::Blob*>(blobPtr);
+    return blob->size();
+  }
+
+  EMSCRIPTEN_KEEPALIVE
+  void FreeBlob(std::uintptr_t blobPtr) {
+    delete reinterpret_cast<io::Blob*>(blobPtr);
+  }
+
   EMSCRIPTEN_KEEPALIVE
   void SetLocation(const char* shapeName, float mx0, float mx1, float mx2, float mx3, float mx4, float mx5, float mx6, float mx7, float mx8, float mx9, float mx10, float mx11) {
     try {
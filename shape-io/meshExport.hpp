@@ -0,0 +1,297 @@
+#ifndef E0_IO_MESH_EXPORT_H
+#define E0_IO_MESH_EXPORT_H
+
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_MergeNodesTool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <gp_Trsf.hxx>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "blob.hpp"
+
+namespace e0 {
+namespace io {
+
+enum MeshFormat {
+  MESH_STL = 0,  // binary STL
+  MESH_3MF = 1   // 3MF package with a single mesh object
+};
+
+struct MeshExportOptions {
+  Standard_Real deflection;      // linear meshing deflection (model units)
+  Standard_Real angle;           // angular meshing deflection (radians)
+  Standard_Real mergeTolerance;  // distance of nodes merged across faces, only coincident nodes are merged when 0
+  bool parallel;
+
+  MeshExportOptions() : deflection(0.01), angle(0.1), mergeTolerance(0), parallel(true) {}
+};
+
+// Face triangles in the absolute coordinate system, oriented along the face normal.
+struct MeshExportFace {
+  TopoDS_Face face;
+  std::vector<gp_XYZ> nodes;
+  std::vector<Poly_Triangle> triangles;
+};
+
+// Number of items processed by one task of parallel writers.
+static const int MESH_EXPORT_CHUNK = 4096;
+
+// Meshes the shape and merges nodes shared by faces into a single watertight triangulation.
+Handle(Poly_Triangulation) buildPrintMesh(const TopoDS_Shape& aShape, const MeshExportOptions& options) {
+  BRepMesh_IncrementalMesh(aShape, options.deflection, Standard_False, options.angle, options.parallel);
+
+  std::vector<MeshExportFace> faces;
+  for (TopExp_Explorer aExpFace(aShape, TopAbs_FACE); aExpFace.More(); aExpFace.Next()) {
+    faces.push_back(MeshExportFace());
+    faces.back().face = TopoDS::Face(aExpFace.Current());
+  }
+
+  // nodes transformation and orientation of triangles are independent per face
+  OSD_Parallel::For(0, int(faces.size()), [&faces](int f) {
+    MeshExportFace& exportFace = faces[f];
+    TopLoc_Location aLocation;
+    const Handle(Poly_Triangulation) aTr = BRep_Tool::Triangulation(exportFace.face, aLocation);
+    if (aTr.IsNull()) {
+      return;
+    }
+    const gp_Trsf aTrsf = aLocation.Transformation();
+    const bool flip = (exportFace.face.Orientation() == TopAbs_REVERSED) != aTrsf.IsNegative();
+    exportFace.nodes.resize(aTr->NbNodes());
+    for (Standard_Integer i = 1; i <= aTr->NbNodes(); ++i) {
+      exportFace.nodes[i - 1] = aTr->Node(i).Transformed(aTrsf).XYZ();
+    }
+    exportFace.triangles.resize(aTr->NbTriangles());
+    for (Standard_Integer t = 1; t <= aTr->NbTriangles(); ++t) {
+      Standard_Integer n1, n2, n3;
+      aTr->Triangle(t).Get(n1, n2, n3);
+      exportFace.triangles[t - 1] = flip ? Poly_Triangle(n1, n3, n2) : Poly_Triangle(n1, n2, n3);
+    }
+  }, !options.parallel);
+
+  int nbTriangles = 0;
+  for (size_t f = 0; f < faces.size(); ++f) {
+    nbTriangles += int(faces[f].triangles.size());
+  }
+  if (nbTriangles == 0) {
+    return Handle(Poly_Triangulation)();
+  }
+
+  // any angle between the face normals is accepted, so that the faces are stitched by the shared nodes
+  Poly_MergeNodesTool aMerger(M_PI, options.mergeTolerance, nbTriangles);
+  for (size_t f = 0; f < faces.size(); ++f) {
+    MeshExportFace& exportFace = faces[f];
+    for (size_t t = 0; t < exportFace.triangles.size(); ++t) {
+      const Poly_Triangle& tri = exportFace.triangles[t];
+      for (int k = 0; k < 3; ++k) {
+        aMerger.ChangeElementNode(k) = exportFace.nodes[tri.Value(k + 1) - 1];
+      }
+      aMerger.PushLastTriangle();
+    }
+    std::vector<gp_XYZ>().swap(exportFace.nodes);
+    std::vector<Poly_Triangle>().swap(exportFace.triangles);
+  }
+  return aMerger.Result();
+}
+
+// Writes the triangulation as binary STL; the facets are formatted by chunks in parallel if requested.
+void writeStl(const Handle(Poly_Triangulation)& aTr, Blob& out, bool parallel = true) {
+  const int nbTriangles = aTr.IsNull() ? 0 : aTr->NbTriangles();
+  const size_t headerSize = 84, facetSize = 50;
+
+  out.assign(headerSize + facetSize * nbTriangles, 0);
+  const char header[] = "occt-interpreter binary STL";
+  memcpy(&out[0], header, sizeof(header) - 1);
+  const uint32_t count = uint32_t(nbTriangles);
+  memcpy(&out[80], &count, sizeof(count));
+
+  const int nbChunks = (nbTriangles + MESH_EXPORT_CHUNK - 1) / MESH_EXPORT_CHUNK;
+  OSD_Parallel::For(0, nbChunks, [&](int chunk) {
+    const int last = std::min(nbTriangles, (chunk + 1) * MESH_EXPORT_CHUNK);
+    for (int t = chunk * MESH_EXPORT_CHUNK; t < last; ++t) {
+      Standard_Integer n1, n2, n3;
+      aTr->Triangle(t + 1).Get(n1, n2, n3);
+      const gp_XYZ p1 = aTr->Node(n1).XYZ(), p2 = aTr->Node(n2).XYZ(), p3 = aTr->Node(n3).XYZ();
+      gp_XYZ n = (p2 - p1).Crossed(p3 - p1);
+      const Standard_Real len = n.Modulus();
+      if (len > gp::Resolution()) {
+        n /= len;
+      }
+      const float facet[12] = {
+        float(n.X()),  float(n.Y()),  float(n.Z()),
+        float(p1.X()), float(p1.Y()), float(p1.Z()),
+        float(p2.X()), float(p2.Y()), float(p2.Z()),
+        float(p3.X()), float(p3.Y()), float(p3.Z())
+      };
+      // the attribute byte count following the facet is left zero
+      memcpy(&out[headerSize + facetSize * size_t(t)], facet, sizeof(facet));
+    }
+  }, !parallel);
+}
+
+// Lookup table of CRC-32 (ISO 3309) used by ZIP archives.
+std::vector<uint32_t> zipCrc32Table() {
+  std::vector<uint32_t> table(256);
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; ++k) {
+      c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    }
+    table[i] = c;
+  }
+  return table;
+}
+
+// CRC-32 of the data, as required by ZIP archives.
+uint32_t zipCrc32(const char* data, size_t size) {
+  static const std::vector<uint32_t> table = zipCrc32Table();
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; ++i) {
+    crc = table[(crc ^ (unsigned char) data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+// Writes the entries as ZIP archive without compression (allowed by the OPC packages used by 3MF).
+void writeZipStored(const std::vector<std::pair<std::string, std::string> >& entries, Blob& out) {
+  Blob directory;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const std::string& name = entries[i].first;
+    const std::string& data = entries[i].second;
+    const uint32_t crc = zipCrc32(data.data(), data.size());
+    const uint32_t offset = uint32_t(out.size());
+
+    blobAppend(out, (uint32_t) 0x04034B50);  // local file header
+    blobAppend(out, (uint16_t) 20);          // version needed
+    blobAppend(out, (uint16_t) 0);           // flags
+    blobAppend(out, (uint16_t) 0);           // stored
+    blobAppend(out, (uint16_t) 0);           // time
+    blobAppend(out, (uint16_t) 0x21);        // date (1980-01-01)
+    blobAppend(out, crc);
+    blobAppend(out, (uint32_t) data.size());
+    blobAppend(out, (uint32_t) data.size());
+    blobAppend(out, (uint16_t) name.size());
+    blobAppend(out, (uint16_t) 0);
+    blobAppendBytes(out, name.data(), name.size());
+    blobAppendBytes(out, data.data(), data.size());
+
+    blobAppend(directory, (uint32_t) 0x02014B50);  // central directory header
+    blobAppend(directory, (uint16_t) 20);          // version made by
+    blobAppend(directory, (uint16_t) 20);          // version needed
+    blobAppend(directory, (uint16_t) 0);
+    blobAppend(directory, (uint16_t) 0);
+    blobAppend(directory, (uint16_t) 0);
+    blobAppend(directory, (uint16_t) 0x21);
+    blobAppend(directory, crc);
+    blobAppend(directory, (uint32_t) data.size());
+    blobAppend(directory, (uint32_t) data.size());
+    blobAppend(directory, (uint16_t) name.size());
+    blobAppend(directory, (uint16_t) 0);           // extra field length
+    blobAppend(directory, (uint16_t) 0);           // comment length
+    blobAppend(directory, (uint16_t) 0);           // disk number
+    blobAppend(directory, (uint16_t) 0);           // internal attributes
+    blobAppend(directory, (uint32_t) 0);           // external attributes
+    blobAppend(directory, offset);
+    blobAppendBytes(directory, name.data(), name.size());
+  }
+
+  const uint32_t directoryOffset = uint32_t(out.size());
+  blobAppendBytes(out, directory.data(), directory.size());
+  blobAppend(out, (uint32_t) 0x06054B50);  // end of central directory
+  blobAppend(out, (uint16_t) 0);
+  blobAppend(out, (uint16_t) 0);
+  blobAppend(out, (uint16_t) entries.size());
+  blobAppend(out, (uint16_t) entries.size());
+  blobAppend(out, (uint32_t) directory.size());
+  blobAppend(out, directoryOffset);
+  blobAppend(out, (uint16_t) 0);
+}
+
+// Writes the triangulation as 3MF package (model units are treated as millimeters).
+void write3mf(const Handle(Poly_Triangulation)& aTr, Blob& out, bool parallel = true) {
+  const int nbNodes = aTr.IsNull() ? 0 : aTr->NbNodes();
+  const int nbTriangles = aTr.IsNull() ? 0 : aTr->NbTriangles();
+
+  // vertices and triangles are formatted by chunks (in parallel if requested) and concatenated afterwards
+  const int nbNodeChunks = (nbNodes + MESH_EXPORT_CHUNK - 1) / MESH_EXPORT_CHUNK;
+  const int nbTriChunks = (nbTriangles + MESH_EXPORT_CHUNK - 1) / MESH_EXPORT_CHUNK;
+  std::vector<std::string> chunks(nbNodeChunks + nbTriChunks);
+  OSD_Parallel::For(0, int(chunks.size()), [&](int chunk) {
+    char buffer[128];
+    std::string& text = chunks[chunk];
+    if (chunk < nbNodeChunks) {
+      const int last = std::min(nbNodes, (chunk + 1) * MESH_EXPORT_CHUNK);
+      for (int i = chunk * MESH_EXPORT_CHUNK; i < last; ++i) {
+        const gp_Pnt p = aTr->Node(i + 1);
+        text.append(buffer, snprintf(buffer, sizeof(buffer), "<vertex x=\"%.9g\" y=\"%.9g\" z=\"%.9g\"/>\n",
+                                     float(p.X()), float(p.Y()), float(p.Z())));
+      }
+    } else {
+      const int first = (chunk - nbNodeChunks) * MESH_EXPORT_CHUNK;
+      const int last = std::min(nbTriangles, first + MESH_EXPORT_CHUNK);
+      for (int t = first; t < last; ++t) {
+        Standard_Integer n1, n2, n3;
+        aTr->Triangle(t + 1).Get(n1, n2, n3);
+        text.append(buffer, snprintf(buffer, sizeof(buffer), "<triangle v1=\"%d\" v2=\"%d\" v3=\"%d\"/>\n",
+                                     n1 - 1, n2 - 1, n3 - 1));
+      }
+    }
+  }, !parallel);
+
+  std::string model =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<model unit=\"millimeter\" xml:lang=\"en-US\" xmlns=\"http://schemas.microsoft.com/3dmanufacturing/core/2015/02\">\n"
+    "<resources>\n<object id=\"1\" type=\"model\">\n<mesh>\n<vertices>\n";
+  for (int c = 0; c < nbNodeChunks; ++c) {
+    model += chunks[c];
+  }
+  model += "</vertices>\n<triangles>\n";
+  for (int c = nbNodeChunks; c < int(chunks.size()); ++c) {
+    model += chunks[c];
+  }
+  model += "</triangles>\n</mesh>\n</object>\n</resources>\n<build>\n<item objectid=\"1\"/>\n</build>\n</model>\n";
+  std::vector<std::string>().swap(chunks);
+
+  std::vector<std::pair<std::string, std::string> > entries;
+  entries.push_back(std::make_pair(std::string("[Content_Types].xml"), std::string(
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+    "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+    "<Default Extension=\"model\" ContentType=\"application/vnd.ms-package.3dmanufacturing-3dmodel+xml\"/>"
+    "</Types>\n")));
+  entries.push_back(std::make_pair(std::string("_rels/.rels"), std::string(
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+    "<Relationship Target=\"/3D/3dmodel.model\" Id=\"rel0\" Type=\"http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel\"/>"
+    "</Relationships>\n")));
+  entries.push_back(std::make_pair(std::string("3D/3dmodel.model"), std::string()));
+  entries.back().second.swap(model);
+
+  out.clear();
+  writeZipStored(entries, out);
+}
+
+// Meshes the shape for printing and writes it in the given format.
+void exportMesh(const TopoDS_Shape& aShape, MeshFormat format, const MeshExportOptions& options, Blob& out) {
+  const Handle(Poly_Triangulation) aMesh = buildPrintMesh(aShape, options);
+  if (format == MESH_3MF) {
+    write3mf(aMesh, out, options.parallel);
+  } else {
+    writeStl(aMesh, out, options.parallel);
+  }
+}
+
+}
+}
+
+#endif // E0_IO_MESH_EXPORT_H
@@ -0,0 +1,66 @@
+#ifndef E0_IO_MESH_PREVIEW_H
+#define E0_IO_MESH_PREVIEW_H
+
+#include <TopoDS_Shape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <MeshCSG_Boolean.hxx>
+#include <Poly_Triangulation.hxx>
+
+#include <cstdint>
+
+#include "blob.hpp"
+
+namespace e0 {
+namespace io {
+
+// Writes the triangulation as:
+//   uint32 nbNodes, uint32 nbTriangles, float32 xyz[3 * nbNodes], uint32 indices[3 * nbTriangles] (0-based).
+void writePreviewMesh(const Handle(Poly_Triangulation)& aTr, Blob& out) {
+  const uint32_t nbNodes = aTr.IsNull() ? 0 : aTr->NbNodes();
+  const uint32_t nbTris = aTr.IsNull() ? 0 : aTr->NbTriangles();
+  out.clear();
+  out.reserve(8 + 12 * size_t(nbNodes) + 12 * size_t(nbTris));
+  blobAppend(out, nbNodes);
+  blobAppend(out, nbTris);
+  for (uint32_t i = 1; i <= nbNodes; ++i) {
+    const gp_Pnt p = aTr->Node(i);
+    blobAppend(out, float(p.X()));
+    blobAppend(out, float(p.Y()));
+    blobAppend(out, float(p.Z()));
+  }
+  for (uint32_t i = 1; i <= nbTris; ++i) {
+    Standard_Integer n1, n2, n3;
+    aTr->Triangle(i).Get(n1, n2, n3);
+    blobAppend(out, uint32_t(n1 - 1));
+    blobAppend(out, uint32_t(n2 - 1));
+    blobAppend(out, uint32_t(n3 - 1));
+  }
+}
+
+// Approximate Boolean operation on the display meshes of the shapes for the real-time preview,
+// the exact result is to be computed by the regular Boolean commands on commit.
+// The shapes are meshed with the given deflection if it is positive, otherwise the meshes
+// computed by the interrogation are used. The blob is empty if any shape has no mesh.
+void booleanPreview(const TopoDS_Shape& object, const TopoDS_Shape& tool, MeshCSG_Operation op,
+                    double deflection, Blob& out) {
+  if (deflection > 0) {
+    BRepMesh_IncrementalMesh(object, deflection);
+    BRepMesh_IncrementalMesh(tool, deflection);
+  }
+  MeshCSG_Boolean bop;
+  bop.SetObject(MeshCSG_Boolean::Triangulation(object));
+  bop.SetTool(MeshCSG_Boolean::Triangulation(tool));
+  bop.SetOperation(op);
+  bop.SetRunParallel(Standard_True);
+  bop.Perform();
+  if (!bop.IsDone()) {
+    out.clear();
+    return;
+  }
+  writePreviewMesh(bop.Result(), out);
+}
+
+}
+}
+
+#endif // E0_IO_MESH_PREVIEW_H
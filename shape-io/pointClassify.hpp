@@ -0,0 +1,40 @@
+#ifndef E0_IO_POINT_CLASSIFY_H
+#define E0_IO_POINT_CLASSIFY_H
+
+#include <TopoDS.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepClass3d_BulkClassifier.hxx>
+
+#include "blob.hpp"
+
+namespace e0 {
+namespace io {
+
+// Classifies the points relatively the first solid of the shape, writing one byte per point:
+//   0 - inside, 1 - outside, 2 - on the boundary, 3 - unknown (TopAbs_State values).
+// The points far from the boundary are classified on the mesh of the solid, the ones closer
+// than the mesh deflection are classified exactly. The solid is meshed with the given deflection
+// if it is positive, otherwise the existing mesh is used (all points are classified exactly without it).
+// The search tree is built on each call, so the points should be passed at once.
+void classifyPoints(const TopoDS_Shape& shape, const double* coords, int nbPoints, double tol,
+                    double deflection, Blob& out) {
+  out.assign(nbPoints > 0 ? nbPoints : 0, char(TopAbs_UNKNOWN));
+  TopExp_Explorer exp(shape, TopAbs_SOLID);
+  if (!exp.More() || nbPoints <= 0) {
+    return;
+  }
+  const TopoDS_Shape& solid = exp.Current();
+  if (deflection > 0) {
+    BRepMesh_IncrementalMesh(solid, deflection);
+  }
+  BRepClass3d_BulkClassifier classifier(solid, tol);
+  classifier.SetRunParallel(Standard_True);
+  classifier.Perform(coords, nbPoints, reinterpret_cast<Standard_Byte*>(out.data()));
+}
+
+}
+}
+
+#endif // E0_IO_POINT_CLASSIFY_H
@@ -0,0 +1,734 @@
+#ifndef E0_IO_SPATIAL_INDEX_H
+#define E0_IO_SPATIAL_INDEX_H
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BVH_PrimitiveSet.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <BVH_Triangulation.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "blob.hpp"
+#include "commonIO.hpp"
+
+namespace e0 {
+namespace io {
+
+static const int SPATIAL_INDEX_FACE = 0;
+static const int SPATIAL_INDEX_EDGE = 1;
+static const int SPATIAL_INDEX_VERTEX = 2;
+
+typedef BVH_Box<Standard_Real, 3> SpatialBox;
+typedef BVH_Tree<Standard_Real, 3> SpatialTree;
+typedef BVH_Triangulation<Standard_Real, 3> SpatialTriangles;
+
+// Triangles of the face with their own tree, so that the face is rebuilt alone when it changes.
+struct IndexedFace {
+  TopoDS_Face face;
+  std::uintptr_t ref;
+  Handle(Poly_Triangulation) mesh; // the triangulation the tree is built on
+  Handle(SpatialTriangles) triangles;
+  Handle(SpatialTree) tree;
+  SpatialBox box;
+};
+
+// Polyline of the edge: the 3D polygon, the polygon on the triangulation of the face or the sampled curve.
+struct IndexedEdge {
+  TopoDS_Edge edge;
+  std::uintptr_t ref;
+  Handle(Standard_Transient) polygon; // the polygon the polyline is taken from, null for the sampled curve
+  std::vector<BVH_Vec3d> points;
+  SpatialBox box;
+};
+
+struct IndexedVertex {
+  TopoDS_Vertex vertex;
+  std::uintptr_t ref;
+  BVH_Vec3d point;
+  SpatialBox box;
+};
+
+// Top level set of the sub-shapes of one kind, the tree is built over their boxes.
+template<class Item>
+class SpatialItemSet : public BVH_PrimitiveSet<Standard_Real, 3> {
+public:
+  using BVH_PrimitiveSet<Standard_Real, 3>::Box;
+
+  std::vector<Item> items;
+
+  virtual Standard_Integer Size() const Standard_OVERRIDE {
+    return (Standard_Integer) items.size();
+  }
+
+  virtual SpatialBox Box(const Standard_Integer index) const Standard_OVERRIDE {
+    return items[index].box;
+  }
+
+  virtual Standard_Real Center(const Standard_Integer index, const Standard_Integer axis) const Standard_OVERRIDE {
+    const SpatialBox& box = items[index].box;
+    return 0.5 * (box.CornerMin()[axis] + box.CornerMax()[axis]);
+  }
+
+  virtual void Swap(const Standard_Integer index1, const Standard_Integer index2) Standard_OVERRIDE {
+    std::swap(items[index1], items[index2]);
+  }
+};
+
+typedef SpatialItemSet<IndexedFace> SpatialFaceSet;
+typedef SpatialItemSet<IndexedEdge> SpatialEdgeSet;
+typedef SpatialItemSet<IndexedVertex> SpatialVertexSet;
+
+inline BVH_Vec3d toVec(const gp_Pnt& p) {
+  return BVH_Vec3d(p.X(), p.Y(), p.Z());
+}
+
+inline void triangleNodes(const SpatialTriangles& set, int index, BVH_Vec3d nodes[3]) {
+  const BVH_Vec4i& tri = set.Elements[index];
+  nodes[0] = set.Vertices[tri.x()];
+  nodes[1] = set.Vertices[tri.y()];
+  nodes[2] = set.Vertices[tri.z()];
+}
+
+// Slab test of the ray and the box, gives the parameter of the entry point (negative if the origin is inside).
+inline bool rayBoxHit(const BVH_Vec3d& origin, const BVH_Vec3d& dir, const BVH_Vec3d& min, const BVH_Vec3d& max,
+                      double& tEnter) {
+  double tLeave;
+  return BVH_Tools<Standard_Real, 3>::RayBoxIntersection(origin, dir, min, max, tEnter, tLeave);
+}
+
+// Projection of the point on the segment.
+BVH_Vec3d segmentProjection(const BVH_Vec3d& p, const BVH_Vec3d& a, const BVH_Vec3d& b) {
+  const BVH_Vec3d ab = b - a;
+  const double len2 = ab.Dot(ab);
+  if (len2 < RealSmall()) {
+    return a;
+  }
+  const double t = Max(0.0, Min(1.0, (p - a).Dot(ab) / len2));
+  return a + ab * t;
+}
+
+bool isBoxOut(const BVH_Vec3d& min1, const BVH_Vec3d& max1, const BVH_Vec3d& min2, const BVH_Vec3d& max2) {
+  for (int i = 0; i < 3; ++i) {
+    if (min1[i] > max2[i] || min2[i] > max1[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Clipping of the segment by the slabs of the box.
+bool segmentBoxOverlap(const BVH_Vec3d& a, const BVH_Vec3d& b, const BVH_Vec3d& min, const BVH_Vec3d& max) {
+  double t0 = 0, t1 = 1;
+  for (int i = 0; i < 3; ++i) {
+    const double d = b[i] - a[i];
+    if (Abs(d) < RealSmall()) {
+      if (a[i] < min[i] || a[i] > max[i]) {
+        return false;
+      }
+      continue;
+    }
+    double tA = (min[i] - a[i]) / d;
+    double tB = (max[i] - a[i]) / d;
+    if (tA > tB) {
+      std::swap(tA, tB);
+    }
+    t0 = Max(t0, tA);
+    t1 = Min(t1, tB);
+    if (t0 > t1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Separating axis test of the triangle and the box: the axes of the box,
+// the normal of the triangle and the cross products of the edges and the axes.
+bool triangleBoxOverlap(const BVH_Vec3d nodes[3], const BVH_Vec3d& min, const BVH_Vec3d& max) {
+  const BVH_Vec3d center = (min + max) * 0.5;
+  const BVH_Vec3d half = (max - min) * 0.5;
+  const BVH_Vec3d v[3] = { nodes[0] - center, nodes[1] - center, nodes[2] - center };
+  const BVH_Vec3d edges[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+  BVH_Vec3d axes[13] = {
+    BVH_Vec3d(1, 0, 0), BVH_Vec3d(0, 1, 0), BVH_Vec3d(0, 0, 1),
+    BVH_Vec3d::Cross(edges[0], edges[1])
+  };
+  int nbAxes = 4;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      axes[nbAxes++] = BVH_Vec3d::Cross(edges[i], axes[j]);
+    }
+  }
+  for (int i = 0; i < nbAxes; ++i) {
+    const BVH_Vec3d& axis = axes[i];
+    const double r = half.x() * Abs(axis.x()) + half.y() * Abs(axis.y()) + half.z() * Abs(axis.z());
+    const double p0 = v[0].Dot(axis), p1 = v[1].Dot(axis), p2 = v[2].Dot(axis);
+    if (Min(p0, Min(p1, p2)) > r || Max(p0, Max(p1, p2)) < -r) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Closest intersection of the ray with the triangles of the face.
+class TrianglePicker : public BVH_Traverse<Standard_Real, 3, SpatialTriangles, Standard_Real> {
+public:
+  TrianglePicker(const SpatialTriangles& set, const BVH_Vec3d& origin, const BVH_Vec3d& dir, double& best)
+      : set(set), origin(origin), dir(dir), best(best) {}
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& min, const BVH_Vec3d& max,
+                                      Standard_Real& metric) const Standard_OVERRIDE {
+    return !rayBoxHit(origin, dir, min, max, metric) || metric > best;
+  }
+
+  virtual Standard_Boolean IsMetricBetter(const Standard_Real& m1, const Standard_Real& m2) const Standard_OVERRIDE {
+    return m1 < m2;
+  }
+
+  virtual Standard_Boolean RejectMetric(const Standard_Real& metric) const Standard_OVERRIDE {
+    return metric > best;
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer index, const Standard_Real&) Standard_OVERRIDE {
+    BVH_Vec3d nodes[3];
+    triangleNodes(set, index, nodes);
+    double t;
+    if (BVH_Tools<Standard_Real, 3>::RayTriangleIntersection(origin, dir, nodes[0], nodes[1], nodes[2], t) && t < best) {
+      best = t;
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+  const SpatialTriangles& set;
+  BVH_Vec3d origin;
+  BVH_Vec3d dir;
+  double& best;
+};
+
+// Closest face hit by the ray, the faces are visited from front to back.
+class FacePicker : public BVH_Traverse<Standard_Real, 3, SpatialFaceSet, Standard_Real> {
+public:
+  FacePicker(const SpatialFaceSet& set, const BVH_Vec3d& origin, const BVH_Vec3d& dir)
+      : set(set), origin(origin), dir(dir), best(RealLast()), found(-1) {}
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& min, const BVH_Vec3d& max,
+                                      Standard_Real& metric) const Standard_OVERRIDE {
+    return !rayBoxHit(origin, dir, min, max, metric) || metric > best;
+  }
+
+  virtual Standard_Boolean IsMetricBetter(const Standard_Real& m1, const Standard_Real& m2) const Standard_OVERRIDE {
+    return m1 < m2;
+  }
+
+  virtual Standard_Boolean RejectMetric(const Standard_Real& metric) const Standard_OVERRIDE {
+    return metric > best;
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer index, const Standard_Real&) Standard_OVERRIDE {
+    const IndexedFace& face = set.items[index];
+    TrianglePicker picker(*face.triangles, origin, dir, best);
+    if (picker.Select(face.tree) > 0) {
+      found = index;
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+  int getFound() const {
+    return found;
+  }
+
+  double getDistance() const {
+    return best;
+  }
+
+private:
+  const SpatialFaceSet& set;
+  BVH_Vec3d origin;
+  BVH_Vec3d dir;
+  double best;
+  int found;
+};
+
+// Nearest vertex or edge point within the radius, the items are visited from near to far.
+template<class Item>
+class NearestSelector : public BVH_Traverse<Standard_Real, 3, SpatialItemSet<Item>, Standard_Real> {
+public:
+  NearestSelector(const SpatialItemSet<Item>& set, const BVH_Vec3d& point, double radius)
+      : set(set), point(point), best(radius * radius), found(-1) {}
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& min, const BVH_Vec3d& max,
+                                      Standard_Real& metric) const Standard_OVERRIDE {
+    metric = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance(point, min, max);
+    return metric > best;
+  }
+
+  virtual Standard_Boolean IsMetricBetter(const Standard_Real& m1, const Standard_Real& m2) const Standard_OVERRIDE {
+    return m1 < m2;
+  }
+
+  virtual Standard_Boolean RejectMetric(const Standard_Real& metric) const Standard_OVERRIDE {
+    return metric > best;
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer index, const Standard_Real&) Standard_OVERRIDE {
+    BVH_Vec3d nearest;
+    const double dist = nearestPoint(set.items[index], nearest);
+    if (dist > best) {
+      return Standard_False;
+    }
+    best = dist;
+    found = index;
+    foundPoint = nearest;
+    return Standard_True;
+  }
+
+  int getFound() const {
+    return found;
+  }
+
+  double getDistance() const {
+    return sqrt(best);
+  }
+
+  const BVH_Vec3d& getPoint() const {
+    return foundPoint;
+  }
+
+private:
+  double nearestPoint(const IndexedVertex& vertex, BVH_Vec3d& nearest) const {
+    nearest = vertex.point;
+    return (nearest - point).SquareModulus();
+  }
+
+  double nearestPoint(const IndexedEdge& edge, BVH_Vec3d& nearest) const {
+    double dist = RealLast();
+    for (size_t i = 0; i + 1 < edge.points.size(); ++i) {
+      const BVH_Vec3d proj = segmentProjection(point, edge.points[i], edge.points[i + 1]);
+      const double d = (proj - point).SquareModulus();
+      if (d < dist) {
+        dist = d;
+        nearest = proj;
+      }
+    }
+    return dist;
+  }
+
+private:
+  const SpatialItemSet<Item>& set;
+  BVH_Vec3d point;
+  double best;
+  int found;
+  BVH_Vec3d foundPoint;
+};
+
+// Checks if any triangle of the face overlaps the box.
+class TriangleBoxSelector : public BVH_Traverse<Standard_Real, 3, SpatialTriangles> {
+public:
+  TriangleBoxSelector(const SpatialTriangles& set, const BVH_Vec3d& min, const BVH_Vec3d& max)
+      : set(set), min(min), max(max), found(false) {}
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& nodeMin, const BVH_Vec3d& nodeMax,
+                                      Standard_Real&) const Standard_OVERRIDE {
+    return isBoxOut(nodeMin, nodeMax, min, max);
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer index, const Standard_Real&) Standard_OVERRIDE {
+    BVH_Vec3d nodes[3];
+    triangleNodes(set, index, nodes);
+    found = triangleBoxOverlap(nodes, min, max);
+    return found;
+  }
+
+  virtual Standard_Boolean Stop() const Standard_OVERRIDE {
+    return found;
+  }
+
+private:
+  const SpatialTriangles& set;
+  BVH_Vec3d min;
+  BVH_Vec3d max;
+  bool found;
+};
+
+// Collects the references of the sub-shapes overlapping the box.
+template<class Item>
+class BoxSelector : public BVH_Traverse<Standard_Real, 3, SpatialItemSet<Item>> {
+public:
+  BoxSelector(const SpatialItemSet<Item>& set, const BVH_Vec3d& min, const BVH_Vec3d& max,
+              std::vector<std::uintptr_t>& refs)
+      : set(set), min(min), max(max), refs(refs) {}
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& nodeMin, const BVH_Vec3d& nodeMax,
+                                      Standard_Real&) const Standard_OVERRIDE {
+    return isBoxOut(nodeMin, nodeMax, min, max);
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer index, const Standard_Real&) Standard_OVERRIDE {
+    const Item& item = set.items[index];
+    if (!overlaps(item)) {
+      return Standard_False;
+    }
+    refs.push_back(item.ref);
+    return Standard_True;
+  }
+
+private:
+  bool overlaps(const IndexedFace& face) const {
+    TriangleBoxSelector selector(*face.triangles, min, max);
+    return selector.Select(face.tree) > 0;
+  }
+
+  bool overlaps(const IndexedEdge& edge) const {
+    for (size_t i = 0; i + 1 < edge.points.size(); ++i) {
+      if (segmentBoxOverlap(edge.points[i], edge.points[i + 1], min, max)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool overlaps(const IndexedVertex& vertex) const {
+    return !isBoxOut(vertex.point, vertex.point, min, max);
+  }
+
+private:
+  const SpatialItemSet<Item>& set;
+  BVH_Vec3d min;
+  BVH_Vec3d max;
+  std::vector<std::uintptr_t>& refs;
+};
+
+// Spatial index over the faces, edges and vertices of the shape for picking, snapping and box selection.
+// The faces are indexed by their triangles, the edges by their polylines; the results refer to
+// the sub-shapes by the stable references reported by the interrogation.
+// The index is built once and updated for the changed sub-shapes only: the faces and edges keep
+// their trees while their TShapes, locations and meshes stay the same, only the top level trees
+// over the boxes of the sub-shapes are rebuilt.
+class SpatialIndex {
+public:
+
+  struct Hit {
+    int kind;
+    std::uintptr_t ref;
+    double distance;
+    gp_Pnt point;
+  };
+
+  // The faces without triangulation are meshed with the given deflection if it is positive,
+  // otherwise they are not indexed.
+  explicit SpatialIndex(double deflection = 0)
+      : deflection(deflection), faces(new SpatialFaceSet()), edges(new SpatialEdgeSet()),
+        vertices(new SpatialVertexSet()) {}
+
+  // Indexes the sub-shapes of the shape reusing the unchanged ones.
+  // Returns the number of the faces and edges (re)built.
+  int update(const TopoDS_Shape& shape) {
+    if (deflection > 0) {
+      meshNewFaces(shape);
+    }
+    int nbBuilt = updateFaces(shape) + updateEdges(shape);
+    updateVertices(shape);
+    faceTree = faces->BVH();
+    edgeTree = edges->BVH();
+    vertexTree = vertices->BVH();
+    return nbBuilt;
+  }
+
+  // Closest face hit by the ray.
+  bool pick(const gp_Pnt& origin, const gp_Dir& dir, Hit& hit) const {
+    FacePicker picker(*faces, toVec(origin), BVH_Vec3d(dir.X(), dir.Y(), dir.Z()));
+    picker.Select(faceTree);
+    if (picker.getFound() < 0) {
+      return false;
+    }
+    hit.kind = SPATIAL_INDEX_FACE;
+    hit.ref = faces->items[picker.getFound()].ref;
+    hit.distance = picker.getDistance();
+    hit.point = origin.Translated(gp_Vec(dir) * hit.distance);
+    return true;
+  }
+
+  // Nearest vertex within the radius, or the nearest point of the edges if there are no vertices around.
+  bool snap(const gp_Pnt& point, double radius, Hit& hit) const {
+    NearestSelector<IndexedVertex> vertexSelector(*vertices, toVec(point), radius);
+    vertexSelector.Select(vertexTree);
+    if (vertexSelector.getFound() >= 0) {
+      fillHit(SPATIAL_INDEX_VERTEX, vertices->items[vertexSelector.getFound()].ref, vertexSelector, hit);
+      return true;
+    }
+    NearestSelector<IndexedEdge> edgeSelector(*edges, toVec(point), radius);
+    edgeSelector.Select(edgeTree);
+    if (edgeSelector.getFound() >= 0) {
+      fillHit(SPATIAL_INDEX_EDGE, edges->items[edgeSelector.getFound()].ref, edgeSelector, hit);
+      return true;
+    }
+    return false;
+  }
+
+  // Sub-shapes overlapping the box.
+  void boxQuery(const gp_Pnt& min, const gp_Pnt& max, std::vector<std::uintptr_t>& faceRefs,
+                std::vector<std::uintptr_t>& edgeRefs, std::vector<std::uintptr_t>& vertexRefs) const {
+    BoxSelector<IndexedFace>(*faces, toVec(min), toVec(max), faceRefs).Select(faceTree);
+    BoxSelector<IndexedEdge>(*edges, toVec(min), toVec(max), edgeRefs).Select(edgeTree);
+    BoxSelector<IndexedVertex>(*vertices, toVec(min), toVec(max), vertexRefs).Select(vertexTree);
+  }
+
+  int nbFaces() const {
+    return faces->Size();
+  }
+
+  int nbEdges() const {
+    return edges->Size();
+  }
+
+  int nbVertices() const {
+    return vertices->Size();
+  }
+
+private:
+
+  typedef NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> IndexMap;
+
+  template<class Selector>
+  static void fillHit(int kind, std::uintptr_t ref, const Selector& selector, Hit& hit) {
+    hit.kind = kind;
+    hit.ref = ref;
+    hit.distance = selector.getDistance();
+    const BVH_Vec3d& p = selector.getPoint();
+    hit.point.SetCoord(p.x(), p.y(), p.z());
+  }
+
+  // Meshes only the faces without triangulation, the check of the existing meshes
+  // by BRepMesh takes longer than the indexing of the whole shape.
+  void meshNewFaces(const TopoDS_Shape& shape) const {
+    BRep_Builder builder;
+    TopoDS_Compound newFaces;
+    builder.MakeCompound(newFaces);
+    bool hasNewFaces = false;
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+      TopLoc_Location loc;
+      if (BRep_Tool::Triangulation(TopoDS::Face(exp.Current()), loc).IsNull()) {
+        builder.Add(newFaces, exp.Current());
+        hasNewFaces = true;
+      }
+    }
+    if (hasNewFaces) {
+      BRepMesh_IncrementalMesh(newFaces, deflection);
+    }
+  }
+
+  int updateFaces(const TopoDS_Shape& shape) {
+    IndexMap oldIndices;
+    for (size_t i = 0; i < faces->items.size(); ++i) {
+      oldIndices.Bind(faces->items[i].face, (int) i);
+    }
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    std::vector<IndexedFace> items;
+    items.reserve(faceMap.Extent());
+    int nbBuilt = 0;
+    for (int i = 1; i <= faceMap.Extent(); ++i) {
+      const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+      TopLoc_Location loc;
+      const Handle(Poly_Triangulation)& mesh = BRep_Tool::Triangulation(face, loc);
+      if (mesh.IsNull() || mesh->NbTriangles() == 0) {
+        continue;
+      }
+      const int* oldIndex = oldIndices.Seek(face);
+      if (oldIndex != NULL && faces->items[*oldIndex].mesh == mesh) {
+        items.push_back(faces->items[*oldIndex]);
+        continue;
+      }
+      items.push_back(buildFace(face, mesh, loc));
+      ++nbBuilt;
+    }
+    faces->items.swap(items);
+    faces->MarkDirty();
+    return nbBuilt;
+  }
+
+  static IndexedFace buildFace(const TopoDS_Face& face, const Handle(Poly_Triangulation)& mesh,
+                               const TopLoc_Location& loc) {
+    IndexedFace item;
+    item.face = face;
+    item.ref = getStableRefernce(face);
+    item.mesh = mesh;
+    item.triangles = new SpatialTriangles();
+    const gp_Trsf& trsf = loc.Transformation();
+    item.triangles->Vertices.reserve(mesh->NbNodes());
+    for (int i = 1; i <= mesh->NbNodes(); ++i) {
+      item.triangles->Vertices.push_back(toVec(mesh->Node(i).Transformed(trsf)));
+    }
+    item.triangles->Elements.reserve(mesh->NbTriangles());
+    for (int i = 1; i <= mesh->NbTriangles(); ++i) {
+      Standard_Integer n1, n2, n3;
+      mesh->Triangle(i).Get(n1, n2, n3);
+      item.triangles->Elements.push_back(BVH_Vec4i(n1 - 1, n2 - 1, n3 - 1, i - 1));
+    }
+    item.triangles->MarkDirty();
+    item.tree = item.triangles->BVH();
+    item.box = item.triangles->Box();
+    return item;
+  }
+
+  int updateEdges(const TopoDS_Shape& shape) {
+    IndexMap oldIndices;
+    for (size_t i = 0; i < edges->items.size(); ++i) {
+      oldIndices.Bind(edges->items[i].edge, (int) i);
+    }
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    std::vector<IndexedEdge> items;
+    items.reserve(edgeMap.Extent());
+    int nbBuilt = 0;
+    for (int i = 1; i <= edgeMap.Extent(); ++i) {
+      const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
+      if (BRep_Tool::Degenerated(edge)) {
+        continue;
+      }
+      IndexedEdge item;
+      item.edge = edge;
+      item.ref = getStableRefernce(edge);
+      const int* oldIndex = oldIndices.Seek(edge);
+      const IndexedEdge* old = oldIndex != NULL ? &edges->items[*oldIndex] : NULL;
+      if (!buildEdge(item, old)) {
+        continue;
+      }
+      if (item.points.empty()) {
+        items.push_back(*old);
+        continue;
+      }
+      items.push_back(item);
+      ++nbBuilt;
+    }
+    edges->items.swap(items);
+    edges->MarkDirty();
+    return nbBuilt;
+  }
+
+  // Takes the polyline of the edge, leaving the points empty if the old item has the same polygon.
+  bool buildEdge(IndexedEdge& item, const IndexedEdge* old) const {
+    TopLoc_Location loc;
+    const Handle(Poly_Polygon3D)& polygon3d = BRep_Tool::Polygon3D(item.edge, loc);
+    Handle(Poly_PolygonOnTriangulation) polygonOnTr;
+    Handle(Poly_Triangulation) mesh;
+    if (polygon3d.IsNull()) {
+      BRep_Tool::PolygonOnTriangulation(item.edge, polygonOnTr, mesh, loc);
+    }
+    if (!polygon3d.IsNull()) {
+      item.polygon = polygon3d;
+    } else {
+      item.polygon = polygonOnTr;
+    }
+    if (old != NULL && old->polygon == item.polygon) {
+      return true;
+    }
+    const gp_Trsf& trsf = loc.Transformation();
+    if (!polygon3d.IsNull()) {
+      for (int i = 1; i <= polygon3d->NbNodes(); ++i) {
+        item.points.push_back(toVec(polygon3d->Nodes()(i).Transformed(trsf)));
+      }
+    } else if (!polygonOnTr.IsNull()) {
+      const TColStd_Array1OfInteger& nodes = polygonOnTr->Nodes();
+      for (int i = nodes.Lower(); i <= nodes.Upper(); ++i) {
+        item.points.push_back(toVec(mesh->Node(nodes(i)).Transformed(trsf)));
+      }
+    } else if (BRep_Tool::IsGeometric(item.edge)) {
+      // free edges (e.g. of the sketches) are not meshed with the faces
+      BRepAdaptor_Curve curve(item.edge);
+      GCPnts_TangentialDeflection sampler(curve, 0.1, deflection > 0 ? deflection : 0.1);
+      for (int i = 1; i <= sampler.NbPoints(); ++i) {
+        item.points.push_back(toVec(sampler.Value(i)));
+      }
+    }
+    if (item.points.size() < 2) {
+      return false;
+    }
+    item.box.Clear();
+    for (size_t i = 0; i < item.points.size(); ++i) {
+      item.box.Add(item.points[i]);
+    }
+    return true;
+  }
+
+  void updateVertices(const TopoDS_Shape& shape) {
+    TopTools_IndexedMapOfShape vertexMap;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+    std::vector<IndexedVertex> items(vertexMap.Extent());
+    for (int i = 1; i <= vertexMap.Extent(); ++i) {
+      IndexedVertex& item = items[i - 1];
+      item.vertex = TopoDS::Vertex(vertexMap(i));
+      item.ref = getStableRefernce(item.vertex);
+      item.point = toVec(BRep_Tool::Pnt(item.vertex));
+      item.box = SpatialBox(item.point, item.point);
+    }
+    vertices->items.swap(items);
+    vertices->MarkDirty();
+  }
+
+private:
+  double deflection;
+  Handle(SpatialFaceSet) faces;
+  Handle(SpatialEdgeSet) edges;
+  Handle(SpatialVertexSet) vertices;
+  Handle(SpatialTree) faceTree;
+  Handle(SpatialTree) edgeTree;
+  Handle(SpatialTree) vertexTree;
+};
+
+// Writes the hit as float64: kind, ref, distance, x, y, z (empty if nothing is found).
+void writeSpatialHit(bool found, const SpatialIndex::Hit& hit, Blob& out) {
+  out.clear();
+  if (!found) {
+    return;
+  }
+  blobAppend(out, double(hit.kind));
+  blobAppend(out, double(hit.ref));
+  blobAppend(out, hit.distance);
+  blobAppend(out, hit.point.X());
+  blobAppend(out, hit.point.Y());
+  blobAppend(out, hit.point.Z());
+}
+
+// Writes the refs as float64: nbFaces, nbEdges, nbVertices, face refs, edge refs, vertex refs.
+void writeSpatialRefs(const std::vector<std::uintptr_t>& faceRefs, const std::vector<std::uintptr_t>& edgeRefs,
+                      const std::vector<std::uintptr_t>& vertexRefs, Blob& out) {
+  out.clear();
+  out.reserve(8 * (3 + faceRefs.size() + edgeRefs.size() + vertexRefs.size()));
+  blobAppend(out, double(faceRefs.size()));
+  blobAppend(out, double(edgeRefs.size()));
+  blobAppend(out, double(vertexRefs.size()));
+  for (const std::vector<std::uintptr_t>* refs : { &faceRefs, &edgeRefs, &vertexRefs }) {
+    for (std::uintptr_t ref : *refs) {
+      blobAppend(out, double(ref));
+    }
+  }
+}
+
+}
+}
+
+#endif // E0_IO_SPATIAL_INDEX_H